@@ -9,16 +9,24 @@
 #define __VRV_ATT_H__
 
 #include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
 #include "attconverter.h"
+#include "pugixml.hpp"
 #include "vrvdef.h"
 
 namespace vrv {
 
 class Object;
 
+/**
+ * The attributes of an element read by the Read methods of the att classes.
+ * They are tracked instead of being removed from the element (see MeiInput::ReadUnsupportedAttr).
+ */
+typedef std::vector<pugi::xml_attribute> ArrayOfConsumedAttrs;
+
 //----------------------------------------------------------------------------
 // Att
 //----------------------------------------------------------------------------
@@ -101,10 +109,16 @@ public:
     std::string WcharTToStr(wchar_t data) const;
     ///@}
 
-    /** @name Basic converters for reading */
+    /**
+     * @name Basic converters for reading
+     * Most converters for reading take a const char * for the value of the pugi attribute not to be copied.
+     * The std::string versions are kept for the callers having one.
+     */
     ///@{
-    double StrToDbl(std::string value) const;
-    int StrToInt(std::string value) const;
+    double StrToDbl(const char *value) const;
+    double StrToDbl(const std::string &value) const { return StrToDbl(value.c_str()); }
+    int StrToInt(const char *value) const;
+    int StrToInt(const std::string &value) const { return StrToInt(value.c_str()); }
     wchar_t StrToWcharT(std::string value) const;
     ///@}
 
@@ -114,61 +128,79 @@ public:
     data_ARTICULATION_List StrToArticulationList(std::string value) const;
 
     std::string BeatrptRendToStr(data_BEATRPT_REND data) const;
-    data_BEATRPT_REND StrToBeatrptRend(std::string value) const;
+    data_BEATRPT_REND StrToBeatrptRend(const char *value) const;
+    data_BEATRPT_REND StrToBeatrptRend(const std::string &value) const { return StrToBeatrptRend(value.c_str()); }
 
     std::string DurationToStr(data_DURATION data) const;
-    data_DURATION StrToDuration(std::string value) const;
+    data_DURATION StrToDuration(const char *value) const;
+    data_DURATION StrToDuration(const std::string &value) const { return StrToDuration(value.c_str()); }
 
     std::string PPQToStr(double data) const;
-    double StrToPPQ(std::string value) const;
+    double StrToPPQ(const char *value) const;
+    double StrToPPQ(const std::string &value) const { return StrToPPQ(value.c_str()); }
 
     std::string KeysignatureToStr(data_KEYSIGNATURE data) const;
-    data_KEYSIGNATURE StrToKeysignature(std::string value) const;
+    data_KEYSIGNATURE StrToKeysignature(const char *value) const;
+    data_KEYSIGNATURE StrToKeysignature(const std::string &value) const { return StrToKeysignature(value.c_str()); }
 
     std::string MeasurebeatToStr(data_MEASUREBEAT data) const;
     data_MEASUREBEAT StrToMeasurebeat(std::string value) const;
 
     std::string ModusmaiorToStr(data_MODUSMAIOR data) const;
-    data_MODUSMAIOR StrToModusmaior(std::string value) const;
+    data_MODUSMAIOR StrToModusmaior(const char *value) const;
+    data_MODUSMAIOR StrToModusmaior(const std::string &value) const { return StrToModusmaior(value.c_str()); }
 
     std::string ModusminorToStr(data_MODUSMINOR data) const;
-    data_MODUSMINOR StrToModusminor(std::string value) const;
+    data_MODUSMINOR StrToModusminor(const char *value) const;
+    data_MODUSMINOR StrToModusminor(const std::string &value) const { return StrToModusminor(value.c_str()); }
 
     std::string MidibpmToStr(data_MIDIBPM data) const { return IntToStr(data); }
-    data_MIDIBPM StrToMidibpm(std::string value) const { return StrToInt(value); }
+    data_MIDIBPM StrToMidibpm(const char *value) const { return StrToInt(value); }
+    data_MIDIBPM StrToMidibpm(const std::string &value) const { return StrToMidibpm(value.c_str()); }
 
     std::string MidichannelToStr(data_MIDICHANNEL data) const { return IntToStr(data); }
-    data_MIDICHANNEL StrToMidichannel(std::string value) const { return StrToInt(value); }
+    data_MIDICHANNEL StrToMidichannel(const char *value) const { return StrToInt(value); }
+    data_MIDICHANNEL StrToMidichannel(const std::string &value) const { return StrToMidichannel(value.c_str()); }
 
     std::string MidimspbToStr(data_MIDIMSPB data) const { return IntToStr(data); }
-    data_MIDIMSPB StrToMidimspb(std::string value) const { return StrToInt(value); }
+    data_MIDIMSPB StrToMidimspb(const char *value) const { return StrToInt(value); }
+    data_MIDIMSPB StrToMidimspb(const std::string &value) const { return StrToMidimspb(value.c_str()); }
 
     std::string MidivalueToStr(data_MIDIVALUE data) const { return IntToStr(data); }
-    data_MIDIVALUE StrToMidivalue(std::string value) const { return StrToInt(value); }
+    data_MIDIVALUE StrToMidivalue(const char *value) const { return StrToInt(value); }
+    data_MIDIVALUE StrToMidivalue(const std::string &value) const { return StrToMidivalue(value.c_str()); }
 
     std::string OctaveDisToStr(data_OCTAVE_DIS data) const;
-    data_OCTAVE_DIS StrToOctaveDis(std::string value) const;
+    data_OCTAVE_DIS StrToOctaveDis(const char *value) const;
+    data_OCTAVE_DIS StrToOctaveDis(const std::string &value) const { return StrToOctaveDis(value.c_str()); }
 
     std::string OrientationToStr(data_ORIENTATION data) const;
-    data_ORIENTATION StrToOrientation(std::string value) const;
+    data_ORIENTATION StrToOrientation(const char *value) const;
+    data_ORIENTATION StrToOrientation(const std::string &value) const { return StrToOrientation(value.c_str()); }
 
     std::string PercentToStr(data_PERCENT data) const;
-    data_PERCENT StrToPercent(std::string value) const;
+    data_PERCENT StrToPercent(const char *value) const;
+    data_PERCENT StrToPercent(const std::string &value) const { return StrToPercent(value.c_str()); }
 
     std::string PitchnameToStr(data_PITCHNAME data) const;
-    data_PITCHNAME StrToPitchname(std::string value) const;
+    data_PITCHNAME StrToPitchname(const char *value) const;
+    data_PITCHNAME StrToPitchname(const std::string &value) const { return StrToPitchname(value.c_str()); }
 
     std::string ProlatioToStr(data_PROLATIO data) const;
-    data_PROLATIO StrToProlatio(std::string value) const;
+    data_PROLATIO StrToProlatio(const char *value) const;
+    data_PROLATIO StrToProlatio(const std::string &value) const { return StrToProlatio(value.c_str()); }
 
     std::string StemdirectionToStr(data_STEMDIRECTION data) const;
-    data_STEMDIRECTION StrToStemdirection(std::string value) const;
+    data_STEMDIRECTION StrToStemdirection(const char *value) const;
+    data_STEMDIRECTION StrToStemdirection(const std::string &value) const { return StrToStemdirection(value.c_str()); }
 
     std::string TempusToStr(data_TEMPUS data) const;
-    data_TEMPUS StrToTempus(std::string value) const;
+    data_TEMPUS StrToTempus(const char *value) const;
+    data_TEMPUS StrToTempus(const std::string &value) const { return StrToTempus(value.c_str()); }
 
     std::string TieToStr(data_TIE data) const;
-    data_TIE StrToTie(std::string value) const;
+    data_TIE StrToTie(const char *value) const;
+    data_TIE StrToTie(const std::string &value) const { return StrToTie(value.c_str()); }
 
     std::string XsdPositiveIntegerListToStr(xsdPositiveInteger_List data) const;
     xsdPositiveInteger_List StrToXsdPositiveIntegerList(std::string value) const;
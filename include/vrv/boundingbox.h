@@ -8,6 +8,13 @@
 #ifndef __VRV_BOUNDING_BOX_H__
 #define __VRV_BOUNDING_BOX_H__
 
+#include <cstddef>
+
+#ifdef OBJECT_ARENA
+#include <atomic>
+#include <vector>
+#endif
+
 //----------------------------------------------------------------------------
 
 #include "vrvdef.h"
@@ -17,6 +24,77 @@ namespace vrv {
 class Doc;
 class Glyph;
 
+#ifdef OBJECT_ARENA
+
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+/**
+ * This class is an arena from which the objects of a document are carved out of large chunks.
+ * The objects created by a thread are taken from the arena of a document while an ObjectArena::Scope is active.
+ * Deleting an object still calls its destructor but does not release its memory. The chunks are released in bulk
+ * when the document is reset, or when the last of its objects still alive at that point is deleted.
+ */
+class ObjectArena {
+public:
+    /**
+     * @name Create the arena of a document and release it when the document is deleted.
+     */
+    ///@{
+    static ObjectArena *Create() { return new ObjectArena(); }
+    static void Release(ObjectArena *arena) { arena->Unref(); }
+    ///@}
+
+    /**
+     * Reset the arena of a document.
+     * The chunks are reused if no object is alive. Otherwise the arena is replaced and released with its last object.
+     */
+    static void Reset(ObjectArena **arena);
+
+    /**
+     * @name Allocate and release a block in the arena selected for the thread (or with the global allocator).
+     */
+    ///@{
+    static void *Allocate(size_t size);
+    static void Free(void *ptr);
+    ///@}
+
+    /**
+     * The scope in which the objects created by the thread are taken from the arena of a document.
+     * The arena is given by the address where the document keeps it since it can be replaced by ObjectArena::Reset.
+     */
+    class Scope {
+    public:
+        Scope(ObjectArena **arena);
+        ~Scope();
+
+    private:
+        ObjectArena **m_previousArena;
+    };
+
+private:
+    ObjectArena();
+    ~ObjectArena();
+
+    void Unref();
+
+private:
+    /** The chunks and the current position in them */
+    std::vector<char *> m_chunks;
+    int m_currentChunk;
+    char *m_current;
+    char *m_end;
+
+    /** The number of objects alive plus one for the document */
+    std::atomic<int> m_count;
+
+    /** The address of the arena selected for the thread */
+    static thread_local ObjectArena **s_currentArena;
+};
+
+#endif
+
 //----------------------------------------------------------------------------
 // BoundingBox
 //----------------------------------------------------------------------------
@@ -38,6 +116,18 @@ public:
     bool Is(const std::vector<ClassId> &classIds) const;
     ///@}
 
+#ifdef OBJECT_ARENA
+    /**
+     * @name Class-specific allocation functions.
+     * All the objects of the tree, the alignments and the positioners are allocated from the arena of a document
+     * when one is selected for the thread (see ObjectArena).
+     */
+    ///@{
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr);
+    ///@}
+#endif
+
     /**
      * @name Methods for updating the bounding boxes and for providing information about their status.
      */
@@ -255,11 +345,6 @@ private:
      * The font size for the smufl glyph used for calculating the bounding box rectangles.
      */
     int m_smuflGlyphFontSize;
-
-    /**
-     * Buffer for De-Casteljau algorithm
-     */
-    static int s_deCasteljau[4][4];
 };
 
 } // namespace vrv
@@ -168,6 +168,14 @@ public:
      * Positions of dots in the chord to avoid overlapping
      */
     std::list<int> m_dots;
+
+    /**
+     * The time the chord is played, filled by the MIDI export
+     */
+    ///@{
+    double m_playingOnset;
+    double m_playingOffset;
+    ///@}
 };
 
 } // namespace vrv
@@ -205,6 +205,14 @@ public:
 private:
     void AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend);
 
+    /**
+     * @name Prepare the extend for measuring a text and set the measured text extend into the one requested
+     */
+    ///@{
+    void InitTextExtend(TextExtend *extend);
+    void MergeTextExtend(const TextExtend &textExtend, TextExtend *extend);
+    ///@}
+
 public:
     //
 protected:
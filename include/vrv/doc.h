@@ -8,9 +8,15 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <atomic>
+#include <mutex>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
 #include "scoredef.h"
 #include "style.h"
+#include "vrv.h"
 
 class MidiFile;
 
@@ -18,6 +24,7 @@ namespace vrv {
 
 class FontInfo;
 class Glyph;
+class Note;
 class Page;
 class Score;
 
@@ -91,6 +98,13 @@ public:
 
     bool GetMidiExportDone() const;
 
+#ifdef OBJECT_ARENA
+    /**
+     * Return the address where the arena of the document is kept, for selecting it with an ObjectArena::Scope.
+     */
+    ObjectArena **GetObjectArena() { return &m_objectArena; }
+#endif
+
     /**
      * @name Get the height or width for a glyph taking into account the staff and grace sizes
      */
@@ -136,6 +150,11 @@ public:
     FontInfo *GetDrawingLyricFont(int staffSize);
     ///@}
 
+    /**
+     * Get the lyric font size for a staff size without changing the drawing lyric font
+     */
+    int GetDrawingLyricFontSize(int staffSize) const { return m_drawingLyricFontSize * staffSize / 100; }
+
     /**
      * @name Setters for the page dimensions and margins
      */
@@ -211,12 +230,40 @@ public:
     double GetSpacingNonLinear() const { return m_drawingSpacingNonLinear; }
     ///@}
 
+    /*
+     * @name Setter and getter for the number of threads used for adjusting the measures and the systems.
+     * The layout is sequential with 1 (default) and uses the number of hardware threads with 0.
+     * The getter returns the actual number of threads.
+     */
+    ///@{
+    void SetLayoutThreads(int layoutThreads) { m_layoutThreads = layoutThreads; }
+    int GetLayoutThreads() const;
+    ///@}
+
+    /**
+     * @name Start and end the processing of objects of the document in several threads (e.g., pages or systems).
+     * The objects are first marked as modified by the calling thread, so that the modifications of their content
+     * in the threads only read the modification flag of their common ancestors (see Object::Modify).
+     * In the meantime, the uuid index is accessed under a lock. Calls can be nested from the threads.
+     */
+    ///@{
+    void StartProcessingInThreads(const ArrayOfObjects &objects);
+    void EndProcessingInThreads();
+    bool IsProcessingInThreads() const { return (m_processingInThreads > 0); }
+    ///@}
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layer and fill the midi file content.
      */
     void ExportMIDI(MidiFile *midiFile);
 
+    /**
+     * Fill the array with the notes, rests and chords being played at a given time (in MIDI ticks) in the document
+     * order. This uses the index of the playing times filled by ExportMIDI, which needs to be called before.
+     */
+    void FindElementsPlayingAt(double time, ArrayOfObjects *elements) const;
+
     /**
      * Set the initial scoreDef of each page.
      * This is necessary for integrating changes that occur within a page.
@@ -235,8 +282,17 @@ public:
     /**
      * Casts off the entire document.
      * Starting from a single system, create and fill pages and systems.
+     * With reuseLayout, the measure widths stored by the previous cast off are used instead of laying out
+     * the content horizontally again. This is possible only when neither the content, the font, the drawing unit,
+     * the lyric size nor the spacing options have changed since then, otherwise the document is cast off normally.
+     */
+    void CastOffDoc(bool reuseLayout = false);
+
+    /**
+     * Invalidate the layout stored by CastOffDoc for being re-used.
+     * Needs to be called after any editing of the content.
      */
-    void CastOffDoc();
+    void ResetCastOffLayout() { m_castOffLayoutIsValid = false; }
 
     /**
      * Undo the cast off of the entire document.
@@ -257,6 +313,13 @@ public:
      */
     void ConvertToPageBasedDoc();
 
+    /**
+     * Replace the content of the doc with the one of a page-based doc.
+     * The pages and the content of the scoreDef are moved and the header copied.
+     * The doc passed as parameter has no page anymore.
+     */
+    void MoveContentFrom(Doc *doc);
+
     /**
      * To be implemented.
      */
@@ -269,13 +332,24 @@ public:
      */
     Page *SetDrawingPage(int pageIdx);
 
+    /**
+     * Set the drawing values once for all the pages so they can be laid out and drawn concurrently.
+     * This is possible only if none of the pages has its own size, since the values are then the same for all pages.
+     * Returns false otherwise. Until Doc::ResetDrawingPage is called, SetDrawingPage only returns the page.
+     */
+    bool SetDrawingPages();
+
     /**
      * Reset drawing page to NULL.
      * This might be necessary if we have replaced a page in the document.
      * We need to call this because otherwise looking at the page idx will fail.
      * See Doc::LayOut for an example.
      */
-    void ResetDrawingPage() { m_drawingPage = NULL; }
+    void ResetDrawingPage()
+    {
+        m_drawingPage = NULL;
+        m_drawingAllPages = false;
+    }
 
     /**
      * Getter to the drawPage. Normally, getting the page should
@@ -285,16 +359,35 @@ public:
     Page *GetDrawingPage() const { return m_drawingPage; }
 
     /**
-     * Return the width adjusted to the content of the current drawing page.
+     * Return true if the drawing values are set for the page (see Doc::SetDrawingPage and Doc::SetDrawingPages).
+     */
+    bool IsDrawingPage(const Page *page) const { return (m_drawingAllPages || (page == m_drawingPage)); }
+
+    /**
+     * Return the width adjusted to the content of the page (the current drawing page by default).
      * This includes the appropriate left and right margins.
      */
-    int GetAdjustedDrawingPageWidth() const;
+    int GetAdjustedDrawingPageWidth(Page *page = NULL) const;
 
     /**
-     * Return the height adjusted to the content of the current drawing page.
+     * Return the height adjusted to the content of the page (the current drawing page by default).
      * This includes the appropriate top and bottom margin (using top as bottom).
      */
-    int GetAdjustedDrawingPageHeight() const;
+    int GetAdjustedDrawingPageHeight(Page *page = NULL) const;
+
+    /**
+     * @name Methods for the uuid index of the document used by Object::FindChildByUuid
+     * The index is built when first needed and then updated when an Object (and its descendants by default) is
+     * added to or removed from the document, or when its uuid changes. Objects not attached to the tree of the
+     * document (e.g., the aligners) are not indexed. ResetUuidIndex discards it when it cannot be updated.
+     * FindInUuidIndex returns false if the uuid is not unique and the index cannot be used.
+     */
+    ///@{
+    void ResetUuidIndex();
+    void AddObjectToUuidIndex(Object *object, bool descendants = true);
+    void RemoveObjectFromUuidIndex(Object *object, bool descendants = true);
+    bool FindInUuidIndex(const std::string &uuid, Object **object);
+    ///@}
 
     //----------//
     // Functors //
@@ -311,6 +404,33 @@ private:
      */
     int CalcMusicFontSize();
 
+    /**
+     * Return true if the object is in the uuid index.
+     * The index is reset when the uuid of the object is not unique, since this cannot be known.
+     */
+    bool IsInUuidIndex(Object *object);
+
+    /**
+     * Get the descender, the width, and the height of a glyph scaled to the music font size (and to the grace size).
+     * The values are taken from the scaled glyph metrics when available and stored in it otherwise.
+     */
+    void GetScaledGlyphMetrics(wchar_t code, bool graceSize, int &descender, int &width, int &height) const;
+
+    /**
+     * Reset the scaled glyph metrics if the font selected for the calling thread or the font size have changed.
+     * Called from SetDrawingPage since the cache cannot be reset when filled from several threads.
+     */
+    void UpdateScaledGlyphMetrics();
+
+    /**
+     * @name Build the maximum offsets of the index of the playing times for the elements in [begin, end) in the
+     * onset order, and look for the elements being played at a given time in it.
+     */
+    ///@{
+    double IndexMidiElements(int begin, int end);
+    void FindMidiElements(int begin, int end, double time, std::vector<int> *indices) const;
+    ///@}
+
 public:
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -351,6 +471,8 @@ public:
     double m_drawingSpacingLinear;
     /** value of the non linear spacing factor */
     double m_drawingSpacingNonLinear;
+    /** number of threads for the horizontal layout */
+    int m_layoutThreads;
     /** minimum measure width */
     int m_drawingMinMeasureWidth;
 
@@ -379,6 +501,8 @@ private:
 
     /** The page currently being drawn */
     Page *m_drawingPage;
+    /** A flag indicating that the drawing values are set for all the pages (see Doc::SetDrawingPages) */
+    bool m_drawingAllPages;
     /** Half a the space between to staff lines */
     int m_drawingUnit;
     /** Space between to staff lines */
@@ -400,10 +524,6 @@ private:
     int m_drawingSmuflFontSize;
     /** Lyric font size  */
     int m_drawingLyricFontSize;
-    /** Current music font */
-    FontInfo m_drawingSmuflFont;
-    /** Current lyric font */
-    FontInfo m_drawingLyricFont;
 
     /**
      * A flag to indicate whether the currentScoreDef has been set or not.
@@ -443,6 +563,74 @@ private:
      * A score buffer for loading or creating a scoreBased MEI.
      */
     Score *m_scoreBuffer;
+
+    /**
+     * The uuid index of all the Object in the tree.
+     * Uuids appearing more than once are mapped to NULL.
+     */
+    MapOfUuidObjects m_uuidIndex;
+    /** A flag indicating if the uuid index is up-to-date */
+    bool m_uuidIndexIsValid;
+    /** The mutex for the uuid index when processing in threads */
+    std::mutex m_uuidIndexMutex;
+    /** The number of nested processings in threads (see Doc::StartProcessingInThreads) */
+    std::atomic<int> m_processingInThreads;
+
+    /**
+     * @name The content layout stored by CastOffDoc and the values it depends on.
+     * The positions and widths of the measures and of the scoreDefs are stored in the objects.
+     */
+    ///@{
+    bool m_castOffLayoutIsValid;
+    const Resources::GlyphTable *m_castOffLayoutFont;
+    double m_castOffLayoutSpacingLinear;
+    double m_castOffLayoutSpacingNonLinear;
+    bool m_castOffLayoutEvenSpacing;
+    int m_castOffLayoutUnit;
+    int m_castOffLayoutLyricFontSize;
+    int m_castOffLayoutLabelsWidth;
+    int m_castOffLayoutScoreDefWidth;
+    ///@}
+
+    /**
+     * @name The index of the notes, rests and chords played filled by ExportMIDI.
+     * The elements are in the document order and their onsets and offsets in the order of the onsets.
+     * This is an implicit interval tree, the middle of each range in the onset order being the root of it.
+     * The maximum offset of the elements in the range is kept at the root for skipping it in the lookup.
+     */
+    ///@{
+    ArrayOfObjects m_midiElements;
+    std::vector<int> m_midiElementsByOnset;
+    std::vector<double> m_midiOnsets;
+    std::vector<double> m_midiOffsets;
+    std::vector<double> m_midiMaxOffsets;
+    ///@}
+
+    /**
+     * The metrics of a glyph scaled to the music font size, for the normal size [0] and the grace size [1].
+     * The values are atomic because they can be filled concurrently by the layout threads.
+     */
+    struct ScaledGlyphMetrics {
+        std::atomic<bool> m_isSet[2];
+        std::atomic<int> m_descender[2];
+        std::atomic<int> m_width[2];
+        std::atomic<int> m_height[2];
+    };
+
+    /**
+     * @name The scaled metrics of the SMuFL glyphs indexed by code (from SMUFL_CODE_FIRST) and the font and the
+     * font size they are valid for. The table is allocated on first use and owned by the Doc.
+     */
+    ///@{
+    mutable ScaledGlyphMetrics *m_scaledGlyphMetrics;
+    const Resources::GlyphTable *m_scaledGlyphMetricsFont;
+    int m_scaledGlyphMetricsFontSize;
+    ///@}
+
+#ifdef OBJECT_ARENA
+    /** The arena from which the objects of the document are allocated, released in bulk by Doc::Reset */
+    ObjectArena *m_objectArena;
+#endif
 };
 
 } // namespace vrv
@@ -87,6 +87,20 @@ public:
     ListOfObjects *m_flatList;
 };
 
+//----------------------------------------------------------------------------
+// AddToUuidIndexParams
+//----------------------------------------------------------------------------
+
+/**
+ * member 0: the pointer to the uuid index to be filled
+**/
+
+class AddToUuidIndexParams : public FunctorParams {
+public:
+    AddToUuidIndexParams(MapOfUuidObjects *uuidIndex) { m_uuidIndex = uuidIndex; }
+    MapOfUuidObjects *m_uuidIndex;
+};
+
 //----------------------------------------------------------------------------
 // AdjustAccidXParams
 //----------------------------------------------------------------------------
@@ -645,6 +659,7 @@ public:
  * member 4: the system width
  * member 5: the current scoreDef width
  * member 6: the current pending objects (ScoreDef, Endings, etc.) to be place at the beginning of a system
+ * member 7: a flag indicating if the widths stored by the previous cast off are used (or stored otherwise)
 **/
 
 class CastOffSystemsParams : public FunctorParams {
@@ -657,6 +672,7 @@ public:
         m_shift = 0;
         m_systemWidth = 0;
         m_currentScoreDefWidth = 0;
+        m_reuseLayout = false;
     }
     System *m_contentSystem;
     Page *m_page;
@@ -665,6 +681,7 @@ public:
     int m_systemWidth;
     int m_currentScoreDefWidth;
     ArrayOfObjects m_pendingObjects;
+    bool m_reuseLayout;
 };
 
 //----------------------------------------------------------------------------
@@ -802,19 +819,22 @@ public:
  * member 1: int*: the midi track number
  * member 2: int*: the current time in the measure (incremented by each element)
  * member 3: int*: the current total measure time (incremented by each measure
- * member 4: std::vector<double>: a stack of maximum duration filled by the functor
- * member 5: int* the semi tone transposition for the current track
- * member 6: int with the current bpm
+ * member 4: std::vector<double>*: the maximum duration of each measure (see CalcMaxMeasureDurationParams)
+ * member 5: int: the index of the current measure in the maximum durations
+ * member 6: int* the semi tone transposition for the current track
+ * member 7: int with the current bpm
 **/
 
 class GenerateMIDIParams : public FunctorParams {
 public:
-    GenerateMIDIParams(MidiFile *midiFile)
+    GenerateMIDIParams(MidiFile *midiFile, std::vector<double> *maxValues)
     {
         m_midiFile = midiFile;
         m_midiTrack = 1;
         m_currentMeasureTime = 0.0;
         m_totalTime = 0.0;
+        m_maxValues = maxValues;
+        m_currentMeasure = 0;
         m_transSemi = 0;
         m_currentBpm = 120;
     }
@@ -822,7 +842,8 @@ public:
     int m_midiTrack;
     double m_currentMeasureTime;
     double m_totalTime;
-    std::vector<double> m_maxValues;
+    std::vector<double> *m_maxValues;
+    int m_currentMeasure;
     int m_transSemi;
     int m_currentBpm;
 };
@@ -1080,6 +1101,26 @@ public:
     ArrayOfObjectBeatPairs m_tstamps;
 };
 
+//----------------------------------------------------------------------------
+// RemoveFromUuidIndexParams
+//----------------------------------------------------------------------------
+
+/**
+ * member 0: the pointer to the uuid index to be updated
+ * member 1: a flag indicating that one of the uuids was not unique (output)
+**/
+
+class RemoveFromUuidIndexParams : public FunctorParams {
+public:
+    RemoveFromUuidIndexParams(MapOfUuidObjects *uuidIndex)
+    {
+        m_uuidIndex = uuidIndex;
+        m_notUnique = false;
+    }
+    MapOfUuidObjects *m_uuidIndex;
+    bool m_notUnique;
+};
+
 //----------------------------------------------------------------------------
 // ReplaceDrawingValuesInStaffDefParams
 //----------------------------------------------------------------------------
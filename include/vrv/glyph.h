@@ -9,6 +9,7 @@
 #define __VRV_GLYPH_H__
 
 #include <algorithm>
+#include <memory>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -16,6 +17,10 @@
 #include "devicecontextbase.h"
 #include "vrvdef.h"
 
+namespace pugi {
+class xml_document;
+}
+
 namespace vrv {
 
 /**
@@ -59,6 +64,9 @@ public:
     /** Get the code string */
     std::string GetCodeStr() { return m_codeStr; }
 
+    /** Get the content of the glyph file as parsed when loading the font (NULL if it could not be loaded) */
+    const pugi::xml_document *GetXML() const { return m_xml.get(); }
+
     /**
      * @name Setter and getter for the horizAdvX
      */
@@ -79,10 +87,28 @@ public:
     bool HasAnchor(SMuFLGlyphAnchor anchor);
 
     /**
-     * Return the SMuFL anchor for the glyph.
+     * Return the SMuFL anchor for the glyph (NULL if not provided).
      */
     const Point *GetAnchor(SMuFLGlyphAnchor anchor);
 
+    /**
+     * @name Write and read the glyph to and from a binary font pack (see Resources::WriteFontPack)
+     * The values are stored as they are in the glyph, together with the content of the glyph file.
+     * When reading, the position is moved to the next glyph and false is returned if the data is invalid.
+     */
+    ///@{
+    void WriteToPack(std::string &pack) const;
+    bool ReadFromPack(const char *&position, const char *end, const std::string &dirname);
+    ///@}
+
+    /**
+     * @name Write and read a value in a binary font pack (as 32-bit little-endian integers)
+     */
+    ///@{
+    static void AppendPackInt(std::string &pack, int value);
+    static bool ReadPackInt(const char *&position, const char *end, int &value);
+    ///@}
+
 private:
     //
 public:
@@ -101,6 +127,8 @@ private:
     std::string m_path;
     /** The Unicode code in hexa as string */
     std::string m_codeStr;
+    /** The parsed content of the glyph file, shared by the copies of the glyph */
+    std::shared_ptr<pugi::xml_document> m_xml;
     /** A map of the available anchors */
     std::map<SMuFLGlyphAnchor, Point> m_anchors;
 };
@@ -352,6 +352,7 @@ protected:
     /**
      * Search if an alignment of the type is already there at the time.
      * If not, return in idx the position where it needs to be inserted (-1 if it is the end)
+     * The search is a binary search since the alignments are kept sorted by time and type.
      */
     Alignment *SearchAlignmentAtTime(double time, AlignmentType type, int &idx);
 
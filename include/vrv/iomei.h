@@ -534,6 +534,7 @@ private:
 
     /**
      * Write unsupported attributes and store them in Object::m_unsupported (not tested)
+     * The attributes consumed by the att classes are skipped.
      */
     void ReadUnsupportedAttr(pugi::xml_node element, Object *object);
 
@@ -599,6 +600,12 @@ private:
      */
     bool m_hasScoreDef;
 
+    /**
+     * The attributes of the element being read that were consumed by the att classes.
+     * They are not removed from the element but skipped in ReadUnsupportedAttr.
+     */
+    ArrayOfConsumedAttrs m_consumedAttrs;
+
     /**
      * Check if an element is allowed within a given parent
      */
@@ -184,6 +184,7 @@ private:
      */
     ///@{
     bool HasAttributeWithValue(pugi::xml_node node, std::string attribute, std::string value);
+    bool HasBeamWithValue(pugi::xml_node node, std::string value);
     bool IsElement(pugi::xml_node node, std::string name);
     bool HasContentWithValue(pugi::xml_node node, std::string value);
     bool HasContent(pugi::xml_node);
@@ -191,11 +192,13 @@ private:
 
     /*
      * @name Helper methods for retrieving attribute values or element content
+     * Children are looked up directly and not with XPath queries since these are compiled for each call
      */
     ///@{
     std::string GetAttributeValue(pugi::xml_node node, std::string attribute);
     std::string GetContent(pugi::xml_node node);
     std::string GetContentOfChild(pugi::xml_node node, std::string child);
+    pugi::xml_node GetChildWithNumber(pugi::xml_node node, std::string name, std::string number, std::string child);
     ///@}
 
     /*
@@ -15,6 +15,7 @@
 
 namespace vrv {
 
+class Clef;
 class Ending;
 class ControlElement;
 class ScoreDef;
@@ -168,6 +169,12 @@ public:
      */
     std::vector<Staff *> GetFirstStaffGrpStaves(ScoreDef *scoreDef);
 
+    /**
+     * Return the clefs of the measure appearing on the staff @n, including cross-staff clefs, in the tree order.
+     * The lists are built once for all staves on the first call and reset by PrepareCrossStaff and ResetDrawing.
+     */
+    const std::vector<Clef *> *GetDrawingClefs(int staffN);
+
     /**
      * Custom method for upgrading page-based unmeasured transcription data
      */
@@ -368,6 +375,23 @@ private:
      */
     Ending *m_drawingEnding;
 
+    /**
+     * The clefs of the measure by staff @n (see Measure::GetDrawingClefs) and a flag indicating if they are built.
+     */
+    ///@{
+    std::map<int, std::vector<Clef *> > m_drawingClefs;
+    bool m_drawingClefsDone;
+    ///@}
+
+    /**
+     * The X relative position and the width of the measure in the content system when last cast off.
+     * Re-used by CastOffSystems when the document is cast off again with the same layout (see Doc::CastOffDoc).
+     */
+    ///@{
+    int m_castOffXRel;
+    int m_castOffWidth;
+    ///@}
+
     /**
      * A flag indicating if the measure has AlignmentReference with multiple layers
      */
@@ -12,7 +12,9 @@
 #include <ctime>
 #include <iterator>
 #include <map>
+#include <random>
 #include <string>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
@@ -51,6 +53,41 @@ struct IntTree {
 
 typedef std::map<int, IntTree> IntTree_t;
 
+/**
+ * The FunctorParams of one staff/layer (or staff/layer/verse) for processing the tree
+ * in a single pass for all of them with Object::ProcessByLayer.
+ * See Doc::PrepareDrawing for an example.
+ */
+class LayerProcessingItem {
+public:
+    LayerProcessingItem(int staffN, int layerN, FunctorParams *params)
+    {
+        m_staffN = staffN;
+        m_layerN = layerN;
+        m_verseN = 0;
+        m_byVerse = false;
+        m_params = params;
+        m_returnCode = 0;
+    }
+    LayerProcessingItem(int staffN, int layerN, int verseN, FunctorParams *params)
+        : LayerProcessingItem(staffN, layerN, params)
+    {
+        m_verseN = verseN;
+        m_byVerse = true;
+    }
+
+    int m_staffN;
+    int m_layerN;
+    int m_verseN;
+    /** Indicates if the verse @n has to be matched */
+    bool m_byVerse;
+    FunctorParams *m_params;
+    /** The code returned by the functor for the item (see Functor::m_returnCode) */
+    int m_returnCode;
+};
+
+typedef std::vector<LayerProcessingItem> ArrayOfLayerProcessingItems;
+
 /**
  * This is the alternate way for representing map of maps. With this solution,
  * we can easily have different types of key (attribute) at each level. We could
@@ -136,17 +173,18 @@ public:
 
     /**
      * @name Methods for registering a MEI att class and for registering interfaces regrouping MEI att classes.
+     * The lists are shared by all the objects registering the same sequence (i.e., of the same class).
      */
     ///@{
-    void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
+    void RegisterAttClass(AttClassId attClassId);
     bool HasAttClass(AttClassId attClassId) const
     {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
+        return std::find(m_attClasses->begin(), m_attClasses->end(), attClassId) != m_attClasses->end();
     }
     void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
     bool HasInterface(InterfaceId interfaceId) const
     {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
+        return std::find(m_interfaces->begin(), m_interfaces->end(), interfaceId) != m_interfaces->end();
     }
     ///@}
 
@@ -323,6 +361,7 @@ public:
     /**
      * Look for a child with the specified uuid (returns NULL if not found)
      * This method is a wrapper for the Object::FindByUuid functor.
+     * For a search without depth limit in an Object of a Doc, the uuid index of the Doc is used instead.
      */
     Object *FindChildByUuid(std::string uuid, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
 
@@ -412,6 +451,15 @@ public:
      */
     void Modify(bool modified = true);
 
+    /**
+     * @name Add or remove the Object and its descendants to or from the uuid index of the Doc it belongs to (if any).
+     * To be called when the Object is attached to or detached from its parent.
+     */
+    ///@{
+    void AddToDocUuidIndex();
+    void RemoveFromDocUuidIndex();
+    ///@}
+
     /**
      * @name Setter and getter of the attribute flag
      */
@@ -440,6 +488,13 @@ public:
                          ArrayOfAttComparisons *filters = NULL, int deepness = UNLIMITED_DEPTH,
                          bool direction = FORWARD);
 
+    /**
+     * Process the functor for each staff/layer (or staff/layer/verse) of the items in one single pass.
+     * This is equivalent to calling Process for each item with its FunctorParams and AttCommonNComparison
+     * filters for its staff, layer (and verse) @n, but without traversing the tree once for each of them.
+     */
+    void ProcessByLayer(Functor *functor, ArrayOfLayerProcessingItems *items, Functor *endFunctor = NULL);
+
     //----------//
     // Functors //
     //----------//
@@ -459,6 +514,16 @@ public:
      */
     virtual int FindByUuid(FunctorParams *functorParams);
 
+    /**
+     * Add the Object to a uuid index (see Doc::FindInUuidIndex).
+     */
+    virtual int AddToUuidIndex(FunctorParams *functorParams);
+
+    /**
+     * Remove the Object from a uuid index (see Doc::RemoveObjectFromUuidIndex).
+     */
+    virtual int RemoveFromUuidIndex(FunctorParams *functorParams);
+
     /**
      * Find a Object with a AttComparison functor .     */
     virtual int FindByAttComparison(FunctorParams *functorParams);
@@ -931,6 +996,11 @@ private:
      */
     void GenerateUuid();
 
+    /**
+     * Recursive method for ProcessByLayer with the items matching the object.
+     */
+    void ProcessLayerItems(Functor *functor, std::vector<LayerProcessingItem *> *items, Functor *endFunctor);
+
     /**
      * Initialisation method taking a uuid prefix argument.
      */
@@ -989,14 +1059,14 @@ private:
     ///@}
 
     /**
-     * A vector for storing the list of AttClassId (MEI att classes) implemented.
+     * A pointer to the shared list of AttClassId (MEI att classes) implemented.
      */
-    std::vector<AttClassId> m_attClasses;
+    const std::vector<AttClassId> *m_attClasses;
 
     /**
-     * A vector for storing the list of InterfaceId (group of MEI att classes) implemented.
+     * A pointer to the shared list of InterfaceId (group of MEI att classes) implemented.
      */
-    std::vector<InterfaceId> m_interfaces;
+    const std::vector<InterfaceId> *m_interfaces;
 
     /**
      * A string for storing a comment to be printed immediately before
@@ -1011,9 +1081,12 @@ private:
     bool m_isAttribute;
 
     /**
-     * A static counter for uuid generation.
+     * The random number generator for uuids.
+     * There is one per thread so documents can be loaded concurrently.
+     * It is seeded with the time when the first uuid is generated unless SeedUuid was called before.
      */
-    static unsigned long s_objectCounter;
+    static thread_local std::mt19937 s_uuidGenerator;
+    static thread_local bool s_uuidGeneratorSeeded;
 };
 
 //----------------------------------------------------------------------------
@@ -1067,6 +1140,15 @@ private:
     mutable ListOfObjects m_list;
     ListOfObjects::iterator m_iteratorCurrent;
 
+    /**
+     * A copy of the list as a vector and the position of each object in it.
+     * They are rebuilt together with the list and make the lookups by position constant time.
+     */
+    ///@{
+    ArrayOfObjects m_listVector;
+    std::unordered_map<const Object *, int> m_listIndexes;
+    ///@}
+
 protected:
     /**
      * Filter the list for a specific class.
@@ -144,6 +144,20 @@ private:
      */
     void AdjustSylSpacingByVerse(PrepareProcessingListsParams &listsParams, Doc *doc);
 
+    /**
+     * Adjust the horizontal position of the content measure by measure with the given number of threads.
+     * Runs the same functors as LayOutHorizontally, which can be done in any order since the measures are
+     * adjusted independently from each other. The position of the measures is set afterwards by AlignMeasures.
+     */
+    void AdjustMeasuresHorizontally(Doc *doc, int threads);
+
+    /**
+     * Adjust the vertical position of the content system by system with the given number of threads.
+     * Runs the same functors as LayOutVertically after the bounding boxes are filled. The systems are adjusted
+     * independently from each other until they are stacked by AlignSystems.
+     */
+    void AdjustSystemsVertically(Doc *doc, int threads);
+
     //
 public:
     /** Page width (MEI scoredef@page.width). Saved if != -1 */
@@ -96,7 +96,14 @@ public:
 private:
     //
 public:
-    //
+    /**
+     * The time the rest is played, filled by the MIDI export
+     */
+    ///@{
+    double m_playingOnset;
+    double m_playingOffset;
+    ///@}
+
 private:
 };
 
@@ -196,7 +196,7 @@ public:
 protected:
     /**
      * Filter the list for a specific class.
-     * For example, keep staffGrp for fast access.
+     * Keep only the staffDefs and index them by @n for GetStaffDef.
      */
     virtual void FilterList(ListOfObjects *childList);
 
@@ -210,6 +210,10 @@ private:
     bool m_drawLabels;
     /** Store the drawing width (clef and key sig) of the scoreDef */
     int m_drawingWidth;
+    /** Store the width (with the abbr labels) of the scoreDef when last cast off (see Doc::CastOffDoc) */
+    int m_castOffWidth;
+    /** The staffDefs by @n, rebuilt together with the list (see ScoreDef::FilterList) */
+    std::unordered_map<int, StaffDef *> m_staffDefsByN;
 };
 
 //----------------------------------------------------------------------------
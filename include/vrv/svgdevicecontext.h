@@ -8,6 +8,7 @@
 #ifndef __VRV_SVG_DC_H__
 #define __VRV_SVG_DC_H__
 
+#include <bitset>
 #include <fstream>
 #include <iostream>
 #include <list>
@@ -197,7 +198,9 @@ private:
 
     // holds the list of glyphs from the smufl font used so far
     // they will be added at the end of the file as <defs>
-    std::vector<std::string> m_smufl_glyphs;
+    std::vector<const Glyph *> m_smufl_glyphs;
+    // flags the SMuFL codes of the glyphs already in m_smufl_glyphs
+    std::bitset<SMUFL_CODE_LAST - SMUFL_CODE_FIRST + 1> m_smuflGlyphCodes;
 
     // pugixml data
     pugi::xml_document m_svgDoc;
@@ -39,7 +39,10 @@ public:
      * @name Constructors and destructors
      */
     ///@{
-    /** If initFont is set to false, Resources::InitFonts will have to be called explicitely */
+    /**
+     * If initFont is set to false, Resources::InitFonts will have to be called explicitely.
+     * The fonts are loaded only once and shared by all the instances.
+     */
     Toolkit(bool initFont = true);
     virtual ~Toolkit();
     ///@}
@@ -108,6 +111,14 @@ public:
      */
     bool RenderToSvgFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render all the pages in SVG and returns them as a vector of strings (one per page).
+     * The pages are laid out and drawn by the given number of threads (the number of hardware threads with 0).
+     * Pages sharing elements (e.g., a slur across a page break) are never processed at the same time.
+     * The rendering is serial if some pages have their own size (see Doc::SetDrawingPages).
+     */
+    std::vector<std::string> RenderAllPagesToSvg(int threads = 0, bool xml_declaration = false);
+
     /**
      * Creates a midi file, opens it, and writes to it.
      * currently generates a dummy midi file.
@@ -127,7 +138,7 @@ public:
     std::string GetHumdrum();
 
     /**
-     * Returns array of IDs of elements being currently played.
+     * Returns arrays of IDs of the notes, rests and chords being currently played.
      */
     std::string GetElementsAtTime(int millisec);
 
@@ -300,6 +311,14 @@ public:
     int GetEvenNoteSpacing() { return m_evenNoteSpacing; }
     ///@}
 
+    /**
+     * @name Number of threads for laying out the measures horizontally (the number of hardware threads with 0)
+     */
+    ///@{
+    void SetLayoutThreads(int threads) { m_layoutThreads = threads; }
+    int GetLayoutThreads() { return m_layoutThreads; }
+    ///@}
+
     /**
      * @name Do not justify the system (for debugging purposes)
      */
@@ -379,6 +398,7 @@ public:
 
     /**
      * @name Set a specific font
+     * The font is selected for this instance only (and not for the process)
      */
     ///@{
     bool SetFont(std::string const &font);
@@ -408,6 +428,24 @@ private:
     bool IsUTF16(const std::string &filename);
     bool LoadUTF16File(const std::string &filename);
 
+    /**
+     * Select the font of the toolkit for the calling thread.
+     * To be called before any layout or rendering operation.
+     */
+    void SelectFont();
+
+    /**
+     * Render the page set in the view in SVG.
+     * The view can be another one than the toolkit one, for rendering pages concurrently.
+     */
+    std::string RenderPageToSvg(View *view, int pageIdx, bool xml_declaration);
+
+    /**
+     * Return for each page the range of pages with which it shares elements (e.g., a tie across a page break).
+     * Used in RenderAllPagesToSvg for not processing them at the same time.
+     */
+    static std::vector<std::pair<int, int> > GetSharingPages(Doc *doc);
+
 protected:
 #ifdef USE_EMSCRIPTEN
     /**
@@ -453,13 +491,17 @@ private:
     std::string m_mdivXPathQuery;
     bool m_scoreBasedMei;
     bool m_evenNoteSpacing;
+    int m_layoutThreads;
     float m_spacingLinear;
     float m_spacingNonLinear;
     // for debugging
     bool m_noJustification;
     bool m_showBoundingBoxes;
 
-    static char *m_humdrumBuffer;
+    /** The font name (empty for the default font) */
+    std::string m_font;
+
+    char *m_humdrumBuffer;
     char *m_cString;
 };
 
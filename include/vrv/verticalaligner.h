@@ -8,6 +8,10 @@
 #ifndef __VRV_VERTICAL_ALIGNER_H__
 #define __VRV_VERTICAL_ALIGNER_H__
 
+#include <tuple>
+
+//----------------------------------------------------------------------------
+
 #include "atts_shared.h"
 #include "object.h"
 
@@ -18,6 +22,79 @@ class StaffAlignment;
 class SystemAligner;
 class TimestampAttr;
 
+//----------------------------------------------------------------------------
+// OverflowBBoxes
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the overflowing bounding boxes of a StaffAlignment.
+ * Along with the boxes in the order they are added, it keeps their horizontal content extent in an interval index.
+ * This makes it possible to find the boxes overlapping horizontally with another one without going through all of them.
+ * The index is made of levels with a power of two number of extents sorted by left position, merged as boxes are added.
+ * Each level is an implicit interval tree, the middle of each range being its root with the maximum right of the range.
+ */
+class OverflowBBoxes {
+public:
+    // constructors and destructors
+    OverflowBBoxes();
+    virtual ~OverflowBBoxes(){};
+
+    /**
+     * @name Add a box or clear the list
+     */
+    ///@{
+    void Add(BoundingBox *box);
+    void Clear();
+    ///@}
+
+    /**
+     * Return the boxes in the order they were added
+     */
+    const ArrayOfBoundingBoxes *GetBoxes() const { return &m_boxes; }
+
+    /**
+     * Fill overlappingBoxes with the boxes having an horizontal content overlap with the box.
+     * The boxes are given in the order they were added.
+     */
+    void FindHorizontalOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes *overlappingBoxes) const;
+
+    /**
+     * Fill skyline with the profile of the overflow of the boxes (above or below) for the staff alignment.
+     * Each step is the x position where it starts and the maximum overflow (INT_MIN where there is no box).
+     * Boxes without width cannot be part of the profile and are added to pointBoxes.
+     */
+    void CalcSkyline(
+        StaffAlignment *alignment, bool above, ArrayOfSkylineSteps *skyline, ArrayOfBoundingBoxes *pointBoxes) const;
+
+    /**
+     * Return the maximum sum of the values of two skylines where both have a value (INT_MIN if never).
+     */
+    static int CalcSkylinesMaxSum(const ArrayOfSkylineSteps &skyline1, const ArrayOfSkylineSteps &skyline2);
+
+private:
+    /**
+     * Set the maximum right of the extents in [begin, end) of a level and return it.
+     */
+    int IndexLevel(int level, int begin, int end);
+
+    /**
+     * Add the index of the boxes in [begin, end) of a level overlapping horizontally with [left, right].
+     */
+    void FindInLevel(int level, int begin, int end, int left, int right, std::vector<int> *indices) const;
+
+public:
+    //
+private:
+    /** The boxes in the order they were added */
+    ArrayOfBoundingBoxes m_boxes;
+    /** The content left and right of the boxes with their index, sorted by left, for each level */
+    std::vector<std::vector<std::tuple<int, int, int> > > m_extents;
+    /** The maximum right of the range of which each extent is the root, for each level */
+    std::vector<std::vector<int> > m_maxRights;
+    /** The index of the boxes without content bounding box when added */
+    std::vector<int> m_unsortedBoxes;
+};
+
 //----------------------------------------------------------------------------
 // SystemAligner
 //----------------------------------------------------------------------------
@@ -150,8 +227,8 @@ public:
      * @name Adds a bounding box to the array of overflowing objects above or below
      */
     ///@{
-    void AddBBoxAbove(BoundingBox *box) { m_overflowAboveBBoxes.push_back(box); }
-    void AddBBoxBelow(BoundingBox *box) { m_overflowBelowBBoxes.push_back(box); }
+    void AddBBoxAbove(BoundingBox *box) { m_overflowAboveBBoxes.Add(box); }
+    void AddBBoxBelow(BoundingBox *box) { m_overflowBelowBBoxes.Add(box); }
     ///@}
 
     /**
@@ -225,8 +302,8 @@ private:
     /**
      * The list of overflowing bounding boxes (e.g, LayerElement or FloatingPositioner)
      */
-    std::vector<BoundingBox *> m_overflowAboveBBoxes;
-    std::vector<BoundingBox *> m_overflowBelowBBoxes;
+    OverflowBBoxes m_overflowAboveBBoxes;
+    OverflowBBoxes m_overflowBelowBBoxes;
 };
 
 } // namespace vrv
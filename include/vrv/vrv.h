@@ -8,11 +8,16 @@
 #ifndef __VRV_H__
 #define __VRV_H__
 
+#include <atomic>
 #include <cstring>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #ifndef _WIN32
@@ -21,9 +26,16 @@
 #include <time.h>
 #endif
 
+//----------------------------------------------------------------------------
+
+#include "glyph.h"
+
+namespace pugi {
+class xml_document;
+}
+
 namespace vrv {
 
-class Glyph;
 class Object;
 
 /**
@@ -39,10 +51,11 @@ void DisableLog();
 
 /**
  * Member and functions specific to emscripten loging that uses a vector of string to buffer the logs.
+ * The buffer is kept per thread so each Toolkit only sees the messages of the calls made on its thread.
  */
 #ifdef EMSCRIPTEN
 enum consoleLogLevel { CONSOLE_LOG = 0, CONSOLE_INFO, CONSOLE_WARN, CONSOLE_ERROR };
-extern std::vector<std::string> logBuffer;
+extern thread_local std::vector<std::string> logBuffer;
 bool LogBufferContains(std::string s);
 void AppendLogBuffer(bool checkDuplicate, std::string message, consoleLogLevel level);
 #endif
@@ -102,7 +115,7 @@ extern bool noLog;
  * ... Do something
  * LogElapsedTimeEnd("name of the operation");
  */
-extern struct timeval start;
+extern thread_local struct timeval start;
 void LogElapsedTimeStart();
 void LogElapsedTimeEnd(const char *msg = "unspecified operation");
 
@@ -119,39 +132,186 @@ bool Check(Object *object);
 /**
  * This class provides static resource values.
  * The default values can be changed by setters.
+ *
+ * The fonts are registered once per resource path as a font set. A font set is never modified once registered
+ * and never freed, so the fonts can be shared by Toolkit instances running in different threads, including
+ * when one of them changes the resource path.
+ * The glyphs are loaded only the first time they are requested (see Resources::GetGlyph).
+ * The font selection, however, is done per thread (see Resources::SetFont).
  */
 
 class Resources {
 public:
+    struct FontSet;
+    struct GlyphTable;
+
+    /**
+     * The bounding box, the horizontal advance and the anchors of a glyph read from the bounding box file
+     */
+    struct GlyphMetrics {
+        GlyphMetrics() : m_x(0.0), m_y(0.0), m_width(0.0), m_height(0.0), m_horizAdvX(0.0), m_hasHorizAdvX(false) {}
+        double m_x;
+        double m_y;
+        double m_width;
+        double m_height;
+        double m_horizAdvX;
+        bool m_hasHorizAdvX;
+        std::vector<std::pair<std::string, std::pair<double, double> > > m_anchors;
+    };
+
+    /**
+     * A glyph registered in a font, loaded from the glyph file or the font pack when first requested
+     */
+    struct FontGlyph {
+        FontGlyph() : m_font(NULL), m_code(0), m_hasMetrics(false), m_packPosition(0), m_packSize(0) {}
+        /** The glyph - valid only once loaded */
+        Glyph m_glyph;
+        /** The font the glyph belongs to and its code in the font */
+        GlyphTable *m_font;
+        wchar_t m_code;
+        /** The glyph file name in the font directory (empty with a font pack) */
+        std::string m_filename;
+        /** The metrics from the bounding box file of the font directory (if any) */
+        GlyphMetrics m_metrics;
+        bool m_hasMetrics;
+        /** The position and the size of the glyph in the font pack */
+        size_t m_packPosition;
+        size_t m_packSize;
+        /** Guarantees that the glyph is loaded only once when requested by concurrent threads */
+        std::once_flag m_loaded;
+    };
+
+    /**
+     * A SMuFL font with its glyphs registered from the font directory or from the font pack.
+     * The glyphs missing in the font are looked for in the fallback font (if any).
+     */
+    struct GlyphTable {
+        GlyphTable() : m_fontSet(NULL), m_unitsPerEm(0), m_fallback(NULL) {}
+        /** The font set the font belongs to */
+        FontSet *m_fontSet;
+        /** The font directory (also used for the glyph paths with a font pack) */
+        std::string m_dirname;
+        std::map<wchar_t, FontGlyph> m_glyphs;
+        /** The content of the font pack (empty for a font directory) */
+        std::string m_pack;
+        /** The units-per-em of the bounding box file of the font directory (0 if none) */
+        int m_unitsPerEm;
+        /** The font in which the missing glyphs are looked for */
+        GlyphTable *m_fallback;
+        /** The glyphs of the font and of the fallback fonts indexed by SMuFL code (from SMUFL_CODE_FIRST) */
+        std::vector<FontGlyph *> m_smuflGlyphs;
+    };
+
+    /**
+     * The SMuFL fonts and the text font registered from a resource path.
+     * Fonts are only added to it (see Resources::SetFont) and never removed.
+     */
+    struct FontSet {
+        FontSet() : m_defaultFont(NULL), m_textFontAscii(128, NULL) {}
+        /** The resource path of the fonts */
+        std::string m_path;
+        /** The SMuFL fonts, each falling back to the default font (or Bravura) for the missing glyphs */
+        std::map<std::string, GlyphTable> m_fonts;
+        /** The default SMuFL font (Leipzig) */
+        GlyphTable *m_defaultFont;
+        /** A text font used for bounding box calculations and its glyphs for the ASCII codes */
+        std::map<wchar_t, Glyph> m_textFont;
+        std::vector<Glyph *> m_textFontAscii;
+        /** The VerovioText font definition loaded with the text font */
+        std::shared_ptr<pugi::xml_document> m_textFontDefinition;
+    };
+
     /**
      * @name Setters and getters for static environment variables
      */
     ///@{
-    /** Resource path */
-    static std::string GetPath() { return m_path; }
-    static void SetPath(std::string path) { m_path = path; }
-    /** Init the SMufL music and text fonts */
+    /** Resource path - to be set before the fonts are initialized */
+    static std::string GetPath();
+    static void SetPath(std::string path);
+    /** Init the SMufL music and text fonts for the resource path and make them the default ones */
     static bool InitFonts();
-    /** Init the text font (bounding boxes and ASCII only) */
-    static bool InitTextFont();
-    /** Select a particular font */
+    /**
+     * Select a particular font for the calling thread.
+     * The font is loaded the first time it is selected.
+     */
     static bool SetFont(std::string fontName);
+    /** Select back the default font for the calling thread */
+    static void ResetFont();
+    /** Returns the font currently selected for the calling thread (or the default one) */
+    static const GlyphTable *GetCurrentFont() { return (s_currentFont) ? s_currentFont : GetDefaultFont(); }
+    /** Select for the calling thread a font returned by GetCurrentFont in another thread */
+    static void SetCurrentFont(const GlyphTable *font);
     /** Returns the glyph (if exists) for the current SMuFL font */
     static Glyph *GetGlyph(wchar_t smuflCode);
     /** Returns the glyph (if exists) for the text font (bounding box and ASCII only) */
     static Glyph *GetTextGlyph(wchar_t code);
+    /** Returns the VerovioText font definition (woff) to be embedded in the SVG output */
+    static const pugi::xml_document &GetTextFontDefinition();
     ///@}
 
+    /**
+     * @name Get and store the extent of a text measured at a point size with the current SMuFL font.
+     * The smufl flag indicates that the text was measured with the SMuFL glyphs only.
+     * The extents are stored per thread and the ones not used recently are discarded first.
+     * The extent is stored with the ascent and the descent of the text only (see DeviceContext::GetTextExtent).
+     */
+    ///@{
+    static bool GetCachedTextExtent(const std::wstring &text, int pointSize, bool smufl, TextExtend *extend);
+    static void CacheTextExtent(const std::wstring &text, int pointSize, bool smufl, const TextExtend &extend);
+    ///@}
+
+    /**
+     * Write the font from the resource directory (glyph files and bounding box file) into a single binary file.
+     * The font pack is used instead of the directory when saved as [path]/[fontName].vrvfont, unless it is older
+     * than the bounding box file or the font directory.
+     */
+    static bool WriteFontPack(std::string fontName, std::string filename);
+
 private:
-    static bool LoadFont(std::string fontName);
+    /** Returns the default font of the default font set (NULL if the fonts are not initialized) */
+    static GlyphTable *GetDefaultFont();
+    /** Returns the font set of the current font (NULL if the fonts are not initialized) */
+    static FontSet *GetCurrentFontSet();
+    /** Register the glyphs of the font from the font pack if any, or from the font directory otherwise */
+    static bool RegisterFont(const std::string &path, std::string fontName, GlyphTable *font);
+    /** Register the glyphs from the font pack - returns false without error if there is no font pack */
+    static bool RegisterFontPack(const std::string &path, std::string fontName, GlyphTable *font);
+    /** Register the glyphs from the font directory and load the bounding box file */
+    static bool RegisterFontDirectory(const std::string &path, std::string fontName, GlyphTable *font);
+    /** Load the glyph from the glyph file or the font pack - called only once per glyph (see GetGlyph) */
+    static void LoadGlyph(FontGlyph *fontGlyph);
+    /** Load the text font (bounding boxes and ASCII only) */
+    static bool LoadTextFont(FontSet *fontSet);
+
+    /**
+     * The text extents measured in a thread, by font, point size and SMuFL flag.
+     * When the current generation is full, it replaces the previous one, so the extents used in neither of
+     * them are discarded. The ones found in the previous generation are moved back to the current one.
+     */
+    struct TextExtentCache {
+        typedef std::map<std::tuple<const GlyphTable *, int, bool>, std::unordered_map<std::wstring, TextExtend> >
+            Generation;
+        TextExtentCache() : m_currentCount(0) {}
+        Generation m_current;
+        Generation m_previous;
+        int m_currentCount;
+    };
 
 private:
     /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
     static std::string m_path;
-    /** The loaded SMuFL font */
-    static std::map<wchar_t, Glyph> m_font;
-    /** A text font used for bounding box calculations */
-    static std::map<wchar_t, Glyph> m_textFont;
+    /** The mutex for the resource path */
+    static std::mutex s_pathMutex;
+    /** The font sets registered so far by resource path */
+    static std::map<std::string, FontSet> s_fontSets;
+    /** The font set of the last initialized resource path */
+    static std::atomic<FontSet *> s_defaultFontSet;
+    /** The SMuFL font selected for the current thread (NULL for the default one) */
+    static thread_local GlyphTable *s_currentFont;
+    /** The text extents measured in the current thread */
+    static thread_local TextExtentCache s_textExtentCache;
+    /** The mutex for registering the fonts */
+    static std::mutex s_fontMutex;
 };
 
 //----------------------------------------------------------------------------
@@ -11,6 +11,8 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -230,10 +232,14 @@ typedef std::vector<FloatingPositioner *> ArrayOfFloatingPositioners;
 
 typedef std::vector<BoundingBox *> ArrayOfBoundingBoxes;
 
+typedef std::vector<std::pair<int, int> > ArrayOfSkylineSteps;
+
 typedef std::vector<LedgerLine> ArrayOfLedgerLines;
 
 typedef std::map<Staff *, std::list<int> > MapOfDotLocs;
 
+typedef std::unordered_map<std::string, Object *> MapOfUuidObjects;
+
 //----------------------------------------------------------------------------
 // Global defines
 //----------------------------------------------------------------------------
@@ -281,6 +287,17 @@ enum FunctorCode { FUNCTOR_CONTINUE = 0, FUNCTOR_SIBLINGS, FUNCTOR_STOP };
 /** Define the maximum levels between a note and its syls **/
 #define MAX_NOTE_DEPTH -1
 
+//----------------------------------------------------------------------------
+// SMuFL codepoints
+//----------------------------------------------------------------------------
+
+/**
+ * The range of the SMuFL codepoints (the Unicode Private Use Area)
+ */
+
+#define SMUFL_CODE_FIRST 0xE000
+#define SMUFL_CODE_LAST 0xF8FF
+
 //----------------------------------------------------------------------------
 // VerovioText codepoints
 //----------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------
 
@@ -24,6 +25,38 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// Lookup tables of the converters from string
+//----------------------------------------------------------------------------
+
+/**
+ * An entry of the lookup table of a converter from string.
+ * The tables are static arrays of constants and are initialized at compile time.
+ */
+template <typename T> struct AttConverterValue {
+    const char *m_str;
+    T m_value;
+};
+
+/**
+ * Look for the value in the table without allocating a string.
+ * The first characters are compared before calling strcmp, which skips most of the entries.
+ */
+template <typename T, size_t N>
+static bool FindInTable(const AttConverterValue<T> (&table)[N], const char *value, T *data)
+{
+    assert(value);
+    assert(data);
+
+    for (const AttConverterValue<T> &entry : table) {
+        if ((entry.m_str[0] == value[0]) && !strcmp(entry.m_str, value)) {
+            (*data) = entry.m_value;
+            return true;
+        }
+    }
+    return false;
+}
+
 //----------------------------------------------------------------------------
 // AttConverter
 //----------------------------------------------------------------------------
@@ -62,31 +95,35 @@ std::string AttConverter::AccidentalExplicitToStr(data_ACCIDENTAL_EXPLICIT data)
     return value;
 }
 
-data_ACCIDENTAL_EXPLICIT AttConverter::StrToAccidentalExplicit(std::string value) const
-{
-    if (value == "s") return ACCIDENTAL_EXPLICIT_s;
-    if (value == "f") return ACCIDENTAL_EXPLICIT_f;
-    if (value == "ss") return ACCIDENTAL_EXPLICIT_ss;
-    if (value == "x") return ACCIDENTAL_EXPLICIT_x;
-    if (value == "ff") return ACCIDENTAL_EXPLICIT_ff;
-    if (value == "xs") return ACCIDENTAL_EXPLICIT_xs;
-    if (value == "sx") return ACCIDENTAL_EXPLICIT_sx;
-    if (value == "ts") return ACCIDENTAL_EXPLICIT_ts;
-    if (value == "tf") return ACCIDENTAL_EXPLICIT_tf;
-    if (value == "n") return ACCIDENTAL_EXPLICIT_n;
-    if (value == "nf") return ACCIDENTAL_EXPLICIT_nf;
-    if (value == "ns") return ACCIDENTAL_EXPLICIT_ns;
-    if (value == "su") return ACCIDENTAL_EXPLICIT_su;
-    if (value == "sd") return ACCIDENTAL_EXPLICIT_sd;
-    if (value == "fu") return ACCIDENTAL_EXPLICIT_fu;
-    if (value == "fd") return ACCIDENTAL_EXPLICIT_fd;
-    if (value == "nu") return ACCIDENTAL_EXPLICIT_nu;
-    if (value == "nd") return ACCIDENTAL_EXPLICIT_nd;
-    if (value == "1qf") return ACCIDENTAL_EXPLICIT_1qf;
-    if (value == "3qf") return ACCIDENTAL_EXPLICIT_3qf;
-    if (value == "1qs") return ACCIDENTAL_EXPLICIT_1qs;
-    if (value == "3qs") return ACCIDENTAL_EXPLICIT_3qs;
-    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.EXPLICIT", value.c_str());
+data_ACCIDENTAL_EXPLICIT AttConverter::StrToAccidentalExplicit(const char *value) const
+{
+    static const AttConverterValue<data_ACCIDENTAL_EXPLICIT> table[] = {
+        { "s", ACCIDENTAL_EXPLICIT_s },
+        { "f", ACCIDENTAL_EXPLICIT_f },
+        { "ss", ACCIDENTAL_EXPLICIT_ss },
+        { "x", ACCIDENTAL_EXPLICIT_x },
+        { "ff", ACCIDENTAL_EXPLICIT_ff },
+        { "xs", ACCIDENTAL_EXPLICIT_xs },
+        { "sx", ACCIDENTAL_EXPLICIT_sx },
+        { "ts", ACCIDENTAL_EXPLICIT_ts },
+        { "tf", ACCIDENTAL_EXPLICIT_tf },
+        { "n", ACCIDENTAL_EXPLICIT_n },
+        { "nf", ACCIDENTAL_EXPLICIT_nf },
+        { "ns", ACCIDENTAL_EXPLICIT_ns },
+        { "su", ACCIDENTAL_EXPLICIT_su },
+        { "sd", ACCIDENTAL_EXPLICIT_sd },
+        { "fu", ACCIDENTAL_EXPLICIT_fu },
+        { "fd", ACCIDENTAL_EXPLICIT_fd },
+        { "nu", ACCIDENTAL_EXPLICIT_nu },
+        { "nd", ACCIDENTAL_EXPLICIT_nd },
+        { "1qf", ACCIDENTAL_EXPLICIT_1qf },
+        { "3qf", ACCIDENTAL_EXPLICIT_3qf },
+        { "1qs", ACCIDENTAL_EXPLICIT_1qs },
+        { "3qs", ACCIDENTAL_EXPLICIT_3qs }
+    };
+    data_ACCIDENTAL_EXPLICIT data = ACCIDENTAL_EXPLICIT_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.EXPLICIT", value);
     return ACCIDENTAL_EXPLICIT_NONE;
 }
 
@@ -111,18 +148,22 @@ std::string AttConverter::AccidentalImplicitToStr(data_ACCIDENTAL_IMPLICIT data)
     return value;
 }
 
-data_ACCIDENTAL_IMPLICIT AttConverter::StrToAccidentalImplicit(std::string value) const
+data_ACCIDENTAL_IMPLICIT AttConverter::StrToAccidentalImplicit(const char *value) const
 {
-    if (value == "s") return ACCIDENTAL_IMPLICIT_s;
-    if (value == "f") return ACCIDENTAL_IMPLICIT_f;
-    if (value == "ss") return ACCIDENTAL_IMPLICIT_ss;
-    if (value == "ff") return ACCIDENTAL_IMPLICIT_ff;
-    if (value == "n") return ACCIDENTAL_IMPLICIT_n;
-    if (value == "su") return ACCIDENTAL_IMPLICIT_su;
-    if (value == "sd") return ACCIDENTAL_IMPLICIT_sd;
-    if (value == "fu") return ACCIDENTAL_IMPLICIT_fu;
-    if (value == "fd") return ACCIDENTAL_IMPLICIT_fd;
-    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.IMPLICIT", value.c_str());
+    static const AttConverterValue<data_ACCIDENTAL_IMPLICIT> table[] = {
+        { "s", ACCIDENTAL_IMPLICIT_s },
+        { "f", ACCIDENTAL_IMPLICIT_f },
+        { "ss", ACCIDENTAL_IMPLICIT_ss },
+        { "ff", ACCIDENTAL_IMPLICIT_ff },
+        { "n", ACCIDENTAL_IMPLICIT_n },
+        { "su", ACCIDENTAL_IMPLICIT_su },
+        { "sd", ACCIDENTAL_IMPLICIT_sd },
+        { "fu", ACCIDENTAL_IMPLICIT_fu },
+        { "fd", ACCIDENTAL_IMPLICIT_fd }
+    };
+    data_ACCIDENTAL_IMPLICIT data = ACCIDENTAL_IMPLICIT_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.IMPLICIT", value);
     return ACCIDENTAL_IMPLICIT_NONE;
 }
 
@@ -173,44 +214,48 @@ std::string AttConverter::ArticulationToStr(data_ARTICULATION data) const
     return value;
 }
 
-data_ARTICULATION AttConverter::StrToArticulation(std::string value) const
-{
-    if (value == "acc") return ARTICULATION_acc;
-    if (value == "stacc") return ARTICULATION_stacc;
-    if (value == "ten") return ARTICULATION_ten;
-    if (value == "stacciss") return ARTICULATION_stacciss;
-    if (value == "marc") return ARTICULATION_marc;
-    if (value == "marc-stacc") return ARTICULATION_marc_stacc;
-    if (value == "spicc") return ARTICULATION_spicc;
-    if (value == "doit") return ARTICULATION_doit;
-    if (value == "scoop") return ARTICULATION_scoop;
-    if (value == "rip") return ARTICULATION_rip;
-    if (value == "plop") return ARTICULATION_plop;
-    if (value == "fall") return ARTICULATION_fall;
-    if (value == "longfall") return ARTICULATION_longfall;
-    if (value == "bend") return ARTICULATION_bend;
-    if (value == "flip") return ARTICULATION_flip;
-    if (value == "smear") return ARTICULATION_smear;
-    if (value == "shake") return ARTICULATION_shake;
-    if (value == "dnbow") return ARTICULATION_dnbow;
-    if (value == "upbow") return ARTICULATION_upbow;
-    if (value == "harm") return ARTICULATION_harm;
-    if (value == "snap") return ARTICULATION_snap;
-    if (value == "fingernail") return ARTICULATION_fingernail;
-    if (value == "ten-stacc") return ARTICULATION_ten_stacc;
-    if (value == "damp") return ARTICULATION_damp;
-    if (value == "dampall") return ARTICULATION_dampall;
-    if (value == "open") return ARTICULATION_open;
-    if (value == "stop") return ARTICULATION_stop;
-    if (value == "dbltongue") return ARTICULATION_dbltongue;
-    if (value == "trpltongue") return ARTICULATION_trpltongue;
-    if (value == "heel") return ARTICULATION_heel;
-    if (value == "toe") return ARTICULATION_toe;
-    if (value == "tap") return ARTICULATION_tap;
-    if (value == "lhpizz") return ARTICULATION_lhpizz;
-    if (value == "dot") return ARTICULATION_dot;
-    if (value == "stroke") return ARTICULATION_stroke;
-    LogWarning("Unsupported value '%s' for data.ARTICULATION", value.c_str());
+data_ARTICULATION AttConverter::StrToArticulation(const char *value) const
+{
+    static const AttConverterValue<data_ARTICULATION> table[] = {
+        { "acc", ARTICULATION_acc },
+        { "stacc", ARTICULATION_stacc },
+        { "ten", ARTICULATION_ten },
+        { "stacciss", ARTICULATION_stacciss },
+        { "marc", ARTICULATION_marc },
+        { "marc-stacc", ARTICULATION_marc_stacc },
+        { "spicc", ARTICULATION_spicc },
+        { "doit", ARTICULATION_doit },
+        { "scoop", ARTICULATION_scoop },
+        { "rip", ARTICULATION_rip },
+        { "plop", ARTICULATION_plop },
+        { "fall", ARTICULATION_fall },
+        { "longfall", ARTICULATION_longfall },
+        { "bend", ARTICULATION_bend },
+        { "flip", ARTICULATION_flip },
+        { "smear", ARTICULATION_smear },
+        { "shake", ARTICULATION_shake },
+        { "dnbow", ARTICULATION_dnbow },
+        { "upbow", ARTICULATION_upbow },
+        { "harm", ARTICULATION_harm },
+        { "snap", ARTICULATION_snap },
+        { "fingernail", ARTICULATION_fingernail },
+        { "ten-stacc", ARTICULATION_ten_stacc },
+        { "damp", ARTICULATION_damp },
+        { "dampall", ARTICULATION_dampall },
+        { "open", ARTICULATION_open },
+        { "stop", ARTICULATION_stop },
+        { "dbltongue", ARTICULATION_dbltongue },
+        { "trpltongue", ARTICULATION_trpltongue },
+        { "heel", ARTICULATION_heel },
+        { "toe", ARTICULATION_toe },
+        { "tap", ARTICULATION_tap },
+        { "lhpizz", ARTICULATION_lhpizz },
+        { "dot", ARTICULATION_dot },
+        { "stroke", ARTICULATION_stroke }
+    };
+    data_ARTICULATION data = ARTICULATION_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.ARTICULATION", value);
     return ARTICULATION_NONE;
 }
 
@@ -229,12 +274,16 @@ std::string AttConverter::BarplaceToStr(data_BARPLACE data) const
     return value;
 }
 
-data_BARPLACE AttConverter::StrToBarplace(std::string value) const
+data_BARPLACE AttConverter::StrToBarplace(const char *value) const
 {
-    if (value == "mensur") return BARPLACE_mensur;
-    if (value == "staff") return BARPLACE_staff;
-    if (value == "takt") return BARPLACE_takt;
-    LogWarning("Unsupported value '%s' for data.BARPLACE", value.c_str());
+    static const AttConverterValue<data_BARPLACE> table[] = {
+        { "mensur", BARPLACE_mensur },
+        { "staff", BARPLACE_staff },
+        { "takt", BARPLACE_takt }
+    };
+    data_BARPLACE data = BARPLACE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.BARPLACE", value);
     return BARPLACE_NONE;
 }
 
@@ -261,20 +310,24 @@ std::string AttConverter::BarrenditionToStr(data_BARRENDITION data) const
     return value;
 }
 
-data_BARRENDITION AttConverter::StrToBarrendition(std::string value) const
+data_BARRENDITION AttConverter::StrToBarrendition(const char *value) const
 {
-    if (value == "dashed") return BARRENDITION_dashed;
-    if (value == "dotted") return BARRENDITION_dotted;
-    if (value == "dbl") return BARRENDITION_dbl;
-    if (value == "dbldashed") return BARRENDITION_dbldashed;
-    if (value == "dbldotted") return BARRENDITION_dbldotted;
-    if (value == "end") return BARRENDITION_end;
-    if (value == "invis") return BARRENDITION_invis;
-    if (value == "rptstart") return BARRENDITION_rptstart;
-    if (value == "rptboth") return BARRENDITION_rptboth;
-    if (value == "rptend") return BARRENDITION_rptend;
-    if (value == "single") return BARRENDITION_single;
-    LogWarning("Unsupported value '%s' for data.BARRENDITION", value.c_str());
+    static const AttConverterValue<data_BARRENDITION> table[] = {
+        { "dashed", BARRENDITION_dashed },
+        { "dotted", BARRENDITION_dotted },
+        { "dbl", BARRENDITION_dbl },
+        { "dbldashed", BARRENDITION_dbldashed },
+        { "dbldotted", BARRENDITION_dbldotted },
+        { "end", BARRENDITION_end },
+        { "invis", BARRENDITION_invis },
+        { "rptstart", BARRENDITION_rptstart },
+        { "rptboth", BARRENDITION_rptboth },
+        { "rptend", BARRENDITION_rptend },
+        { "single", BARRENDITION_single }
+    };
+    data_BARRENDITION data = BARRENDITION_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.BARRENDITION", value);
     return BARRENDITION_NONE;
 }
 
@@ -303,22 +356,26 @@ std::string AttConverter::BetypeToStr(data_BETYPE data) const
     return value;
 }
 
-data_BETYPE AttConverter::StrToBetype(std::string value) const
+data_BETYPE AttConverter::StrToBetype(const char *value) const
 {
-    if (value == "byte") return BETYPE_byte;
-    if (value == "smil") return BETYPE_smil;
-    if (value == "midi") return BETYPE_midi;
-    if (value == "mmc") return BETYPE_mmc;
-    if (value == "mtc") return BETYPE_mtc;
-    if (value == "smpte-25") return BETYPE_smpte_25;
-    if (value == "smpte-24") return BETYPE_smpte_24;
-    if (value == "smpte-df30") return BETYPE_smpte_df30;
-    if (value == "smpte-ndf30") return BETYPE_smpte_ndf30;
-    if (value == "smpte-df29.97") return BETYPE_smpte_df29_97;
-    if (value == "smpte-ndf29.97") return BETYPE_smpte_ndf29_97;
-    if (value == "tcf") return BETYPE_tcf;
-    if (value == "time") return BETYPE_time;
-    LogWarning("Unsupported value '%s' for data.BETYPE", value.c_str());
+    static const AttConverterValue<data_BETYPE> table[] = {
+        { "byte", BETYPE_byte },
+        { "smil", BETYPE_smil },
+        { "midi", BETYPE_midi },
+        { "mmc", BETYPE_mmc },
+        { "mtc", BETYPE_mtc },
+        { "smpte-25", BETYPE_smpte_25 },
+        { "smpte-24", BETYPE_smpte_24 },
+        { "smpte-df30", BETYPE_smpte_df30 },
+        { "smpte-ndf30", BETYPE_smpte_ndf30 },
+        { "smpte-df29.97", BETYPE_smpte_df29_97 },
+        { "smpte-ndf29.97", BETYPE_smpte_ndf29_97 },
+        { "tcf", BETYPE_tcf },
+        { "time", BETYPE_time }
+    };
+    data_BETYPE data = BETYPE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.BETYPE", value);
     return BETYPE_NONE;
 }
 
@@ -336,11 +393,15 @@ std::string AttConverter::BooleanToStr(data_BOOLEAN data) const
     return value;
 }
 
-data_BOOLEAN AttConverter::StrToBoolean(std::string value) const
+data_BOOLEAN AttConverter::StrToBoolean(const char *value) const
 {
-    if (value == "true") return BOOLEAN_true;
-    if (value == "false") return BOOLEAN_false;
-    LogWarning("Unsupported value '%s' for data.BOOLEAN", value.c_str());
+    static const AttConverterValue<data_BOOLEAN> table[] = {
+        { "true", BOOLEAN_true },
+        { "false", BOOLEAN_false }
+    };
+    data_BOOLEAN data = BOOLEAN_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.BOOLEAN", value);
     return BOOLEAN_NONE;
 }
 
@@ -360,13 +421,17 @@ std::string AttConverter::CertaintyToStr(data_CERTAINTY data) const
     return value;
 }
 
-data_CERTAINTY AttConverter::StrToCertainty(std::string value) const
+data_CERTAINTY AttConverter::StrToCertainty(const char *value) const
 {
-    if (value == "high") return CERTAINTY_high;
-    if (value == "medium") return CERTAINTY_medium;
-    if (value == "low") return CERTAINTY_low;
-    if (value == "unknown") return CERTAINTY_unknown;
-    LogWarning("Unsupported value '%s' for data.CERTAINTY", value.c_str());
+    static const AttConverterValue<data_CERTAINTY> table[] = {
+        { "high", CERTAINTY_high },
+        { "medium", CERTAINTY_medium },
+        { "low", CERTAINTY_low },
+        { "unknown", CERTAINTY_unknown }
+    };
+    data_CERTAINTY data = CERTAINTY_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.CERTAINTY", value);
     return CERTAINTY_NONE;
 }
 
@@ -388,15 +453,19 @@ std::string AttConverter::ClefshapeToStr(data_CLEFSHAPE data) const
     return value;
 }
 
-data_CLEFSHAPE AttConverter::StrToClefshape(std::string value) const
+data_CLEFSHAPE AttConverter::StrToClefshape(const char *value) const
 {
-    if (value == "G") return CLEFSHAPE_G;
-    if (value == "GG") return CLEFSHAPE_GG;
-    if (value == "F") return CLEFSHAPE_F;
-    if (value == "C") return CLEFSHAPE_C;
-    if (value == "perc") return CLEFSHAPE_perc;
-    if (value == "TAB") return CLEFSHAPE_TAB;
-    LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value.c_str());
+    static const AttConverterValue<data_CLEFSHAPE> table[] = {
+        { "G", CLEFSHAPE_G },
+        { "GG", CLEFSHAPE_GG },
+        { "F", CLEFSHAPE_F },
+        { "C", CLEFSHAPE_C },
+        { "perc", CLEFSHAPE_perc },
+        { "TAB", CLEFSHAPE_TAB }
+    };
+    data_CLEFSHAPE data = CLEFSHAPE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value);
     return CLEFSHAPE_NONE;
 }
 
@@ -415,12 +484,16 @@ std::string AttConverter::ClusterToStr(data_CLUSTER data) const
     return value;
 }
 
-data_CLUSTER AttConverter::StrToCluster(std::string value) const
+data_CLUSTER AttConverter::StrToCluster(const char *value) const
 {
-    if (value == "white") return CLUSTER_white;
-    if (value == "black") return CLUSTER_black;
-    if (value == "chromatic") return CLUSTER_chromatic;
-    LogWarning("Unsupported value '%s' for data.CLUSTER", value.c_str());
+    static const AttConverterValue<data_CLUSTER> table[] = {
+        { "white", CLUSTER_white },
+        { "black", CLUSTER_black },
+        { "chromatic", CLUSTER_chromatic }
+    };
+    data_CLUSTER data = CLUSTER_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.CLUSTER", value);
     return CLUSTER_NONE;
 }
 
@@ -452,25 +525,29 @@ std::string AttConverter::ColornamesToStr(data_COLORNAMES data) const
     return value;
 }
 
-data_COLORNAMES AttConverter::StrToColornames(std::string value) const
+data_COLORNAMES AttConverter::StrToColornames(const char *value) const
 {
-    if (value == "aqua") return COLORNAMES_aqua;
-    if (value == "black") return COLORNAMES_black;
-    if (value == "blue") return COLORNAMES_blue;
-    if (value == "fuchsia") return COLORNAMES_fuchsia;
-    if (value == "gray") return COLORNAMES_gray;
-    if (value == "green") return COLORNAMES_green;
-    if (value == "lime") return COLORNAMES_lime;
-    if (value == "maroon") return COLORNAMES_maroon;
-    if (value == "navy") return COLORNAMES_navy;
-    if (value == "olive") return COLORNAMES_olive;
-    if (value == "purple") return COLORNAMES_purple;
-    if (value == "red") return COLORNAMES_red;
-    if (value == "silver") return COLORNAMES_silver;
-    if (value == "teal") return COLORNAMES_teal;
-    if (value == "white") return COLORNAMES_white;
-    if (value == "yellow") return COLORNAMES_yellow;
-    LogWarning("Unsupported value '%s' for data.COLORNAMES", value.c_str());
+    static const AttConverterValue<data_COLORNAMES> table[] = {
+        { "aqua", COLORNAMES_aqua },
+        { "black", COLORNAMES_black },
+        { "blue", COLORNAMES_blue },
+        { "fuchsia", COLORNAMES_fuchsia },
+        { "gray", COLORNAMES_gray },
+        { "green", COLORNAMES_green },
+        { "lime", COLORNAMES_lime },
+        { "maroon", COLORNAMES_maroon },
+        { "navy", COLORNAMES_navy },
+        { "olive", COLORNAMES_olive },
+        { "purple", COLORNAMES_purple },
+        { "red", COLORNAMES_red },
+        { "silver", COLORNAMES_silver },
+        { "teal", COLORNAMES_teal },
+        { "white", COLORNAMES_white },
+        { "yellow", COLORNAMES_yellow }
+    };
+    data_COLORNAMES data = COLORNAMES_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.COLORNAMES", value);
     return COLORNAMES_NONE;
 }
 
@@ -488,11 +565,15 @@ std::string AttConverter::EnclosureToStr(data_ENCLOSURE data) const
     return value;
 }
 
-data_ENCLOSURE AttConverter::StrToEnclosure(std::string value) const
+data_ENCLOSURE AttConverter::StrToEnclosure(const char *value) const
 {
-    if (value == "paren") return ENCLOSURE_paren;
-    if (value == "brack") return ENCLOSURE_brack;
-    LogWarning("Unsupported value '%s' for data.ENCLOSURE", value.c_str());
+    static const AttConverterValue<data_ENCLOSURE> table[] = {
+        { "paren", ENCLOSURE_paren },
+        { "brack", ENCLOSURE_brack }
+    };
+    data_ENCLOSURE data = ENCLOSURE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.ENCLOSURE", value);
     return ENCLOSURE_NONE;
 }
 
@@ -514,15 +595,19 @@ std::string AttConverter::FillToStr(data_FILL data) const
     return value;
 }
 
-data_FILL AttConverter::StrToFill(std::string value) const
+data_FILL AttConverter::StrToFill(const char *value) const
 {
-    if (value == "void") return FILL_void;
-    if (value == "solid") return FILL_solid;
-    if (value == "top") return FILL_top;
-    if (value == "bottom") return FILL_bottom;
-    if (value == "left") return FILL_left;
-    if (value == "right") return FILL_right;
-    LogWarning("Unsupported value '%s' for data.FILL", value.c_str());
+    static const AttConverterValue<data_FILL> table[] = {
+        { "void", FILL_void },
+        { "solid", FILL_solid },
+        { "top", FILL_top },
+        { "bottom", FILL_bottom },
+        { "left", FILL_left },
+        { "right", FILL_right }
+    };
+    data_FILL data = FILL_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.FILL", value);
     return FILL_NONE;
 }
 
@@ -547,18 +632,22 @@ std::string AttConverter::FontsizetermToStr(data_FONTSIZETERM data) const
     return value;
 }
 
-data_FONTSIZETERM AttConverter::StrToFontsizeterm(std::string value) const
+data_FONTSIZETERM AttConverter::StrToFontsizeterm(const char *value) const
 {
-    if (value == "xx-small") return FONTSIZETERM_xx_small;
-    if (value == "x-small") return FONTSIZETERM_x_small;
-    if (value == "small") return FONTSIZETERM_small;
-    if (value == "medium") return FONTSIZETERM_medium;
-    if (value == "large") return FONTSIZETERM_large;
-    if (value == "x-large") return FONTSIZETERM_x_large;
-    if (value == "xx-large") return FONTSIZETERM_xx_large;
-    if (value == "smaller") return FONTSIZETERM_smaller;
-    if (value == "larger") return FONTSIZETERM_larger;
-    LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value.c_str());
+    static const AttConverterValue<data_FONTSIZETERM> table[] = {
+        { "xx-small", FONTSIZETERM_xx_small },
+        { "x-small", FONTSIZETERM_x_small },
+        { "small", FONTSIZETERM_small },
+        { "medium", FONTSIZETERM_medium },
+        { "large", FONTSIZETERM_large },
+        { "x-large", FONTSIZETERM_x_large },
+        { "xx-large", FONTSIZETERM_xx_large },
+        { "smaller", FONTSIZETERM_smaller },
+        { "larger", FONTSIZETERM_larger }
+    };
+    data_FONTSIZETERM data = FONTSIZETERM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value);
     return FONTSIZETERM_NONE;
 }
 
@@ -577,12 +666,16 @@ std::string AttConverter::FontstyleToStr(data_FONTSTYLE data) const
     return value;
 }
 
-data_FONTSTYLE AttConverter::StrToFontstyle(std::string value) const
+data_FONTSTYLE AttConverter::StrToFontstyle(const char *value) const
 {
-    if (value == "italic") return FONTSTYLE_italic;
-    if (value == "normal") return FONTSTYLE_normal;
-    if (value == "oblique") return FONTSTYLE_oblique;
-    LogWarning("Unsupported value '%s' for data.FONTSTYLE", value.c_str());
+    static const AttConverterValue<data_FONTSTYLE> table[] = {
+        { "italic", FONTSTYLE_italic },
+        { "normal", FONTSTYLE_normal },
+        { "oblique", FONTSTYLE_oblique }
+    };
+    data_FONTSTYLE data = FONTSTYLE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.FONTSTYLE", value);
     return FONTSTYLE_NONE;
 }
 
@@ -600,11 +693,15 @@ std::string AttConverter::FontweightToStr(data_FONTWEIGHT data) const
     return value;
 }
 
-data_FONTWEIGHT AttConverter::StrToFontweight(std::string value) const
+data_FONTWEIGHT AttConverter::StrToFontweight(const char *value) const
 {
-    if (value == "bold") return FONTWEIGHT_bold;
-    if (value == "normal") return FONTWEIGHT_normal;
-    LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value.c_str());
+    static const AttConverterValue<data_FONTWEIGHT> table[] = {
+        { "bold", FONTWEIGHT_bold },
+        { "normal", FONTWEIGHT_normal }
+    };
+    data_FONTWEIGHT data = FONTWEIGHT_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value);
     return FONTWEIGHT_NONE;
 }
 
@@ -623,12 +720,16 @@ std::string AttConverter::GlissandoToStr(data_GLISSANDO data) const
     return value;
 }
 
-data_GLISSANDO AttConverter::StrToGlissando(std::string value) const
+data_GLISSANDO AttConverter::StrToGlissando(const char *value) const
 {
-    if (value == "i") return GLISSANDO_i;
-    if (value == "m") return GLISSANDO_m;
-    if (value == "t") return GLISSANDO_t;
-    LogWarning("Unsupported value '%s' for data.GLISSANDO", value.c_str());
+    static const AttConverterValue<data_GLISSANDO> table[] = {
+        { "i", GLISSANDO_i },
+        { "m", GLISSANDO_m },
+        { "t", GLISSANDO_t }
+    };
+    data_GLISSANDO data = GLISSANDO_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.GLISSANDO", value);
     return GLISSANDO_NONE;
 }
 
@@ -647,12 +748,16 @@ std::string AttConverter::GraceToStr(data_GRACE data) const
     return value;
 }
 
-data_GRACE AttConverter::StrToGrace(std::string value) const
+data_GRACE AttConverter::StrToGrace(const char *value) const
 {
-    if (value == "acc") return GRACE_acc;
-    if (value == "unacc") return GRACE_unacc;
-    if (value == "unknown") return GRACE_unknown;
-    LogWarning("Unsupported value '%s' for data.GRACE", value.c_str());
+    static const AttConverterValue<data_GRACE> table[] = {
+        { "acc", GRACE_acc },
+        { "unacc", GRACE_unacc },
+        { "unknown", GRACE_unknown }
+    };
+    data_GRACE data = GRACE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.GRACE", value);
     return GRACE_NONE;
 }
 
@@ -684,25 +789,29 @@ std::string AttConverter::HeadshapeListToStr(data_HEADSHAPE_list data) const
     return value;
 }
 
-data_HEADSHAPE_list AttConverter::StrToHeadshapeList(std::string value) const
+data_HEADSHAPE_list AttConverter::StrToHeadshapeList(const char *value) const
 {
-    if (value == "quarter") return HEADSHAPE_list_quarter;
-    if (value == "half") return HEADSHAPE_list_half;
-    if (value == "whole") return HEADSHAPE_list_whole;
-    if (value == "backslash") return HEADSHAPE_list_backslash;
-    if (value == "circle") return HEADSHAPE_list_circle;
-    if (value == "+") return HEADSHAPE_list_plus;
-    if (value == "diamond") return HEADSHAPE_list_diamond;
-    if (value == "isotriangle") return HEADSHAPE_list_isotriangle;
-    if (value == "oval") return HEADSHAPE_list_oval;
-    if (value == "piewedge") return HEADSHAPE_list_piewedge;
-    if (value == "rectangle") return HEADSHAPE_list_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_list_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_list_semicircle;
-    if (value == "slash") return HEADSHAPE_list_slash;
-    if (value == "square") return HEADSHAPE_list_square;
-    if (value == "x") return HEADSHAPE_list_x;
-    LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value.c_str());
+    static const AttConverterValue<data_HEADSHAPE_list> table[] = {
+        { "quarter", HEADSHAPE_list_quarter },
+        { "half", HEADSHAPE_list_half },
+        { "whole", HEADSHAPE_list_whole },
+        { "backslash", HEADSHAPE_list_backslash },
+        { "circle", HEADSHAPE_list_circle },
+        { "+", HEADSHAPE_list_plus },
+        { "diamond", HEADSHAPE_list_diamond },
+        { "isotriangle", HEADSHAPE_list_isotriangle },
+        { "oval", HEADSHAPE_list_oval },
+        { "piewedge", HEADSHAPE_list_piewedge },
+        { "rectangle", HEADSHAPE_list_rectangle },
+        { "rtriangle", HEADSHAPE_list_rtriangle },
+        { "semicircle", HEADSHAPE_list_semicircle },
+        { "slash", HEADSHAPE_list_slash },
+        { "square", HEADSHAPE_list_square },
+        { "x", HEADSHAPE_list_x }
+    };
+    data_HEADSHAPE_list data = HEADSHAPE_list_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value);
     return HEADSHAPE_list_NONE;
 }
 
@@ -722,13 +831,17 @@ std::string AttConverter::HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data
     return value;
 }
 
-data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(std::string value) const
+data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(const char *value) const
 {
-    if (value == "left") return HORIZONTALALIGNMENT_left;
-    if (value == "right") return HORIZONTALALIGNMENT_right;
-    if (value == "center") return HORIZONTALALIGNMENT_center;
-    if (value == "justify") return HORIZONTALALIGNMENT_justify;
-    LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value.c_str());
+    static const AttConverterValue<data_HORIZONTALALIGNMENT> table[] = {
+        { "left", HORIZONTALALIGNMENT_left },
+        { "right", HORIZONTALALIGNMENT_right },
+        { "center", HORIZONTALALIGNMENT_center },
+        { "justify", HORIZONTALALIGNMENT_justify }
+    };
+    data_HORIZONTALALIGNMENT data = HORIZONTALALIGNMENT_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value);
     return HORIZONTALALIGNMENT_NONE;
 }
 
@@ -749,14 +862,18 @@ std::string AttConverter::IneumeformToStr(data_INEUMEFORM data) const
     return value;
 }
 
-data_INEUMEFORM AttConverter::StrToIneumeform(std::string value) const
+data_INEUMEFORM AttConverter::StrToIneumeform(const char *value) const
 {
-    if (value == "liquescent1") return INEUMEFORM_liquescent1;
-    if (value == "liquescent2") return INEUMEFORM_liquescent2;
-    if (value == "tied") return INEUMEFORM_tied;
-    if (value == "tiedliquescent1") return INEUMEFORM_tiedliquescent1;
-    if (value == "tiedliquescent2") return INEUMEFORM_tiedliquescent2;
-    LogWarning("Unsupported value '%s' for data.INEUMEFORM", value.c_str());
+    static const AttConverterValue<data_INEUMEFORM> table[] = {
+        { "liquescent1", INEUMEFORM_liquescent1 },
+        { "liquescent2", INEUMEFORM_liquescent2 },
+        { "tied", INEUMEFORM_tied },
+        { "tiedliquescent1", INEUMEFORM_tiedliquescent1 },
+        { "tiedliquescent2", INEUMEFORM_tiedliquescent2 }
+    };
+    data_INEUMEFORM data = INEUMEFORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.INEUMEFORM", value);
     return INEUMEFORM_NONE;
 }
 
@@ -779,16 +896,20 @@ std::string AttConverter::IneumenameToStr(data_INEUMENAME data) const
     return value;
 }
 
-data_INEUMENAME AttConverter::StrToIneumename(std::string value) const
+data_INEUMENAME AttConverter::StrToIneumename(const char *value) const
 {
-    if (value == "pessubpunctis") return INEUMENAME_pessubpunctis;
-    if (value == "climacus") return INEUMENAME_climacus;
-    if (value == "scandicus") return INEUMENAME_scandicus;
-    if (value == "bistropha") return INEUMENAME_bistropha;
-    if (value == "tristropha") return INEUMENAME_tristropha;
-    if (value == "pressusminor") return INEUMENAME_pressusminor;
-    if (value == "pressusmaior") return INEUMENAME_pressusmaior;
-    LogWarning("Unsupported value '%s' for data.INEUMENAME", value.c_str());
+    static const AttConverterValue<data_INEUMENAME> table[] = {
+        { "pessubpunctis", INEUMENAME_pessubpunctis },
+        { "climacus", INEUMENAME_climacus },
+        { "scandicus", INEUMENAME_scandicus },
+        { "bistropha", INEUMENAME_bistropha },
+        { "tristropha", INEUMENAME_tristropha },
+        { "pressusminor", INEUMENAME_pressusminor },
+        { "pressusmaior", INEUMENAME_pressusmaior }
+    };
+    data_INEUMENAME data = INEUMENAME_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.INEUMENAME", value);
     return INEUMENAME_NONE;
 }
 
@@ -809,14 +930,18 @@ std::string AttConverter::LayerschemeToStr(data_LAYERSCHEME data) const
     return value;
 }
 
-data_LAYERSCHEME AttConverter::StrToLayerscheme(std::string value) const
+data_LAYERSCHEME AttConverter::StrToLayerscheme(const char *value) const
 {
-    if (value == "1") return LAYERSCHEME_1;
-    if (value == "2o") return LAYERSCHEME_2o;
-    if (value == "2f") return LAYERSCHEME_2f;
-    if (value == "3o") return LAYERSCHEME_3o;
-    if (value == "3f") return LAYERSCHEME_3f;
-    LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value.c_str());
+    static const AttConverterValue<data_LAYERSCHEME> table[] = {
+        { "1", LAYERSCHEME_1 },
+        { "2o", LAYERSCHEME_2o },
+        { "2f", LAYERSCHEME_2f },
+        { "3o", LAYERSCHEME_3o },
+        { "3f", LAYERSCHEME_3f }
+    };
+    data_LAYERSCHEME data = LAYERSCHEME_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value);
     return LAYERSCHEME_NONE;
 }
 
@@ -834,11 +959,15 @@ std::string AttConverter::LigatureformToStr(data_LIGATUREFORM data) const
     return value;
 }
 
-data_LIGATUREFORM AttConverter::StrToLigatureform(std::string value) const
+data_LIGATUREFORM AttConverter::StrToLigatureform(const char *value) const
 {
-    if (value == "recta") return LIGATUREFORM_recta;
-    if (value == "obliqua") return LIGATUREFORM_obliqua;
-    LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value.c_str());
+    static const AttConverterValue<data_LIGATUREFORM> table[] = {
+        { "recta", LIGATUREFORM_recta },
+        { "obliqua", LIGATUREFORM_obliqua }
+    };
+    data_LIGATUREFORM data = LIGATUREFORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value);
     return LIGATUREFORM_NONE;
 }
 
@@ -858,13 +987,17 @@ std::string AttConverter::LineformToStr(data_LINEFORM data) const
     return value;
 }
 
-data_LINEFORM AttConverter::StrToLineform(std::string value) const
+data_LINEFORM AttConverter::StrToLineform(const char *value) const
 {
-    if (value == "dashed") return LINEFORM_dashed;
-    if (value == "dotted") return LINEFORM_dotted;
-    if (value == "solid") return LINEFORM_solid;
-    if (value == "wavy") return LINEFORM_wavy;
-    LogWarning("Unsupported value '%s' for data.LINEFORM", value.c_str());
+    static const AttConverterValue<data_LINEFORM> table[] = {
+        { "dashed", LINEFORM_dashed },
+        { "dotted", LINEFORM_dotted },
+        { "solid", LINEFORM_solid },
+        { "wavy", LINEFORM_wavy }
+    };
+    data_LINEFORM data = LINEFORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.LINEFORM", value);
     return LINEFORM_NONE;
 }
 
@@ -890,19 +1023,23 @@ std::string AttConverter::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data)
     return value;
 }
 
-data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(std::string value) const
+data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(const char *value) const
 {
-    if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
-    if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
-    if (value == "angleright") return LINESTARTENDSYMBOL_angleright;
-    if (value == "angleleft") return LINESTARTENDSYMBOL_angleleft;
-    if (value == "arrow") return LINESTARTENDSYMBOL_arrow;
-    if (value == "arrowopen") return LINESTARTENDSYMBOL_arrowopen;
-    if (value == "arrowwhite") return LINESTARTENDSYMBOL_arrowwhite;
-    if (value == "harpoonleft") return LINESTARTENDSYMBOL_harpoonleft;
-    if (value == "harpoonright") return LINESTARTENDSYMBOL_harpoonright;
-    if (value == "none") return LINESTARTENDSYMBOL_none;
-    LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value.c_str());
+    static const AttConverterValue<data_LINESTARTENDSYMBOL> table[] = {
+        { "angledown", LINESTARTENDSYMBOL_angledown },
+        { "angleup", LINESTARTENDSYMBOL_angleup },
+        { "angleright", LINESTARTENDSYMBOL_angleright },
+        { "angleleft", LINESTARTENDSYMBOL_angleleft },
+        { "arrow", LINESTARTENDSYMBOL_arrow },
+        { "arrowopen", LINESTARTENDSYMBOL_arrowopen },
+        { "arrowwhite", LINESTARTENDSYMBOL_arrowwhite },
+        { "harpoonleft", LINESTARTENDSYMBOL_harpoonleft },
+        { "harpoonright", LINESTARTENDSYMBOL_harpoonright },
+        { "none", LINESTARTENDSYMBOL_none }
+    };
+    data_LINESTARTENDSYMBOL data = LINESTARTENDSYMBOL_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value);
     return LINESTARTENDSYMBOL_NONE;
 }
 
@@ -921,12 +1058,16 @@ std::string AttConverter::LinewidthtermToStr(data_LINEWIDTHTERM data) const
     return value;
 }
 
-data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(std::string value) const
+data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(const char *value) const
 {
-    if (value == "narrow") return LINEWIDTHTERM_narrow;
-    if (value == "medium") return LINEWIDTHTERM_medium;
-    if (value == "wide") return LINEWIDTHTERM_wide;
-    LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value.c_str());
+    static const AttConverterValue<data_LINEWIDTHTERM> table[] = {
+        { "narrow", LINEWIDTHTERM_narrow },
+        { "medium", LINEWIDTHTERM_medium },
+        { "wide", LINEWIDTHTERM_wide }
+    };
+    data_LINEWIDTHTERM data = LINEWIDTHTERM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value);
     return LINEWIDTHTERM_NONE;
 }
 
@@ -970,37 +1111,41 @@ std::string AttConverter::MelodicfunctionToStr(data_MELODICFUNCTION data) const
     return value;
 }
 
-data_MELODICFUNCTION AttConverter::StrToMelodicfunction(std::string value) const
-{
-    if (value == "aln") return MELODICFUNCTION_aln;
-    if (value == "ant") return MELODICFUNCTION_ant;
-    if (value == "app") return MELODICFUNCTION_app;
-    if (value == "apt") return MELODICFUNCTION_apt;
-    if (value == "arp") return MELODICFUNCTION_arp;
-    if (value == "arp7") return MELODICFUNCTION_arp7;
-    if (value == "aun") return MELODICFUNCTION_aun;
-    if (value == "chg") return MELODICFUNCTION_chg;
-    if (value == "cln") return MELODICFUNCTION_cln;
-    if (value == "ct") return MELODICFUNCTION_ct;
-    if (value == "ct7") return MELODICFUNCTION_ct7;
-    if (value == "cun") return MELODICFUNCTION_cun;
-    if (value == "cup") return MELODICFUNCTION_cup;
-    if (value == "et") return MELODICFUNCTION_et;
-    if (value == "ln") return MELODICFUNCTION_ln;
-    if (value == "ped") return MELODICFUNCTION_ped;
-    if (value == "rep") return MELODICFUNCTION_rep;
-    if (value == "ret") return MELODICFUNCTION_ret;
-    if (value == "23ret") return MELODICFUNCTION_23ret;
-    if (value == "78ret") return MELODICFUNCTION_78ret;
-    if (value == "sus") return MELODICFUNCTION_sus;
-    if (value == "43sus") return MELODICFUNCTION_43sus;
-    if (value == "98sus") return MELODICFUNCTION_98sus;
-    if (value == "76sus") return MELODICFUNCTION_76sus;
-    if (value == "un") return MELODICFUNCTION_un;
-    if (value == "un7") return MELODICFUNCTION_un7;
-    if (value == "upt") return MELODICFUNCTION_upt;
-    if (value == "upt7") return MELODICFUNCTION_upt7;
-    LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value.c_str());
+data_MELODICFUNCTION AttConverter::StrToMelodicfunction(const char *value) const
+{
+    static const AttConverterValue<data_MELODICFUNCTION> table[] = {
+        { "aln", MELODICFUNCTION_aln },
+        { "ant", MELODICFUNCTION_ant },
+        { "app", MELODICFUNCTION_app },
+        { "apt", MELODICFUNCTION_apt },
+        { "arp", MELODICFUNCTION_arp },
+        { "arp7", MELODICFUNCTION_arp7 },
+        { "aun", MELODICFUNCTION_aun },
+        { "chg", MELODICFUNCTION_chg },
+        { "cln", MELODICFUNCTION_cln },
+        { "ct", MELODICFUNCTION_ct },
+        { "ct7", MELODICFUNCTION_ct7 },
+        { "cun", MELODICFUNCTION_cun },
+        { "cup", MELODICFUNCTION_cup },
+        { "et", MELODICFUNCTION_et },
+        { "ln", MELODICFUNCTION_ln },
+        { "ped", MELODICFUNCTION_ped },
+        { "rep", MELODICFUNCTION_rep },
+        { "ret", MELODICFUNCTION_ret },
+        { "23ret", MELODICFUNCTION_23ret },
+        { "78ret", MELODICFUNCTION_78ret },
+        { "sus", MELODICFUNCTION_sus },
+        { "43sus", MELODICFUNCTION_43sus },
+        { "98sus", MELODICFUNCTION_98sus },
+        { "76sus", MELODICFUNCTION_76sus },
+        { "un", MELODICFUNCTION_un },
+        { "un7", MELODICFUNCTION_un7 },
+        { "upt", MELODICFUNCTION_upt },
+        { "upt7", MELODICFUNCTION_upt7 }
+    };
+    data_MELODICFUNCTION data = MELODICFUNCTION_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value);
     return MELODICFUNCTION_NONE;
 }
 
@@ -1018,11 +1163,15 @@ std::string AttConverter::MensurationsignToStr(data_MENSURATIONSIGN data) const
     return value;
 }
 
-data_MENSURATIONSIGN AttConverter::StrToMensurationsign(std::string value) const
+data_MENSURATIONSIGN AttConverter::StrToMensurationsign(const char *value) const
 {
-    if (value == "C") return MENSURATIONSIGN_C;
-    if (value == "O") return MENSURATIONSIGN_O;
-    LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value.c_str());
+    static const AttConverterValue<data_MENSURATIONSIGN> table[] = {
+        { "C", MENSURATIONSIGN_C },
+        { "O", MENSURATIONSIGN_O }
+    };
+    data_MENSURATIONSIGN data = MENSURATIONSIGN_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value);
     return MENSURATIONSIGN_NONE;
 }
 
@@ -1040,11 +1189,15 @@ std::string AttConverter::MetersignToStr(data_METERSIGN data) const
     return value;
 }
 
-data_METERSIGN AttConverter::StrToMetersign(std::string value) const
+data_METERSIGN AttConverter::StrToMetersign(const char *value) const
 {
-    if (value == "common") return METERSIGN_common;
-    if (value == "cut") return METERSIGN_cut;
-    LogWarning("Unsupported value '%s' for data.METERSIGN", value.c_str());
+    static const AttConverterValue<data_METERSIGN> table[] = {
+        { "common", METERSIGN_common },
+        { "cut", METERSIGN_cut }
+    };
+    data_METERSIGN data = METERSIGN_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.METERSIGN", value);
     return METERSIGN_NONE;
 }
 
@@ -1235,184 +1388,188 @@ std::string AttConverter::MidinamesToStr(data_MIDINAMES data) const
     return value;
 }
 
-data_MIDINAMES AttConverter::StrToMidinames(std::string value) const
-{
-    if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
-    if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
-    if (value == "Electric_Grand_Piano") return MIDINAMES_Electric_Grand_Piano;
-    if (value == "Honky-tonk_Piano") return MIDINAMES_Honky_tonk_Piano;
-    if (value == "Electric_Piano_1") return MIDINAMES_Electric_Piano_1;
-    if (value == "Electric_Piano_2") return MIDINAMES_Electric_Piano_2;
-    if (value == "Harpsichord") return MIDINAMES_Harpsichord;
-    if (value == "Clavi") return MIDINAMES_Clavi;
-    if (value == "Celesta") return MIDINAMES_Celesta;
-    if (value == "Glockenspiel") return MIDINAMES_Glockenspiel;
-    if (value == "Music_Box") return MIDINAMES_Music_Box;
-    if (value == "Vibraphone") return MIDINAMES_Vibraphone;
-    if (value == "Marimba") return MIDINAMES_Marimba;
-    if (value == "Xylophone") return MIDINAMES_Xylophone;
-    if (value == "Tubular_Bells") return MIDINAMES_Tubular_Bells;
-    if (value == "Dulcimer") return MIDINAMES_Dulcimer;
-    if (value == "Drawbar_Organ") return MIDINAMES_Drawbar_Organ;
-    if (value == "Percussive_Organ") return MIDINAMES_Percussive_Organ;
-    if (value == "Rock_Organ") return MIDINAMES_Rock_Organ;
-    if (value == "Church_Organ") return MIDINAMES_Church_Organ;
-    if (value == "Reed_Organ") return MIDINAMES_Reed_Organ;
-    if (value == "Accordion") return MIDINAMES_Accordion;
-    if (value == "Harmonica") return MIDINAMES_Harmonica;
-    if (value == "Tango_Accordion") return MIDINAMES_Tango_Accordion;
-    if (value == "Acoustic_Guitar_nylon") return MIDINAMES_Acoustic_Guitar_nylon;
-    if (value == "Acoustic_Guitar_steel") return MIDINAMES_Acoustic_Guitar_steel;
-    if (value == "Electric_Guitar_jazz") return MIDINAMES_Electric_Guitar_jazz;
-    if (value == "Electric_Guitar_clean") return MIDINAMES_Electric_Guitar_clean;
-    if (value == "Electric_Guitar_muted") return MIDINAMES_Electric_Guitar_muted;
-    if (value == "Overdriven_Guitar") return MIDINAMES_Overdriven_Guitar;
-    if (value == "Distortion_Guitar") return MIDINAMES_Distortion_Guitar;
-    if (value == "Guitar_harmonics") return MIDINAMES_Guitar_harmonics;
-    if (value == "Acoustic_Bass") return MIDINAMES_Acoustic_Bass;
-    if (value == "Electric_Bass_finger") return MIDINAMES_Electric_Bass_finger;
-    if (value == "Electric_Bass_pick") return MIDINAMES_Electric_Bass_pick;
-    if (value == "Fretless_Bass") return MIDINAMES_Fretless_Bass;
-    if (value == "Slap_Bass_1") return MIDINAMES_Slap_Bass_1;
-    if (value == "Slap_Bass_2") return MIDINAMES_Slap_Bass_2;
-    if (value == "Synth_Bass_1") return MIDINAMES_Synth_Bass_1;
-    if (value == "Synth_Bass_2") return MIDINAMES_Synth_Bass_2;
-    if (value == "Violin") return MIDINAMES_Violin;
-    if (value == "Viola") return MIDINAMES_Viola;
-    if (value == "Cello") return MIDINAMES_Cello;
-    if (value == "Contrabass") return MIDINAMES_Contrabass;
-    if (value == "Tremolo_Strings") return MIDINAMES_Tremolo_Strings;
-    if (value == "Pizzicato_Strings") return MIDINAMES_Pizzicato_Strings;
-    if (value == "Orchestral_Harp") return MIDINAMES_Orchestral_Harp;
-    if (value == "Timpani") return MIDINAMES_Timpani;
-    if (value == "String_Ensemble_1") return MIDINAMES_String_Ensemble_1;
-    if (value == "String_Ensemble_2") return MIDINAMES_String_Ensemble_2;
-    if (value == "SynthStrings_1") return MIDINAMES_SynthStrings_1;
-    if (value == "SynthStrings_2") return MIDINAMES_SynthStrings_2;
-    if (value == "Choir_Aahs") return MIDINAMES_Choir_Aahs;
-    if (value == "Voice_Oohs") return MIDINAMES_Voice_Oohs;
-    if (value == "Synth_Voice") return MIDINAMES_Synth_Voice;
-    if (value == "Orchestra_Hit") return MIDINAMES_Orchestra_Hit;
-    if (value == "Trumpet") return MIDINAMES_Trumpet;
-    if (value == "Trombone") return MIDINAMES_Trombone;
-    if (value == "Tuba") return MIDINAMES_Tuba;
-    if (value == "Muted_Trumpet") return MIDINAMES_Muted_Trumpet;
-    if (value == "French_Horn") return MIDINAMES_French_Horn;
-    if (value == "Brass_Section") return MIDINAMES_Brass_Section;
-    if (value == "SynthBrass_1") return MIDINAMES_SynthBrass_1;
-    if (value == "SynthBrass_2") return MIDINAMES_SynthBrass_2;
-    if (value == "Soprano_Sax") return MIDINAMES_Soprano_Sax;
-    if (value == "Alto_Sax") return MIDINAMES_Alto_Sax;
-    if (value == "Tenor_Sax") return MIDINAMES_Tenor_Sax;
-    if (value == "Baritone_Sax") return MIDINAMES_Baritone_Sax;
-    if (value == "Oboe") return MIDINAMES_Oboe;
-    if (value == "English_Horn") return MIDINAMES_English_Horn;
-    if (value == "Bassoon") return MIDINAMES_Bassoon;
-    if (value == "Clarinet") return MIDINAMES_Clarinet;
-    if (value == "Piccolo") return MIDINAMES_Piccolo;
-    if (value == "Flute") return MIDINAMES_Flute;
-    if (value == "Recorder") return MIDINAMES_Recorder;
-    if (value == "Pan_Flute") return MIDINAMES_Pan_Flute;
-    if (value == "Blown_Bottle") return MIDINAMES_Blown_Bottle;
-    if (value == "Shakuhachi") return MIDINAMES_Shakuhachi;
-    if (value == "Whistle") return MIDINAMES_Whistle;
-    if (value == "Ocarina") return MIDINAMES_Ocarina;
-    if (value == "Lead_1_square") return MIDINAMES_Lead_1_square;
-    if (value == "Lead_2_sawtooth") return MIDINAMES_Lead_2_sawtooth;
-    if (value == "Lead_3_calliope") return MIDINAMES_Lead_3_calliope;
-    if (value == "Lead_4_chiff") return MIDINAMES_Lead_4_chiff;
-    if (value == "Lead_5_charang") return MIDINAMES_Lead_5_charang;
-    if (value == "Lead_6_voice") return MIDINAMES_Lead_6_voice;
-    if (value == "Lead_7_fifths") return MIDINAMES_Lead_7_fifths;
-    if (value == "Lead_8_bass_and_lead") return MIDINAMES_Lead_8_bass_and_lead;
-    if (value == "Pad_1_new_age") return MIDINAMES_Pad_1_new_age;
-    if (value == "Pad_2_warm") return MIDINAMES_Pad_2_warm;
-    if (value == "Pad_3_polysynth") return MIDINAMES_Pad_3_polysynth;
-    if (value == "Pad_4_choir") return MIDINAMES_Pad_4_choir;
-    if (value == "Pad_5_bowed") return MIDINAMES_Pad_5_bowed;
-    if (value == "Pad_6_metallic") return MIDINAMES_Pad_6_metallic;
-    if (value == "Pad_7_halo") return MIDINAMES_Pad_7_halo;
-    if (value == "Pad_8_sweep") return MIDINAMES_Pad_8_sweep;
-    if (value == "FX_1_rain") return MIDINAMES_FX_1_rain;
-    if (value == "FX_2_soundtrack") return MIDINAMES_FX_2_soundtrack;
-    if (value == "FX_3_crystal") return MIDINAMES_FX_3_crystal;
-    if (value == "FX_4_atmosphere") return MIDINAMES_FX_4_atmosphere;
-    if (value == "FX_5_brightness") return MIDINAMES_FX_5_brightness;
-    if (value == "FX_6_goblins") return MIDINAMES_FX_6_goblins;
-    if (value == "FX_7_echoes") return MIDINAMES_FX_7_echoes;
-    if (value == "FX_8_sci-fi") return MIDINAMES_FX_8_sci_fi;
-    if (value == "Sitar") return MIDINAMES_Sitar;
-    if (value == "Banjo") return MIDINAMES_Banjo;
-    if (value == "Shamisen") return MIDINAMES_Shamisen;
-    if (value == "Koto") return MIDINAMES_Koto;
-    if (value == "Kalimba") return MIDINAMES_Kalimba;
-    if (value == "Bagpipe") return MIDINAMES_Bagpipe;
-    if (value == "Fiddle") return MIDINAMES_Fiddle;
-    if (value == "Shanai") return MIDINAMES_Shanai;
-    if (value == "Tinkle_Bell") return MIDINAMES_Tinkle_Bell;
-    if (value == "Agogo") return MIDINAMES_Agogo;
-    if (value == "Steel_Drums") return MIDINAMES_Steel_Drums;
-    if (value == "Woodblock") return MIDINAMES_Woodblock;
-    if (value == "Taiko_Drum") return MIDINAMES_Taiko_Drum;
-    if (value == "Melodic_Tom") return MIDINAMES_Melodic_Tom;
-    if (value == "Synth_Drum") return MIDINAMES_Synth_Drum;
-    if (value == "Reverse_Cymbal") return MIDINAMES_Reverse_Cymbal;
-    if (value == "Guitar_Fret_Noise") return MIDINAMES_Guitar_Fret_Noise;
-    if (value == "Breath_Noise") return MIDINAMES_Breath_Noise;
-    if (value == "Seashore") return MIDINAMES_Seashore;
-    if (value == "Bird_Tweet") return MIDINAMES_Bird_Tweet;
-    if (value == "Telephone_Ring") return MIDINAMES_Telephone_Ring;
-    if (value == "Helicopter") return MIDINAMES_Helicopter;
-    if (value == "Applause") return MIDINAMES_Applause;
-    if (value == "Gunshot") return MIDINAMES_Gunshot;
-    if (value == "Acoustic_Bass_Drum") return MIDINAMES_Acoustic_Bass_Drum;
-    if (value == "Bass_Drum_1") return MIDINAMES_Bass_Drum_1;
-    if (value == "Side_Stick") return MIDINAMES_Side_Stick;
-    if (value == "Acoustic_Snare") return MIDINAMES_Acoustic_Snare;
-    if (value == "Hand_Clap") return MIDINAMES_Hand_Clap;
-    if (value == "Electric_Snare") return MIDINAMES_Electric_Snare;
-    if (value == "Low_Floor_Tom") return MIDINAMES_Low_Floor_Tom;
-    if (value == "Closed_Hi_Hat") return MIDINAMES_Closed_Hi_Hat;
-    if (value == "High_Floor_Tom") return MIDINAMES_High_Floor_Tom;
-    if (value == "Pedal_Hi-Hat") return MIDINAMES_Pedal_Hi_Hat;
-    if (value == "Low_Tom") return MIDINAMES_Low_Tom;
-    if (value == "Open_Hi-Hat") return MIDINAMES_Open_Hi_Hat;
-    if (value == "Low-Mid_Tom") return MIDINAMES_Low_Mid_Tom;
-    if (value == "Hi-Mid_Tom") return MIDINAMES_Hi_Mid_Tom;
-    if (value == "Crash_Cymbal_1") return MIDINAMES_Crash_Cymbal_1;
-    if (value == "High_Tom") return MIDINAMES_High_Tom;
-    if (value == "Ride_Cymbal_1") return MIDINAMES_Ride_Cymbal_1;
-    if (value == "Chinese_Cymbal") return MIDINAMES_Chinese_Cymbal;
-    if (value == "Ride_Bell") return MIDINAMES_Ride_Bell;
-    if (value == "Tambourine") return MIDINAMES_Tambourine;
-    if (value == "Splash_Cymbal") return MIDINAMES_Splash_Cymbal;
-    if (value == "Cowbell") return MIDINAMES_Cowbell;
-    if (value == "Crash_Cymbal_2") return MIDINAMES_Crash_Cymbal_2;
-    if (value == "Vibraslap") return MIDINAMES_Vibraslap;
-    if (value == "Ride_Cymbal_2") return MIDINAMES_Ride_Cymbal_2;
-    if (value == "Hi_Bongo") return MIDINAMES_Hi_Bongo;
-    if (value == "Low_Bongo") return MIDINAMES_Low_Bongo;
-    if (value == "Mute_Hi_Conga") return MIDINAMES_Mute_Hi_Conga;
-    if (value == "Open_Hi_Conga") return MIDINAMES_Open_Hi_Conga;
-    if (value == "Low_Conga") return MIDINAMES_Low_Conga;
-    if (value == "High_Timbale") return MIDINAMES_High_Timbale;
-    if (value == "Low_Timbale") return MIDINAMES_Low_Timbale;
-    if (value == "High_Agogo") return MIDINAMES_High_Agogo;
-    if (value == "Low_Agogo") return MIDINAMES_Low_Agogo;
-    if (value == "Cabasa") return MIDINAMES_Cabasa;
-    if (value == "Maracas") return MIDINAMES_Maracas;
-    if (value == "Short_Whistle") return MIDINAMES_Short_Whistle;
-    if (value == "Long_Whistle") return MIDINAMES_Long_Whistle;
-    if (value == "Short_Guiro") return MIDINAMES_Short_Guiro;
-    if (value == "Long_Guiro") return MIDINAMES_Long_Guiro;
-    if (value == "Claves") return MIDINAMES_Claves;
-    if (value == "Hi_Wood_Block") return MIDINAMES_Hi_Wood_Block;
-    if (value == "Low_Wood_Block") return MIDINAMES_Low_Wood_Block;
-    if (value == "Mute_Cuica") return MIDINAMES_Mute_Cuica;
-    if (value == "Open_Cuica") return MIDINAMES_Open_Cuica;
-    if (value == "Mute_Triangle") return MIDINAMES_Mute_Triangle;
-    if (value == "Open_Triangle") return MIDINAMES_Open_Triangle;
-    LogWarning("Unsupported value '%s' for data.MIDINAMES", value.c_str());
+data_MIDINAMES AttConverter::StrToMidinames(const char *value) const
+{
+    static const AttConverterValue<data_MIDINAMES> table[] = {
+        { "Acoustic_Grand_Piano", MIDINAMES_Acoustic_Grand_Piano },
+        { "Bright_Acoustic_Piano", MIDINAMES_Bright_Acoustic_Piano },
+        { "Electric_Grand_Piano", MIDINAMES_Electric_Grand_Piano },
+        { "Honky-tonk_Piano", MIDINAMES_Honky_tonk_Piano },
+        { "Electric_Piano_1", MIDINAMES_Electric_Piano_1 },
+        { "Electric_Piano_2", MIDINAMES_Electric_Piano_2 },
+        { "Harpsichord", MIDINAMES_Harpsichord },
+        { "Clavi", MIDINAMES_Clavi },
+        { "Celesta", MIDINAMES_Celesta },
+        { "Glockenspiel", MIDINAMES_Glockenspiel },
+        { "Music_Box", MIDINAMES_Music_Box },
+        { "Vibraphone", MIDINAMES_Vibraphone },
+        { "Marimba", MIDINAMES_Marimba },
+        { "Xylophone", MIDINAMES_Xylophone },
+        { "Tubular_Bells", MIDINAMES_Tubular_Bells },
+        { "Dulcimer", MIDINAMES_Dulcimer },
+        { "Drawbar_Organ", MIDINAMES_Drawbar_Organ },
+        { "Percussive_Organ", MIDINAMES_Percussive_Organ },
+        { "Rock_Organ", MIDINAMES_Rock_Organ },
+        { "Church_Organ", MIDINAMES_Church_Organ },
+        { "Reed_Organ", MIDINAMES_Reed_Organ },
+        { "Accordion", MIDINAMES_Accordion },
+        { "Harmonica", MIDINAMES_Harmonica },
+        { "Tango_Accordion", MIDINAMES_Tango_Accordion },
+        { "Acoustic_Guitar_nylon", MIDINAMES_Acoustic_Guitar_nylon },
+        { "Acoustic_Guitar_steel", MIDINAMES_Acoustic_Guitar_steel },
+        { "Electric_Guitar_jazz", MIDINAMES_Electric_Guitar_jazz },
+        { "Electric_Guitar_clean", MIDINAMES_Electric_Guitar_clean },
+        { "Electric_Guitar_muted", MIDINAMES_Electric_Guitar_muted },
+        { "Overdriven_Guitar", MIDINAMES_Overdriven_Guitar },
+        { "Distortion_Guitar", MIDINAMES_Distortion_Guitar },
+        { "Guitar_harmonics", MIDINAMES_Guitar_harmonics },
+        { "Acoustic_Bass", MIDINAMES_Acoustic_Bass },
+        { "Electric_Bass_finger", MIDINAMES_Electric_Bass_finger },
+        { "Electric_Bass_pick", MIDINAMES_Electric_Bass_pick },
+        { "Fretless_Bass", MIDINAMES_Fretless_Bass },
+        { "Slap_Bass_1", MIDINAMES_Slap_Bass_1 },
+        { "Slap_Bass_2", MIDINAMES_Slap_Bass_2 },
+        { "Synth_Bass_1", MIDINAMES_Synth_Bass_1 },
+        { "Synth_Bass_2", MIDINAMES_Synth_Bass_2 },
+        { "Violin", MIDINAMES_Violin },
+        { "Viola", MIDINAMES_Viola },
+        { "Cello", MIDINAMES_Cello },
+        { "Contrabass", MIDINAMES_Contrabass },
+        { "Tremolo_Strings", MIDINAMES_Tremolo_Strings },
+        { "Pizzicato_Strings", MIDINAMES_Pizzicato_Strings },
+        { "Orchestral_Harp", MIDINAMES_Orchestral_Harp },
+        { "Timpani", MIDINAMES_Timpani },
+        { "String_Ensemble_1", MIDINAMES_String_Ensemble_1 },
+        { "String_Ensemble_2", MIDINAMES_String_Ensemble_2 },
+        { "SynthStrings_1", MIDINAMES_SynthStrings_1 },
+        { "SynthStrings_2", MIDINAMES_SynthStrings_2 },
+        { "Choir_Aahs", MIDINAMES_Choir_Aahs },
+        { "Voice_Oohs", MIDINAMES_Voice_Oohs },
+        { "Synth_Voice", MIDINAMES_Synth_Voice },
+        { "Orchestra_Hit", MIDINAMES_Orchestra_Hit },
+        { "Trumpet", MIDINAMES_Trumpet },
+        { "Trombone", MIDINAMES_Trombone },
+        { "Tuba", MIDINAMES_Tuba },
+        { "Muted_Trumpet", MIDINAMES_Muted_Trumpet },
+        { "French_Horn", MIDINAMES_French_Horn },
+        { "Brass_Section", MIDINAMES_Brass_Section },
+        { "SynthBrass_1", MIDINAMES_SynthBrass_1 },
+        { "SynthBrass_2", MIDINAMES_SynthBrass_2 },
+        { "Soprano_Sax", MIDINAMES_Soprano_Sax },
+        { "Alto_Sax", MIDINAMES_Alto_Sax },
+        { "Tenor_Sax", MIDINAMES_Tenor_Sax },
+        { "Baritone_Sax", MIDINAMES_Baritone_Sax },
+        { "Oboe", MIDINAMES_Oboe },
+        { "English_Horn", MIDINAMES_English_Horn },
+        { "Bassoon", MIDINAMES_Bassoon },
+        { "Clarinet", MIDINAMES_Clarinet },
+        { "Piccolo", MIDINAMES_Piccolo },
+        { "Flute", MIDINAMES_Flute },
+        { "Recorder", MIDINAMES_Recorder },
+        { "Pan_Flute", MIDINAMES_Pan_Flute },
+        { "Blown_Bottle", MIDINAMES_Blown_Bottle },
+        { "Shakuhachi", MIDINAMES_Shakuhachi },
+        { "Whistle", MIDINAMES_Whistle },
+        { "Ocarina", MIDINAMES_Ocarina },
+        { "Lead_1_square", MIDINAMES_Lead_1_square },
+        { "Lead_2_sawtooth", MIDINAMES_Lead_2_sawtooth },
+        { "Lead_3_calliope", MIDINAMES_Lead_3_calliope },
+        { "Lead_4_chiff", MIDINAMES_Lead_4_chiff },
+        { "Lead_5_charang", MIDINAMES_Lead_5_charang },
+        { "Lead_6_voice", MIDINAMES_Lead_6_voice },
+        { "Lead_7_fifths", MIDINAMES_Lead_7_fifths },
+        { "Lead_8_bass_and_lead", MIDINAMES_Lead_8_bass_and_lead },
+        { "Pad_1_new_age", MIDINAMES_Pad_1_new_age },
+        { "Pad_2_warm", MIDINAMES_Pad_2_warm },
+        { "Pad_3_polysynth", MIDINAMES_Pad_3_polysynth },
+        { "Pad_4_choir", MIDINAMES_Pad_4_choir },
+        { "Pad_5_bowed", MIDINAMES_Pad_5_bowed },
+        { "Pad_6_metallic", MIDINAMES_Pad_6_metallic },
+        { "Pad_7_halo", MIDINAMES_Pad_7_halo },
+        { "Pad_8_sweep", MIDINAMES_Pad_8_sweep },
+        { "FX_1_rain", MIDINAMES_FX_1_rain },
+        { "FX_2_soundtrack", MIDINAMES_FX_2_soundtrack },
+        { "FX_3_crystal", MIDINAMES_FX_3_crystal },
+        { "FX_4_atmosphere", MIDINAMES_FX_4_atmosphere },
+        { "FX_5_brightness", MIDINAMES_FX_5_brightness },
+        { "FX_6_goblins", MIDINAMES_FX_6_goblins },
+        { "FX_7_echoes", MIDINAMES_FX_7_echoes },
+        { "FX_8_sci-fi", MIDINAMES_FX_8_sci_fi },
+        { "Sitar", MIDINAMES_Sitar },
+        { "Banjo", MIDINAMES_Banjo },
+        { "Shamisen", MIDINAMES_Shamisen },
+        { "Koto", MIDINAMES_Koto },
+        { "Kalimba", MIDINAMES_Kalimba },
+        { "Bagpipe", MIDINAMES_Bagpipe },
+        { "Fiddle", MIDINAMES_Fiddle },
+        { "Shanai", MIDINAMES_Shanai },
+        { "Tinkle_Bell", MIDINAMES_Tinkle_Bell },
+        { "Agogo", MIDINAMES_Agogo },
+        { "Steel_Drums", MIDINAMES_Steel_Drums },
+        { "Woodblock", MIDINAMES_Woodblock },
+        { "Taiko_Drum", MIDINAMES_Taiko_Drum },
+        { "Melodic_Tom", MIDINAMES_Melodic_Tom },
+        { "Synth_Drum", MIDINAMES_Synth_Drum },
+        { "Reverse_Cymbal", MIDINAMES_Reverse_Cymbal },
+        { "Guitar_Fret_Noise", MIDINAMES_Guitar_Fret_Noise },
+        { "Breath_Noise", MIDINAMES_Breath_Noise },
+        { "Seashore", MIDINAMES_Seashore },
+        { "Bird_Tweet", MIDINAMES_Bird_Tweet },
+        { "Telephone_Ring", MIDINAMES_Telephone_Ring },
+        { "Helicopter", MIDINAMES_Helicopter },
+        { "Applause", MIDINAMES_Applause },
+        { "Gunshot", MIDINAMES_Gunshot },
+        { "Acoustic_Bass_Drum", MIDINAMES_Acoustic_Bass_Drum },
+        { "Bass_Drum_1", MIDINAMES_Bass_Drum_1 },
+        { "Side_Stick", MIDINAMES_Side_Stick },
+        { "Acoustic_Snare", MIDINAMES_Acoustic_Snare },
+        { "Hand_Clap", MIDINAMES_Hand_Clap },
+        { "Electric_Snare", MIDINAMES_Electric_Snare },
+        { "Low_Floor_Tom", MIDINAMES_Low_Floor_Tom },
+        { "Closed_Hi_Hat", MIDINAMES_Closed_Hi_Hat },
+        { "High_Floor_Tom", MIDINAMES_High_Floor_Tom },
+        { "Pedal_Hi-Hat", MIDINAMES_Pedal_Hi_Hat },
+        { "Low_Tom", MIDINAMES_Low_Tom },
+        { "Open_Hi-Hat", MIDINAMES_Open_Hi_Hat },
+        { "Low-Mid_Tom", MIDINAMES_Low_Mid_Tom },
+        { "Hi-Mid_Tom", MIDINAMES_Hi_Mid_Tom },
+        { "Crash_Cymbal_1", MIDINAMES_Crash_Cymbal_1 },
+        { "High_Tom", MIDINAMES_High_Tom },
+        { "Ride_Cymbal_1", MIDINAMES_Ride_Cymbal_1 },
+        { "Chinese_Cymbal", MIDINAMES_Chinese_Cymbal },
+        { "Ride_Bell", MIDINAMES_Ride_Bell },
+        { "Tambourine", MIDINAMES_Tambourine },
+        { "Splash_Cymbal", MIDINAMES_Splash_Cymbal },
+        { "Cowbell", MIDINAMES_Cowbell },
+        { "Crash_Cymbal_2", MIDINAMES_Crash_Cymbal_2 },
+        { "Vibraslap", MIDINAMES_Vibraslap },
+        { "Ride_Cymbal_2", MIDINAMES_Ride_Cymbal_2 },
+        { "Hi_Bongo", MIDINAMES_Hi_Bongo },
+        { "Low_Bongo", MIDINAMES_Low_Bongo },
+        { "Mute_Hi_Conga", MIDINAMES_Mute_Hi_Conga },
+        { "Open_Hi_Conga", MIDINAMES_Open_Hi_Conga },
+        { "Low_Conga", MIDINAMES_Low_Conga },
+        { "High_Timbale", MIDINAMES_High_Timbale },
+        { "Low_Timbale", MIDINAMES_Low_Timbale },
+        { "High_Agogo", MIDINAMES_High_Agogo },
+        { "Low_Agogo", MIDINAMES_Low_Agogo },
+        { "Cabasa", MIDINAMES_Cabasa },
+        { "Maracas", MIDINAMES_Maracas },
+        { "Short_Whistle", MIDINAMES_Short_Whistle },
+        { "Long_Whistle", MIDINAMES_Long_Whistle },
+        { "Short_Guiro", MIDINAMES_Short_Guiro },
+        { "Long_Guiro", MIDINAMES_Long_Guiro },
+        { "Claves", MIDINAMES_Claves },
+        { "Hi_Wood_Block", MIDINAMES_Hi_Wood_Block },
+        { "Low_Wood_Block", MIDINAMES_Low_Wood_Block },
+        { "Mute_Cuica", MIDINAMES_Mute_Cuica },
+        { "Open_Cuica", MIDINAMES_Open_Cuica },
+        { "Mute_Triangle", MIDINAMES_Mute_Triangle },
+        { "Open_Triangle", MIDINAMES_Open_Triangle }
+    };
+    data_MIDINAMES data = MIDINAMES_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.MIDINAMES", value);
     return MIDINAMES_NONE;
 }
 
@@ -1436,17 +1593,21 @@ std::string AttConverter::ModeToStr(data_MODE data) const
     return value;
 }
 
-data_MODE AttConverter::StrToMode(std::string value) const
+data_MODE AttConverter::StrToMode(const char *value) const
 {
-    if (value == "major") return MODE_major;
-    if (value == "minor") return MODE_minor;
-    if (value == "dorian") return MODE_dorian;
-    if (value == "phrygian") return MODE_phrygian;
-    if (value == "lydian") return MODE_lydian;
-    if (value == "mixolydian") return MODE_mixolydian;
-    if (value == "aeolian") return MODE_aeolian;
-    if (value == "locrian") return MODE_locrian;
-    LogWarning("Unsupported value '%s' for data.MODE", value.c_str());
+    static const AttConverterValue<data_MODE> table[] = {
+        { "major", MODE_major },
+        { "minor", MODE_minor },
+        { "dorian", MODE_dorian },
+        { "phrygian", MODE_phrygian },
+        { "lydian", MODE_lydian },
+        { "mixolydian", MODE_mixolydian },
+        { "aeolian", MODE_aeolian },
+        { "locrian", MODE_locrian }
+    };
+    data_MODE data = MODE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.MODE", value);
     return MODE_NONE;
 }
 
@@ -1468,15 +1629,19 @@ std::string AttConverter::NotationtypeToStr(data_NOTATIONTYPE data) const
     return value;
 }
 
-data_NOTATIONTYPE AttConverter::StrToNotationtype(std::string value) const
+data_NOTATIONTYPE AttConverter::StrToNotationtype(const char *value) const
 {
-    if (value == "cmn") return NOTATIONTYPE_cmn;
-    if (value == "mensural") return NOTATIONTYPE_mensural;
-    if (value == "mensural.black") return NOTATIONTYPE_mensural_black;
-    if (value == "mensural.white") return NOTATIONTYPE_mensural_white;
-    if (value == "neume") return NOTATIONTYPE_neume;
-    if (value == "tab") return NOTATIONTYPE_tab;
-    LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value.c_str());
+    static const AttConverterValue<data_NOTATIONTYPE> table[] = {
+        { "cmn", NOTATIONTYPE_cmn },
+        { "mensural", NOTATIONTYPE_mensural },
+        { "mensural.black", NOTATIONTYPE_mensural_black },
+        { "mensural.white", NOTATIONTYPE_mensural_white },
+        { "neume", NOTATIONTYPE_neume },
+        { "tab", NOTATIONTYPE_tab }
+    };
+    data_NOTATIONTYPE data = NOTATIONTYPE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value);
     return NOTATIONTYPE_NONE;
 }
 
@@ -1502,19 +1667,23 @@ std::string AttConverter::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list d
     return value;
 }
 
-data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(std::string value) const
+data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(const char *value) const
 {
-    if (value == "slash") return NOTEHEADMODIFIER_list_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_list_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_list_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_list_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_list_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_list_brack;
-    if (value == "box") return NOTEHEADMODIFIER_list_box;
-    if (value == "circle") return NOTEHEADMODIFIER_list_circle;
-    if (value == "dblwhole") return NOTEHEADMODIFIER_list_dblwhole;
-    LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value.c_str());
+    static const AttConverterValue<data_NOTEHEADMODIFIER_list> table[] = {
+        { "slash", NOTEHEADMODIFIER_list_slash },
+        { "backslash", NOTEHEADMODIFIER_list_backslash },
+        { "vline", NOTEHEADMODIFIER_list_vline },
+        { "hline", NOTEHEADMODIFIER_list_hline },
+        { "centerdot", NOTEHEADMODIFIER_list_centerdot },
+        { "paren", NOTEHEADMODIFIER_list_paren },
+        { "brack", NOTEHEADMODIFIER_list_brack },
+        { "box", NOTEHEADMODIFIER_list_box },
+        { "circle", NOTEHEADMODIFIER_list_circle },
+        { "dblwhole", NOTEHEADMODIFIER_list_dblwhole }
+    };
+    data_NOTEHEADMODIFIER_list data = NOTEHEADMODIFIER_list_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value);
     return NOTEHEADMODIFIER_list_NONE;
 }
 
@@ -1532,11 +1701,15 @@ std::string AttConverter::OtherstaffToStr(data_OTHERSTAFF data) const
     return value;
 }
 
-data_OTHERSTAFF AttConverter::StrToOtherstaff(std::string value) const
+data_OTHERSTAFF AttConverter::StrToOtherstaff(const char *value) const
 {
-    if (value == "above") return OTHERSTAFF_above;
-    if (value == "below") return OTHERSTAFF_below;
-    LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value.c_str());
+    static const AttConverterValue<data_OTHERSTAFF> table[] = {
+        { "above", OTHERSTAFF_above },
+        { "below", OTHERSTAFF_below }
+    };
+    data_OTHERSTAFF data = OTHERSTAFF_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value);
     return OTHERSTAFF_NONE;
 }
 
@@ -1554,11 +1727,15 @@ std::string AttConverter::PlaceToStr(data_PLACE data) const
     return value;
 }
 
-data_PLACE AttConverter::StrToPlace(std::string value) const
+data_PLACE AttConverter::StrToPlace(const char *value) const
 {
-    if (value == "above") return PLACE_above;
-    if (value == "below") return PLACE_below;
-    LogWarning("Unsupported value '%s' for data.PLACE", value.c_str());
+    static const AttConverterValue<data_PLACE> table[] = {
+        { "above", PLACE_above },
+        { "below", PLACE_below }
+    };
+    data_PLACE data = PLACE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.PLACE", value);
     return PLACE_NONE;
 }
 
@@ -1581,16 +1758,20 @@ std::string AttConverter::RotationdirectionToStr(data_ROTATIONDIRECTION data) co
     return value;
 }
 
-data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(std::string value) const
+data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(const char *value) const
 {
-    if (value == "none") return ROTATIONDIRECTION_none;
-    if (value == "down") return ROTATIONDIRECTION_down;
-    if (value == "left") return ROTATIONDIRECTION_left;
-    if (value == "ne") return ROTATIONDIRECTION_ne;
-    if (value == "nw") return ROTATIONDIRECTION_nw;
-    if (value == "se") return ROTATIONDIRECTION_se;
-    if (value == "sw") return ROTATIONDIRECTION_sw;
-    LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value.c_str());
+    static const AttConverterValue<data_ROTATIONDIRECTION> table[] = {
+        { "none", ROTATIONDIRECTION_none },
+        { "down", ROTATIONDIRECTION_down },
+        { "left", ROTATIONDIRECTION_left },
+        { "ne", ROTATIONDIRECTION_ne },
+        { "nw", ROTATIONDIRECTION_nw },
+        { "se", ROTATIONDIRECTION_se },
+        { "sw", ROTATIONDIRECTION_sw }
+    };
+    data_ROTATIONDIRECTION data = ROTATIONDIRECTION_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value);
     return ROTATIONDIRECTION_NONE;
 }
 
@@ -1608,11 +1789,15 @@ std::string AttConverter::SizeToStr(data_SIZE data) const
     return value;
 }
 
-data_SIZE AttConverter::StrToSize(std::string value) const
+data_SIZE AttConverter::StrToSize(const char *value) const
 {
-    if (value == "normal") return SIZE_normal;
-    if (value == "cue") return SIZE_cue;
-    LogWarning("Unsupported value '%s' for data.SIZE", value.c_str());
+    static const AttConverterValue<data_SIZE> table[] = {
+        { "normal", SIZE_normal },
+        { "cue", SIZE_cue }
+    };
+    data_SIZE data = SIZE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.SIZE", value);
     return SIZE_NONE;
 }
 
@@ -1631,12 +1816,16 @@ std::string AttConverter::StaffrelToStr(data_STAFFREL data) const
     return value;
 }
 
-data_STAFFREL AttConverter::StrToStaffrel(std::string value) const
+data_STAFFREL AttConverter::StrToStaffrel(const char *value) const
 {
-    if (value == "above") return STAFFREL_above;
-    if (value == "below") return STAFFREL_below;
-    if (value == "within") return STAFFREL_within;
-    LogWarning("Unsupported value '%s' for data.STAFFREL", value.c_str());
+    static const AttConverterValue<data_STAFFREL> table[] = {
+        { "above", STAFFREL_above },
+        { "below", STAFFREL_below },
+        { "within", STAFFREL_within }
+    };
+    data_STAFFREL data = STAFFREL_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.STAFFREL", value);
     return STAFFREL_NONE;
 }
 
@@ -1661,18 +1850,22 @@ std::string AttConverter::StemmodifierToStr(data_STEMMODIFIER data) const
     return value;
 }
 
-data_STEMMODIFIER AttConverter::StrToStemmodifier(std::string value) const
+data_STEMMODIFIER AttConverter::StrToStemmodifier(const char *value) const
 {
-    if (value == "none") return STEMMODIFIER_none;
-    if (value == "1slash") return STEMMODIFIER_1slash;
-    if (value == "2slash") return STEMMODIFIER_2slash;
-    if (value == "3slash") return STEMMODIFIER_3slash;
-    if (value == "4slash") return STEMMODIFIER_4slash;
-    if (value == "5slash") return STEMMODIFIER_5slash;
-    if (value == "6slash") return STEMMODIFIER_6slash;
-    if (value == "sprech") return STEMMODIFIER_sprech;
-    if (value == "z") return STEMMODIFIER_z;
-    LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value.c_str());
+    static const AttConverterValue<data_STEMMODIFIER> table[] = {
+        { "none", STEMMODIFIER_none },
+        { "1slash", STEMMODIFIER_1slash },
+        { "2slash", STEMMODIFIER_2slash },
+        { "3slash", STEMMODIFIER_3slash },
+        { "4slash", STEMMODIFIER_4slash },
+        { "5slash", STEMMODIFIER_5slash },
+        { "6slash", STEMMODIFIER_6slash },
+        { "sprech", STEMMODIFIER_sprech },
+        { "z", STEMMODIFIER_z }
+    };
+    data_STEMMODIFIER data = STEMMODIFIER_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value);
     return STEMMODIFIER_NONE;
 }
 
@@ -1691,12 +1884,16 @@ std::string AttConverter::StempositionToStr(data_STEMPOSITION data) const
     return value;
 }
 
-data_STEMPOSITION AttConverter::StrToStemposition(std::string value) const
+data_STEMPOSITION AttConverter::StrToStemposition(const char *value) const
 {
-    if (value == "left") return STEMPOSITION_left;
-    if (value == "right") return STEMPOSITION_right;
-    if (value == "center") return STEMPOSITION_center;
-    LogWarning("Unsupported value '%s' for data.STEMPOSITION", value.c_str());
+    static const AttConverterValue<data_STEMPOSITION> table[] = {
+        { "left", STEMPOSITION_left },
+        { "right", STEMPOSITION_right },
+        { "center", STEMPOSITION_center }
+    };
+    data_STEMPOSITION data = STEMPOSITION_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.STEMPOSITION", value);
     return STEMPOSITION_NONE;
 }
 
@@ -1716,13 +1913,17 @@ std::string AttConverter::TemperamentToStr(data_TEMPERAMENT data) const
     return value;
 }
 
-data_TEMPERAMENT AttConverter::StrToTemperament(std::string value) const
+data_TEMPERAMENT AttConverter::StrToTemperament(const char *value) const
 {
-    if (value == "equal") return TEMPERAMENT_equal;
-    if (value == "just") return TEMPERAMENT_just;
-    if (value == "mean") return TEMPERAMENT_mean;
-    if (value == "pythagorean") return TEMPERAMENT_pythagorean;
-    LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value.c_str());
+    static const AttConverterValue<data_TEMPERAMENT> table[] = {
+        { "equal", TEMPERAMENT_equal },
+        { "just", TEMPERAMENT_just },
+        { "mean", TEMPERAMENT_mean },
+        { "pythagorean", TEMPERAMENT_pythagorean }
+    };
+    data_TEMPERAMENT data = TEMPERAMENT_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value);
     return TEMPERAMENT_NONE;
 }
 
@@ -1762,33 +1963,37 @@ std::string AttConverter::TextrenditionlistToStr(data_TEXTRENDITIONLIST data) co
     return value;
 }
 
-data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(std::string value) const
-{
-    if (value == "italic") return TEXTRENDITIONLIST_italic;
-    if (value == "oblique") return TEXTRENDITIONLIST_oblique;
-    if (value == "smcaps") return TEXTRENDITIONLIST_smcaps;
-    if (value == "bold") return TEXTRENDITIONLIST_bold;
-    if (value == "bolder") return TEXTRENDITIONLIST_bolder;
-    if (value == "lighter") return TEXTRENDITIONLIST_lighter;
-    if (value == "box") return TEXTRENDITIONLIST_box;
-    if (value == "circle") return TEXTRENDITIONLIST_circle;
-    if (value == "dbox") return TEXTRENDITIONLIST_dbox;
-    if (value == "tbox") return TEXTRENDITIONLIST_tbox;
-    if (value == "bslash") return TEXTRENDITIONLIST_bslash;
-    if (value == "fslash") return TEXTRENDITIONLIST_fslash;
-    if (value == "line-through") return TEXTRENDITIONLIST_line_through;
-    if (value == "none") return TEXTRENDITIONLIST_none;
-    if (value == "overline") return TEXTRENDITIONLIST_overline;
-    if (value == "overstrike") return TEXTRENDITIONLIST_overstrike;
-    if (value == "strike") return TEXTRENDITIONLIST_strike;
-    if (value == "sub") return TEXTRENDITIONLIST_sub;
-    if (value == "sup") return TEXTRENDITIONLIST_sup;
-    if (value == "underline") return TEXTRENDITIONLIST_underline;
-    if (value == "ltr") return TEXTRENDITIONLIST_ltr;
-    if (value == "rtl") return TEXTRENDITIONLIST_rtl;
-    if (value == "lro") return TEXTRENDITIONLIST_lro;
-    if (value == "rlo") return TEXTRENDITIONLIST_rlo;
-    LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value.c_str());
+data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(const char *value) const
+{
+    static const AttConverterValue<data_TEXTRENDITIONLIST> table[] = {
+        { "italic", TEXTRENDITIONLIST_italic },
+        { "oblique", TEXTRENDITIONLIST_oblique },
+        { "smcaps", TEXTRENDITIONLIST_smcaps },
+        { "bold", TEXTRENDITIONLIST_bold },
+        { "bolder", TEXTRENDITIONLIST_bolder },
+        { "lighter", TEXTRENDITIONLIST_lighter },
+        { "box", TEXTRENDITIONLIST_box },
+        { "circle", TEXTRENDITIONLIST_circle },
+        { "dbox", TEXTRENDITIONLIST_dbox },
+        { "tbox", TEXTRENDITIONLIST_tbox },
+        { "bslash", TEXTRENDITIONLIST_bslash },
+        { "fslash", TEXTRENDITIONLIST_fslash },
+        { "line-through", TEXTRENDITIONLIST_line_through },
+        { "none", TEXTRENDITIONLIST_none },
+        { "overline", TEXTRENDITIONLIST_overline },
+        { "overstrike", TEXTRENDITIONLIST_overstrike },
+        { "strike", TEXTRENDITIONLIST_strike },
+        { "sub", TEXTRENDITIONLIST_sub },
+        { "sup", TEXTRENDITIONLIST_sup },
+        { "underline", TEXTRENDITIONLIST_underline },
+        { "ltr", TEXTRENDITIONLIST_ltr },
+        { "rtl", TEXTRENDITIONLIST_rtl },
+        { "lro", TEXTRENDITIONLIST_lro },
+        { "rlo", TEXTRENDITIONLIST_rlo }
+    };
+    data_TEXTRENDITIONLIST data = TEXTRENDITIONLIST_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value);
     return TEXTRENDITIONLIST_NONE;
 }
 
@@ -1811,16 +2016,20 @@ std::string AttConverter::UneumeformToStr(data_UNEUMEFORM data) const
     return value;
 }
 
-data_UNEUMEFORM AttConverter::StrToUneumeform(std::string value) const
+data_UNEUMEFORM AttConverter::StrToUneumeform(const char *value) const
 {
-    if (value == "liquescent1") return UNEUMEFORM_liquescent1;
-    if (value == "liquescent2") return UNEUMEFORM_liquescent2;
-    if (value == "liquescent3") return UNEUMEFORM_liquescent3;
-    if (value == "quilismatic") return UNEUMEFORM_quilismatic;
-    if (value == "rectangular") return UNEUMEFORM_rectangular;
-    if (value == "rhombic") return UNEUMEFORM_rhombic;
-    if (value == "tied") return UNEUMEFORM_tied;
-    LogWarning("Unsupported value '%s' for data.UNEUMEFORM", value.c_str());
+    static const AttConverterValue<data_UNEUMEFORM> table[] = {
+        { "liquescent1", UNEUMEFORM_liquescent1 },
+        { "liquescent2", UNEUMEFORM_liquescent2 },
+        { "liquescent3", UNEUMEFORM_liquescent3 },
+        { "quilismatic", UNEUMEFORM_quilismatic },
+        { "rectangular", UNEUMEFORM_rectangular },
+        { "rhombic", UNEUMEFORM_rhombic },
+        { "tied", UNEUMEFORM_tied }
+    };
+    data_UNEUMEFORM data = UNEUMEFORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.UNEUMEFORM", value);
     return UNEUMEFORM_NONE;
 }
 
@@ -1849,22 +2058,26 @@ std::string AttConverter::UneumenameToStr(data_UNEUMENAME data) const
     return value;
 }
 
-data_UNEUMENAME AttConverter::StrToUneumename(std::string value) const
+data_UNEUMENAME AttConverter::StrToUneumename(const char *value) const
 {
-    if (value == "punctum") return UNEUMENAME_punctum;
-    if (value == "virga") return UNEUMENAME_virga;
-    if (value == "pes") return UNEUMENAME_pes;
-    if (value == "clivis") return UNEUMENAME_clivis;
-    if (value == "torculus") return UNEUMENAME_torculus;
-    if (value == "torculusresupinus") return UNEUMENAME_torculusresupinus;
-    if (value == "porrectus") return UNEUMENAME_porrectus;
-    if (value == "porrectusflexus") return UNEUMENAME_porrectusflexus;
-    if (value == "apostropha") return UNEUMENAME_apostropha;
-    if (value == "oriscus") return UNEUMENAME_oriscus;
-    if (value == "pressusmaior") return UNEUMENAME_pressusmaior;
-    if (value == "pressusminor") return UNEUMENAME_pressusminor;
-    if (value == "virgastrata") return UNEUMENAME_virgastrata;
-    LogWarning("Unsupported value '%s' for data.UNEUMENAME", value.c_str());
+    static const AttConverterValue<data_UNEUMENAME> table[] = {
+        { "punctum", UNEUMENAME_punctum },
+        { "virga", UNEUMENAME_virga },
+        { "pes", UNEUMENAME_pes },
+        { "clivis", UNEUMENAME_clivis },
+        { "torculus", UNEUMENAME_torculus },
+        { "torculusresupinus", UNEUMENAME_torculusresupinus },
+        { "porrectus", UNEUMENAME_porrectus },
+        { "porrectusflexus", UNEUMENAME_porrectusflexus },
+        { "apostropha", UNEUMENAME_apostropha },
+        { "oriscus", UNEUMENAME_oriscus },
+        { "pressusmaior", UNEUMENAME_pressusmaior },
+        { "pressusminor", UNEUMENAME_pressusminor },
+        { "virgastrata", UNEUMENAME_virgastrata }
+    };
+    data_UNEUMENAME data = UNEUMENAME_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for data.UNEUMENAME", value);
     return UNEUMENAME_NONE;
 }
 
@@ -1882,11 +2095,15 @@ std::string AttConverter::AccidLogFuncToStr(accidLog_FUNC data) const
     return value;
 }
 
-accidLog_FUNC AttConverter::StrToAccidLogFunc(std::string value) const
+accidLog_FUNC AttConverter::StrToAccidLogFunc(const char *value) const
 {
-    if (value == "caution") return accidLog_FUNC_caution;
-    if (value == "edit") return accidLog_FUNC_edit;
-    LogWarning("Unsupported value '%s' for att.accid.log@func", value.c_str());
+    static const AttConverterValue<accidLog_FUNC> table[] = {
+        { "caution", accidLog_FUNC_caution },
+        { "edit", accidLog_FUNC_edit }
+    };
+    accidLog_FUNC data = accidLog_FUNC_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.accid.log@func", value);
     return accidLog_FUNC_NONE;
 }
 
@@ -1905,12 +2122,16 @@ std::string AttConverter::ArpegLogOrderToStr(arpegLog_ORDER data) const
     return value;
 }
 
-arpegLog_ORDER AttConverter::StrToArpegLogOrder(std::string value) const
+arpegLog_ORDER AttConverter::StrToArpegLogOrder(const char *value) const
 {
-    if (value == "up") return arpegLog_ORDER_up;
-    if (value == "down") return arpegLog_ORDER_down;
-    if (value == "nonarp") return arpegLog_ORDER_nonarp;
-    LogWarning("Unsupported value '%s' for att.arpeg.log@order", value.c_str());
+    static const AttConverterValue<arpegLog_ORDER> table[] = {
+        { "up", arpegLog_ORDER_up },
+        { "down", arpegLog_ORDER_down },
+        { "nonarp", arpegLog_ORDER_nonarp }
+    };
+    arpegLog_ORDER data = arpegLog_ORDER_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.arpeg.log@order", value);
     return arpegLog_ORDER_NONE;
 }
 
@@ -1928,11 +2149,15 @@ std::string AttConverter::BTremLogFormToStr(bTremLog_FORM data) const
     return value;
 }
 
-bTremLog_FORM AttConverter::StrToBTremLogForm(std::string value) const
+bTremLog_FORM AttConverter::StrToBTremLogForm(const char *value) const
 {
-    if (value == "meas") return bTremLog_FORM_meas;
-    if (value == "unmeas") return bTremLog_FORM_unmeas;
-    LogWarning("Unsupported value '%s' for att.bTrem.log@form", value.c_str());
+    static const AttConverterValue<bTremLog_FORM> table[] = {
+        { "meas", bTremLog_FORM_meas },
+        { "unmeas", bTremLog_FORM_unmeas }
+    };
+    bTremLog_FORM data = bTremLog_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.bTrem.log@form", value);
     return bTremLog_FORM_NONE;
 }
 
@@ -1951,12 +2176,16 @@ std::string AttConverter::BeamingVisBeamrendToStr(beamingVis_BEAMREND data) cons
     return value;
 }
 
-beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(std::string value) const
+beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(const char *value) const
 {
-    if (value == "acc") return beamingVis_BEAMREND_acc;
-    if (value == "rit") return beamingVis_BEAMREND_rit;
-    if (value == "norm") return beamingVis_BEAMREND_norm;
-    LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value.c_str());
+    static const AttConverterValue<beamingVis_BEAMREND> table[] = {
+        { "acc", beamingVis_BEAMREND_acc },
+        { "rit", beamingVis_BEAMREND_rit },
+        { "norm", beamingVis_BEAMREND_norm }
+    };
+    beamingVis_BEAMREND data = beamingVis_BEAMREND_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value);
     return beamingVis_BEAMREND_NONE;
 }
 
@@ -1976,13 +2205,17 @@ std::string AttConverter::BeamrendFormToStr(beamrend_FORM data) const
     return value;
 }
 
-beamrend_FORM AttConverter::StrToBeamrendForm(std::string value) const
+beamrend_FORM AttConverter::StrToBeamrendForm(const char *value) const
 {
-    if (value == "acc") return beamrend_FORM_acc;
-    if (value == "mixed") return beamrend_FORM_mixed;
-    if (value == "rit") return beamrend_FORM_rit;
-    if (value == "norm") return beamrend_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.beamrend@form", value.c_str());
+    static const AttConverterValue<beamrend_FORM> table[] = {
+        { "acc", beamrend_FORM_acc },
+        { "mixed", beamrend_FORM_mixed },
+        { "rit", beamrend_FORM_rit },
+        { "norm", beamrend_FORM_norm }
+    };
+    beamrend_FORM data = beamrend_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.beamrend@form", value);
     return beamrend_FORM_NONE;
 }
 
@@ -2001,12 +2234,16 @@ std::string AttConverter::CurvatureCurvedirToStr(curvature_CURVEDIR data) const
     return value;
 }
 
-curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(std::string value) const
+curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(const char *value) const
 {
-    if (value == "above") return curvature_CURVEDIR_above;
-    if (value == "below") return curvature_CURVEDIR_below;
-    if (value == "mixed") return curvature_CURVEDIR_mixed;
-    LogWarning("Unsupported value '%s' for att.curvature@curvedir", value.c_str());
+    static const AttConverterValue<curvature_CURVEDIR> table[] = {
+        { "above", curvature_CURVEDIR_above },
+        { "below", curvature_CURVEDIR_below },
+        { "mixed", curvature_CURVEDIR_mixed }
+    };
+    curvature_CURVEDIR data = curvature_CURVEDIR_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.curvature@curvedir", value);
     return curvature_CURVEDIR_NONE;
 }
 
@@ -2023,10 +2260,14 @@ std::string AttConverter::CutoutCutoutToStr(cutout_CUTOUT data) const
     return value;
 }
 
-cutout_CUTOUT AttConverter::StrToCutoutCutout(std::string value) const
+cutout_CUTOUT AttConverter::StrToCutoutCutout(const char *value) const
 {
-    if (value == "cutout") return cutout_CUTOUT_cutout;
-    LogWarning("Unsupported value '%s' for att.cutout@cutout", value.c_str());
+    static const AttConverterValue<cutout_CUTOUT> table[] = {
+        { "cutout", cutout_CUTOUT_cutout }
+    };
+    cutout_CUTOUT data = cutout_CUTOUT_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.cutout@cutout", value);
     return cutout_CUTOUT_NONE;
 }
 
@@ -2044,11 +2285,15 @@ std::string AttConverter::DotLogFormToStr(dotLog_FORM data) const
     return value;
 }
 
-dotLog_FORM AttConverter::StrToDotLogForm(std::string value) const
+dotLog_FORM AttConverter::StrToDotLogForm(const char *value) const
 {
-    if (value == "aug") return dotLog_FORM_aug;
-    if (value == "div") return dotLog_FORM_div;
-    LogWarning("Unsupported value '%s' for att.dot.log@form", value.c_str());
+    static const AttConverterValue<dotLog_FORM> table[] = {
+        { "aug", dotLog_FORM_aug },
+        { "div", dotLog_FORM_div }
+    };
+    dotLog_FORM data = dotLog_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.dot.log@form", value);
     return dotLog_FORM_NONE;
 }
 
@@ -2067,12 +2312,16 @@ std::string AttConverter::EndingsEndingrendToStr(endings_ENDINGREND data) const
     return value;
 }
 
-endings_ENDINGREND AttConverter::StrToEndingsEndingrend(std::string value) const
+endings_ENDINGREND AttConverter::StrToEndingsEndingrend(const char *value) const
 {
-    if (value == "top") return endings_ENDINGREND_top;
-    if (value == "barred") return endings_ENDINGREND_barred;
-    if (value == "grouped") return endings_ENDINGREND_grouped;
-    LogWarning("Unsupported value '%s' for att.endings@ending.rend", value.c_str());
+    static const AttConverterValue<endings_ENDINGREND> table[] = {
+        { "top", endings_ENDINGREND_top },
+        { "barred", endings_ENDINGREND_barred },
+        { "grouped", endings_ENDINGREND_grouped }
+    };
+    endings_ENDINGREND data = endings_ENDINGREND_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.endings@ending.rend", value);
     return endings_ENDINGREND_NONE;
 }
 
@@ -2090,11 +2339,15 @@ std::string AttConverter::FTremLogFormToStr(fTremLog_FORM data) const
     return value;
 }
 
-fTremLog_FORM AttConverter::StrToFTremLogForm(std::string value) const
+fTremLog_FORM AttConverter::StrToFTremLogForm(const char *value) const
 {
-    if (value == "meas") return fTremLog_FORM_meas;
-    if (value == "unmeas") return fTremLog_FORM_unmeas;
-    LogWarning("Unsupported value '%s' for att.fTrem.log@form", value.c_str());
+    static const AttConverterValue<fTremLog_FORM> table[] = {
+        { "meas", fTremLog_FORM_meas },
+        { "unmeas", fTremLog_FORM_unmeas }
+    };
+    fTremLog_FORM data = fTremLog_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.fTrem.log@form", value);
     return fTremLog_FORM_NONE;
 }
 
@@ -2112,11 +2365,15 @@ std::string AttConverter::FermataVisFormToStr(fermataVis_FORM data) const
     return value;
 }
 
-fermataVis_FORM AttConverter::StrToFermataVisForm(std::string value) const
+fermataVis_FORM AttConverter::StrToFermataVisForm(const char *value) const
 {
-    if (value == "inv") return fermataVis_FORM_inv;
-    if (value == "norm") return fermataVis_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.fermata.vis@form", value.c_str());
+    static const AttConverterValue<fermataVis_FORM> table[] = {
+        { "inv", fermataVis_FORM_inv },
+        { "norm", fermataVis_FORM_norm }
+    };
+    fermataVis_FORM data = fermataVis_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.fermata.vis@form", value);
     return fermataVis_FORM_NONE;
 }
 
@@ -2135,12 +2392,16 @@ std::string AttConverter::FermataVisShapeToStr(fermataVis_SHAPE data) const
     return value;
 }
 
-fermataVis_SHAPE AttConverter::StrToFermataVisShape(std::string value) const
+fermataVis_SHAPE AttConverter::StrToFermataVisShape(const char *value) const
 {
-    if (value == "curved") return fermataVis_SHAPE_curved;
-    if (value == "square") return fermataVis_SHAPE_square;
-    if (value == "angular") return fermataVis_SHAPE_angular;
-    LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value.c_str());
+    static const AttConverterValue<fermataVis_SHAPE> table[] = {
+        { "curved", fermataVis_SHAPE_curved },
+        { "square", fermataVis_SHAPE_square },
+        { "angular", fermataVis_SHAPE_angular }
+    };
+    fermataVis_SHAPE data = fermataVis_SHAPE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value);
     return fermataVis_SHAPE_NONE;
 }
 
@@ -2158,11 +2419,15 @@ std::string AttConverter::HairpinLogFormToStr(hairpinLog_FORM data) const
     return value;
 }
 
-hairpinLog_FORM AttConverter::StrToHairpinLogForm(std::string value) const
+hairpinLog_FORM AttConverter::StrToHairpinLogForm(const char *value) const
 {
-    if (value == "cres") return hairpinLog_FORM_cres;
-    if (value == "dim") return hairpinLog_FORM_dim;
-    LogWarning("Unsupported value '%s' for att.hairpin.log@form", value.c_str());
+    static const AttConverterValue<hairpinLog_FORM> table[] = {
+        { "cres", hairpinLog_FORM_cres },
+        { "dim", hairpinLog_FORM_dim }
+    };
+    hairpinLog_FORM data = hairpinLog_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.hairpin.log@form", value);
     return hairpinLog_FORM_NONE;
 }
 
@@ -2181,12 +2446,16 @@ std::string AttConverter::HarmVisRendgridToStr(harmVis_RENDGRID data) const
     return value;
 }
 
-harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(std::string value) const
+harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(const char *value) const
 {
-    if (value == "grid") return harmVis_RENDGRID_grid;
-    if (value == "gridtext") return harmVis_RENDGRID_gridtext;
-    if (value == "text") return harmVis_RENDGRID_text;
-    LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value.c_str());
+    static const AttConverterValue<harmVis_RENDGRID> table[] = {
+        { "grid", harmVis_RENDGRID_grid },
+        { "gridtext", harmVis_RENDGRID_gridtext },
+        { "text", harmVis_RENDGRID_text }
+    };
+    harmVis_RENDGRID data = harmVis_RENDGRID_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value);
     return harmVis_RENDGRID_NONE;
 }
 
@@ -2205,12 +2474,16 @@ std::string AttConverter::HarpPedalLogAToStr(harpPedalLog_A data) const
     return value;
 }
 
-harpPedalLog_A AttConverter::StrToHarpPedalLogA(std::string value) const
+harpPedalLog_A AttConverter::StrToHarpPedalLogA(const char *value) const
 {
-    if (value == "f") return harpPedalLog_A_f;
-    if (value == "n") return harpPedalLog_A_n;
-    if (value == "s") return harpPedalLog_A_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value.c_str());
+    static const AttConverterValue<harpPedalLog_A> table[] = {
+        { "f", harpPedalLog_A_f },
+        { "n", harpPedalLog_A_n },
+        { "s", harpPedalLog_A_s }
+    };
+    harpPedalLog_A data = harpPedalLog_A_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value);
     return harpPedalLog_A_NONE;
 }
 
@@ -2229,12 +2502,16 @@ std::string AttConverter::HarpPedalLogBToStr(harpPedalLog_B data) const
     return value;
 }
 
-harpPedalLog_B AttConverter::StrToHarpPedalLogB(std::string value) const
+harpPedalLog_B AttConverter::StrToHarpPedalLogB(const char *value) const
 {
-    if (value == "f") return harpPedalLog_B_f;
-    if (value == "n") return harpPedalLog_B_n;
-    if (value == "s") return harpPedalLog_B_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value.c_str());
+    static const AttConverterValue<harpPedalLog_B> table[] = {
+        { "f", harpPedalLog_B_f },
+        { "n", harpPedalLog_B_n },
+        { "s", harpPedalLog_B_s }
+    };
+    harpPedalLog_B data = harpPedalLog_B_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value);
     return harpPedalLog_B_NONE;
 }
 
@@ -2253,12 +2530,16 @@ std::string AttConverter::HarpPedalLogCToStr(harpPedalLog_C data) const
     return value;
 }
 
-harpPedalLog_C AttConverter::StrToHarpPedalLogC(std::string value) const
+harpPedalLog_C AttConverter::StrToHarpPedalLogC(const char *value) const
 {
-    if (value == "f") return harpPedalLog_C_f;
-    if (value == "n") return harpPedalLog_C_n;
-    if (value == "s") return harpPedalLog_C_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value.c_str());
+    static const AttConverterValue<harpPedalLog_C> table[] = {
+        { "f", harpPedalLog_C_f },
+        { "n", harpPedalLog_C_n },
+        { "s", harpPedalLog_C_s }
+    };
+    harpPedalLog_C data = harpPedalLog_C_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value);
     return harpPedalLog_C_NONE;
 }
 
@@ -2277,12 +2558,16 @@ std::string AttConverter::HarpPedalLogDToStr(harpPedalLog_D data) const
     return value;
 }
 
-harpPedalLog_D AttConverter::StrToHarpPedalLogD(std::string value) const
+harpPedalLog_D AttConverter::StrToHarpPedalLogD(const char *value) const
 {
-    if (value == "f") return harpPedalLog_D_f;
-    if (value == "n") return harpPedalLog_D_n;
-    if (value == "s") return harpPedalLog_D_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value.c_str());
+    static const AttConverterValue<harpPedalLog_D> table[] = {
+        { "f", harpPedalLog_D_f },
+        { "n", harpPedalLog_D_n },
+        { "s", harpPedalLog_D_s }
+    };
+    harpPedalLog_D data = harpPedalLog_D_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value);
     return harpPedalLog_D_NONE;
 }
 
@@ -2301,12 +2586,16 @@ std::string AttConverter::HarpPedalLogEToStr(harpPedalLog_E data) const
     return value;
 }
 
-harpPedalLog_E AttConverter::StrToHarpPedalLogE(std::string value) const
+harpPedalLog_E AttConverter::StrToHarpPedalLogE(const char *value) const
 {
-    if (value == "f") return harpPedalLog_E_f;
-    if (value == "n") return harpPedalLog_E_n;
-    if (value == "s") return harpPedalLog_E_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value.c_str());
+    static const AttConverterValue<harpPedalLog_E> table[] = {
+        { "f", harpPedalLog_E_f },
+        { "n", harpPedalLog_E_n },
+        { "s", harpPedalLog_E_s }
+    };
+    harpPedalLog_E data = harpPedalLog_E_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value);
     return harpPedalLog_E_NONE;
 }
 
@@ -2325,12 +2614,16 @@ std::string AttConverter::HarpPedalLogFToStr(harpPedalLog_F data) const
     return value;
 }
 
-harpPedalLog_F AttConverter::StrToHarpPedalLogF(std::string value) const
+harpPedalLog_F AttConverter::StrToHarpPedalLogF(const char *value) const
 {
-    if (value == "f") return harpPedalLog_F_f;
-    if (value == "n") return harpPedalLog_F_n;
-    if (value == "s") return harpPedalLog_F_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value.c_str());
+    static const AttConverterValue<harpPedalLog_F> table[] = {
+        { "f", harpPedalLog_F_f },
+        { "n", harpPedalLog_F_n },
+        { "s", harpPedalLog_F_s }
+    };
+    harpPedalLog_F data = harpPedalLog_F_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value);
     return harpPedalLog_F_NONE;
 }
 
@@ -2349,12 +2642,16 @@ std::string AttConverter::HarpPedalLogGToStr(harpPedalLog_G data) const
     return value;
 }
 
-harpPedalLog_G AttConverter::StrToHarpPedalLogG(std::string value) const
+harpPedalLog_G AttConverter::StrToHarpPedalLogG(const char *value) const
 {
-    if (value == "f") return harpPedalLog_G_f;
-    if (value == "n") return harpPedalLog_G_n;
-    if (value == "s") return harpPedalLog_G_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value.c_str());
+    static const AttConverterValue<harpPedalLog_G> table[] = {
+        { "f", harpPedalLog_G_f },
+        { "n", harpPedalLog_G_n },
+        { "s", harpPedalLog_G_s }
+    };
+    harpPedalLog_G data = harpPedalLog_G_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value);
     return harpPedalLog_G_NONE;
 }
 
@@ -2371,10 +2668,14 @@ std::string AttConverter::MeiversionMeiversionToStr(meiversion_MEIVERSION data)
     return value;
 }
 
-meiversion_MEIVERSION AttConverter::StrToMeiversionMeiversion(std::string value) const
+meiversion_MEIVERSION AttConverter::StrToMeiversionMeiversion(const char *value) const
 {
-    if (value == "3.0.0") return meiversion_MEIVERSION_3_0_0;
-    LogWarning("Unsupported value '%s' for att.meiversion@meiversion", value.c_str());
+    static const AttConverterValue<meiversion_MEIVERSION> table[] = {
+        { "3.0.0", meiversion_MEIVERSION_3_0_0 }
+    };
+    meiversion_MEIVERSION data = meiversion_MEIVERSION_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.meiversion@meiversion", value);
     return meiversion_MEIVERSION_NONE;
 }
 
@@ -2392,11 +2693,15 @@ std::string AttConverter::MensurVisFormToStr(mensurVis_FORM data) const
     return value;
 }
 
-mensurVis_FORM AttConverter::StrToMensurVisForm(std::string value) const
+mensurVis_FORM AttConverter::StrToMensurVisForm(const char *value) const
 {
-    if (value == "horizontal") return mensurVis_FORM_horizontal;
-    if (value == "vertical") return mensurVis_FORM_vertical;
-    LogWarning("Unsupported value '%s' for att.mensur.vis@form", value.c_str());
+    static const AttConverterValue<mensurVis_FORM> table[] = {
+        { "horizontal", mensurVis_FORM_horizontal },
+        { "vertical", mensurVis_FORM_vertical }
+    };
+    mensurVis_FORM data = mensurVis_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.mensur.vis@form", value);
     return mensurVis_FORM_NONE;
 }
 
@@ -2414,11 +2719,15 @@ std::string AttConverter::MensuralVisMensurformToStr(mensuralVis_MENSURFORM data
     return value;
 }
 
-mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(std::string value) const
+mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(const char *value) const
 {
-    if (value == "horizontal") return mensuralVis_MENSURFORM_horizontal;
-    if (value == "vertical") return mensuralVis_MENSURFORM_vertical;
-    LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value.c_str());
+    static const AttConverterValue<mensuralVis_MENSURFORM> table[] = {
+        { "horizontal", mensuralVis_MENSURFORM_horizontal },
+        { "vertical", mensuralVis_MENSURFORM_vertical }
+    };
+    mensuralVis_MENSURFORM data = mensuralVis_MENSURFORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value);
     return mensuralVis_MENSURFORM_NONE;
 }
 
@@ -2438,13 +2747,17 @@ std::string AttConverter::MeterSigVisFormToStr(meterSigVis_FORM data) const
     return value;
 }
 
-meterSigVis_FORM AttConverter::StrToMeterSigVisForm(std::string value) const
+meterSigVis_FORM AttConverter::StrToMeterSigVisForm(const char *value) const
 {
-    if (value == "num") return meterSigVis_FORM_num;
-    if (value == "denomsym") return meterSigVis_FORM_denomsym;
-    if (value == "norm") return meterSigVis_FORM_norm;
-    if (value == "invis") return meterSigVis_FORM_invis;
-    LogWarning("Unsupported value '%s' for att.meterSig.vis@form", value.c_str());
+    static const AttConverterValue<meterSigVis_FORM> table[] = {
+        { "num", meterSigVis_FORM_num },
+        { "denomsym", meterSigVis_FORM_denomsym },
+        { "norm", meterSigVis_FORM_norm },
+        { "invis", meterSigVis_FORM_invis }
+    };
+    meterSigVis_FORM data = meterSigVis_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.meterSig.vis@form", value);
     return meterSigVis_FORM_NONE;
 }
 
@@ -2464,13 +2777,17 @@ std::string AttConverter::MeterSigDefaultVisMeterrendToStr(meterSigDefaultVis_ME
     return value;
 }
 
-meterSigDefaultVis_METERREND AttConverter::StrToMeterSigDefaultVisMeterrend(std::string value) const
+meterSigDefaultVis_METERREND AttConverter::StrToMeterSigDefaultVisMeterrend(const char *value) const
 {
-    if (value == "num") return meterSigDefaultVis_METERREND_num;
-    if (value == "denomsym") return meterSigDefaultVis_METERREND_denomsym;
-    if (value == "norm") return meterSigDefaultVis_METERREND_norm;
-    if (value == "invis") return meterSigDefaultVis_METERREND_invis;
-    LogWarning("Unsupported value '%s' for att.meterSigDefault.vis@meter.rend", value.c_str());
+    static const AttConverterValue<meterSigDefaultVis_METERREND> table[] = {
+        { "num", meterSigDefaultVis_METERREND_num },
+        { "denomsym", meterSigDefaultVis_METERREND_denomsym },
+        { "norm", meterSigDefaultVis_METERREND_norm },
+        { "invis", meterSigDefaultVis_METERREND_invis }
+    };
+    meterSigDefaultVis_METERREND data = meterSigDefaultVis_METERREND_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.meterSigDefault.vis@meter.rend", value);
     return meterSigDefaultVis_METERREND_NONE;
 }
 
@@ -2489,12 +2806,16 @@ std::string AttConverter::MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) cons
     return value;
 }
 
-meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(std::string value) const
+meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(const char *value) const
 {
-    if (value == "alternating") return meterSigGrpLog_FUNC_alternating;
-    if (value == "interchanging") return meterSigGrpLog_FUNC_interchanging;
-    if (value == "mixed") return meterSigGrpLog_FUNC_mixed;
-    LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value.c_str());
+    static const AttConverterValue<meterSigGrpLog_FUNC> table[] = {
+        { "alternating", meterSigGrpLog_FUNC_alternating },
+        { "interchanging", meterSigGrpLog_FUNC_interchanging },
+        { "mixed", meterSigGrpLog_FUNC_mixed }
+    };
+    meterSigGrpLog_FUNC data = meterSigGrpLog_FUNC_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value);
     return meterSigGrpLog_FUNC_NONE;
 }
 
@@ -2513,12 +2834,16 @@ std::string AttConverter::MeterconformanceMetconToStr(meterconformance_METCON da
     return value;
 }
 
-meterconformance_METCON AttConverter::StrToMeterconformanceMetcon(std::string value) const
+meterconformance_METCON AttConverter::StrToMeterconformanceMetcon(const char *value) const
 {
-    if (value == "c") return meterconformance_METCON_c;
-    if (value == "i") return meterconformance_METCON_i;
-    if (value == "o") return meterconformance_METCON_o;
-    LogWarning("Unsupported value '%s' for att.meterconformance@metcon", value.c_str());
+    static const AttConverterValue<meterconformance_METCON> table[] = {
+        { "c", meterconformance_METCON_c },
+        { "i", meterconformance_METCON_i },
+        { "o", meterconformance_METCON_o }
+    };
+    meterconformance_METCON data = meterconformance_METCON_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.meterconformance@metcon", value);
     return meterconformance_METCON_NONE;
 }
 
@@ -2536,11 +2861,15 @@ std::string AttConverter::MordentLogFormToStr(mordentLog_FORM data) const
     return value;
 }
 
-mordentLog_FORM AttConverter::StrToMordentLogForm(std::string value) const
+mordentLog_FORM AttConverter::StrToMordentLogForm(const char *value) const
 {
-    if (value == "inv") return mordentLog_FORM_inv;
-    if (value == "norm") return mordentLog_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.mordent.log@form", value.c_str());
+    static const AttConverterValue<mordentLog_FORM> table[] = {
+        { "inv", mordentLog_FORM_inv },
+        { "norm", mordentLog_FORM_norm }
+    };
+    mordentLog_FORM data = mordentLog_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.mordent.log@form", value);
     return mordentLog_FORM_NONE;
 }
 
@@ -2558,11 +2887,15 @@ std::string AttConverter::NoteLogMensuralLigToStr(noteLogMensural_LIG data) cons
     return value;
 }
 
-noteLogMensural_LIG AttConverter::StrToNoteLogMensuralLig(std::string value) const
+noteLogMensural_LIG AttConverter::StrToNoteLogMensuralLig(const char *value) const
 {
-    if (value == "recta") return noteLogMensural_LIG_recta;
-    if (value == "obliqua") return noteLogMensural_LIG_obliqua;
-    LogWarning("Unsupported value '%s' for att.note.log.mensural@lig", value.c_str());
+    static const AttConverterValue<noteLogMensural_LIG> table[] = {
+        { "recta", noteLogMensural_LIG_recta },
+        { "obliqua", noteLogMensural_LIG_obliqua }
+    };
+    noteLogMensural_LIG data = noteLogMensural_LIG_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.note.log.mensural@lig", value);
     return noteLogMensural_LIG_NONE;
 }
 
@@ -2579,10 +2912,14 @@ std::string AttConverter::OctaveLogCollToStr(octaveLog_COLL data) const
     return value;
 }
 
-octaveLog_COLL AttConverter::StrToOctaveLogColl(std::string value) const
+octaveLog_COLL AttConverter::StrToOctaveLogColl(const char *value) const
 {
-    if (value == "coll") return octaveLog_COLL_coll;
-    LogWarning("Unsupported value '%s' for att.octave.log@coll", value.c_str());
+    static const AttConverterValue<octaveLog_COLL> table[] = {
+        { "coll", octaveLog_COLL_coll }
+    };
+    octaveLog_COLL data = octaveLog_COLL_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.octave.log@coll", value);
     return octaveLog_COLL_NONE;
 }
 
@@ -2600,11 +2937,15 @@ std::string AttConverter::PbVisFoliumToStr(pbVis_FOLIUM data) const
     return value;
 }
 
-pbVis_FOLIUM AttConverter::StrToPbVisFolium(std::string value) const
+pbVis_FOLIUM AttConverter::StrToPbVisFolium(const char *value) const
 {
-    if (value == "verso") return pbVis_FOLIUM_verso;
-    if (value == "recto") return pbVis_FOLIUM_recto;
-    LogWarning("Unsupported value '%s' for att.pb.vis@folium", value.c_str());
+    static const AttConverterValue<pbVis_FOLIUM> table[] = {
+        { "verso", pbVis_FOLIUM_verso },
+        { "recto", pbVis_FOLIUM_recto }
+    };
+    pbVis_FOLIUM data = pbVis_FOLIUM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.pb.vis@folium", value);
     return pbVis_FOLIUM_NONE;
 }
 
@@ -2624,13 +2965,17 @@ std::string AttConverter::PedalLogDirToStr(pedalLog_DIR data) const
     return value;
 }
 
-pedalLog_DIR AttConverter::StrToPedalLogDir(std::string value) const
+pedalLog_DIR AttConverter::StrToPedalLogDir(const char *value) const
 {
-    if (value == "down") return pedalLog_DIR_down;
-    if (value == "up") return pedalLog_DIR_up;
-    if (value == "half") return pedalLog_DIR_half;
-    if (value == "bounce") return pedalLog_DIR_bounce;
-    LogWarning("Unsupported value '%s' for att.pedal.log@dir", value.c_str());
+    static const AttConverterValue<pedalLog_DIR> table[] = {
+        { "down", pedalLog_DIR_down },
+        { "up", pedalLog_DIR_up },
+        { "half", pedalLog_DIR_half },
+        { "bounce", pedalLog_DIR_bounce }
+    };
+    pedalLog_DIR data = pedalLog_DIR_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.pedal.log@dir", value);
     return pedalLog_DIR_NONE;
 }
 
@@ -2649,12 +2994,16 @@ std::string AttConverter::PedalVisFormToStr(pedalVis_FORM data) const
     return value;
 }
 
-pedalVis_FORM AttConverter::StrToPedalVisForm(std::string value) const
+pedalVis_FORM AttConverter::StrToPedalVisForm(const char *value) const
 {
-    if (value == "line") return pedalVis_FORM_line;
-    if (value == "pedstar") return pedalVis_FORM_pedstar;
-    if (value == "altpedstar") return pedalVis_FORM_altpedstar;
-    LogWarning("Unsupported value '%s' for att.pedal.vis@form", value.c_str());
+    static const AttConverterValue<pedalVis_FORM> table[] = {
+        { "line", pedalVis_FORM_line },
+        { "pedstar", pedalVis_FORM_pedstar },
+        { "altpedstar", pedalVis_FORM_altpedstar }
+    };
+    pedalVis_FORM data = pedalVis_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.pedal.vis@form", value);
     return pedalVis_FORM_NONE;
 }
 
@@ -2673,12 +3022,16 @@ std::string AttConverter::PianopedalsPedalstyleToStr(pianopedals_PEDALSTYLE data
     return value;
 }
 
-pianopedals_PEDALSTYLE AttConverter::StrToPianopedalsPedalstyle(std::string value) const
+pianopedals_PEDALSTYLE AttConverter::StrToPianopedalsPedalstyle(const char *value) const
 {
-    if (value == "line") return pianopedals_PEDALSTYLE_line;
-    if (value == "pedstar") return pianopedals_PEDALSTYLE_pedstar;
-    if (value == "altpedstar") return pianopedals_PEDALSTYLE_altpedstar;
-    LogWarning("Unsupported value '%s' for att.pianopedals@pedal.style", value.c_str());
+    static const AttConverterValue<pianopedals_PEDALSTYLE> table[] = {
+        { "line", pianopedals_PEDALSTYLE_line },
+        { "pedstar", pianopedals_PEDALSTYLE_pedstar },
+        { "altpedstar", pianopedals_PEDALSTYLE_altpedstar }
+    };
+    pianopedals_PEDALSTYLE data = pianopedals_PEDALSTYLE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.pianopedals@pedal.style", value);
     return pianopedals_PEDALSTYLE_NONE;
 }
 
@@ -2698,13 +3051,17 @@ std::string AttConverter::PointingXlinkactuateToStr(pointing_XLINKACTUATE data)
     return value;
 }
 
-pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(std::string value) const
+pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(const char *value) const
 {
-    if (value == "onLoad") return pointing_XLINKACTUATE_onLoad;
-    if (value == "onRequest") return pointing_XLINKACTUATE_onRequest;
-    if (value == "none") return pointing_XLINKACTUATE_none;
-    if (value == "other") return pointing_XLINKACTUATE_other;
-    LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value.c_str());
+    static const AttConverterValue<pointing_XLINKACTUATE> table[] = {
+        { "onLoad", pointing_XLINKACTUATE_onLoad },
+        { "onRequest", pointing_XLINKACTUATE_onRequest },
+        { "none", pointing_XLINKACTUATE_none },
+        { "other", pointing_XLINKACTUATE_other }
+    };
+    pointing_XLINKACTUATE data = pointing_XLINKACTUATE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value);
     return pointing_XLINKACTUATE_NONE;
 }
 
@@ -2725,14 +3082,18 @@ std::string AttConverter::PointingXlinkshowToStr(pointing_XLINKSHOW data) const
     return value;
 }
 
-pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(std::string value) const
+pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(const char *value) const
 {
-    if (value == "new") return pointing_XLINKSHOW_new;
-    if (value == "replace") return pointing_XLINKSHOW_replace;
-    if (value == "embed") return pointing_XLINKSHOW_embed;
-    if (value == "none") return pointing_XLINKSHOW_none;
-    if (value == "other") return pointing_XLINKSHOW_other;
-    LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value.c_str());
+    static const AttConverterValue<pointing_XLINKSHOW> table[] = {
+        { "new", pointing_XLINKSHOW_new },
+        { "replace", pointing_XLINKSHOW_replace },
+        { "embed", pointing_XLINKSHOW_embed },
+        { "none", pointing_XLINKSHOW_none },
+        { "other", pointing_XLINKSHOW_other }
+    };
+    pointing_XLINKSHOW data = pointing_XLINKSHOW_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value);
     return pointing_XLINKSHOW_NONE;
 }
 
@@ -2750,11 +3111,15 @@ std::string AttConverter::RegularmethodMethodToStr(regularmethod_METHOD data) co
     return value;
 }
 
-regularmethod_METHOD AttConverter::StrToRegularmethodMethod(std::string value) const
+regularmethod_METHOD AttConverter::StrToRegularmethodMethod(const char *value) const
 {
-    if (value == "silent") return regularmethod_METHOD_silent;
-    if (value == "tags") return regularmethod_METHOD_tags;
-    LogWarning("Unsupported value '%s' for att.regularmethod@method", value.c_str());
+    static const AttConverterValue<regularmethod_METHOD> table[] = {
+        { "silent", regularmethod_METHOD_silent },
+        { "tags", regularmethod_METHOD_tags }
+    };
+    regularmethod_METHOD data = regularmethod_METHOD_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.regularmethod@method", value);
     return regularmethod_METHOD_NONE;
 }
 
@@ -2773,12 +3138,16 @@ std::string AttConverter::RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) co
     return value;
 }
 
-rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(std::string value) const
+rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(const char *value) const
 {
-    if (value == "box") return rehearsal_REHENCLOSE_box;
-    if (value == "circle") return rehearsal_REHENCLOSE_circle;
-    if (value == "none") return rehearsal_REHENCLOSE_none;
-    LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value.c_str());
+    static const AttConverterValue<rehearsal_REHENCLOSE> table[] = {
+        { "box", rehearsal_REHENCLOSE_box },
+        { "circle", rehearsal_REHENCLOSE_circle },
+        { "none", rehearsal_REHENCLOSE_none }
+    };
+    rehearsal_REHENCLOSE data = rehearsal_REHENCLOSE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value);
     return rehearsal_REHENCLOSE_NONE;
 }
 
@@ -2795,10 +3164,14 @@ std::string AttConverter::SbVisFormToStr(sbVis_FORM data) const
     return value;
 }
 
-sbVis_FORM AttConverter::StrToSbVisForm(std::string value) const
+sbVis_FORM AttConverter::StrToSbVisForm(const char *value) const
 {
-    if (value == "hash") return sbVis_FORM_hash;
-    LogWarning("Unsupported value '%s' for att.sb.vis@form", value.c_str());
+    static const AttConverterValue<sbVis_FORM> table[] = {
+        { "hash", sbVis_FORM_hash }
+    };
+    sbVis_FORM data = sbVis_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.sb.vis@form", value);
     return sbVis_FORM_NONE;
 }
 
@@ -2819,14 +3192,18 @@ std::string AttConverter::StaffgroupingsymSymbolToStr(staffgroupingsym_SYMBOL da
     return value;
 }
 
-staffgroupingsym_SYMBOL AttConverter::StrToStaffgroupingsymSymbol(std::string value) const
+staffgroupingsym_SYMBOL AttConverter::StrToStaffgroupingsymSymbol(const char *value) const
 {
-    if (value == "brace") return staffgroupingsym_SYMBOL_brace;
-    if (value == "bracket") return staffgroupingsym_SYMBOL_bracket;
-    if (value == "bracketsq") return staffgroupingsym_SYMBOL_bracketsq;
-    if (value == "line") return staffgroupingsym_SYMBOL_line;
-    if (value == "none") return staffgroupingsym_SYMBOL_none;
-    LogWarning("Unsupported value '%s' for att.staffgroupingsym@symbol", value.c_str());
+    static const AttConverterValue<staffgroupingsym_SYMBOL> table[] = {
+        { "brace", staffgroupingsym_SYMBOL_brace },
+        { "bracket", staffgroupingsym_SYMBOL_bracket },
+        { "bracketsq", staffgroupingsym_SYMBOL_bracketsq },
+        { "line", staffgroupingsym_SYMBOL_line },
+        { "none", staffgroupingsym_SYMBOL_none }
+    };
+    staffgroupingsym_SYMBOL data = staffgroupingsym_SYMBOL_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.staffgroupingsym@symbol", value);
     return staffgroupingsym_SYMBOL_NONE;
 }
 
@@ -2850,17 +3227,21 @@ std::string AttConverter::SylLogConToStr(sylLog_CON data) const
     return value;
 }
 
-sylLog_CON AttConverter::StrToSylLogCon(std::string value) const
+sylLog_CON AttConverter::StrToSylLogCon(const char *value) const
 {
-    if (value == "s") return sylLog_CON_s;
-    if (value == "d") return sylLog_CON_d;
-    if (value == "u") return sylLog_CON_u;
-    if (value == "t") return sylLog_CON_t;
-    if (value == "c") return sylLog_CON_c;
-    if (value == "v") return sylLog_CON_v;
-    if (value == "i") return sylLog_CON_i;
-    if (value == "b") return sylLog_CON_b;
-    LogWarning("Unsupported value '%s' for att.syl.log@con", value.c_str());
+    static const AttConverterValue<sylLog_CON> table[] = {
+        { "s", sylLog_CON_s },
+        { "d", sylLog_CON_d },
+        { "u", sylLog_CON_u },
+        { "t", sylLog_CON_t },
+        { "c", sylLog_CON_c },
+        { "v", sylLog_CON_v },
+        { "i", sylLog_CON_i },
+        { "b", sylLog_CON_b }
+    };
+    sylLog_CON data = sylLog_CON_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.syl.log@con", value);
     return sylLog_CON_NONE;
 }
 
@@ -2879,12 +3260,16 @@ std::string AttConverter::SylLogWordposToStr(sylLog_WORDPOS data) const
     return value;
 }
 
-sylLog_WORDPOS AttConverter::StrToSylLogWordpos(std::string value) const
+sylLog_WORDPOS AttConverter::StrToSylLogWordpos(const char *value) const
 {
-    if (value == "i") return sylLog_WORDPOS_i;
-    if (value == "m") return sylLog_WORDPOS_m;
-    if (value == "t") return sylLog_WORDPOS_t;
-    LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value.c_str());
+    static const AttConverterValue<sylLog_WORDPOS> table[] = {
+        { "i", sylLog_WORDPOS_i },
+        { "m", sylLog_WORDPOS_m },
+        { "t", sylLog_WORDPOS_t }
+    };
+    sylLog_WORDPOS data = sylLog_WORDPOS_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value);
     return sylLog_WORDPOS_NONE;
 }
 
@@ -2903,12 +3288,16 @@ std::string AttConverter::TargetevalEvaluateToStr(targeteval_EVALUATE data) cons
     return value;
 }
 
-targeteval_EVALUATE AttConverter::StrToTargetevalEvaluate(std::string value) const
+targeteval_EVALUATE AttConverter::StrToTargetevalEvaluate(const char *value) const
 {
-    if (value == "all") return targeteval_EVALUATE_all;
-    if (value == "one") return targeteval_EVALUATE_one;
-    if (value == "none") return targeteval_EVALUATE_none;
-    LogWarning("Unsupported value '%s' for att.targeteval@evaluate", value.c_str());
+    static const AttConverterValue<targeteval_EVALUATE> table[] = {
+        { "all", targeteval_EVALUATE_all },
+        { "one", targeteval_EVALUATE_one },
+        { "none", targeteval_EVALUATE_none }
+    };
+    targeteval_EVALUATE data = targeteval_EVALUATE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.targeteval@evaluate", value);
     return targeteval_EVALUATE_NONE;
 }
 
@@ -2928,13 +3317,17 @@ std::string AttConverter::TempoLogFuncToStr(tempoLog_FUNC data) const
     return value;
 }
 
-tempoLog_FUNC AttConverter::StrToTempoLogFunc(std::string value) const
+tempoLog_FUNC AttConverter::StrToTempoLogFunc(const char *value) const
 {
-    if (value == "continuous") return tempoLog_FUNC_continuous;
-    if (value == "instantaneous") return tempoLog_FUNC_instantaneous;
-    if (value == "metricmod") return tempoLog_FUNC_metricmod;
-    if (value == "precedente") return tempoLog_FUNC_precedente;
-    LogWarning("Unsupported value '%s' for att.tempo.log@func", value.c_str());
+    static const AttConverterValue<tempoLog_FUNC> table[] = {
+        { "continuous", tempoLog_FUNC_continuous },
+        { "instantaneous", tempoLog_FUNC_instantaneous },
+        { "metricmod", tempoLog_FUNC_metricmod },
+        { "precedente", tempoLog_FUNC_precedente }
+    };
+    tempoLog_FUNC data = tempoLog_FUNC_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.tempo.log@func", value);
     return tempoLog_FUNC_NONE;
 }
 
@@ -2952,11 +3345,15 @@ std::string AttConverter::TupletVisNumformatToStr(tupletVis_NUMFORMAT data) cons
     return value;
 }
 
-tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(std::string value) const
+tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(const char *value) const
 {
-    if (value == "count") return tupletVis_NUMFORMAT_count;
-    if (value == "ratio") return tupletVis_NUMFORMAT_ratio;
-    LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value.c_str());
+    static const AttConverterValue<tupletVis_NUMFORMAT> table[] = {
+        { "count", tupletVis_NUMFORMAT_count },
+        { "ratio", tupletVis_NUMFORMAT_ratio }
+    };
+    tupletVis_NUMFORMAT data = tupletVis_NUMFORMAT_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value);
     return tupletVis_NUMFORMAT_NONE;
 }
 
@@ -2974,11 +3371,15 @@ std::string AttConverter::TurnLogFormToStr(turnLog_FORM data) const
     return value;
 }
 
-turnLog_FORM AttConverter::StrToTurnLogForm(std::string value) const
+turnLog_FORM AttConverter::StrToTurnLogForm(const char *value) const
 {
-    if (value == "inv") return turnLog_FORM_inv;
-    if (value == "norm") return turnLog_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.turn.log@form", value.c_str());
+    static const AttConverterValue<turnLog_FORM> table[] = {
+        { "inv", turnLog_FORM_inv },
+        { "norm", turnLog_FORM_norm }
+    };
+    turnLog_FORM data = turnLog_FORM_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.turn.log@form", value);
     return turnLog_FORM_NONE;
 }
 
@@ -2996,11 +3397,15 @@ std::string AttConverter::WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) cons
     return value;
 }
 
-whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(std::string value) const
+whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(const char *value) const
 {
-    if (value == "default") return whitespace_XMLSPACE_default;
-    if (value == "preserve") return whitespace_XMLSPACE_preserve;
-    LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value.c_str());
+    static const AttConverterValue<whitespace_XMLSPACE> table[] = {
+        { "default", whitespace_XMLSPACE_default },
+        { "preserve", whitespace_XMLSPACE_preserve }
+    };
+    whitespace_XMLSPACE data = whitespace_XMLSPACE_NONE;
+    if (FindInTable(table, value, &data)) return data;
+    LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value);
     return whitespace_XMLSPACE_NONE;
 }
 
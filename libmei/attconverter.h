@@ -30,283 +30,466 @@ namespace vrv {
 class AttConverter {
 public:
     std::string AccidentalExplicitToStr(data_ACCIDENTAL_EXPLICIT data) const;
-    data_ACCIDENTAL_EXPLICIT StrToAccidentalExplicit(std::string value) const;
+    data_ACCIDENTAL_EXPLICIT StrToAccidentalExplicit(const char *value) const;
+    data_ACCIDENTAL_EXPLICIT StrToAccidentalExplicit(const std::string &value) const
+    {
+        return StrToAccidentalExplicit(value.c_str());
+    }
 
     std::string AccidentalImplicitToStr(data_ACCIDENTAL_IMPLICIT data) const;
-    data_ACCIDENTAL_IMPLICIT StrToAccidentalImplicit(std::string value) const;
+    data_ACCIDENTAL_IMPLICIT StrToAccidentalImplicit(const char *value) const;
+    data_ACCIDENTAL_IMPLICIT StrToAccidentalImplicit(const std::string &value) const
+    {
+        return StrToAccidentalImplicit(value.c_str());
+    }
 
     std::string ArticulationToStr(data_ARTICULATION data) const;
-    data_ARTICULATION StrToArticulation(std::string value) const;
+    data_ARTICULATION StrToArticulation(const char *value) const;
+    data_ARTICULATION StrToArticulation(const std::string &value) const { return StrToArticulation(value.c_str()); }
 
     std::string BarplaceToStr(data_BARPLACE data) const;
-    data_BARPLACE StrToBarplace(std::string value) const;
+    data_BARPLACE StrToBarplace(const char *value) const;
+    data_BARPLACE StrToBarplace(const std::string &value) const { return StrToBarplace(value.c_str()); }
 
     std::string BarrenditionToStr(data_BARRENDITION data) const;
-    data_BARRENDITION StrToBarrendition(std::string value) const;
+    data_BARRENDITION StrToBarrendition(const char *value) const;
+    data_BARRENDITION StrToBarrendition(const std::string &value) const { return StrToBarrendition(value.c_str()); }
 
     std::string BetypeToStr(data_BETYPE data) const;
-    data_BETYPE StrToBetype(std::string value) const;
+    data_BETYPE StrToBetype(const char *value) const;
+    data_BETYPE StrToBetype(const std::string &value) const { return StrToBetype(value.c_str()); }
 
     std::string BooleanToStr(data_BOOLEAN data) const;
-    data_BOOLEAN StrToBoolean(std::string value) const;
+    data_BOOLEAN StrToBoolean(const char *value) const;
+    data_BOOLEAN StrToBoolean(const std::string &value) const { return StrToBoolean(value.c_str()); }
 
     std::string CertaintyToStr(data_CERTAINTY data) const;
-    data_CERTAINTY StrToCertainty(std::string value) const;
+    data_CERTAINTY StrToCertainty(const char *value) const;
+    data_CERTAINTY StrToCertainty(const std::string &value) const { return StrToCertainty(value.c_str()); }
 
     std::string ClefshapeToStr(data_CLEFSHAPE data) const;
-    data_CLEFSHAPE StrToClefshape(std::string value) const;
+    data_CLEFSHAPE StrToClefshape(const char *value) const;
+    data_CLEFSHAPE StrToClefshape(const std::string &value) const { return StrToClefshape(value.c_str()); }
 
     std::string ClusterToStr(data_CLUSTER data) const;
-    data_CLUSTER StrToCluster(std::string value) const;
+    data_CLUSTER StrToCluster(const char *value) const;
+    data_CLUSTER StrToCluster(const std::string &value) const { return StrToCluster(value.c_str()); }
 
     std::string ColornamesToStr(data_COLORNAMES data) const;
-    data_COLORNAMES StrToColornames(std::string value) const;
+    data_COLORNAMES StrToColornames(const char *value) const;
+    data_COLORNAMES StrToColornames(const std::string &value) const { return StrToColornames(value.c_str()); }
 
     std::string EnclosureToStr(data_ENCLOSURE data) const;
-    data_ENCLOSURE StrToEnclosure(std::string value) const;
+    data_ENCLOSURE StrToEnclosure(const char *value) const;
+    data_ENCLOSURE StrToEnclosure(const std::string &value) const { return StrToEnclosure(value.c_str()); }
 
     std::string FillToStr(data_FILL data) const;
-    data_FILL StrToFill(std::string value) const;
+    data_FILL StrToFill(const char *value) const;
+    data_FILL StrToFill(const std::string &value) const { return StrToFill(value.c_str()); }
 
     std::string FontsizetermToStr(data_FONTSIZETERM data) const;
-    data_FONTSIZETERM StrToFontsizeterm(std::string value) const;
+    data_FONTSIZETERM StrToFontsizeterm(const char *value) const;
+    data_FONTSIZETERM StrToFontsizeterm(const std::string &value) const { return StrToFontsizeterm(value.c_str()); }
 
     std::string FontstyleToStr(data_FONTSTYLE data) const;
-    data_FONTSTYLE StrToFontstyle(std::string value) const;
+    data_FONTSTYLE StrToFontstyle(const char *value) const;
+    data_FONTSTYLE StrToFontstyle(const std::string &value) const { return StrToFontstyle(value.c_str()); }
 
     std::string FontweightToStr(data_FONTWEIGHT data) const;
-    data_FONTWEIGHT StrToFontweight(std::string value) const;
+    data_FONTWEIGHT StrToFontweight(const char *value) const;
+    data_FONTWEIGHT StrToFontweight(const std::string &value) const { return StrToFontweight(value.c_str()); }
 
     std::string GlissandoToStr(data_GLISSANDO data) const;
-    data_GLISSANDO StrToGlissando(std::string value) const;
+    data_GLISSANDO StrToGlissando(const char *value) const;
+    data_GLISSANDO StrToGlissando(const std::string &value) const { return StrToGlissando(value.c_str()); }
 
     std::string GraceToStr(data_GRACE data) const;
-    data_GRACE StrToGrace(std::string value) const;
+    data_GRACE StrToGrace(const char *value) const;
+    data_GRACE StrToGrace(const std::string &value) const { return StrToGrace(value.c_str()); }
 
     std::string HeadshapeListToStr(data_HEADSHAPE_list data) const;
-    data_HEADSHAPE_list StrToHeadshapeList(std::string value) const;
+    data_HEADSHAPE_list StrToHeadshapeList(const char *value) const;
+    data_HEADSHAPE_list StrToHeadshapeList(const std::string &value) const { return StrToHeadshapeList(value.c_str()); }
 
     std::string HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data) const;
-    data_HORIZONTALALIGNMENT StrToHorizontalalignment(std::string value) const;
+    data_HORIZONTALALIGNMENT StrToHorizontalalignment(const char *value) const;
+    data_HORIZONTALALIGNMENT StrToHorizontalalignment(const std::string &value) const
+    {
+        return StrToHorizontalalignment(value.c_str());
+    }
 
     std::string IneumeformToStr(data_INEUMEFORM data) const;
-    data_INEUMEFORM StrToIneumeform(std::string value) const;
+    data_INEUMEFORM StrToIneumeform(const char *value) const;
+    data_INEUMEFORM StrToIneumeform(const std::string &value) const { return StrToIneumeform(value.c_str()); }
 
     std::string IneumenameToStr(data_INEUMENAME data) const;
-    data_INEUMENAME StrToIneumename(std::string value) const;
+    data_INEUMENAME StrToIneumename(const char *value) const;
+    data_INEUMENAME StrToIneumename(const std::string &value) const { return StrToIneumename(value.c_str()); }
 
     std::string LayerschemeToStr(data_LAYERSCHEME data) const;
-    data_LAYERSCHEME StrToLayerscheme(std::string value) const;
+    data_LAYERSCHEME StrToLayerscheme(const char *value) const;
+    data_LAYERSCHEME StrToLayerscheme(const std::string &value) const { return StrToLayerscheme(value.c_str()); }
 
     std::string LigatureformToStr(data_LIGATUREFORM data) const;
-    data_LIGATUREFORM StrToLigatureform(std::string value) const;
+    data_LIGATUREFORM StrToLigatureform(const char *value) const;
+    data_LIGATUREFORM StrToLigatureform(const std::string &value) const { return StrToLigatureform(value.c_str()); }
 
     std::string LineformToStr(data_LINEFORM data) const;
-    data_LINEFORM StrToLineform(std::string value) const;
+    data_LINEFORM StrToLineform(const char *value) const;
+    data_LINEFORM StrToLineform(const std::string &value) const { return StrToLineform(value.c_str()); }
 
     std::string LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data) const;
-    data_LINESTARTENDSYMBOL StrToLinestartendsymbol(std::string value) const;
+    data_LINESTARTENDSYMBOL StrToLinestartendsymbol(const char *value) const;
+    data_LINESTARTENDSYMBOL StrToLinestartendsymbol(const std::string &value) const
+    {
+        return StrToLinestartendsymbol(value.c_str());
+    }
 
     std::string LinewidthtermToStr(data_LINEWIDTHTERM data) const;
-    data_LINEWIDTHTERM StrToLinewidthterm(std::string value) const;
+    data_LINEWIDTHTERM StrToLinewidthterm(const char *value) const;
+    data_LINEWIDTHTERM StrToLinewidthterm(const std::string &value) const { return StrToLinewidthterm(value.c_str()); }
 
     std::string MelodicfunctionToStr(data_MELODICFUNCTION data) const;
-    data_MELODICFUNCTION StrToMelodicfunction(std::string value) const;
+    data_MELODICFUNCTION StrToMelodicfunction(const char *value) const;
+    data_MELODICFUNCTION StrToMelodicfunction(const std::string &value) const
+    {
+        return StrToMelodicfunction(value.c_str());
+    }
 
     std::string MensurationsignToStr(data_MENSURATIONSIGN data) const;
-    data_MENSURATIONSIGN StrToMensurationsign(std::string value) const;
+    data_MENSURATIONSIGN StrToMensurationsign(const char *value) const;
+    data_MENSURATIONSIGN StrToMensurationsign(const std::string &value) const
+    {
+        return StrToMensurationsign(value.c_str());
+    }
 
     std::string MetersignToStr(data_METERSIGN data) const;
-    data_METERSIGN StrToMetersign(std::string value) const;
+    data_METERSIGN StrToMetersign(const char *value) const;
+    data_METERSIGN StrToMetersign(const std::string &value) const { return StrToMetersign(value.c_str()); }
 
     std::string MidinamesToStr(data_MIDINAMES data) const;
-    data_MIDINAMES StrToMidinames(std::string value) const;
+    data_MIDINAMES StrToMidinames(const char *value) const;
+    data_MIDINAMES StrToMidinames(const std::string &value) const { return StrToMidinames(value.c_str()); }
 
     std::string ModeToStr(data_MODE data) const;
-    data_MODE StrToMode(std::string value) const;
+    data_MODE StrToMode(const char *value) const;
+    data_MODE StrToMode(const std::string &value) const { return StrToMode(value.c_str()); }
 
     std::string NotationtypeToStr(data_NOTATIONTYPE data) const;
-    data_NOTATIONTYPE StrToNotationtype(std::string value) const;
+    data_NOTATIONTYPE StrToNotationtype(const char *value) const;
+    data_NOTATIONTYPE StrToNotationtype(const std::string &value) const { return StrToNotationtype(value.c_str()); }
 
     std::string NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list data) const;
-    data_NOTEHEADMODIFIER_list StrToNoteheadmodifierList(std::string value) const;
+    data_NOTEHEADMODIFIER_list StrToNoteheadmodifierList(const char *value) const;
+    data_NOTEHEADMODIFIER_list StrToNoteheadmodifierList(const std::string &value) const
+    {
+        return StrToNoteheadmodifierList(value.c_str());
+    }
 
     std::string OtherstaffToStr(data_OTHERSTAFF data) const;
-    data_OTHERSTAFF StrToOtherstaff(std::string value) const;
+    data_OTHERSTAFF StrToOtherstaff(const char *value) const;
+    data_OTHERSTAFF StrToOtherstaff(const std::string &value) const { return StrToOtherstaff(value.c_str()); }
 
     std::string PlaceToStr(data_PLACE data) const;
-    data_PLACE StrToPlace(std::string value) const;
+    data_PLACE StrToPlace(const char *value) const;
+    data_PLACE StrToPlace(const std::string &value) const { return StrToPlace(value.c_str()); }
 
     std::string RotationdirectionToStr(data_ROTATIONDIRECTION data) const;
-    data_ROTATIONDIRECTION StrToRotationdirection(std::string value) const;
+    data_ROTATIONDIRECTION StrToRotationdirection(const char *value) const;
+    data_ROTATIONDIRECTION StrToRotationdirection(const std::string &value) const
+    {
+        return StrToRotationdirection(value.c_str());
+    }
 
     std::string SizeToStr(data_SIZE data) const;
-    data_SIZE StrToSize(std::string value) const;
+    data_SIZE StrToSize(const char *value) const;
+    data_SIZE StrToSize(const std::string &value) const { return StrToSize(value.c_str()); }
 
     std::string StaffrelToStr(data_STAFFREL data) const;
-    data_STAFFREL StrToStaffrel(std::string value) const;
+    data_STAFFREL StrToStaffrel(const char *value) const;
+    data_STAFFREL StrToStaffrel(const std::string &value) const { return StrToStaffrel(value.c_str()); }
 
     std::string StemmodifierToStr(data_STEMMODIFIER data) const;
-    data_STEMMODIFIER StrToStemmodifier(std::string value) const;
+    data_STEMMODIFIER StrToStemmodifier(const char *value) const;
+    data_STEMMODIFIER StrToStemmodifier(const std::string &value) const { return StrToStemmodifier(value.c_str()); }
 
     std::string StempositionToStr(data_STEMPOSITION data) const;
-    data_STEMPOSITION StrToStemposition(std::string value) const;
+    data_STEMPOSITION StrToStemposition(const char *value) const;
+    data_STEMPOSITION StrToStemposition(const std::string &value) const { return StrToStemposition(value.c_str()); }
 
     std::string TemperamentToStr(data_TEMPERAMENT data) const;
-    data_TEMPERAMENT StrToTemperament(std::string value) const;
+    data_TEMPERAMENT StrToTemperament(const char *value) const;
+    data_TEMPERAMENT StrToTemperament(const std::string &value) const { return StrToTemperament(value.c_str()); }
 
     std::string TextrenditionlistToStr(data_TEXTRENDITIONLIST data) const;
-    data_TEXTRENDITIONLIST StrToTextrenditionlist(std::string value) const;
+    data_TEXTRENDITIONLIST StrToTextrenditionlist(const char *value) const;
+    data_TEXTRENDITIONLIST StrToTextrenditionlist(const std::string &value) const
+    {
+        return StrToTextrenditionlist(value.c_str());
+    }
 
     std::string UneumeformToStr(data_UNEUMEFORM data) const;
-    data_UNEUMEFORM StrToUneumeform(std::string value) const;
+    data_UNEUMEFORM StrToUneumeform(const char *value) const;
+    data_UNEUMEFORM StrToUneumeform(const std::string &value) const { return StrToUneumeform(value.c_str()); }
 
     std::string UneumenameToStr(data_UNEUMENAME data) const;
-    data_UNEUMENAME StrToUneumename(std::string value) const;
+    data_UNEUMENAME StrToUneumename(const char *value) const;
+    data_UNEUMENAME StrToUneumename(const std::string &value) const { return StrToUneumename(value.c_str()); }
 
     std::string AccidLogFuncToStr(accidLog_FUNC data) const;
-    accidLog_FUNC StrToAccidLogFunc(std::string value) const;
+    accidLog_FUNC StrToAccidLogFunc(const char *value) const;
+    accidLog_FUNC StrToAccidLogFunc(const std::string &value) const { return StrToAccidLogFunc(value.c_str()); }
 
     std::string ArpegLogOrderToStr(arpegLog_ORDER data) const;
-    arpegLog_ORDER StrToArpegLogOrder(std::string value) const;
+    arpegLog_ORDER StrToArpegLogOrder(const char *value) const;
+    arpegLog_ORDER StrToArpegLogOrder(const std::string &value) const { return StrToArpegLogOrder(value.c_str()); }
 
     std::string BTremLogFormToStr(bTremLog_FORM data) const;
-    bTremLog_FORM StrToBTremLogForm(std::string value) const;
+    bTremLog_FORM StrToBTremLogForm(const char *value) const;
+    bTremLog_FORM StrToBTremLogForm(const std::string &value) const { return StrToBTremLogForm(value.c_str()); }
 
     std::string BeamingVisBeamrendToStr(beamingVis_BEAMREND data) const;
-    beamingVis_BEAMREND StrToBeamingVisBeamrend(std::string value) const;
+    beamingVis_BEAMREND StrToBeamingVisBeamrend(const char *value) const;
+    beamingVis_BEAMREND StrToBeamingVisBeamrend(const std::string &value) const
+    {
+        return StrToBeamingVisBeamrend(value.c_str());
+    }
 
     std::string BeamrendFormToStr(beamrend_FORM data) const;
-    beamrend_FORM StrToBeamrendForm(std::string value) const;
+    beamrend_FORM StrToBeamrendForm(const char *value) const;
+    beamrend_FORM StrToBeamrendForm(const std::string &value) const { return StrToBeamrendForm(value.c_str()); }
 
     std::string CurvatureCurvedirToStr(curvature_CURVEDIR data) const;
-    curvature_CURVEDIR StrToCurvatureCurvedir(std::string value) const;
+    curvature_CURVEDIR StrToCurvatureCurvedir(const char *value) const;
+    curvature_CURVEDIR StrToCurvatureCurvedir(const std::string &value) const
+    {
+        return StrToCurvatureCurvedir(value.c_str());
+    }
 
     std::string CutoutCutoutToStr(cutout_CUTOUT data) const;
-    cutout_CUTOUT StrToCutoutCutout(std::string value) const;
+    cutout_CUTOUT StrToCutoutCutout(const char *value) const;
+    cutout_CUTOUT StrToCutoutCutout(const std::string &value) const { return StrToCutoutCutout(value.c_str()); }
 
     std::string DotLogFormToStr(dotLog_FORM data) const;
-    dotLog_FORM StrToDotLogForm(std::string value) const;
+    dotLog_FORM StrToDotLogForm(const char *value) const;
+    dotLog_FORM StrToDotLogForm(const std::string &value) const { return StrToDotLogForm(value.c_str()); }
 
     std::string EndingsEndingrendToStr(endings_ENDINGREND data) const;
-    endings_ENDINGREND StrToEndingsEndingrend(std::string value) const;
+    endings_ENDINGREND StrToEndingsEndingrend(const char *value) const;
+    endings_ENDINGREND StrToEndingsEndingrend(const std::string &value) const
+    {
+        return StrToEndingsEndingrend(value.c_str());
+    }
 
     std::string FTremLogFormToStr(fTremLog_FORM data) const;
-    fTremLog_FORM StrToFTremLogForm(std::string value) const;
+    fTremLog_FORM StrToFTremLogForm(const char *value) const;
+    fTremLog_FORM StrToFTremLogForm(const std::string &value) const { return StrToFTremLogForm(value.c_str()); }
 
     std::string FermataVisFormToStr(fermataVis_FORM data) const;
-    fermataVis_FORM StrToFermataVisForm(std::string value) const;
+    fermataVis_FORM StrToFermataVisForm(const char *value) const;
+    fermataVis_FORM StrToFermataVisForm(const std::string &value) const { return StrToFermataVisForm(value.c_str()); }
 
     std::string FermataVisShapeToStr(fermataVis_SHAPE data) const;
-    fermataVis_SHAPE StrToFermataVisShape(std::string value) const;
+    fermataVis_SHAPE StrToFermataVisShape(const char *value) const;
+    fermataVis_SHAPE StrToFermataVisShape(const std::string &value) const
+    {
+        return StrToFermataVisShape(value.c_str());
+    }
 
     std::string HairpinLogFormToStr(hairpinLog_FORM data) const;
-    hairpinLog_FORM StrToHairpinLogForm(std::string value) const;
+    hairpinLog_FORM StrToHairpinLogForm(const char *value) const;
+    hairpinLog_FORM StrToHairpinLogForm(const std::string &value) const { return StrToHairpinLogForm(value.c_str()); }
 
     std::string HarmVisRendgridToStr(harmVis_RENDGRID data) const;
-    harmVis_RENDGRID StrToHarmVisRendgrid(std::string value) const;
+    harmVis_RENDGRID StrToHarmVisRendgrid(const char *value) const;
+    harmVis_RENDGRID StrToHarmVisRendgrid(const std::string &value) const
+    {
+        return StrToHarmVisRendgrid(value.c_str());
+    }
 
     std::string HarpPedalLogAToStr(harpPedalLog_A data) const;
-    harpPedalLog_A StrToHarpPedalLogA(std::string value) const;
+    harpPedalLog_A StrToHarpPedalLogA(const char *value) const;
+    harpPedalLog_A StrToHarpPedalLogA(const std::string &value) const { return StrToHarpPedalLogA(value.c_str()); }
 
     std::string HarpPedalLogBToStr(harpPedalLog_B data) const;
-    harpPedalLog_B StrToHarpPedalLogB(std::string value) const;
+    harpPedalLog_B StrToHarpPedalLogB(const char *value) const;
+    harpPedalLog_B StrToHarpPedalLogB(const std::string &value) const { return StrToHarpPedalLogB(value.c_str()); }
 
     std::string HarpPedalLogCToStr(harpPedalLog_C data) const;
-    harpPedalLog_C StrToHarpPedalLogC(std::string value) const;
+    harpPedalLog_C StrToHarpPedalLogC(const char *value) const;
+    harpPedalLog_C StrToHarpPedalLogC(const std::string &value) const { return StrToHarpPedalLogC(value.c_str()); }
 
     std::string HarpPedalLogDToStr(harpPedalLog_D data) const;
-    harpPedalLog_D StrToHarpPedalLogD(std::string value) const;
+    harpPedalLog_D StrToHarpPedalLogD(const char *value) const;
+    harpPedalLog_D StrToHarpPedalLogD(const std::string &value) const { return StrToHarpPedalLogD(value.c_str()); }
 
     std::string HarpPedalLogEToStr(harpPedalLog_E data) const;
-    harpPedalLog_E StrToHarpPedalLogE(std::string value) const;
+    harpPedalLog_E StrToHarpPedalLogE(const char *value) const;
+    harpPedalLog_E StrToHarpPedalLogE(const std::string &value) const { return StrToHarpPedalLogE(value.c_str()); }
 
     std::string HarpPedalLogFToStr(harpPedalLog_F data) const;
-    harpPedalLog_F StrToHarpPedalLogF(std::string value) const;
+    harpPedalLog_F StrToHarpPedalLogF(const char *value) const;
+    harpPedalLog_F StrToHarpPedalLogF(const std::string &value) const { return StrToHarpPedalLogF(value.c_str()); }
 
     std::string HarpPedalLogGToStr(harpPedalLog_G data) const;
-    harpPedalLog_G StrToHarpPedalLogG(std::string value) const;
+    harpPedalLog_G StrToHarpPedalLogG(const char *value) const;
+    harpPedalLog_G StrToHarpPedalLogG(const std::string &value) const { return StrToHarpPedalLogG(value.c_str()); }
 
     std::string MeiversionMeiversionToStr(meiversion_MEIVERSION data) const;
-    meiversion_MEIVERSION StrToMeiversionMeiversion(std::string value) const;
+    meiversion_MEIVERSION StrToMeiversionMeiversion(const char *value) const;
+    meiversion_MEIVERSION StrToMeiversionMeiversion(const std::string &value) const
+    {
+        return StrToMeiversionMeiversion(value.c_str());
+    }
 
     std::string MensurVisFormToStr(mensurVis_FORM data) const;
-    mensurVis_FORM StrToMensurVisForm(std::string value) const;
+    mensurVis_FORM StrToMensurVisForm(const char *value) const;
+    mensurVis_FORM StrToMensurVisForm(const std::string &value) const { return StrToMensurVisForm(value.c_str()); }
 
     std::string MensuralVisMensurformToStr(mensuralVis_MENSURFORM data) const;
-    mensuralVis_MENSURFORM StrToMensuralVisMensurform(std::string value) const;
+    mensuralVis_MENSURFORM StrToMensuralVisMensurform(const char *value) const;
+    mensuralVis_MENSURFORM StrToMensuralVisMensurform(const std::string &value) const
+    {
+        return StrToMensuralVisMensurform(value.c_str());
+    }
 
     std::string MeterSigVisFormToStr(meterSigVis_FORM data) const;
-    meterSigVis_FORM StrToMeterSigVisForm(std::string value) const;
+    meterSigVis_FORM StrToMeterSigVisForm(const char *value) const;
+    meterSigVis_FORM StrToMeterSigVisForm(const std::string &value) const
+    {
+        return StrToMeterSigVisForm(value.c_str());
+    }
 
     std::string MeterSigDefaultVisMeterrendToStr(meterSigDefaultVis_METERREND data) const;
-    meterSigDefaultVis_METERREND StrToMeterSigDefaultVisMeterrend(std::string value) const;
+    meterSigDefaultVis_METERREND StrToMeterSigDefaultVisMeterrend(const char *value) const;
+    meterSigDefaultVis_METERREND StrToMeterSigDefaultVisMeterrend(const std::string &value) const
+    {
+        return StrToMeterSigDefaultVisMeterrend(value.c_str());
+    }
 
     std::string MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) const;
-    meterSigGrpLog_FUNC StrToMeterSigGrpLogFunc(std::string value) const;
+    meterSigGrpLog_FUNC StrToMeterSigGrpLogFunc(const char *value) const;
+    meterSigGrpLog_FUNC StrToMeterSigGrpLogFunc(const std::string &value) const
+    {
+        return StrToMeterSigGrpLogFunc(value.c_str());
+    }
 
     std::string MeterconformanceMetconToStr(meterconformance_METCON data) const;
-    meterconformance_METCON StrToMeterconformanceMetcon(std::string value) const;
+    meterconformance_METCON StrToMeterconformanceMetcon(const char *value) const;
+    meterconformance_METCON StrToMeterconformanceMetcon(const std::string &value) const
+    {
+        return StrToMeterconformanceMetcon(value.c_str());
+    }
 
     std::string MordentLogFormToStr(mordentLog_FORM data) const;
-    mordentLog_FORM StrToMordentLogForm(std::string value) const;
+    mordentLog_FORM StrToMordentLogForm(const char *value) const;
+    mordentLog_FORM StrToMordentLogForm(const std::string &value) const { return StrToMordentLogForm(value.c_str()); }
 
     std::string NoteLogMensuralLigToStr(noteLogMensural_LIG data) const;
-    noteLogMensural_LIG StrToNoteLogMensuralLig(std::string value) const;
+    noteLogMensural_LIG StrToNoteLogMensuralLig(const char *value) const;
+    noteLogMensural_LIG StrToNoteLogMensuralLig(const std::string &value) const
+    {
+        return StrToNoteLogMensuralLig(value.c_str());
+    }
 
     std::string OctaveLogCollToStr(octaveLog_COLL data) const;
-    octaveLog_COLL StrToOctaveLogColl(std::string value) const;
+    octaveLog_COLL StrToOctaveLogColl(const char *value) const;
+    octaveLog_COLL StrToOctaveLogColl(const std::string &value) const { return StrToOctaveLogColl(value.c_str()); }
 
     std::string PbVisFoliumToStr(pbVis_FOLIUM data) const;
-    pbVis_FOLIUM StrToPbVisFolium(std::string value) const;
+    pbVis_FOLIUM StrToPbVisFolium(const char *value) const;
+    pbVis_FOLIUM StrToPbVisFolium(const std::string &value) const { return StrToPbVisFolium(value.c_str()); }
 
     std::string PedalLogDirToStr(pedalLog_DIR data) const;
-    pedalLog_DIR StrToPedalLogDir(std::string value) const;
+    pedalLog_DIR StrToPedalLogDir(const char *value) const;
+    pedalLog_DIR StrToPedalLogDir(const std::string &value) const { return StrToPedalLogDir(value.c_str()); }
 
     std::string PedalVisFormToStr(pedalVis_FORM data) const;
-    pedalVis_FORM StrToPedalVisForm(std::string value) const;
+    pedalVis_FORM StrToPedalVisForm(const char *value) const;
+    pedalVis_FORM StrToPedalVisForm(const std::string &value) const { return StrToPedalVisForm(value.c_str()); }
 
     std::string PianopedalsPedalstyleToStr(pianopedals_PEDALSTYLE data) const;
-    pianopedals_PEDALSTYLE StrToPianopedalsPedalstyle(std::string value) const;
+    pianopedals_PEDALSTYLE StrToPianopedalsPedalstyle(const char *value) const;
+    pianopedals_PEDALSTYLE StrToPianopedalsPedalstyle(const std::string &value) const
+    {
+        return StrToPianopedalsPedalstyle(value.c_str());
+    }
 
     std::string PointingXlinkactuateToStr(pointing_XLINKACTUATE data) const;
-    pointing_XLINKACTUATE StrToPointingXlinkactuate(std::string value) const;
+    pointing_XLINKACTUATE StrToPointingXlinkactuate(const char *value) const;
+    pointing_XLINKACTUATE StrToPointingXlinkactuate(const std::string &value) const
+    {
+        return StrToPointingXlinkactuate(value.c_str());
+    }
 
     std::string PointingXlinkshowToStr(pointing_XLINKSHOW data) const;
-    pointing_XLINKSHOW StrToPointingXlinkshow(std::string value) const;
+    pointing_XLINKSHOW StrToPointingXlinkshow(const char *value) const;
+    pointing_XLINKSHOW StrToPointingXlinkshow(const std::string &value) const
+    {
+        return StrToPointingXlinkshow(value.c_str());
+    }
 
     std::string RegularmethodMethodToStr(regularmethod_METHOD data) const;
-    regularmethod_METHOD StrToRegularmethodMethod(std::string value) const;
+    regularmethod_METHOD StrToRegularmethodMethod(const char *value) const;
+    regularmethod_METHOD StrToRegularmethodMethod(const std::string &value) const
+    {
+        return StrToRegularmethodMethod(value.c_str());
+    }
 
     std::string RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) const;
-    rehearsal_REHENCLOSE StrToRehearsalRehenclose(std::string value) const;
+    rehearsal_REHENCLOSE StrToRehearsalRehenclose(const char *value) const;
+    rehearsal_REHENCLOSE StrToRehearsalRehenclose(const std::string &value) const
+    {
+        return StrToRehearsalRehenclose(value.c_str());
+    }
 
     std::string SbVisFormToStr(sbVis_FORM data) const;
-    sbVis_FORM StrToSbVisForm(std::string value) const;
+    sbVis_FORM StrToSbVisForm(const char *value) const;
+    sbVis_FORM StrToSbVisForm(const std::string &value) const { return StrToSbVisForm(value.c_str()); }
 
     std::string StaffgroupingsymSymbolToStr(staffgroupingsym_SYMBOL data) const;
-    staffgroupingsym_SYMBOL StrToStaffgroupingsymSymbol(std::string value) const;
+    staffgroupingsym_SYMBOL StrToStaffgroupingsymSymbol(const char *value) const;
+    staffgroupingsym_SYMBOL StrToStaffgroupingsymSymbol(const std::string &value) const
+    {
+        return StrToStaffgroupingsymSymbol(value.c_str());
+    }
 
     std::string SylLogConToStr(sylLog_CON data) const;
-    sylLog_CON StrToSylLogCon(std::string value) const;
+    sylLog_CON StrToSylLogCon(const char *value) const;
+    sylLog_CON StrToSylLogCon(const std::string &value) const { return StrToSylLogCon(value.c_str()); }
 
     std::string SylLogWordposToStr(sylLog_WORDPOS data) const;
-    sylLog_WORDPOS StrToSylLogWordpos(std::string value) const;
+    sylLog_WORDPOS StrToSylLogWordpos(const char *value) const;
+    sylLog_WORDPOS StrToSylLogWordpos(const std::string &value) const { return StrToSylLogWordpos(value.c_str()); }
 
     std::string TargetevalEvaluateToStr(targeteval_EVALUATE data) const;
-    targeteval_EVALUATE StrToTargetevalEvaluate(std::string value) const;
+    targeteval_EVALUATE StrToTargetevalEvaluate(const char *value) const;
+    targeteval_EVALUATE StrToTargetevalEvaluate(const std::string &value) const
+    {
+        return StrToTargetevalEvaluate(value.c_str());
+    }
 
     std::string TempoLogFuncToStr(tempoLog_FUNC data) const;
-    tempoLog_FUNC StrToTempoLogFunc(std::string value) const;
+    tempoLog_FUNC StrToTempoLogFunc(const char *value) const;
+    tempoLog_FUNC StrToTempoLogFunc(const std::string &value) const { return StrToTempoLogFunc(value.c_str()); }
 
     std::string TupletVisNumformatToStr(tupletVis_NUMFORMAT data) const;
-    tupletVis_NUMFORMAT StrToTupletVisNumformat(std::string value) const;
+    tupletVis_NUMFORMAT StrToTupletVisNumformat(const char *value) const;
+    tupletVis_NUMFORMAT StrToTupletVisNumformat(const std::string &value) const
+    {
+        return StrToTupletVisNumformat(value.c_str());
+    }
 
     std::string TurnLogFormToStr(turnLog_FORM data) const;
-    turnLog_FORM StrToTurnLogForm(std::string value) const;
+    turnLog_FORM StrToTurnLogForm(const char *value) const;
+    turnLog_FORM StrToTurnLogForm(const std::string &value) const { return StrToTurnLogForm(value.c_str()); }
 
     std::string WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) const;
-    whitespace_XMLSPACE StrToWhitespaceXmlspace(std::string value) const;
+    whitespace_XMLSPACE StrToWhitespaceXmlspace(const char *value) const;
+    whitespace_XMLSPACE StrToWhitespaceXmlspace(const std::string &value) const
+    {
+        return StrToWhitespaceXmlspace(value.c_str());
+    }
 };
 
 } // vrv namespace
@@ -49,37 +49,43 @@ void AttCommonAnl::ResetCommonAnl()
     m_synch = "";
 }
 
-bool AttCommonAnl::ReadCommonAnl(pugi::xml_node element)
+bool AttCommonAnl::ReadCommonAnl(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("copyof")) {
-        this->SetCopyof(StrToStr(element.attribute("copyof").value()));
-        element.remove_attribute("copyof");
+    pugi::xml_attribute attr = element.attribute("copyof");
+    if (attr) {
+        this->SetCopyof(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("corresp")) {
-        this->SetCorresp(StrToStr(element.attribute("corresp").value()));
-        element.remove_attribute("corresp");
+    attr = element.attribute("corresp");
+    if (attr) {
+        this->SetCorresp(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("next")) {
-        this->SetNext(StrToStr(element.attribute("next").value()));
-        element.remove_attribute("next");
+    attr = element.attribute("next");
+    if (attr) {
+        this->SetNext(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("prev")) {
-        this->SetPrev(StrToStr(element.attribute("prev").value()));
-        element.remove_attribute("prev");
+    attr = element.attribute("prev");
+    if (attr) {
+        this->SetPrev(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sameas")) {
-        this->SetSameas(StrToStr(element.attribute("sameas").value()));
-        element.remove_attribute("sameas");
+    attr = element.attribute("sameas");
+    if (attr) {
+        this->SetSameas(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("synch")) {
-        this->SetSynch(StrToStr(element.attribute("synch").value()));
-        element.remove_attribute("synch");
+    attr = element.attribute("synch");
+    if (attr) {
+        this->SetSynch(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -165,12 +171,13 @@ void AttHarmonicfunction::ResetHarmonicfunction()
     m_deg = SCALEDEGREE_NONE;
 }
 
-bool AttHarmonicfunction::ReadHarmonicfunction(pugi::xml_node element)
+bool AttHarmonicfunction::ReadHarmonicfunction(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("deg")) {
-        this->SetDeg(StrToScaledegree(element.attribute("deg").value()));
-        element.remove_attribute("deg");
+    pugi::xml_attribute attr = element.attribute("deg");
+    if (attr) {
+        this->SetDeg(StrToScaledegree(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -211,12 +218,13 @@ void AttIntervalharmonic::ResetIntervalharmonic()
     m_inth = INTERVAL_HARMONIC_NONE;
 }
 
-bool AttIntervalharmonic::ReadIntervalharmonic(pugi::xml_node element)
+bool AttIntervalharmonic::ReadIntervalharmonic(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("inth")) {
-        this->SetInth(StrToIntervalHarmonic(element.attribute("inth").value()));
-        element.remove_attribute("inth");
+    pugi::xml_attribute attr = element.attribute("inth");
+    if (attr) {
+        this->SetInth(StrToIntervalHarmonic(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -257,12 +265,13 @@ void AttIntervalmelodic::ResetIntervalmelodic()
     m_intm = INTERVAL_MELODIC_NONE;
 }
 
-bool AttIntervalmelodic::ReadIntervalmelodic(pugi::xml_node element)
+bool AttIntervalmelodic::ReadIntervalmelodic(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("intm")) {
-        this->SetIntm(StrToIntervalMelodic(element.attribute("intm").value()));
-        element.remove_attribute("intm");
+    pugi::xml_attribute attr = element.attribute("intm");
+    if (attr) {
+        this->SetIntm(StrToIntervalMelodic(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -303,12 +312,13 @@ void AttMelodicfunction::ResetMelodicfunction()
     m_mfunc = MELODICFUNCTION_NONE;
 }
 
-bool AttMelodicfunction::ReadMelodicfunction(pugi::xml_node element)
+bool AttMelodicfunction::ReadMelodicfunction(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("mfunc")) {
-        this->SetMfunc(StrToMelodicfunction(element.attribute("mfunc").value()));
-        element.remove_attribute("mfunc");
+    pugi::xml_attribute attr = element.attribute("mfunc");
+    if (attr) {
+        this->SetMfunc(StrToMelodicfunction(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -349,12 +359,13 @@ void AttPitchclass::ResetPitchclass()
     m_pclass = PITCHCLASS_NONE;
 }
 
-bool AttPitchclass::ReadPitchclass(pugi::xml_node element)
+bool AttPitchclass::ReadPitchclass(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("pclass")) {
-        this->SetPclass(StrToPitchclass(element.attribute("pclass").value()));
-        element.remove_attribute("pclass");
+    pugi::xml_attribute attr = element.attribute("pclass");
+    if (attr) {
+        this->SetPclass(StrToPitchclass(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -395,12 +406,13 @@ void AttSolfa::ResetSolfa()
     m_psolfa = "";
 }
 
-bool AttSolfa::ReadSolfa(pugi::xml_node element)
+bool AttSolfa::ReadSolfa(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("psolfa")) {
-        this->SetPsolfa(StrToStr(element.attribute("psolfa").value()));
-        element.remove_attribute("psolfa");
+    pugi::xml_attribute attr = element.attribute("psolfa");
+    if (attr) {
+        this->SetPsolfa(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetCommonAnl();
 
     /** Read the values for the attribute class **/
-    bool ReadCommonAnl(pugi::xml_node element);
+    bool ReadCommonAnl(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCommonAnl(pugi::xml_node element);
@@ -110,7 +110,7 @@ public:
     void ResetHarmonicfunction();
 
     /** Read the values for the attribute class **/
-    bool ReadHarmonicfunction(pugi::xml_node element);
+    bool ReadHarmonicfunction(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHarmonicfunction(pugi::xml_node element);
@@ -152,7 +152,7 @@ public:
     void ResetIntervalharmonic();
 
     /** Read the values for the attribute class **/
-    bool ReadIntervalharmonic(pugi::xml_node element);
+    bool ReadIntervalharmonic(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteIntervalharmonic(pugi::xml_node element);
@@ -188,7 +188,7 @@ public:
     void ResetIntervalmelodic();
 
     /** Read the values for the attribute class **/
-    bool ReadIntervalmelodic(pugi::xml_node element);
+    bool ReadIntervalmelodic(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteIntervalmelodic(pugi::xml_node element);
@@ -229,7 +229,7 @@ public:
     void ResetMelodicfunction();
 
     /** Read the values for the attribute class **/
-    bool ReadMelodicfunction(pugi::xml_node element);
+    bool ReadMelodicfunction(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMelodicfunction(pugi::xml_node element);
@@ -265,7 +265,7 @@ public:
     void ResetPitchclass();
 
     /** Read the values for the attribute class **/
-    bool ReadPitchclass(pugi::xml_node element);
+    bool ReadPitchclass(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePitchclass(pugi::xml_node element);
@@ -301,7 +301,7 @@ public:
     void ResetSolfa();
 
     /** Read the values for the attribute class **/
-    bool ReadSolfa(pugi::xml_node element);
+    bool ReadSolfa(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSolfa(pugi::xml_node element);
@@ -44,12 +44,13 @@ void AttArpegLog::ResetArpegLog()
     m_order = arpegLog_ORDER_NONE;
 }
 
-bool AttArpegLog::ReadArpegLog(pugi::xml_node element)
+bool AttArpegLog::ReadArpegLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("order")) {
-        this->SetOrder(StrToArpegLogOrder(element.attribute("order").value()));
-        element.remove_attribute("order");
+    pugi::xml_attribute attr = element.attribute("order");
+    if (attr) {
+        this->SetOrder(StrToArpegLogOrder(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +91,13 @@ void AttArpegVis::ResetArpegVis()
     m_arrow = BOOLEAN_NONE;
 }
 
-bool AttArpegVis::ReadArpegVis(pugi::xml_node element)
+bool AttArpegVis::ReadArpegVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("arrow")) {
-        this->SetArrow(StrToBoolean(element.attribute("arrow").value()));
-        element.remove_attribute("arrow");
+    pugi::xml_attribute attr = element.attribute("arrow");
+    if (attr) {
+        this->SetArrow(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +138,13 @@ void AttBTremLog::ResetBTremLog()
     m_form = bTremLog_FORM_NONE;
 }
 
-bool AttBTremLog::ReadBTremLog(pugi::xml_node element)
+bool AttBTremLog::ReadBTremLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToBTremLogForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -182,12 +185,13 @@ void AttBeamed::ResetBeamed()
     m_beam = "";
 }
 
-bool AttBeamed::ReadBeamed(pugi::xml_node element)
+bool AttBeamed::ReadBeamed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam")) {
-        this->SetBeam(StrToStr(element.attribute("beam").value()));
-        element.remove_attribute("beam");
+    pugi::xml_attribute attr = element.attribute("beam");
+    if (attr) {
+        this->SetBeam(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -228,12 +232,13 @@ void AttBeamedwith::ResetBeamedwith()
     m_beamWith = OTHERSTAFF_NONE;
 }
 
-bool AttBeamedwith::ReadBeamedwith(pugi::xml_node element)
+bool AttBeamedwith::ReadBeamedwith(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.with")) {
-        this->SetBeamWith(StrToOtherstaff(element.attribute("beam.with").value()));
-        element.remove_attribute("beam.with");
+    pugi::xml_attribute attr = element.attribute("beam.with");
+    if (attr) {
+        this->SetBeamWith(StrToOtherstaff(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -275,17 +280,19 @@ void AttBeamingLog::ResetBeamingLog()
     m_beamRests = BOOLEAN_NONE;
 }
 
-bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element)
+bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.group")) {
-        this->SetBeamGroup(StrToStr(element.attribute("beam.group").value()));
-        element.remove_attribute("beam.group");
+    pugi::xml_attribute attr = element.attribute("beam.group");
+    if (attr) {
+        this->SetBeamGroup(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rests")) {
-        this->SetBeamRests(StrToBoolean(element.attribute("beam.rests").value()));
-        element.remove_attribute("beam.rests");
+    attr = element.attribute("beam.rests");
+    if (attr) {
+        this->SetBeamRests(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -336,17 +343,19 @@ void AttBeamrend::ResetBeamrend()
     m_slope = 0.0;
 }
 
-bool AttBeamrend::ReadBeamrend(pugi::xml_node element)
+bool AttBeamrend::ReadBeamrend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeamrendForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToBeamrendForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("slope")) {
-        this->SetSlope(StrToDbl(element.attribute("slope").value()));
-        element.remove_attribute("slope");
+    attr = element.attribute("slope");
+    if (attr) {
+        this->SetSlope(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -396,12 +405,13 @@ void AttBeamsecondary::ResetBeamsecondary()
     m_breaksec = 0;
 }
 
-bool AttBeamsecondary::ReadBeamsecondary(pugi::xml_node element)
+bool AttBeamsecondary::ReadBeamsecondary(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("breaksec")) {
-        this->SetBreaksec(StrToInt(element.attribute("breaksec").value()));
-        element.remove_attribute("breaksec");
+    pugi::xml_attribute attr = element.attribute("breaksec");
+    if (attr) {
+        this->SetBreaksec(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -442,12 +452,13 @@ void AttBeatRptLog::ResetBeatRptLog()
     m_beatDef = DURATION_NONE;
 }
 
-bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element)
+bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("beatDef")) {
-        this->SetBeatDef(StrToDuration(element.attribute("beatDef").value()));
-        element.remove_attribute("beatDef");
+    pugi::xml_attribute attr = element.attribute("beatDef");
+    if (attr) {
+        this->SetBeatDef(StrToDuration(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -488,12 +499,13 @@ void AttBeatRptVis::ResetBeatRptVis()
     m_form = BEATRPT_REND_NONE;
 }
 
-bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element)
+bool AttBeatRptVis::ReadBeatRptVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeatrptRend(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToBeatrptRend(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -534,12 +546,13 @@ void AttBendGes::ResetBendGes()
     m_amount = 0.0;
 }
 
-bool AttBendGes::ReadBendGes(pugi::xml_node element)
+bool AttBendGes::ReadBendGes(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("amount")) {
-        this->SetAmount(StrToDbl(element.attribute("amount").value()));
-        element.remove_attribute("amount");
+    pugi::xml_attribute attr = element.attribute("amount");
+    if (attr) {
+        this->SetAmount(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -580,12 +593,13 @@ void AttCutout::ResetCutout()
     m_cutout = cutout_CUTOUT_NONE;
 }
 
-bool AttCutout::ReadCutout(pugi::xml_node element)
+bool AttCutout::ReadCutout(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("cutout")) {
-        this->SetCutout(StrToCutoutCutout(element.attribute("cutout").value()));
-        element.remove_attribute("cutout");
+    pugi::xml_attribute attr = element.attribute("cutout");
+    if (attr) {
+        this->SetCutout(StrToCutoutCutout(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -626,12 +640,13 @@ void AttExpandable::ResetExpandable()
     m_expand = BOOLEAN_NONE;
 }
 
-bool AttExpandable::ReadExpandable(pugi::xml_node element)
+bool AttExpandable::ReadExpandable(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("expand")) {
-        this->SetExpand(StrToBoolean(element.attribute("expand").value()));
-        element.remove_attribute("expand");
+    pugi::xml_attribute attr = element.attribute("expand");
+    if (attr) {
+        this->SetExpand(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -672,12 +687,13 @@ void AttFTremLog::ResetFTremLog()
     m_form = fTremLog_FORM_NONE;
 }
 
-bool AttFTremLog::ReadFTremLog(pugi::xml_node element)
+bool AttFTremLog::ReadFTremLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFTremLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToFTremLogForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -719,17 +735,19 @@ void AttFermataVis::ResetFermataVis()
     m_shape = fermataVis_SHAPE_NONE;
 }
 
-bool AttFermataVis::ReadFermataVis(pugi::xml_node element)
+bool AttFermataVis::ReadFermataVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToFermataVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToFermataVisForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("shape")) {
-        this->SetShape(StrToFermataVisShape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    attr = element.attribute("shape");
+    if (attr) {
+        this->SetShape(StrToFermataVisShape(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -780,17 +798,19 @@ void AttGraced::ResetGraced()
     m_graceTime = 0;
 }
 
-bool AttGraced::ReadGraced(pugi::xml_node element)
+bool AttGraced::ReadGraced(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("grace")) {
-        this->SetGrace(StrToGrace(element.attribute("grace").value()));
-        element.remove_attribute("grace");
+    pugi::xml_attribute attr = element.attribute("grace");
+    if (attr) {
+        this->SetGrace(StrToGrace(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("grace.time")) {
-        this->SetGraceTime(StrToPercent(element.attribute("grace.time").value()));
-        element.remove_attribute("grace.time");
+    attr = element.attribute("grace.time");
+    if (attr) {
+        this->SetGraceTime(StrToPercent(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -841,17 +861,19 @@ void AttHairpinLog::ResetHairpinLog()
     m_niente = BOOLEAN_NONE;
 }
 
-bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element)
+bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHairpinLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToHairpinLogForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("niente")) {
-        this->SetNiente(StrToBoolean(element.attribute("niente").value()));
-        element.remove_attribute("niente");
+    attr = element.attribute("niente");
+    if (attr) {
+        this->SetNiente(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -901,12 +923,13 @@ void AttHairpinVis::ResetHairpinVis()
     m_opening = "";
 }
 
-bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element)
+bool AttHairpinVis::ReadHairpinVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("opening")) {
-        this->SetOpening(StrToStr(element.attribute("opening").value()));
-        element.remove_attribute("opening");
+    pugi::xml_attribute attr = element.attribute("opening");
+    if (attr) {
+        this->SetOpening(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -953,42 +976,49 @@ void AttHarpPedalLog::ResetHarpPedalLog()
     m_b = harpPedalLog_B_NONE;
 }
 
-bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element)
+bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("c")) {
-        this->SetC(StrToHarpPedalLogC(element.attribute("c").value()));
-        element.remove_attribute("c");
+    pugi::xml_attribute attr = element.attribute("c");
+    if (attr) {
+        this->SetC(StrToHarpPedalLogC(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("d")) {
-        this->SetD(StrToHarpPedalLogD(element.attribute("d").value()));
-        element.remove_attribute("d");
+    attr = element.attribute("d");
+    if (attr) {
+        this->SetD(StrToHarpPedalLogD(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("e")) {
-        this->SetE(StrToHarpPedalLogE(element.attribute("e").value()));
-        element.remove_attribute("e");
+    attr = element.attribute("e");
+    if (attr) {
+        this->SetE(StrToHarpPedalLogE(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("f")) {
-        this->SetF(StrToHarpPedalLogF(element.attribute("f").value()));
-        element.remove_attribute("f");
+    attr = element.attribute("f");
+    if (attr) {
+        this->SetF(StrToHarpPedalLogF(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("g")) {
-        this->SetG(StrToHarpPedalLogG(element.attribute("g").value()));
-        element.remove_attribute("g");
+    attr = element.attribute("g");
+    if (attr) {
+        this->SetG(StrToHarpPedalLogG(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("a")) {
-        this->SetA(StrToHarpPedalLogA(element.attribute("a").value()));
-        element.remove_attribute("a");
+    attr = element.attribute("a");
+    if (attr) {
+        this->SetA(StrToHarpPedalLogA(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("b")) {
-        this->SetB(StrToHarpPedalLogB(element.attribute("b").value()));
-        element.remove_attribute("b");
+    attr = element.attribute("b");
+    if (attr) {
+        this->SetB(StrToHarpPedalLogB(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1083,12 +1113,13 @@ void AttLvpresent::ResetLvpresent()
     m_lv = BOOLEAN_NONE;
 }
 
-bool AttLvpresent::ReadLvpresent(pugi::xml_node element)
+bool AttLvpresent::ReadLvpresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("lv")) {
-        this->SetLv(StrToBoolean(element.attribute("lv").value()));
-        element.remove_attribute("lv");
+    pugi::xml_attribute attr = element.attribute("lv");
+    if (attr) {
+        this->SetLv(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1129,12 +1160,13 @@ void AttMeterSigGrpLog::ResetMeterSigGrpLog()
     m_func = meterSigGrpLog_FUNC_NONE;
 }
 
-bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element)
+bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToMeterSigGrpLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    pugi::xml_attribute attr = element.attribute("func");
+    if (attr) {
+        this->SetFunc(StrToMeterSigGrpLogFunc(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1175,12 +1207,13 @@ void AttMultiRestVis::ResetMultiRestVis()
     m_block = BOOLEAN_NONE;
 }
 
-bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element)
+bool AttMultiRestVis::ReadMultiRestVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("block")) {
-        this->SetBlock(StrToBoolean(element.attribute("block").value()));
-        element.remove_attribute("block");
+    pugi::xml_attribute attr = element.attribute("block");
+    if (attr) {
+        this->SetBlock(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1221,12 +1254,13 @@ void AttNoteGesCmn::ResetNoteGesCmn()
     m_gliss = GLISSANDO_NONE;
 }
 
-bool AttNoteGesCmn::ReadNoteGesCmn(pugi::xml_node element)
+bool AttNoteGesCmn::ReadNoteGesCmn(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("gliss")) {
-        this->SetGliss(StrToGlissando(element.attribute("gliss").value()));
-        element.remove_attribute("gliss");
+    pugi::xml_attribute attr = element.attribute("gliss");
+    if (attr) {
+        this->SetGliss(StrToGlissando(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1267,12 +1301,13 @@ void AttNumbered::ResetNumbered()
     m_num = 0;
 }
 
-bool AttNumbered::ReadNumbered(pugi::xml_node element)
+bool AttNumbered::ReadNumbered(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    pugi::xml_attribute attr = element.attribute("num");
+    if (attr) {
+        this->SetNum(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1314,17 +1349,19 @@ void AttNumberplacement::ResetNumberplacement()
     m_numVisible = BOOLEAN_NONE;
 }
 
-bool AttNumberplacement::ReadNumberplacement(pugi::xml_node element)
+bool AttNumberplacement::ReadNumberplacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("num.place")) {
-        this->SetNumPlace(StrToPlace(element.attribute("num.place").value()));
-        element.remove_attribute("num.place");
+    pugi::xml_attribute attr = element.attribute("num.place");
+    if (attr) {
+        this->SetNumPlace(StrToPlace(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("num.visible")) {
-        this->SetNumVisible(StrToBoolean(element.attribute("num.visible").value()));
-        element.remove_attribute("num.visible");
+    attr = element.attribute("num.visible");
+    if (attr) {
+        this->SetNumVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1374,12 +1411,13 @@ void AttOctaveLog::ResetOctaveLog()
     m_coll = octaveLog_COLL_NONE;
 }
 
-bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element)
+bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("coll")) {
-        this->SetColl(StrToOctaveLogColl(element.attribute("coll").value()));
-        element.remove_attribute("coll");
+    pugi::xml_attribute attr = element.attribute("coll");
+    if (attr) {
+        this->SetColl(StrToOctaveLogColl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1420,12 +1458,13 @@ void AttPedalLog::ResetPedalLog()
     m_dir = pedalLog_DIR_NONE;
 }
 
-bool AttPedalLog::ReadPedalLog(pugi::xml_node element)
+bool AttPedalLog::ReadPedalLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToPedalLogDir(element.attribute("dir").value()));
-        element.remove_attribute("dir");
+    pugi::xml_attribute attr = element.attribute("dir");
+    if (attr) {
+        this->SetDir(StrToPedalLogDir(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1466,12 +1505,13 @@ void AttPedalVis::ResetPedalVis()
     m_form = pedalVis_FORM_NONE;
 }
 
-bool AttPedalVis::ReadPedalVis(pugi::xml_node element)
+bool AttPedalVis::ReadPedalVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToPedalVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToPedalVisForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1512,12 +1552,13 @@ void AttPianopedals::ResetPianopedals()
     m_pedalStyle = pianopedals_PEDALSTYLE_NONE;
 }
 
-bool AttPianopedals::ReadPianopedals(pugi::xml_node element)
+bool AttPianopedals::ReadPianopedals(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("pedal.style")) {
-        this->SetPedalStyle(StrToPianopedalsPedalstyle(element.attribute("pedal.style").value()));
-        element.remove_attribute("pedal.style");
+    pugi::xml_attribute attr = element.attribute("pedal.style");
+    if (attr) {
+        this->SetPedalStyle(StrToPianopedalsPedalstyle(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1558,12 +1599,13 @@ void AttRehearsal::ResetRehearsal()
     m_rehEnclose = rehearsal_REHENCLOSE_NONE;
 }
 
-bool AttRehearsal::ReadRehearsal(pugi::xml_node element)
+bool AttRehearsal::ReadRehearsal(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("reh.enclose")) {
-        this->SetRehEnclose(StrToRehearsalRehenclose(element.attribute("reh.enclose").value()));
-        element.remove_attribute("reh.enclose");
+    pugi::xml_attribute attr = element.attribute("reh.enclose");
+    if (attr) {
+        this->SetRehEnclose(StrToRehearsalRehenclose(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1604,12 +1646,13 @@ void AttScoreDefVisCmn::ResetScoreDefVisCmn()
     m_gridShow = BOOLEAN_NONE;
 }
 
-bool AttScoreDefVisCmn::ReadScoreDefVisCmn(pugi::xml_node element)
+bool AttScoreDefVisCmn::ReadScoreDefVisCmn(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
+    pugi::xml_attribute attr = element.attribute("grid.show");
+    if (attr) {
+        this->SetGridShow(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1651,17 +1694,19 @@ void AttSlurrend::ResetSlurrend()
     m_slurLwidth = "";
 }
 
-bool AttSlurrend::ReadSlurrend(pugi::xml_node element)
+bool AttSlurrend::ReadSlurrend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur.lform")) {
-        this->SetSlurLform(StrToLineform(element.attribute("slur.lform").value()));
-        element.remove_attribute("slur.lform");
+    pugi::xml_attribute attr = element.attribute("slur.lform");
+    if (attr) {
+        this->SetSlurLform(StrToLineform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("slur.lwidth")) {
-        this->SetSlurLwidth(StrToStr(element.attribute("slur.lwidth").value()));
-        element.remove_attribute("slur.lwidth");
+    attr = element.attribute("slur.lwidth");
+    if (attr) {
+        this->SetSlurLwidth(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1711,12 +1756,13 @@ void AttStemsCmn::ResetStemsCmn()
     m_stemWith = OTHERSTAFF_NONE;
 }
 
-bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element)
+bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.with")) {
-        this->SetStemWith(StrToOtherstaff(element.attribute("stem.with").value()));
-        element.remove_attribute("stem.with");
+    pugi::xml_attribute attr = element.attribute("stem.with");
+    if (attr) {
+        this->SetStemWith(StrToOtherstaff(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1758,17 +1804,19 @@ void AttTierend::ResetTierend()
     m_tieLwidth = "";
 }
 
-bool AttTierend::ReadTierend(pugi::xml_node element)
+bool AttTierend::ReadTierend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie.lform")) {
-        this->SetTieLform(StrToLineform(element.attribute("tie.lform").value()));
-        element.remove_attribute("tie.lform");
+    pugi::xml_attribute attr = element.attribute("tie.lform");
+    if (attr) {
+        this->SetTieLform(StrToLineform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tie.lwidth")) {
-        this->SetTieLwidth(StrToStr(element.attribute("tie.lwidth").value()));
-        element.remove_attribute("tie.lwidth");
+    attr = element.attribute("tie.lwidth");
+    if (attr) {
+        this->SetTieLwidth(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1818,12 +1866,13 @@ void AttTremmeasured::ResetTremmeasured()
     m_measperf = DURATION_NONE;
 }
 
-bool AttTremmeasured::ReadTremmeasured(pugi::xml_node element)
+bool AttTremmeasured::ReadTremmeasured(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("measperf")) {
-        this->SetMeasperf(StrToDuration(element.attribute("measperf").value()));
-        element.remove_attribute("measperf");
+    pugi::xml_attribute attr = element.attribute("measperf");
+    if (attr) {
+        this->SetMeasperf(StrToDuration(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1867,27 +1916,31 @@ void AttTupletVis::ResetTupletVis()
     m_numFormat = tupletVis_NUMFORMAT_NONE;
 }
 
-bool AttTupletVis::ReadTupletVis(pugi::xml_node element)
+bool AttTupletVis::ReadTupletVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("bracket.place")) {
-        this->SetBracketPlace(StrToPlace(element.attribute("bracket.place").value()));
-        element.remove_attribute("bracket.place");
+    pugi::xml_attribute attr = element.attribute("bracket.place");
+    if (attr) {
+        this->SetBracketPlace(StrToPlace(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("bracket.visible")) {
-        this->SetBracketVisible(StrToBoolean(element.attribute("bracket.visible").value()));
-        element.remove_attribute("bracket.visible");
+    attr = element.attribute("bracket.visible");
+    if (attr) {
+        this->SetBracketVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dur.visible")) {
-        this->SetDurVisible(StrToBoolean(element.attribute("dur.visible").value()));
-        element.remove_attribute("dur.visible");
+    attr = element.attribute("dur.visible");
+    if (attr) {
+        this->SetDurVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("num.format")) {
-        this->SetNumFormat(StrToTupletVisNumformat(element.attribute("num.format").value()));
-        element.remove_attribute("num.format");
+    attr = element.attribute("num.format");
+    if (attr) {
+        this->SetNumFormat(StrToTupletVisNumformat(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
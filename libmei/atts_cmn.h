@@ -38,7 +38,7 @@ public:
     void ResetArpegLog();
 
     /** Read the values for the attribute class **/
-    bool ReadArpegLog(pugi::xml_node element);
+    bool ReadArpegLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteArpegLog(pugi::xml_node element);
@@ -74,7 +74,7 @@ public:
     void ResetArpegVis();
 
     /** Read the values for the attribute class **/
-    bool ReadArpegVis(pugi::xml_node element);
+    bool ReadArpegVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteArpegVis(pugi::xml_node element);
@@ -110,7 +110,7 @@ public:
     void ResetBTremLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBTremLog(pugi::xml_node element);
+    bool ReadBTremLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBTremLog(pugi::xml_node element);
@@ -146,7 +146,7 @@ public:
     void ResetBeamed();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamed(pugi::xml_node element);
+    bool ReadBeamed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeamed(pugi::xml_node element);
@@ -182,7 +182,7 @@ public:
     void ResetBeamedwith();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamedwith(pugi::xml_node element);
+    bool ReadBeamedwith(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeamedwith(pugi::xml_node element);
@@ -222,7 +222,7 @@ public:
     void ResetBeamingLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamingLog(pugi::xml_node element);
+    bool ReadBeamingLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeamingLog(pugi::xml_node element);
@@ -270,7 +270,7 @@ public:
     void ResetBeamrend();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamrend(pugi::xml_node element);
+    bool ReadBeamrend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeamrend(pugi::xml_node element);
@@ -312,7 +312,7 @@ public:
     void ResetBeamsecondary();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamsecondary(pugi::xml_node element);
+    bool ReadBeamsecondary(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeamsecondary(pugi::xml_node element);
@@ -353,7 +353,7 @@ public:
     void ResetBeatRptLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBeatRptLog(pugi::xml_node element);
+    bool ReadBeatRptLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeatRptLog(pugi::xml_node element);
@@ -389,7 +389,7 @@ public:
     void ResetBeatRptVis();
 
     /** Read the values for the attribute class **/
-    bool ReadBeatRptVis(pugi::xml_node element);
+    bool ReadBeatRptVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeatRptVis(pugi::xml_node element);
@@ -425,7 +425,7 @@ public:
     void ResetBendGes();
 
     /** Read the values for the attribute class **/
-    bool ReadBendGes(pugi::xml_node element);
+    bool ReadBendGes(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBendGes(pugi::xml_node element);
@@ -464,7 +464,7 @@ public:
     void ResetCutout();
 
     /** Read the values for the attribute class **/
-    bool ReadCutout(pugi::xml_node element);
+    bool ReadCutout(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCutout(pugi::xml_node element);
@@ -500,7 +500,7 @@ public:
     void ResetExpandable();
 
     /** Read the values for the attribute class **/
-    bool ReadExpandable(pugi::xml_node element);
+    bool ReadExpandable(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteExpandable(pugi::xml_node element);
@@ -541,7 +541,7 @@ public:
     void ResetFTremLog();
 
     /** Read the values for the attribute class **/
-    bool ReadFTremLog(pugi::xml_node element);
+    bool ReadFTremLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteFTremLog(pugi::xml_node element);
@@ -577,7 +577,7 @@ public:
     void ResetFermataVis();
 
     /** Read the values for the attribute class **/
-    bool ReadFermataVis(pugi::xml_node element);
+    bool ReadFermataVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteFermataVis(pugi::xml_node element);
@@ -619,7 +619,7 @@ public:
     void ResetGraced();
 
     /** Read the values for the attribute class **/
-    bool ReadGraced(pugi::xml_node element);
+    bool ReadGraced(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteGraced(pugi::xml_node element);
@@ -664,7 +664,7 @@ public:
     void ResetHairpinLog();
 
     /** Read the values for the attribute class **/
-    bool ReadHairpinLog(pugi::xml_node element);
+    bool ReadHairpinLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHairpinLog(pugi::xml_node element);
@@ -710,7 +710,7 @@ public:
     void ResetHairpinVis();
 
     /** Read the values for the attribute class **/
-    bool ReadHairpinVis(pugi::xml_node element);
+    bool ReadHairpinVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHairpinVis(pugi::xml_node element);
@@ -749,7 +749,7 @@ public:
     void ResetHarpPedalLog();
 
     /** Read the values for the attribute class **/
-    bool ReadHarpPedalLog(pugi::xml_node element);
+    bool ReadHarpPedalLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHarpPedalLog(pugi::xml_node element);
@@ -821,7 +821,7 @@ public:
     void ResetLvpresent();
 
     /** Read the values for the attribute class **/
-    bool ReadLvpresent(pugi::xml_node element);
+    bool ReadLvpresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLvpresent(pugi::xml_node element);
@@ -860,7 +860,7 @@ public:
     void ResetMeterSigGrpLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigGrpLog(pugi::xml_node element);
+    bool ReadMeterSigGrpLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigGrpLog(pugi::xml_node element);
@@ -896,7 +896,7 @@ public:
     void ResetMultiRestVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMultiRestVis(pugi::xml_node element);
+    bool ReadMultiRestVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMultiRestVis(pugi::xml_node element);
@@ -936,7 +936,7 @@ public:
     void ResetNoteGesCmn();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteGesCmn(pugi::xml_node element);
+    bool ReadNoteGesCmn(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNoteGesCmn(pugi::xml_node element);
@@ -972,7 +972,7 @@ public:
     void ResetNumbered();
 
     /** Read the values for the attribute class **/
-    bool ReadNumbered(pugi::xml_node element);
+    bool ReadNumbered(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNumbered(pugi::xml_node element);
@@ -1011,7 +1011,7 @@ public:
     void ResetNumberplacement();
 
     /** Read the values for the attribute class **/
-    bool ReadNumberplacement(pugi::xml_node element);
+    bool ReadNumberplacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNumberplacement(pugi::xml_node element);
@@ -1053,7 +1053,7 @@ public:
     void ResetOctaveLog();
 
     /** Read the values for the attribute class **/
-    bool ReadOctaveLog(pugi::xml_node element);
+    bool ReadOctaveLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOctaveLog(pugi::xml_node element);
@@ -1095,7 +1095,7 @@ public:
     void ResetPedalLog();
 
     /** Read the values for the attribute class **/
-    bool ReadPedalLog(pugi::xml_node element);
+    bool ReadPedalLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePedalLog(pugi::xml_node element);
@@ -1131,7 +1131,7 @@ public:
     void ResetPedalVis();
 
     /** Read the values for the attribute class **/
-    bool ReadPedalVis(pugi::xml_node element);
+    bool ReadPedalVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePedalVis(pugi::xml_node element);
@@ -1167,7 +1167,7 @@ public:
     void ResetPianopedals();
 
     /** Read the values for the attribute class **/
-    bool ReadPianopedals(pugi::xml_node element);
+    bool ReadPianopedals(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePianopedals(pugi::xml_node element);
@@ -1203,7 +1203,7 @@ public:
     void ResetRehearsal();
 
     /** Read the values for the attribute class **/
-    bool ReadRehearsal(pugi::xml_node element);
+    bool ReadRehearsal(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteRehearsal(pugi::xml_node element);
@@ -1239,7 +1239,7 @@ public:
     void ResetScoreDefVisCmn();
 
     /** Read the values for the attribute class **/
-    bool ReadScoreDefVisCmn(pugi::xml_node element);
+    bool ReadScoreDefVisCmn(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefVisCmn(pugi::xml_node element);
@@ -1275,7 +1275,7 @@ public:
     void ResetSlurrend();
 
     /** Read the values for the attribute class **/
-    bool ReadSlurrend(pugi::xml_node element);
+    bool ReadSlurrend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSlurrend(pugi::xml_node element);
@@ -1317,7 +1317,7 @@ public:
     void ResetStemsCmn();
 
     /** Read the values for the attribute class **/
-    bool ReadStemsCmn(pugi::xml_node element);
+    bool ReadStemsCmn(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStemsCmn(pugi::xml_node element);
@@ -1357,7 +1357,7 @@ public:
     void ResetTierend();
 
     /** Read the values for the attribute class **/
-    bool ReadTierend(pugi::xml_node element);
+    bool ReadTierend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTierend(pugi::xml_node element);
@@ -1399,7 +1399,7 @@ public:
     void ResetTremmeasured();
 
     /** Read the values for the attribute class **/
-    bool ReadTremmeasured(pugi::xml_node element);
+    bool ReadTremmeasured(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTremmeasured(pugi::xml_node element);
@@ -1435,7 +1435,7 @@ public:
     void ResetTupletVis();
 
     /** Read the values for the attribute class **/
-    bool ReadTupletVis(pugi::xml_node element);
+    bool ReadTupletVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTupletVis(pugi::xml_node element);
@@ -45,17 +45,19 @@ void AttMordentLog::ResetMordentLog()
     m_long = BOOLEAN_NONE;
 }
 
-bool AttMordentLog::ReadMordentLog(pugi::xml_node element)
+bool AttMordentLog::ReadMordentLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMordentLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToMordentLogForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("long")) {
-        this->SetLong(StrToBoolean(element.attribute("long").value()));
-        element.remove_attribute("long");
+    attr = element.attribute("long");
+    if (attr) {
+        this->SetLong(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -105,12 +107,13 @@ void AttOrnam::ResetOrnam()
     m_ornam = "";
 }
 
-bool AttOrnam::ReadOrnam(pugi::xml_node element)
+bool AttOrnam::ReadOrnam(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("ornam")) {
-        this->SetOrnam(StrToStr(element.attribute("ornam").value()));
-        element.remove_attribute("ornam");
+    pugi::xml_attribute attr = element.attribute("ornam");
+    if (attr) {
+        this->SetOrnam(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -152,17 +155,19 @@ void AttOrnamentaccid::ResetOrnamentaccid()
     m_accidlower = ACCIDENTAL_EXPLICIT_NONE;
 }
 
-bool AttOrnamentaccid::ReadOrnamentaccid(pugi::xml_node element)
+bool AttOrnamentaccid::ReadOrnamentaccid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper")) {
-        this->SetAccidupper(StrToAccidentalExplicit(element.attribute("accidupper").value()));
-        element.remove_attribute("accidupper");
+    pugi::xml_attribute attr = element.attribute("accidupper");
+    if (attr) {
+        this->SetAccidupper(StrToAccidentalExplicit(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("accidlower")) {
-        this->SetAccidlower(StrToAccidentalExplicit(element.attribute("accidlower").value()));
-        element.remove_attribute("accidlower");
+    attr = element.attribute("accidlower");
+    if (attr) {
+        this->SetAccidlower(StrToAccidentalExplicit(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -213,17 +218,19 @@ void AttTurnLog::ResetTurnLog()
     m_form = turnLog_FORM_NONE;
 }
 
-bool AttTurnLog::ReadTurnLog(pugi::xml_node element)
+bool AttTurnLog::ReadTurnLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("delayed")) {
-        this->SetDelayed(StrToBoolean(element.attribute("delayed").value()));
-        element.remove_attribute("delayed");
+    pugi::xml_attribute attr = element.attribute("delayed");
+    if (attr) {
+        this->SetDelayed(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("form")) {
-        this->SetForm(StrToTurnLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToTurnLogForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetMordentLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMordentLog(pugi::xml_node element);
+    bool ReadMordentLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMordentLog(pugi::xml_node element);
@@ -83,7 +83,7 @@ public:
     void ResetOrnam();
 
     /** Read the values for the attribute class **/
-    bool ReadOrnam(pugi::xml_node element);
+    bool ReadOrnam(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOrnam(pugi::xml_node element);
@@ -123,7 +123,7 @@ public:
     void ResetOrnamentaccid();
 
     /** Read the values for the attribute class **/
-    bool ReadOrnamentaccid(pugi::xml_node element);
+    bool ReadOrnamentaccid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOrnamentaccid(pugi::xml_node element);
@@ -165,7 +165,7 @@ public:
     void ResetTurnLog();
 
     /** Read the values for the attribute class **/
-    bool ReadTurnLog(pugi::xml_node element);
+    bool ReadTurnLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTurnLog(pugi::xml_node element);
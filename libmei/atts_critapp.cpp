@@ -44,12 +44,13 @@ void AttCrit::ResetCrit()
     m_cause = "";
 }
 
-bool AttCrit::ReadCrit(pugi::xml_node element)
+bool AttCrit::ReadCrit(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("cause")) {
-        this->SetCause(StrToStr(element.attribute("cause").value()));
-        element.remove_attribute("cause");
+    pugi::xml_attribute attr = element.attribute("cause");
+    if (attr) {
+        this->SetCause(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +91,13 @@ void AttSource::ResetSource()
     m_source = "";
 }
 
-bool AttSource::ReadSource(pugi::xml_node element)
+bool AttSource::ReadSource(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("source")) {
-        this->SetSource(StrToStr(element.attribute("source").value()));
-        element.remove_attribute("source");
+    pugi::xml_attribute attr = element.attribute("source");
+    if (attr) {
+        this->SetSource(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetCrit();
 
     /** Read the values for the attribute class **/
-    bool ReadCrit(pugi::xml_node element);
+    bool ReadCrit(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCrit(pugi::xml_node element);
@@ -77,7 +77,7 @@ public:
     void ResetSource();
 
     /** Read the values for the attribute class **/
-    bool ReadSource(pugi::xml_node element);
+    bool ReadSource(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSource(pugi::xml_node element);
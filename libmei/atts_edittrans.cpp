@@ -44,12 +44,13 @@ void AttAgentident::ResetAgentident()
     m_agent = "";
 }
 
-bool AttAgentident::ReadAgentident(pugi::xml_node element)
+bool AttAgentident::ReadAgentident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        element.remove_attribute("agent");
+    pugi::xml_attribute attr = element.attribute("agent");
+    if (attr) {
+        this->SetAgent(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -91,17 +92,19 @@ void AttEvidence::ResetEvidence()
     m_evidence = "";
 }
 
-bool AttEvidence::ReadEvidence(pugi::xml_node element)
+bool AttEvidence::ReadEvidence(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("cert")) {
-        this->SetCert(StrToCertainty(element.attribute("cert").value()));
-        element.remove_attribute("cert");
+    pugi::xml_attribute attr = element.attribute("cert");
+    if (attr) {
+        this->SetCert(StrToCertainty(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("evidence")) {
-        this->SetEvidence(StrToStr(element.attribute("evidence").value()));
-        element.remove_attribute("evidence");
+    attr = element.attribute("evidence");
+    if (attr) {
+        this->SetEvidence(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -151,12 +154,13 @@ void AttExtent::ResetExtent()
     m_extent = "";
 }
 
-bool AttExtent::ReadExtent(pugi::xml_node element)
+bool AttExtent::ReadExtent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("extent")) {
-        this->SetExtent(StrToStr(element.attribute("extent").value()));
-        element.remove_attribute("extent");
+    pugi::xml_attribute attr = element.attribute("extent");
+    if (attr) {
+        this->SetExtent(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -197,12 +201,13 @@ void AttReasonident::ResetReasonident()
     m_reason = "";
 }
 
-bool AttReasonident::ReadReasonident(pugi::xml_node element)
+bool AttReasonident::ReadReasonident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        element.remove_attribute("reason");
+    pugi::xml_attribute attr = element.attribute("reason");
+    if (attr) {
+        this->SetReason(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetAgentident();
 
     /** Read the values for the attribute class **/
-    bool ReadAgentident(pugi::xml_node element);
+    bool ReadAgentident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteAgentident(pugi::xml_node element);
@@ -77,7 +77,7 @@ public:
     void ResetEvidence();
 
     /** Read the values for the attribute class **/
-    bool ReadEvidence(pugi::xml_node element);
+    bool ReadEvidence(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteEvidence(pugi::xml_node element);
@@ -123,7 +123,7 @@ public:
     void ResetExtent();
 
     /** Read the values for the attribute class **/
-    bool ReadExtent(pugi::xml_node element);
+    bool ReadExtent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteExtent(pugi::xml_node element);
@@ -159,7 +159,7 @@ public:
     void ResetReasonident();
 
     /** Read the values for the attribute class **/
-    bool ReadReasonident(pugi::xml_node element);
+    bool ReadReasonident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteReasonident(pugi::xml_node element);
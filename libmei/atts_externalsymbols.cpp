@@ -45,17 +45,19 @@ void AttExtsym::ResetExtsym()
     m_glyphnum = 0;
 }
 
-bool AttExtsym::ReadExtsym(pugi::xml_node element)
+bool AttExtsym::ReadExtsym(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyphname")) {
-        this->SetGlyphname(StrToStr(element.attribute("glyphname").value()));
-        element.remove_attribute("glyphname");
+    pugi::xml_attribute attr = element.attribute("glyphname");
+    if (attr) {
+        this->SetGlyphname(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("glyphnum")) {
-        this->SetGlyphnum(StrToWcharT(element.attribute("glyphnum").value()));
-        element.remove_attribute("glyphnum");
+    attr = element.attribute("glyphnum");
+    if (attr) {
+        this->SetGlyphnum(StrToWcharT(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetExtsym();
 
     /** Read the values for the attribute class **/
-    bool ReadExtsym(pugi::xml_node element);
+    bool ReadExtsym(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteExtsym(pugi::xml_node element);
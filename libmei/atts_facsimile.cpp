@@ -44,12 +44,13 @@ void AttFacsimile::ResetFacsimile()
     m_facs = URIS_NONE;
 }
 
-bool AttFacsimile::ReadFacsimile(pugi::xml_node element)
+bool AttFacsimile::ReadFacsimile(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("facs")) {
-        this->SetFacs(StrToUris(element.attribute("facs").value()));
-        element.remove_attribute("facs");
+    pugi::xml_attribute attr = element.attribute("facs");
+    if (attr) {
+        this->SetFacs(StrToUris(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
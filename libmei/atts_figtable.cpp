@@ -45,17 +45,19 @@ void AttTabular::ResetTabular()
     m_rowspan = 0;
 }
 
-bool AttTabular::ReadTabular(pugi::xml_node element)
+bool AttTabular::ReadTabular(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("colspan")) {
-        this->SetColspan(StrToInt(element.attribute("colspan").value()));
-        element.remove_attribute("colspan");
+    pugi::xml_attribute attr = element.attribute("colspan");
+    if (attr) {
+        this->SetColspan(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("rowspan")) {
-        this->SetRowspan(StrToInt(element.attribute("rowspan").value()));
-        element.remove_attribute("rowspan");
+    attr = element.attribute("rowspan");
+    if (attr) {
+        this->SetRowspan(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
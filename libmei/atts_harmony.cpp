@@ -44,12 +44,13 @@ void AttFretlocation::ResetFretlocation()
     m_fret = FRET_NONE;
 }
 
-bool AttFretlocation::ReadFretlocation(pugi::xml_node element)
+bool AttFretlocation::ReadFretlocation(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("fret")) {
-        this->SetFret(StrToFret(element.attribute("fret").value()));
-        element.remove_attribute("fret");
+    pugi::xml_attribute attr = element.attribute("fret");
+    if (attr) {
+        this->SetFret(StrToFret(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +91,13 @@ void AttHarmLog::ResetHarmLog()
     m_chordref = "";
 }
 
-bool AttHarmLog::ReadHarmLog(pugi::xml_node element)
+bool AttHarmLog::ReadHarmLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("chordref")) {
-        this->SetChordref(StrToStr(element.attribute("chordref").value()));
-        element.remove_attribute("chordref");
+    pugi::xml_attribute attr = element.attribute("chordref");
+    if (attr) {
+        this->SetChordref(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +138,13 @@ void AttHarmVis::ResetHarmVis()
     m_rendgrid = harmVis_RENDGRID_NONE;
 }
 
-bool AttHarmVis::ReadHarmVis(pugi::xml_node element)
+bool AttHarmVis::ReadHarmVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("rendgrid")) {
-        this->SetRendgrid(StrToHarmVisRendgrid(element.attribute("rendgrid").value()));
-        element.remove_attribute("rendgrid");
+    pugi::xml_attribute attr = element.attribute("rendgrid");
+    if (attr) {
+        this->SetRendgrid(StrToHarmVisRendgrid(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetFretlocation();
 
     /** Read the values for the attribute class **/
-    bool ReadFretlocation(pugi::xml_node element);
+    bool ReadFretlocation(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteFretlocation(pugi::xml_node element);
@@ -74,7 +74,7 @@ public:
     void ResetHarmLog();
 
     /** Read the values for the attribute class **/
-    bool ReadHarmLog(pugi::xml_node element);
+    bool ReadHarmLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHarmLog(pugi::xml_node element);
@@ -110,7 +110,7 @@ public:
     void ResetHarmVis();
 
     /** Read the values for the attribute class **/
-    bool ReadHarmVis(pugi::xml_node element);
+    bool ReadHarmVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHarmVis(pugi::xml_node element);
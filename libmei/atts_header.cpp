@@ -44,12 +44,13 @@ void AttRegularmethod::ResetRegularmethod()
     m_method = regularmethod_METHOD_NONE;
 }
 
-bool AttRegularmethod::ReadRegularmethod(pugi::xml_node element)
+bool AttRegularmethod::ReadRegularmethod(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("method")) {
-        this->SetMethod(StrToRegularmethodMethod(element.attribute("method").value()));
-        element.remove_attribute("method");
+    pugi::xml_attribute attr = element.attribute("method");
+    if (attr) {
+        this->SetMethod(StrToRegularmethodMethod(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
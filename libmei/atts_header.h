@@ -38,7 +38,7 @@ public:
     void ResetRegularmethod();
 
     /** Read the values for the attribute class **/
-    bool ReadRegularmethod(pugi::xml_node element);
+    bool ReadRegularmethod(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteRegularmethod(pugi::xml_node element);
@@ -45,17 +45,19 @@ void AttVerseLog::ResetVerseLog()
     m_rhythm = "";
 }
 
-bool AttVerseLog::ReadVerseLog(pugi::xml_node element)
+bool AttVerseLog::ReadVerseLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("refrain")) {
-        this->SetRefrain(StrToBoolean(element.attribute("refrain").value()));
-        element.remove_attribute("refrain");
+    pugi::xml_attribute attr = element.attribute("refrain");
+    if (attr) {
+        this->SetRefrain(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("rhythm")) {
-        this->SetRhythm(StrToStr(element.attribute("rhythm").value()));
-        element.remove_attribute("rhythm");
+    attr = element.attribute("rhythm");
+    if (attr) {
+        this->SetRhythm(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
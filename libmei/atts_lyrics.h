@@ -38,7 +38,7 @@ public:
     void ResetVerseLog();
 
     /** Read the values for the attribute class **/
-    bool ReadVerseLog(pugi::xml_node element);
+    bool ReadVerseLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVerseLog(pugi::xml_node element);
@@ -45,17 +45,19 @@ void AttNotationtype::ResetNotationtype()
     m_notationsubtype = "";
 }
 
-bool AttNotationtype::ReadNotationtype(pugi::xml_node element)
+bool AttNotationtype::ReadNotationtype(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("notationtype")) {
-        this->SetNotationtype(StrToNotationtype(element.attribute("notationtype").value()));
-        element.remove_attribute("notationtype");
+    pugi::xml_attribute attr = element.attribute("notationtype");
+    if (attr) {
+        this->SetNotationtype(StrToNotationtype(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("notationsubtype")) {
-        this->SetNotationsubtype(StrToStr(element.attribute("notationsubtype").value()));
-        element.remove_attribute("notationsubtype");
+    attr = element.attribute("notationsubtype");
+    if (attr) {
+        this->SetNotationsubtype(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetNotationtype();
 
     /** Read the values for the attribute class **/
-    bool ReadNotationtype(pugi::xml_node element);
+    bool ReadNotationtype(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNotationtype(pugi::xml_node element);
@@ -44,12 +44,13 @@ void AttLigatureLog::ResetLigatureLog()
     m_form = LIGATUREFORM_NONE;
 }
 
-bool AttLigatureLog::ReadLigatureLog(pugi::xml_node element)
+bool AttLigatureLog::ReadLigatureLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLigatureform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToLigatureform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -91,17 +92,19 @@ void AttMensurVis::ResetMensurVis()
     m_orient = ORIENTATION_NONE;
 }
 
-bool AttMensurVis::ReadMensurVis(pugi::xml_node element)
+bool AttMensurVis::ReadMensurVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMensurVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToMensurVisForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("orient")) {
-        this->SetOrient(StrToOrientation(element.attribute("orient").value()));
-        element.remove_attribute("orient");
+    attr = element.attribute("orient");
+    if (attr) {
+        this->SetOrient(StrToOrientation(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -155,32 +158,37 @@ void AttMensuralLog::ResetMensuralLog()
     m_proportNumbase = -1;
 }
 
-bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element)
+bool AttMensuralLog::ReadMensuralLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.dot")) {
-        this->SetMensurDot(StrToBoolean(element.attribute("mensur.dot").value()));
-        element.remove_attribute("mensur.dot");
+    pugi::xml_attribute attr = element.attribute("mensur.dot");
+    if (attr) {
+        this->SetMensurDot(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.sign")) {
-        this->SetMensurSign(StrToMensurationsign(element.attribute("mensur.sign").value()));
-        element.remove_attribute("mensur.sign");
+    attr = element.attribute("mensur.sign");
+    if (attr) {
+        this->SetMensurSign(StrToMensurationsign(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.slash")) {
-        this->SetMensurSlash(StrToInt(element.attribute("mensur.slash").value()));
-        element.remove_attribute("mensur.slash");
+    attr = element.attribute("mensur.slash");
+    if (attr) {
+        this->SetMensurSlash(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("proport.num")) {
-        this->SetProportNum(StrToInt(element.attribute("proport.num").value()));
-        element.remove_attribute("proport.num");
+    attr = element.attribute("proport.num");
+    if (attr) {
+        this->SetProportNum(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("proport.numbase")) {
-        this->SetProportNumbase(StrToInt(element.attribute("proport.numbase").value()));
-        element.remove_attribute("proport.numbase");
+    attr = element.attribute("proport.numbase");
+    if (attr) {
+        this->SetProportNumbase(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -260,27 +268,31 @@ void AttMensuralShared::ResetMensuralShared()
     m_tempus = TEMPUS_NONE;
 }
 
-bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element)
+bool AttMensuralShared::ReadMensuralShared(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("modusmaior")) {
-        this->SetModusmaior(StrToModusmaior(element.attribute("modusmaior").value()));
-        element.remove_attribute("modusmaior");
+    pugi::xml_attribute attr = element.attribute("modusmaior");
+    if (attr) {
+        this->SetModusmaior(StrToModusmaior(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("modusminor")) {
-        this->SetModusminor(StrToModusminor(element.attribute("modusminor").value()));
-        element.remove_attribute("modusminor");
+    attr = element.attribute("modusminor");
+    if (attr) {
+        this->SetModusminor(StrToModusminor(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("prolatio")) {
-        this->SetProlatio(StrToProlatio(element.attribute("prolatio").value()));
-        element.remove_attribute("prolatio");
+    attr = element.attribute("prolatio");
+    if (attr) {
+        this->SetProlatio(StrToProlatio(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tempus")) {
-        this->SetTempus(StrToTempus(element.attribute("tempus").value()));
-        element.remove_attribute("tempus");
+    attr = element.attribute("tempus");
+    if (attr) {
+        this->SetTempus(StrToTempus(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -352,32 +364,37 @@ void AttMensuralVis::ResetMensuralVis()
     m_mensurSize = SIZE_NONE;
 }
 
-bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element)
+bool AttMensuralVis::ReadMensuralVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("mensur.color")) {
-        this->SetMensurColor(StrToStr(element.attribute("mensur.color").value()));
-        element.remove_attribute("mensur.color");
+    pugi::xml_attribute attr = element.attribute("mensur.color");
+    if (attr) {
+        this->SetMensurColor(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.form")) {
-        this->SetMensurForm(StrToMensuralVisMensurform(element.attribute("mensur.form").value()));
-        element.remove_attribute("mensur.form");
+    attr = element.attribute("mensur.form");
+    if (attr) {
+        this->SetMensurForm(StrToMensuralVisMensurform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.loc")) {
-        this->SetMensurLoc(StrToInt(element.attribute("mensur.loc").value()));
-        element.remove_attribute("mensur.loc");
+    attr = element.attribute("mensur.loc");
+    if (attr) {
+        this->SetMensurLoc(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.orient")) {
-        this->SetMensurOrient(StrToOrientation(element.attribute("mensur.orient").value()));
-        element.remove_attribute("mensur.orient");
+    attr = element.attribute("mensur.orient");
+    if (attr) {
+        this->SetMensurOrient(StrToOrientation(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mensur.size")) {
-        this->SetMensurSize(StrToSize(element.attribute("mensur.size").value()));
-        element.remove_attribute("mensur.size");
+    attr = element.attribute("mensur.size");
+    if (attr) {
+        this->SetMensurSize(StrToSize(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -454,12 +471,13 @@ void AttNoteLogMensural::ResetNoteLogMensural()
     m_lig = noteLogMensural_LIG_NONE;
 }
 
-bool AttNoteLogMensural::ReadNoteLogMensural(pugi::xml_node element)
+bool AttNoteLogMensural::ReadNoteLogMensural(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("lig")) {
-        this->SetLig(StrToNoteLogMensuralLig(element.attribute("lig").value()));
-        element.remove_attribute("lig");
+    pugi::xml_attribute attr = element.attribute("lig");
+    if (attr) {
+        this->SetLig(StrToNoteLogMensuralLig(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -500,12 +518,13 @@ void AttRestVisMensural::ResetRestVisMensural()
     m_spaces = 0;
 }
 
-bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element)
+bool AttRestVisMensural::ReadRestVisMensural(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("spaces")) {
-        this->SetSpaces(StrToInt(element.attribute("spaces").value()));
-        element.remove_attribute("spaces");
+    pugi::xml_attribute attr = element.attribute("spaces");
+    if (attr) {
+        this->SetSpaces(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
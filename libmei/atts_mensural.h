@@ -38,7 +38,7 @@ public:
     void ResetLigatureLog();
 
     /** Read the values for the attribute class **/
-    bool ReadLigatureLog(pugi::xml_node element);
+    bool ReadLigatureLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLigatureLog(pugi::xml_node element);
@@ -74,7 +74,7 @@ public:
     void ResetMensurVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMensurVis(pugi::xml_node element);
+    bool ReadMensurVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMensurVis(pugi::xml_node element);
@@ -116,7 +116,7 @@ public:
     void ResetMensuralLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMensuralLog(pugi::xml_node element);
+    bool ReadMensuralLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralLog(pugi::xml_node element);
@@ -187,7 +187,7 @@ public:
     void ResetMensuralShared();
 
     /** Read the values for the attribute class **/
-    bool ReadMensuralShared(pugi::xml_node element);
+    bool ReadMensuralShared(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralShared(pugi::xml_node element);
@@ -241,7 +241,7 @@ public:
     void ResetMensuralVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMensuralVis(pugi::xml_node element);
+    bool ReadMensuralVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMensuralVis(pugi::xml_node element);
@@ -304,7 +304,7 @@ public:
     void ResetNoteLogMensural();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteLogMensural(pugi::xml_node element);
+    bool ReadNoteLogMensural(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNoteLogMensural(pugi::xml_node element);
@@ -340,7 +340,7 @@ public:
     void ResetRestVisMensural();
 
     /** Read the values for the attribute class **/
-    bool ReadRestVisMensural(pugi::xml_node element);
+    bool ReadRestVisMensural(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteRestVisMensural(pugi::xml_node element);
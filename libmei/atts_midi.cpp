@@ -47,27 +47,31 @@ void AttChannelized::ResetChannelized()
     m_midiTrack = 0;
 }
 
-bool AttChannelized::ReadChannelized(pugi::xml_node element)
+bool AttChannelized::ReadChannelized(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.channel")) {
-        this->SetMidiChannel(StrToMidichannel(element.attribute("midi.channel").value()));
-        element.remove_attribute("midi.channel");
+    pugi::xml_attribute attr = element.attribute("midi.channel");
+    if (attr) {
+        this->SetMidiChannel(StrToMidichannel(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.duty")) {
-        this->SetMidiDuty(StrToPercent(element.attribute("midi.duty").value()));
-        element.remove_attribute("midi.duty");
+    attr = element.attribute("midi.duty");
+    if (attr) {
+        this->SetMidiDuty(StrToPercent(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.port")) {
-        this->SetMidiPort(StrToMidivalue(element.attribute("midi.port").value()));
-        element.remove_attribute("midi.port");
+    attr = element.attribute("midi.port");
+    if (attr) {
+        this->SetMidiPort(StrToMidivalue(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.track")) {
-        this->SetMidiTrack(StrToInt(element.attribute("midi.track").value()));
-        element.remove_attribute("midi.track");
+    attr = element.attribute("midi.track");
+    if (attr) {
+        this->SetMidiTrack(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -138,28 +142,32 @@ void AttMidiinstrument::ResetMidiinstrument()
     m_midiVolume = -1;
 }
 
-bool AttMidiinstrument::ReadMidiinstrument(pugi::xml_node element)
+bool AttMidiinstrument::ReadMidiinstrument(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.instrnum")) {
-        this->SetMidiInstrnum(StrToMidivalue(element.attribute("midi.instrnum").value()));
-        element.remove_attribute("midi.instrnum");
+    pugi::xml_attribute attr = element.attribute("midi.instrnum");
+    if (attr) {
+        this->SetMidiInstrnum(StrToMidivalue(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.instrname")) {
-        //this->SetMidiInstrname(StrToMidinames(element.attribute("midi.instrname").value()));
-        this->SetMidiInstrname(element.attribute("midi.instrname").value());
-        element.remove_attribute("midi.instrname");
+    attr = element.attribute("midi.instrname");
+    if (attr) {
+        //this->SetMidiInstrname(StrToMidinames(attr.value()));
+        this->SetMidiInstrname(attr.value());
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.pan")) {
-        this->SetMidiPan(StrToMidivalue(element.attribute("midi.pan").value()));
-        element.remove_attribute("midi.pan");
+    attr = element.attribute("midi.pan");
+    if (attr) {
+        this->SetMidiPan(StrToMidivalue(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.volume")) {
-        this->SetMidiVolume(StrToMidivalue(element.attribute("midi.volume").value()));
-        element.remove_attribute("midi.volume");
+    attr = element.attribute("midi.volume");
+    if (attr) {
+        this->SetMidiVolume(StrToMidivalue(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -227,12 +235,13 @@ void AttMidinumber::ResetMidinumber()
     m_num = 0;
 }
 
-bool AttMidinumber::ReadMidinumber(pugi::xml_node element)
+bool AttMidinumber::ReadMidinumber(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    pugi::xml_attribute attr = element.attribute("num");
+    if (attr) {
+        this->SetNum(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -274,17 +283,19 @@ void AttMiditempo::ResetMiditempo()
     m_midiMspb = -1;
 }
 
-bool AttMiditempo::ReadMiditempo(pugi::xml_node element)
+bool AttMiditempo::ReadMiditempo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.bpm")) {
-        this->SetMidiBpm(StrToMidibpm(element.attribute("midi.bpm").value()));
-        element.remove_attribute("midi.bpm");
+    pugi::xml_attribute attr = element.attribute("midi.bpm");
+    if (attr) {
+        this->SetMidiBpm(StrToMidibpm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.mspb")) {
-        this->SetMidiMspb(StrToMidimspb(element.attribute("midi.mspb").value()));
-        element.remove_attribute("midi.mspb");
+    attr = element.attribute("midi.mspb");
+    if (attr) {
+        this->SetMidiMspb(StrToMidimspb(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -334,12 +345,13 @@ void AttMidivalue::ResetMidivalue()
     m_val = -1;
 }
 
-bool AttMidivalue::ReadMidivalue(pugi::xml_node element)
+bool AttMidivalue::ReadMidivalue(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("val")) {
-        this->SetVal(StrToMidivalue(element.attribute("val").value()));
-        element.remove_attribute("val");
+    pugi::xml_attribute attr = element.attribute("val");
+    if (attr) {
+        this->SetVal(StrToMidivalue(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -380,12 +392,13 @@ void AttMidivalue2::ResetMidivalue2()
     m_val2 = -1;
 }
 
-bool AttMidivalue2::ReadMidivalue2(pugi::xml_node element)
+bool AttMidivalue2::ReadMidivalue2(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("val2")) {
-        this->SetVal2(StrToMidivalue(element.attribute("val2").value()));
-        element.remove_attribute("val2");
+    pugi::xml_attribute attr = element.attribute("val2");
+    if (attr) {
+        this->SetVal2(StrToMidivalue(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -426,12 +439,13 @@ void AttMidivelocity::ResetMidivelocity()
     m_vel = -1;
 }
 
-bool AttMidivelocity::ReadMidivelocity(pugi::xml_node element)
+bool AttMidivelocity::ReadMidivelocity(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("vel")) {
-        this->SetVel(StrToMidivalue(element.attribute("vel").value()));
-        element.remove_attribute("vel");
+    pugi::xml_attribute attr = element.attribute("vel");
+    if (attr) {
+        this->SetVel(StrToMidivalue(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -472,12 +486,13 @@ void AttTimebase::ResetTimebase()
     m_ppq = 0;
 }
 
-bool AttTimebase::ReadTimebase(pugi::xml_node element)
+bool AttTimebase::ReadTimebase(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("ppq")) {
-        this->SetPpq(StrToInt(element.attribute("ppq").value()));
-        element.remove_attribute("ppq");
+    pugi::xml_attribute attr = element.attribute("ppq");
+    if (attr) {
+        this->SetPpq(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
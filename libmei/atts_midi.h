@@ -38,7 +38,7 @@ public:
     void ResetChannelized();
 
     /** Read the values for the attribute class **/
-    bool ReadChannelized(pugi::xml_node element);
+    bool ReadChannelized(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteChannelized(pugi::xml_node element);
@@ -92,7 +92,7 @@ public:
     void ResetMidiinstrument();
 
     /** Read the values for the attribute class **/
-    bool ReadMidiinstrument(pugi::xml_node element);
+    bool ReadMidiinstrument(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMidiinstrument(pugi::xml_node element);
@@ -149,7 +149,7 @@ public:
     void ResetMidinumber();
 
     /** Read the values for the attribute class **/
-    bool ReadMidinumber(pugi::xml_node element);
+    bool ReadMidinumber(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMidinumber(pugi::xml_node element);
@@ -188,7 +188,7 @@ public:
     void ResetMiditempo();
 
     /** Read the values for the attribute class **/
-    bool ReadMiditempo(pugi::xml_node element);
+    bool ReadMiditempo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMiditempo(pugi::xml_node element);
@@ -239,7 +239,7 @@ public:
     void ResetMidivalue();
 
     /** Read the values for the attribute class **/
-    bool ReadMidivalue(pugi::xml_node element);
+    bool ReadMidivalue(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMidivalue(pugi::xml_node element);
@@ -275,7 +275,7 @@ public:
     void ResetMidivalue2();
 
     /** Read the values for the attribute class **/
-    bool ReadMidivalue2(pugi::xml_node element);
+    bool ReadMidivalue2(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMidivalue2(pugi::xml_node element);
@@ -311,7 +311,7 @@ public:
     void ResetMidivelocity();
 
     /** Read the values for the attribute class **/
-    bool ReadMidivelocity(pugi::xml_node element);
+    bool ReadMidivelocity(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMidivelocity(pugi::xml_node element);
@@ -347,7 +347,7 @@ public:
     void ResetTimebase();
 
     /** Read the values for the attribute class **/
-    bool ReadTimebase(pugi::xml_node element);
+    bool ReadTimebase(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTimebase(pugi::xml_node element);
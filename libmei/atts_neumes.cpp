@@ -45,17 +45,19 @@ void AttIneumeLog::ResetIneumeLog()
     m_name = INEUMENAME_NONE;
 }
 
-bool AttIneumeLog::ReadIneumeLog(pugi::xml_node element)
+bool AttIneumeLog::ReadIneumeLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToIneumeform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToIneumeform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("name")) {
-        this->SetName(StrToIneumename(element.attribute("name").value()));
-        element.remove_attribute("name");
+    attr = element.attribute("name");
+    if (attr) {
+        this->SetName(StrToIneumename(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -106,17 +108,19 @@ void AttUneumeLog::ResetUneumeLog()
     m_name = UNEUMENAME_NONE;
 }
 
-bool AttUneumeLog::ReadUneumeLog(pugi::xml_node element)
+bool AttUneumeLog::ReadUneumeLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToUneumeform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToUneumeform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("name")) {
-        this->SetName(StrToUneumename(element.attribute("name").value()));
-        element.remove_attribute("name");
+    attr = element.attribute("name");
+    if (attr) {
+        this->SetName(StrToUneumename(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetIneumeLog();
 
     /** Read the values for the attribute class **/
-    bool ReadIneumeLog(pugi::xml_node element);
+    bool ReadIneumeLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteIneumeLog(pugi::xml_node element);
@@ -80,7 +80,7 @@ public:
     void ResetUneumeLog();
 
     /** Read the values for the attribute class **/
-    bool ReadUneumeLog(pugi::xml_node element);
+    bool ReadUneumeLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteUneumeLog(pugi::xml_node element);
@@ -44,12 +44,13 @@ void AttSurface::ResetSurface()
     m_surface = "";
 }
 
-bool AttSurface::ReadSurface(pugi::xml_node element)
+bool AttSurface::ReadSurface(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("surface")) {
-        this->SetSurface(StrToStr(element.attribute("surface").value()));
-        element.remove_attribute("surface");
+    pugi::xml_attribute attr = element.attribute("surface");
+    if (attr) {
+        this->SetSurface(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
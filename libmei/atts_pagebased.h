@@ -38,7 +38,7 @@ public:
     void ResetSurface();
 
     /** Read the values for the attribute class **/
-    bool ReadSurface(pugi::xml_node element);
+    bool ReadSurface(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSurface(pugi::xml_node element);
@@ -44,12 +44,13 @@ void AttAlignment::ResetAlignment()
     m_when = "";
 }
 
-bool AttAlignment::ReadAlignment(pugi::xml_node element)
+bool AttAlignment::ReadAlignment(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("when")) {
-        this->SetWhen(StrToStr(element.attribute("when").value()));
-        element.remove_attribute("when");
+    pugi::xml_attribute attr = element.attribute("when");
+    if (attr) {
+        this->SetWhen(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -44,12 +44,13 @@ void AttAccidLog::ResetAccidLog()
     m_func = accidLog_FUNC_NONE;
 }
 
-bool AttAccidLog::ReadAccidLog(pugi::xml_node element)
+bool AttAccidLog::ReadAccidLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToAccidLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    pugi::xml_attribute attr = element.attribute("func");
+    if (attr) {
+        this->SetFunc(StrToAccidLogFunc(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -90,12 +91,13 @@ void AttAccidental::ResetAccidental()
     m_accid = ACCIDENTAL_EXPLICIT_NONE;
 }
 
-bool AttAccidental::ReadAccidental(pugi::xml_node element)
+bool AttAccidental::ReadAccidental(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid")) {
-        this->SetAccid(StrToAccidentalExplicit(element.attribute("accid").value()));
-        element.remove_attribute("accid");
+    pugi::xml_attribute attr = element.attribute("accid");
+    if (attr) {
+        this->SetAccid(StrToAccidentalExplicit(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -136,12 +138,13 @@ void AttAccidentalPerformed::ResetAccidentalPerformed()
     m_accidGes = ACCIDENTAL_IMPLICIT_NONE;
 }
 
-bool AttAccidentalPerformed::ReadAccidentalPerformed(pugi::xml_node element)
+bool AttAccidentalPerformed::ReadAccidentalPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("accid.ges")) {
-        this->SetAccidGes(StrToAccidentalImplicit(element.attribute("accid.ges").value()));
-        element.remove_attribute("accid.ges");
+    pugi::xml_attribute attr = element.attribute("accid.ges");
+    if (attr) {
+        this->SetAccidGes(StrToAccidentalImplicit(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -182,12 +185,13 @@ void AttArticulation::ResetArticulation()
     m_artic = std::vector<data_ARTICULATION>();
 }
 
-bool AttArticulation::ReadArticulation(pugi::xml_node element)
+bool AttArticulation::ReadArticulation(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic")) {
-        this->SetArtic(StrToArticulationList(element.attribute("artic").value()));
-        element.remove_attribute("artic");
+    pugi::xml_attribute attr = element.attribute("artic");
+    if (attr) {
+        this->SetArtic(StrToArticulationList(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -228,12 +232,13 @@ void AttArticulationPerformed::ResetArticulationPerformed()
     m_articGes = ARTICULATION_NONE;
 }
 
-bool AttArticulationPerformed::ReadArticulationPerformed(pugi::xml_node element)
+bool AttArticulationPerformed::ReadArticulationPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("artic.ges")) {
-        this->SetArticGes(StrToArticulation(element.attribute("artic.ges").value()));
-        element.remove_attribute("artic.ges");
+    pugi::xml_attribute attr = element.attribute("artic.ges");
+    if (attr) {
+        this->SetArticGes(StrToArticulation(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -274,12 +279,13 @@ void AttAugmentdots::ResetAugmentdots()
     m_dots = 0;
 }
 
-bool AttAugmentdots::ReadAugmentdots(pugi::xml_node element)
+bool AttAugmentdots::ReadAugmentdots(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dots")) {
-        this->SetDots(StrToInt(element.attribute("dots").value()));
-        element.remove_attribute("dots");
+    pugi::xml_attribute attr = element.attribute("dots");
+    if (attr) {
+        this->SetDots(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -321,17 +327,19 @@ void AttAuthorized::ResetAuthorized()
     m_authURI = "";
 }
 
-bool AttAuthorized::ReadAuthorized(pugi::xml_node element)
+bool AttAuthorized::ReadAuthorized(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("authority")) {
-        this->SetAuthority(StrToStr(element.attribute("authority").value()));
-        element.remove_attribute("authority");
+    pugi::xml_attribute attr = element.attribute("authority");
+    if (attr) {
+        this->SetAuthority(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("authURI")) {
-        this->SetAuthURI(StrToStr(element.attribute("authURI").value()));
-        element.remove_attribute("authURI");
+    attr = element.attribute("authURI");
+    if (attr) {
+        this->SetAuthURI(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -381,12 +389,13 @@ void AttBarLineLog::ResetBarLineLog()
     m_form = BARRENDITION_single;
 }
 
-bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element)
+bool AttBarLineLog::ReadBarLineLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBarrendition(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToBarrendition(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -428,17 +437,19 @@ void AttBarplacement::ResetBarplacement()
     m_taktplace = 0;
 }
 
-bool AttBarplacement::ReadBarplacement(pugi::xml_node element)
+bool AttBarplacement::ReadBarplacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("barplace")) {
-        this->SetBarplace(StrToBarplace(element.attribute("barplace").value()));
-        element.remove_attribute("barplace");
+    pugi::xml_attribute attr = element.attribute("barplace");
+    if (attr) {
+        this->SetBarplace(StrToBarplace(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("taktplace")) {
-        this->SetTaktplace(StrToInt(element.attribute("taktplace").value()));
-        element.remove_attribute("taktplace");
+    attr = element.attribute("taktplace");
+    if (attr) {
+        this->SetTaktplace(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -490,22 +501,25 @@ void AttBeamingVis::ResetBeamingVis()
     m_beamSlope = 0.0;
 }
 
-bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element)
+bool AttBeamingVis::ReadBeamingVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.color")) {
-        this->SetBeamColor(StrToStr(element.attribute("beam.color").value()));
-        element.remove_attribute("beam.color");
+    pugi::xml_attribute attr = element.attribute("beam.color");
+    if (attr) {
+        this->SetBeamColor(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rend")) {
-        this->SetBeamRend(StrToBeamingVisBeamrend(element.attribute("beam.rend").value()));
-        element.remove_attribute("beam.rend");
+    attr = element.attribute("beam.rend");
+    if (attr) {
+        this->SetBeamRend(StrToBeamingVisBeamrend(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beam.slope")) {
-        this->SetBeamSlope(StrToDbl(element.attribute("beam.slope").value()));
-        element.remove_attribute("beam.slope");
+    attr = element.attribute("beam.slope");
+    if (attr) {
+        this->SetBeamSlope(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -564,12 +578,13 @@ void AttBibl::ResetBibl()
     m_analog = "";
 }
 
-bool AttBibl::ReadBibl(pugi::xml_node element)
+bool AttBibl::ReadBibl(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("analog")) {
-        this->SetAnalog(StrToStr(element.attribute("analog").value()));
-        element.remove_attribute("analog");
+    pugi::xml_attribute attr = element.attribute("analog");
+    if (attr) {
+        this->SetAnalog(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -610,12 +625,13 @@ void AttCalendared::ResetCalendared()
     m_calendar = "";
 }
 
-bool AttCalendared::ReadCalendared(pugi::xml_node element)
+bool AttCalendared::ReadCalendared(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("calendar")) {
-        this->SetCalendar(StrToStr(element.attribute("calendar").value()));
-        element.remove_attribute("calendar");
+    pugi::xml_attribute attr = element.attribute("calendar");
+    if (attr) {
+        this->SetCalendar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -656,12 +672,13 @@ void AttCanonical::ResetCanonical()
     m_codedval = "";
 }
 
-bool AttCanonical::ReadCanonical(pugi::xml_node element)
+bool AttCanonical::ReadCanonical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("codedval")) {
-        this->SetCodedval(StrToStr(element.attribute("codedval").value()));
-        element.remove_attribute("codedval");
+    pugi::xml_attribute attr = element.attribute("codedval");
+    if (attr) {
+        this->SetCodedval(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -702,12 +719,13 @@ void AttChordVis::ResetChordVis()
     m_cluster = CLUSTER_NONE;
 }
 
-bool AttChordVis::ReadChordVis(pugi::xml_node element)
+bool AttChordVis::ReadChordVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("cluster")) {
-        this->SetCluster(StrToCluster(element.attribute("cluster").value()));
-        element.remove_attribute("cluster");
+    pugi::xml_attribute attr = element.attribute("cluster");
+    if (attr) {
+        this->SetCluster(StrToCluster(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -748,12 +766,13 @@ void AttClasscodeident::ResetClasscodeident()
     m_classcode = "";
 }
 
-bool AttClasscodeident::ReadClasscodeident(pugi::xml_node element)
+bool AttClasscodeident::ReadClasscodeident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("classcode")) {
-        this->SetClasscode(StrToStr(element.attribute("classcode").value()));
-        element.remove_attribute("classcode");
+    pugi::xml_attribute attr = element.attribute("classcode");
+    if (attr) {
+        this->SetClasscode(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -794,12 +813,13 @@ void AttClefLog::ResetClefLog()
     m_cautionary = BOOLEAN_NONE;
 }
 
-bool AttClefLog::ReadClefLog(pugi::xml_node element)
+bool AttClefLog::ReadClefLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("cautionary")) {
-        this->SetCautionary(StrToBoolean(element.attribute("cautionary").value()));
-        element.remove_attribute("cautionary");
+    pugi::xml_attribute attr = element.attribute("cautionary");
+    if (attr) {
+        this->SetCautionary(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -843,27 +863,31 @@ void AttCleffingLog::ResetCleffingLog()
     m_clefDisPlace = PLACE_NONE;
 }
 
-bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element)
+bool AttCleffingLog::ReadCleffingLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.shape")) {
-        this->SetClefShape(StrToClefshape(element.attribute("clef.shape").value()));
-        element.remove_attribute("clef.shape");
+    pugi::xml_attribute attr = element.attribute("clef.shape");
+    if (attr) {
+        this->SetClefShape(StrToClefshape(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.line")) {
-        this->SetClefLine(StrToInt(element.attribute("clef.line").value()));
-        element.remove_attribute("clef.line");
+    attr = element.attribute("clef.line");
+    if (attr) {
+        this->SetClefLine(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis")) {
-        this->SetClefDis(StrToOctaveDis(element.attribute("clef.dis").value()));
-        element.remove_attribute("clef.dis");
+    attr = element.attribute("clef.dis");
+    if (attr) {
+        this->SetClefDis(StrToOctaveDis(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.dis.place")) {
-        this->SetClefDisPlace(StrToPlace(element.attribute("clef.dis.place").value()));
-        element.remove_attribute("clef.dis.place");
+    attr = element.attribute("clef.dis.place");
+    if (attr) {
+        this->SetClefDisPlace(StrToPlace(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -932,17 +956,19 @@ void AttCleffingVis::ResetCleffingVis()
     m_clefVisible = BOOLEAN_NONE;
 }
 
-bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element)
+bool AttCleffingVis::ReadCleffingVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("clef.color")) {
-        this->SetClefColor(StrToStr(element.attribute("clef.color").value()));
-        element.remove_attribute("clef.color");
+    pugi::xml_attribute attr = element.attribute("clef.color");
+    if (attr) {
+        this->SetClefColor(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("clef.visible")) {
-        this->SetClefVisible(StrToBoolean(element.attribute("clef.visible").value()));
-        element.remove_attribute("clef.visible");
+    attr = element.attribute("clef.visible");
+    if (attr) {
+        this->SetClefVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -992,12 +1018,13 @@ void AttClefshape::ResetClefshape()
     m_shape = CLEFSHAPE_NONE;
 }
 
-bool AttClefshape::ReadClefshape(pugi::xml_node element)
+bool AttClefshape::ReadClefshape(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("shape")) {
-        this->SetShape(StrToClefshape(element.attribute("shape").value()));
-        element.remove_attribute("shape");
+    pugi::xml_attribute attr = element.attribute("shape");
+    if (attr) {
+        this->SetShape(StrToClefshape(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1038,12 +1065,13 @@ void AttColor::ResetColor()
     m_color = "";
 }
 
-bool AttColor::ReadColor(pugi::xml_node element)
+bool AttColor::ReadColor(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("color")) {
-        this->SetColor(StrToStr(element.attribute("color").value()));
-        element.remove_attribute("color");
+    pugi::xml_attribute attr = element.attribute("color");
+    if (attr) {
+        this->SetColor(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1084,12 +1112,13 @@ void AttColoration::ResetColoration()
     m_colored = BOOLEAN_NONE;
 }
 
-bool AttColoration::ReadColoration(pugi::xml_node element)
+bool AttColoration::ReadColoration(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("colored")) {
-        this->SetColored(StrToBoolean(element.attribute("colored").value()));
-        element.remove_attribute("colored");
+    pugi::xml_attribute attr = element.attribute("colored");
+    if (attr) {
+        this->SetColored(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1130,12 +1159,13 @@ void AttCommon::ResetCommon()
     m_n = -1;
 }
 
-bool AttCommon::ReadCommon(pugi::xml_node element)
+bool AttCommon::ReadCommon(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("n")) {
-        this->SetN(StrToInt(element.attribute("n").value()));
-        element.remove_attribute("n");
+    pugi::xml_attribute attr = element.attribute("n");
+    if (attr) {
+        this->SetN(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1177,17 +1207,19 @@ void AttCommonPart::ResetCommonPart()
     m_base = "";
 }
 
-bool AttCommonPart::ReadCommonPart(pugi::xml_node element)
+bool AttCommonPart::ReadCommonPart(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("label")) {
-        this->SetLabel(StrToStr(element.attribute("label").value()));
-        element.remove_attribute("label");
+    pugi::xml_attribute attr = element.attribute("label");
+    if (attr) {
+        this->SetLabel(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xml:base")) {
-        this->SetBase(StrToStr(element.attribute("xml:base").value()));
-        element.remove_attribute("xml:base");
+    attr = element.attribute("xml:base");
+    if (attr) {
+        this->SetBase(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1240,27 +1272,31 @@ void AttCoordinated::ResetCoordinated()
     m_lry = 0;
 }
 
-bool AttCoordinated::ReadCoordinated(pugi::xml_node element)
+bool AttCoordinated::ReadCoordinated(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("ulx")) {
-        this->SetUlx(StrToInt(element.attribute("ulx").value()));
-        element.remove_attribute("ulx");
+    pugi::xml_attribute attr = element.attribute("ulx");
+    if (attr) {
+        this->SetUlx(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("uly")) {
-        this->SetUly(StrToInt(element.attribute("uly").value()));
-        element.remove_attribute("uly");
+    attr = element.attribute("uly");
+    if (attr) {
+        this->SetUly(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lrx")) {
-        this->SetLrx(StrToInt(element.attribute("lrx").value()));
-        element.remove_attribute("lrx");
+    attr = element.attribute("lrx");
+    if (attr) {
+        this->SetLrx(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lry")) {
-        this->SetLry(StrToInt(element.attribute("lry").value()));
-        element.remove_attribute("lry");
+    attr = element.attribute("lry");
+    if (attr) {
+        this->SetLry(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1330,22 +1366,25 @@ void AttCurvature::ResetCurvature()
     m_curvedir = curvature_CURVEDIR_NONE;
 }
 
-bool AttCurvature::ReadCurvature(pugi::xml_node element)
+bool AttCurvature::ReadCurvature(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("bezier")) {
-        this->SetBezier(StrToStr(element.attribute("bezier").value()));
-        element.remove_attribute("bezier");
+    pugi::xml_attribute attr = element.attribute("bezier");
+    if (attr) {
+        this->SetBezier(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("bulge")) {
-        this->SetBulge(StrToDbl(element.attribute("bulge").value()));
-        element.remove_attribute("bulge");
+    attr = element.attribute("bulge");
+    if (attr) {
+        this->SetBulge(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("curvedir")) {
-        this->SetCurvedir(StrToCurvatureCurvedir(element.attribute("curvedir").value()));
-        element.remove_attribute("curvedir");
+    attr = element.attribute("curvedir");
+    if (attr) {
+        this->SetCurvedir(StrToCurvatureCurvedir(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1405,17 +1444,19 @@ void AttCurverend::ResetCurverend()
     m_lwidth = "";
 }
 
-bool AttCurverend::ReadCurverend(pugi::xml_node element)
+bool AttCurverend::ReadCurverend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
+    pugi::xml_attribute attr = element.attribute("lform");
+    if (attr) {
+        this->SetLform(StrToLineform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToStr(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    attr = element.attribute("lwidth");
+    if (attr) {
+        this->SetLwidth(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1465,12 +1506,13 @@ void AttCustosLog::ResetCustosLog()
     m_target = "";
 }
 
-bool AttCustosLog::ReadCustosLog(pugi::xml_node element)
+bool AttCustosLog::ReadCustosLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("target")) {
-        this->SetTarget(StrToStr(element.attribute("target").value()));
-        element.remove_attribute("target");
+    pugi::xml_attribute attr = element.attribute("target");
+    if (attr) {
+        this->SetTarget(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1515,32 +1557,37 @@ void AttDatable::ResetDatable()
     m_startdate = "";
 }
 
-bool AttDatable::ReadDatable(pugi::xml_node element)
+bool AttDatable::ReadDatable(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("enddate")) {
-        this->SetEnddate(StrToStr(element.attribute("enddate").value()));
-        element.remove_attribute("enddate");
+    pugi::xml_attribute attr = element.attribute("enddate");
+    if (attr) {
+        this->SetEnddate(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("isodate")) {
-        this->SetIsodate(StrToStr(element.attribute("isodate").value()));
-        element.remove_attribute("isodate");
+    attr = element.attribute("isodate");
+    if (attr) {
+        this->SetIsodate(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("notafter")) {
-        this->SetNotafter(StrToStr(element.attribute("notafter").value()));
-        element.remove_attribute("notafter");
+    attr = element.attribute("notafter");
+    if (attr) {
+        this->SetNotafter(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("notbefore")) {
-        this->SetNotbefore(StrToStr(element.attribute("notbefore").value()));
-        element.remove_attribute("notbefore");
+    attr = element.attribute("notbefore");
+    if (attr) {
+        this->SetNotbefore(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("startdate")) {
-        this->SetStartdate(StrToStr(element.attribute("startdate").value()));
-        element.remove_attribute("startdate");
+    attr = element.attribute("startdate");
+    if (attr) {
+        this->SetStartdate(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1617,12 +1664,13 @@ void AttDatapointing::ResetDatapointing()
     m_data = "";
 }
 
-bool AttDatapointing::ReadDatapointing(pugi::xml_node element)
+bool AttDatapointing::ReadDatapointing(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("data")) {
-        this->SetData(StrToStr(element.attribute("data").value()));
-        element.remove_attribute("data");
+    pugi::xml_attribute attr = element.attribute("data");
+    if (attr) {
+        this->SetData(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1663,12 +1711,13 @@ void AttDeclaring::ResetDeclaring()
     m_decls = "";
 }
 
-bool AttDeclaring::ReadDeclaring(pugi::xml_node element)
+bool AttDeclaring::ReadDeclaring(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("decls")) {
-        this->SetDecls(StrToStr(element.attribute("decls").value()));
-        element.remove_attribute("decls");
+    pugi::xml_attribute attr = element.attribute("decls");
+    if (attr) {
+        this->SetDecls(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1711,22 +1760,25 @@ void AttDistances::ResetDistances()
     m_textDist = "";
 }
 
-bool AttDistances::ReadDistances(pugi::xml_node element)
+bool AttDistances::ReadDistances(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dynam.dist")) {
-        this->SetDynamDist(StrToStr(element.attribute("dynam.dist").value()));
-        element.remove_attribute("dynam.dist");
+    pugi::xml_attribute attr = element.attribute("dynam.dist");
+    if (attr) {
+        this->SetDynamDist(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("harm.dist")) {
-        this->SetHarmDist(StrToStr(element.attribute("harm.dist").value()));
-        element.remove_attribute("harm.dist");
+    attr = element.attribute("harm.dist");
+    if (attr) {
+        this->SetHarmDist(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.dist")) {
-        this->SetTextDist(StrToStr(element.attribute("text.dist").value()));
-        element.remove_attribute("text.dist");
+    attr = element.attribute("text.dist");
+    if (attr) {
+        this->SetTextDist(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1785,12 +1837,13 @@ void AttDotLog::ResetDotLog()
     m_form = dotLog_FORM_NONE;
 }
 
-bool AttDotLog::ReadDotLog(pugi::xml_node element)
+bool AttDotLog::ReadDotLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDotLogForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToDotLogForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1831,12 +1884,13 @@ void AttDurationAdditive::ResetDurationAdditive()
     m_dur = DURATION_NONE;
 }
 
-bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element)
+bool AttDurationAdditive::ReadDurationAdditive(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    pugi::xml_attribute attr = element.attribute("dur");
+    if (attr) {
+        this->SetDur(StrToDuration(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1879,22 +1933,25 @@ void AttDurationDefault::ResetDurationDefault()
     m_numbaseDefault = 0;
 }
 
-bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element)
+bool AttDurationDefault::ReadDurationDefault(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.default")) {
-        this->SetDurDefault(StrToDuration(element.attribute("dur.default").value()));
-        element.remove_attribute("dur.default");
+    pugi::xml_attribute attr = element.attribute("dur.default");
+    if (attr) {
+        this->SetDurDefault(StrToDuration(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("num.default")) {
-        this->SetNumDefault(StrToInt(element.attribute("num.default").value()));
-        element.remove_attribute("num.default");
+    attr = element.attribute("num.default");
+    if (attr) {
+        this->SetNumDefault(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("numbase.default")) {
-        this->SetNumbaseDefault(StrToInt(element.attribute("numbase.default").value()));
-        element.remove_attribute("numbase.default");
+    attr = element.attribute("numbase.default");
+    if (attr) {
+        this->SetNumbaseDefault(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1953,12 +2010,13 @@ void AttDurationMusical::ResetDurationMusical()
     m_dur = DURATION_NONE;
 }
 
-bool AttDurationMusical::ReadDurationMusical(pugi::xml_node element)
+bool AttDurationMusical::ReadDurationMusical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur")) {
-        this->SetDur(StrToDuration(element.attribute("dur").value()));
-        element.remove_attribute("dur");
+    pugi::xml_attribute attr = element.attribute("dur");
+    if (attr) {
+        this->SetDur(StrToDuration(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2000,13 +2058,14 @@ void AttDurationPerformed::ResetDurationPerformed()
     m_durPPQ = -1;
 }
 
-bool AttDurationPerformed::ReadDurationPerformed(pugi::xml_node element)
+bool AttDurationPerformed::ReadDurationPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dur.ges")) {
-        this->SetDurGes(StrToDuration(element.attribute("dur.ges").value()));
-        this->SetDurPPQ(StrToPPQ(element.attribute("dur.ges").value()));
-        element.remove_attribute("dur.ges");
+    pugi::xml_attribute attr = element.attribute("dur.ges");
+    if (attr) {
+        this->SetDurGes(StrToDuration(attr.value()));
+        this->SetDurPPQ(StrToPPQ(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2058,17 +2117,19 @@ void AttDurationRatio::ResetDurationRatio()
     m_numbase = -1;
 }
 
-bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element)
+bool AttDurationRatio::ReadDurationRatio(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    pugi::xml_attribute attr = element.attribute("num");
+    if (attr) {
+        this->SetNum(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("numbase")) {
-        this->SetNumbase(StrToInt(element.attribute("numbase").value()));
-        element.remove_attribute("numbase");
+    attr = element.attribute("numbase");
+    if (attr) {
+        this->SetNumbase(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2118,12 +2179,13 @@ void AttEnclosingchars::ResetEnclosingchars()
     m_enclose = ENCLOSURE_NONE;
 }
 
-bool AttEnclosingchars::ReadEnclosingchars(pugi::xml_node element)
+bool AttEnclosingchars::ReadEnclosingchars(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("enclose")) {
-        this->SetEnclose(StrToEnclosure(element.attribute("enclose").value()));
-        element.remove_attribute("enclose");
+    pugi::xml_attribute attr = element.attribute("enclose");
+    if (attr) {
+        this->SetEnclose(StrToEnclosure(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2164,12 +2226,13 @@ void AttEndings::ResetEndings()
     m_endingRend = endings_ENDINGREND_NONE;
 }
 
-bool AttEndings::ReadEndings(pugi::xml_node element)
+bool AttEndings::ReadEndings(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("ending.rend")) {
-        this->SetEndingRend(StrToEndingsEndingrend(element.attribute("ending.rend").value()));
-        element.remove_attribute("ending.rend");
+    pugi::xml_attribute attr = element.attribute("ending.rend");
+    if (attr) {
+        this->SetEndingRend(StrToEndingsEndingrend(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2210,12 +2273,13 @@ void AttExtender::ResetExtender()
     m_extender = BOOLEAN_NONE;
 }
 
-bool AttExtender::ReadExtender(pugi::xml_node element)
+bool AttExtender::ReadExtender(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("extender")) {
-        this->SetExtender(StrToBoolean(element.attribute("extender").value()));
-        element.remove_attribute("extender");
+    pugi::xml_attribute attr = element.attribute("extender");
+    if (attr) {
+        this->SetExtender(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2256,12 +2320,13 @@ void AttFermatapresent::ResetFermatapresent()
     m_fermata = PLACE_NONE;
 }
 
-bool AttFermatapresent::ReadFermatapresent(pugi::xml_node element)
+bool AttFermatapresent::ReadFermatapresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("fermata")) {
-        this->SetFermata(StrToPlace(element.attribute("fermata").value()));
-        element.remove_attribute("fermata");
+    pugi::xml_attribute attr = element.attribute("fermata");
+    if (attr) {
+        this->SetFermata(StrToPlace(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2302,12 +2367,13 @@ void AttFiling::ResetFiling()
     m_nonfiling = 0;
 }
 
-bool AttFiling::ReadFiling(pugi::xml_node element)
+bool AttFiling::ReadFiling(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("nonfiling")) {
-        this->SetNonfiling(StrToInt(element.attribute("nonfiling").value()));
-        element.remove_attribute("nonfiling");
+    pugi::xml_attribute attr = element.attribute("nonfiling");
+    if (attr) {
+        this->SetNonfiling(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2348,12 +2414,13 @@ void AttGrpSymLog::ResetGrpSymLog()
     m_level = 0;
 }
 
-bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element)
+bool AttGrpSymLog::ReadGrpSymLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("level")) {
-        this->SetLevel(StrToInt(element.attribute("level").value()));
-        element.remove_attribute("level");
+    pugi::xml_attribute attr = element.attribute("level");
+    if (attr) {
+        this->SetLevel(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2394,12 +2461,13 @@ void AttHandident::ResetHandident()
     m_hand = "";
 }
 
-bool AttHandident::ReadHandident(pugi::xml_node element)
+bool AttHandident::ReadHandident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("hand")) {
-        this->SetHand(StrToStr(element.attribute("hand").value()));
-        element.remove_attribute("hand");
+    pugi::xml_attribute attr = element.attribute("hand");
+    if (attr) {
+        this->SetHand(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2440,12 +2508,13 @@ void AttHeight::ResetHeight()
     m_height = "";
 }
 
-bool AttHeight::ReadHeight(pugi::xml_node element)
+bool AttHeight::ReadHeight(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("height")) {
-        this->SetHeight(StrToStr(element.attribute("height").value()));
-        element.remove_attribute("height");
+    pugi::xml_attribute attr = element.attribute("height");
+    if (attr) {
+        this->SetHeight(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2486,12 +2555,13 @@ void AttHorizontalalign::ResetHorizontalalign()
     m_halign = HORIZONTALALIGNMENT_NONE;
 }
 
-bool AttHorizontalalign::ReadHorizontalalign(pugi::xml_node element)
+bool AttHorizontalalign::ReadHorizontalalign(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("halign")) {
-        this->SetHalign(StrToHorizontalalignment(element.attribute("halign").value()));
-        element.remove_attribute("halign");
+    pugi::xml_attribute attr = element.attribute("halign");
+    if (attr) {
+        this->SetHalign(StrToHorizontalalignment(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2532,12 +2602,13 @@ void AttInstrumentident::ResetInstrumentident()
     m_instr = "";
 }
 
-bool AttInstrumentident::ReadInstrumentident(pugi::xml_node element)
+bool AttInstrumentident::ReadInstrumentident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("instr")) {
-        this->SetInstr(StrToStr(element.attribute("instr").value()));
-        element.remove_attribute("instr");
+    pugi::xml_attribute attr = element.attribute("instr");
+    if (attr) {
+        this->SetInstr(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2578,12 +2649,13 @@ void AttInternetmedia::ResetInternetmedia()
     m_mimetype = "";
 }
 
-bool AttInternetmedia::ReadInternetmedia(pugi::xml_node element)
+bool AttInternetmedia::ReadInternetmedia(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("mimetype")) {
-        this->SetMimetype(StrToStr(element.attribute("mimetype").value()));
-        element.remove_attribute("mimetype");
+    pugi::xml_attribute attr = element.attribute("mimetype");
+    if (attr) {
+        this->SetMimetype(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2624,12 +2696,13 @@ void AttJoined::ResetJoined()
     m_join = "";
 }
 
-bool AttJoined::ReadJoined(pugi::xml_node element)
+bool AttJoined::ReadJoined(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("join")) {
-        this->SetJoin(StrToStr(element.attribute("join").value()));
-        element.remove_attribute("join");
+    pugi::xml_attribute attr = element.attribute("join");
+    if (attr) {
+        this->SetJoin(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2672,22 +2745,25 @@ void AttKeySigLog::ResetKeySigLog()
     m_mode = MODE_NONE;
 }
 
-bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element)
+bool AttKeySigLog::ReadKeySigLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig")) {
-        this->SetSig(StrToKeysignature(element.attribute("sig").value()));
-        element.remove_attribute("sig");
+    pugi::xml_attribute attr = element.attribute("sig");
+    if (attr) {
+        this->SetSig(StrToKeysignature(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sig.mixed")) {
-        this->SetSigMixed(StrToStr(element.attribute("sig.mixed").value()));
-        element.remove_attribute("sig.mixed");
+    attr = element.attribute("sig.mixed");
+    if (attr) {
+        this->SetSigMixed(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mode")) {
-        this->SetMode(StrToMode(element.attribute("mode").value()));
-        element.remove_attribute("mode");
+    attr = element.attribute("mode");
+    if (attr) {
+        this->SetMode(StrToMode(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2746,12 +2822,13 @@ void AttKeySigVis::ResetKeySigVis()
     m_sigShowchange = BOOLEAN_NONE;
 }
 
-bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element)
+bool AttKeySigVis::ReadKeySigVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("sig.showchange")) {
-        this->SetSigShowchange(StrToBoolean(element.attribute("sig.showchange").value()));
-        element.remove_attribute("sig.showchange");
+    pugi::xml_attribute attr = element.attribute("sig.showchange");
+    if (attr) {
+        this->SetSigShowchange(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2796,32 +2873,37 @@ void AttKeySigDefaultLog::ResetKeySigDefaultLog()
     m_keySigMixed = "";
 }
 
-bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element)
+bool AttKeySigDefaultLog::ReadKeySigDefaultLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.accid")) {
-        this->SetKeyAccid(StrToAccidentalImplicit(element.attribute("key.accid").value()));
-        element.remove_attribute("key.accid");
+    pugi::xml_attribute attr = element.attribute("key.accid");
+    if (attr) {
+        this->SetKeyAccid(StrToAccidentalImplicit(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("key.mode")) {
-        this->SetKeyMode(StrToMode(element.attribute("key.mode").value()));
-        element.remove_attribute("key.mode");
+    attr = element.attribute("key.mode");
+    if (attr) {
+        this->SetKeyMode(StrToMode(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("key.pname")) {
-        this->SetKeyPname(StrToPitchname(element.attribute("key.pname").value()));
-        element.remove_attribute("key.pname");
+    attr = element.attribute("key.pname");
+    if (attr) {
+        this->SetKeyPname(StrToPitchname(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("key.sig")) {
-        this->SetKeySig(StrToKeysignature(element.attribute("key.sig").value()));
-        element.remove_attribute("key.sig");
+    attr = element.attribute("key.sig");
+    if (attr) {
+        this->SetKeySig(StrToKeysignature(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("key.sig.mixed")) {
-        this->SetKeySigMixed(StrToStr(element.attribute("key.sig.mixed").value()));
-        element.remove_attribute("key.sig.mixed");
+    attr = element.attribute("key.sig.mixed");
+    if (attr) {
+        this->SetKeySigMixed(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2899,17 +2981,19 @@ void AttKeySigDefaultVis::ResetKeySigDefaultVis()
     m_keySigShowchange = BOOLEAN_NONE;
 }
 
-bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element)
+bool AttKeySigDefaultVis::ReadKeySigDefaultVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.sig.show")) {
-        this->SetKeySigShow(StrToBoolean(element.attribute("key.sig.show").value()));
-        element.remove_attribute("key.sig.show");
+    pugi::xml_attribute attr = element.attribute("key.sig.show");
+    if (attr) {
+        this->SetKeySigShow(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("key.sig.showchange")) {
-        this->SetKeySigShowchange(StrToBoolean(element.attribute("key.sig.showchange").value()));
-        element.remove_attribute("key.sig.showchange");
+    attr = element.attribute("key.sig.showchange");
+    if (attr) {
+        this->SetKeySigShowchange(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -2960,17 +3044,19 @@ void AttLabelsAddl::ResetLabelsAddl()
     m_isPart = BOOLEAN_NONE;
 }
 
-bool AttLabelsAddl::ReadLabelsAddl(pugi::xml_node element)
+bool AttLabelsAddl::ReadLabelsAddl(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("label.abbr")) {
-        this->SetLabelAbbr(StrToStr(element.attribute("label.abbr").value()));
-        element.remove_attribute("label.abbr");
+    pugi::xml_attribute attr = element.attribute("label.abbr");
+    if (attr) {
+        this->SetLabelAbbr(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("isPart")) {
-        this->SetIsPart(StrToBoolean(element.attribute("isPart").value()));
-        element.remove_attribute("isPart");
+    attr = element.attribute("isPart");
+    if (attr) {
+        this->SetIsPart(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3017,17 +3103,19 @@ void AttLang::ResetLang()
     m_translit = "";
 }
 
-bool AttLang::ReadLang(pugi::xml_node element)
+bool AttLang::ReadLang(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:lang")) {
-        this->SetLang(StrToStr(element.attribute("xml:lang").value()));
-        element.remove_attribute("xml:lang");
+    pugi::xml_attribute attr = element.attribute("xml:lang");
+    if (attr) {
+        this->SetLang(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xml:translit")) {
-        this->SetTranslit(StrToStr(element.attribute("xml:translit").value()));
-        element.remove_attribute("xml:translit");
+    attr = element.attribute("xml:translit");
+    if (attr) {
+        this->SetTranslit(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3077,12 +3165,13 @@ void AttLayerLog::ResetLayerLog()
     m_def = "";
 }
 
-bool AttLayerLog::ReadLayerLog(pugi::xml_node element)
+bool AttLayerLog::ReadLayerLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    pugi::xml_attribute attr = element.attribute("def");
+    if (attr) {
+        this->SetDef(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3123,12 +3212,13 @@ void AttLayerident::ResetLayerident()
     m_layer = 0;
 }
 
-bool AttLayerident::ReadLayerident(pugi::xml_node element)
+bool AttLayerident::ReadLayerident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("layer")) {
-        this->SetLayer(StrToInt(element.attribute("layer").value()));
-        element.remove_attribute("layer");
+    pugi::xml_attribute attr = element.attribute("layer");
+    if (attr) {
+        this->SetLayer(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3174,37 +3264,43 @@ void AttLineVis::ResetLineVis()
     m_startsymsize = "";
 }
 
-bool AttLineVis::ReadLineVis(pugi::xml_node element)
+bool AttLineVis::ReadLineVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToLineform(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToLineform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("width")) {
-        this->SetWidth(StrToStr(element.attribute("width").value()));
-        element.remove_attribute("width");
+    attr = element.attribute("width");
+    if (attr) {
+        this->SetWidth(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endsym")) {
-        this->SetEndsym(StrToLinestartendsymbol(element.attribute("endsym").value()));
-        element.remove_attribute("endsym");
+    attr = element.attribute("endsym");
+    if (attr) {
+        this->SetEndsym(StrToLinestartendsymbol(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endsymsize")) {
-        this->SetEndsymsize(StrToStr(element.attribute("endsymsize").value()));
-        element.remove_attribute("endsymsize");
+    attr = element.attribute("endsymsize");
+    if (attr) {
+        this->SetEndsymsize(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("startsym")) {
-        this->SetStartsym(StrToLinestartendsymbol(element.attribute("startsym").value()));
-        element.remove_attribute("startsym");
+    attr = element.attribute("startsym");
+    if (attr) {
+        this->SetStartsym(StrToLinestartendsymbol(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("startsymsize")) {
-        this->SetStartsymsize(StrToStr(element.attribute("startsymsize").value()));
-        element.remove_attribute("startsymsize");
+    attr = element.attribute("startsymsize");
+    if (attr) {
+        this->SetStartsymsize(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3290,12 +3386,13 @@ void AttLineloc::ResetLineloc()
     m_line = 0;
 }
 
-bool AttLineloc::ReadLineloc(pugi::xml_node element)
+bool AttLineloc::ReadLineloc(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("line")) {
-        this->SetLine(StrToInt(element.attribute("line").value()));
-        element.remove_attribute("line");
+    pugi::xml_attribute attr = element.attribute("line");
+    if (attr) {
+        this->SetLine(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3339,27 +3436,31 @@ void AttLinerend::ResetLinerend()
     m_lstartsymsize = "";
 }
 
-bool AttLinerend::ReadLinerend(pugi::xml_node element)
+bool AttLinerend::ReadLinerend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("lendsym")) {
-        this->SetLendsym(StrToLinestartendsymbol(element.attribute("lendsym").value()));
-        element.remove_attribute("lendsym");
+    pugi::xml_attribute attr = element.attribute("lendsym");
+    if (attr) {
+        this->SetLendsym(StrToLinestartendsymbol(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lendsymsize")) {
-        this->SetLendsymsize(StrToStr(element.attribute("lendsymsize").value()));
-        element.remove_attribute("lendsymsize");
+    attr = element.attribute("lendsymsize");
+    if (attr) {
+        this->SetLendsymsize(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsym")) {
-        this->SetLstartsym(StrToLinestartendsymbol(element.attribute("lstartsym").value()));
-        element.remove_attribute("lstartsym");
+    attr = element.attribute("lstartsym");
+    if (attr) {
+        this->SetLstartsym(StrToLinestartendsymbol(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lstartsymsize")) {
-        this->SetLstartsymsize(StrToStr(element.attribute("lstartsymsize").value()));
-        element.remove_attribute("lstartsymsize");
+    attr = element.attribute("lstartsymsize");
+    if (attr) {
+        this->SetLstartsymsize(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3428,17 +3529,19 @@ void AttLinerendBase::ResetLinerendBase()
     m_lwidth = "";
 }
 
-bool AttLinerendBase::ReadLinerendBase(pugi::xml_node element)
+bool AttLinerendBase::ReadLinerendBase(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("lform")) {
-        this->SetLform(StrToLineform(element.attribute("lform").value()));
-        element.remove_attribute("lform");
+    pugi::xml_attribute attr = element.attribute("lform");
+    if (attr) {
+        this->SetLform(StrToLineform(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lwidth")) {
-        this->SetLwidth(StrToStr(element.attribute("lwidth").value()));
-        element.remove_attribute("lwidth");
+    attr = element.attribute("lwidth");
+    if (attr) {
+        this->SetLwidth(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3493,37 +3596,43 @@ void AttLyricstyle::ResetLyricstyle()
     m_lyricWeight = FONTWEIGHT_NONE;
 }
 
-bool AttLyricstyle::ReadLyricstyle(pugi::xml_node element)
+bool AttLyricstyle::ReadLyricstyle(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("lyric.align")) {
-        this->SetLyricAlign(StrToStr(element.attribute("lyric.align").value()));
-        element.remove_attribute("lyric.align");
+    pugi::xml_attribute attr = element.attribute("lyric.align");
+    if (attr) {
+        this->SetLyricAlign(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.fam")) {
-        this->SetLyricFam(StrToStr(element.attribute("lyric.fam").value()));
-        element.remove_attribute("lyric.fam");
+    attr = element.attribute("lyric.fam");
+    if (attr) {
+        this->SetLyricFam(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.name")) {
-        this->SetLyricName(StrToStr(element.attribute("lyric.name").value()));
-        element.remove_attribute("lyric.name");
+    attr = element.attribute("lyric.name");
+    if (attr) {
+        this->SetLyricName(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.size")) {
-        this->SetLyricSize(StrToInt(element.attribute("lyric.size").value()));
-        element.remove_attribute("lyric.size");
+    attr = element.attribute("lyric.size");
+    if (attr) {
+        this->SetLyricSize(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.style")) {
-        this->SetLyricStyle(StrToFontstyle(element.attribute("lyric.style").value()));
-        element.remove_attribute("lyric.style");
+    attr = element.attribute("lyric.style");
+    if (attr) {
+        this->SetLyricStyle(StrToFontstyle(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lyric.weight")) {
-        this->SetLyricWeight(StrToFontweight(element.attribute("lyric.weight").value()));
-        element.remove_attribute("lyric.weight");
+    attr = element.attribute("lyric.weight");
+    if (attr) {
+        this->SetLyricWeight(StrToFontweight(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3610,17 +3719,19 @@ void AttMeasureLog::ResetMeasureLog()
     m_right = BARRENDITION_NONE;
 }
 
-bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element)
+bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("left")) {
-        this->SetLeft(StrToBarrendition(element.attribute("left").value()));
-        element.remove_attribute("left");
+    pugi::xml_attribute attr = element.attribute("left");
+    if (attr) {
+        this->SetLeft(StrToBarrendition(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("right")) {
-        this->SetRight(StrToBarrendition(element.attribute("right").value()));
-        element.remove_attribute("right");
+    attr = element.attribute("right");
+    if (attr) {
+        this->SetRight(StrToBarrendition(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3670,12 +3781,13 @@ void AttMeasurement::ResetMeasurement()
     m_unit = "";
 }
 
-bool AttMeasurement::ReadMeasurement(pugi::xml_node element)
+bool AttMeasurement::ReadMeasurement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToStr(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    pugi::xml_attribute attr = element.attribute("unit");
+    if (attr) {
+        this->SetUnit(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3716,12 +3828,13 @@ void AttMeasurenumbers::ResetMeasurenumbers()
     m_mnumVisible = BOOLEAN_NONE;
 }
 
-bool AttMeasurenumbers::ReadMeasurenumbers(pugi::xml_node element)
+bool AttMeasurenumbers::ReadMeasurenumbers(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("mnum.visible")) {
-        this->SetMnumVisible(StrToBoolean(element.attribute("mnum.visible").value()));
-        element.remove_attribute("mnum.visible");
+    pugi::xml_attribute attr = element.attribute("mnum.visible");
+    if (attr) {
+        this->SetMnumVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3764,22 +3877,25 @@ void AttMediabounds::ResetMediabounds()
     m_betype = BETYPE_NONE;
 }
 
-bool AttMediabounds::ReadMediabounds(pugi::xml_node element)
+bool AttMediabounds::ReadMediabounds(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("begin")) {
-        this->SetBegin(StrToStr(element.attribute("begin").value()));
-        element.remove_attribute("begin");
+    pugi::xml_attribute attr = element.attribute("begin");
+    if (attr) {
+        this->SetBegin(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("end")) {
-        this->SetEnd(StrToStr(element.attribute("end").value()));
-        element.remove_attribute("end");
+    attr = element.attribute("end");
+    if (attr) {
+        this->SetEnd(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("betype")) {
-        this->SetBetype(StrToBetype(element.attribute("betype").value()));
-        element.remove_attribute("betype");
+    attr = element.attribute("betype");
+    if (attr) {
+        this->SetBetype(StrToBetype(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3838,12 +3954,13 @@ void AttMedium::ResetMedium()
     m_medium = "";
 }
 
-bool AttMedium::ReadMedium(pugi::xml_node element)
+bool AttMedium::ReadMedium(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("medium")) {
-        this->SetMedium(StrToStr(element.attribute("medium").value()));
-        element.remove_attribute("medium");
+    pugi::xml_attribute attr = element.attribute("medium");
+    if (attr) {
+        this->SetMedium(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3884,12 +4001,13 @@ void AttMeiversion::ResetMeiversion()
     m_meiversion = meiversion_MEIVERSION_NONE;
 }
 
-bool AttMeiversion::ReadMeiversion(pugi::xml_node element)
+bool AttMeiversion::ReadMeiversion(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("meiversion")) {
-        this->SetMeiversion(StrToMeiversionMeiversion(element.attribute("meiversion").value()));
-        element.remove_attribute("meiversion");
+    pugi::xml_attribute attr = element.attribute("meiversion");
+    if (attr) {
+        this->SetMeiversion(StrToMeiversionMeiversion(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3931,17 +4049,19 @@ void AttMensurLog::ResetMensurLog()
     m_sign = MENSURATIONSIGN_NONE;
 }
 
-bool AttMensurLog::ReadMensurLog(pugi::xml_node element)
+bool AttMensurLog::ReadMensurLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dot")) {
-        this->SetDot(StrToBoolean(element.attribute("dot").value()));
-        element.remove_attribute("dot");
+    pugi::xml_attribute attr = element.attribute("dot");
+    if (attr) {
+        this->SetDot(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sign")) {
-        this->SetSign(StrToMensurationsign(element.attribute("sign").value()));
-        element.remove_attribute("sign");
+    attr = element.attribute("sign");
+    if (attr) {
+        this->SetSign(StrToMensurationsign(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -3993,22 +4113,25 @@ void AttMeterSigLog::ResetMeterSigLog()
     m_unit = 0;
 }
 
-bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element)
+bool AttMeterSigLog::ReadMeterSigLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToInt(element.attribute("count").value()));
-        element.remove_attribute("count");
+    pugi::xml_attribute attr = element.attribute("count");
+    if (attr) {
+        this->SetCount(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sym")) {
-        this->SetSym(StrToMetersign(element.attribute("sym").value()));
-        element.remove_attribute("sym");
+    attr = element.attribute("sym");
+    if (attr) {
+        this->SetSym(StrToMetersign(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("unit")) {
-        this->SetUnit(StrToInt(element.attribute("unit").value()));
-        element.remove_attribute("unit");
+    attr = element.attribute("unit");
+    if (attr) {
+        this->SetUnit(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4067,12 +4190,13 @@ void AttMeterSigVis::ResetMeterSigVis()
     m_form = meterSigVis_FORM_NONE;
 }
 
-bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element)
+bool AttMeterSigVis::ReadMeterSigVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMeterSigVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToMeterSigVisForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4114,17 +4238,19 @@ void AttMeterSigDefaultLog::ResetMeterSigDefaultLog()
     m_meterUnit = 0;
 }
 
-bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element)
+bool AttMeterSigDefaultLog::ReadMeterSigDefaultLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.count")) {
-        this->SetMeterCount(StrToInt(element.attribute("meter.count").value()));
-        element.remove_attribute("meter.count");
+    pugi::xml_attribute attr = element.attribute("meter.count");
+    if (attr) {
+        this->SetMeterCount(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("meter.unit")) {
-        this->SetMeterUnit(StrToInt(element.attribute("meter.unit").value()));
-        element.remove_attribute("meter.unit");
+    attr = element.attribute("meter.unit");
+    if (attr) {
+        this->SetMeterUnit(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4176,22 +4302,25 @@ void AttMeterSigDefaultVis::ResetMeterSigDefaultVis()
     m_meterSym = METERSIGN_NONE;
 }
 
-bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element)
+bool AttMeterSigDefaultVis::ReadMeterSigDefaultVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("meter.rend")) {
-        this->SetMeterRend(StrToMeterSigDefaultVisMeterrend(element.attribute("meter.rend").value()));
-        element.remove_attribute("meter.rend");
+    pugi::xml_attribute attr = element.attribute("meter.rend");
+    if (attr) {
+        this->SetMeterRend(StrToMeterSigDefaultVisMeterrend(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("meter.showchange")) {
-        this->SetMeterShowchange(StrToBoolean(element.attribute("meter.showchange").value()));
-        element.remove_attribute("meter.showchange");
+    attr = element.attribute("meter.showchange");
+    if (attr) {
+        this->SetMeterShowchange(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("meter.sym")) {
-        this->SetMeterSym(StrToMetersign(element.attribute("meter.sym").value()));
-        element.remove_attribute("meter.sym");
+    attr = element.attribute("meter.sym");
+    if (attr) {
+        this->SetMeterSym(StrToMetersign(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4250,12 +4379,13 @@ void AttMeterconformance::ResetMeterconformance()
     m_metcon = meterconformance_METCON_NONE;
 }
 
-bool AttMeterconformance::ReadMeterconformance(pugi::xml_node element)
+bool AttMeterconformance::ReadMeterconformance(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToMeterconformanceMetcon(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
+    pugi::xml_attribute attr = element.attribute("metcon");
+    if (attr) {
+        this->SetMetcon(StrToMeterconformanceMetcon(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4297,17 +4427,19 @@ void AttMeterconformanceBar::ResetMeterconformanceBar()
     m_control = BOOLEAN_NONE;
 }
 
-bool AttMeterconformanceBar::ReadMeterconformanceBar(pugi::xml_node element)
+bool AttMeterconformanceBar::ReadMeterconformanceBar(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("metcon")) {
-        this->SetMetcon(StrToBoolean(element.attribute("metcon").value()));
-        element.remove_attribute("metcon");
+    pugi::xml_attribute attr = element.attribute("metcon");
+    if (attr) {
+        this->SetMetcon(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("control")) {
-        this->SetControl(StrToBoolean(element.attribute("control").value()));
-        element.remove_attribute("control");
+    attr = element.attribute("control");
+    if (attr) {
+        this->SetControl(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4359,22 +4491,25 @@ void AttMmtempo::ResetMmtempo()
     m_mmDots = 0;
 }
 
-bool AttMmtempo::ReadMmtempo(pugi::xml_node element)
+bool AttMmtempo::ReadMmtempo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("mm")) {
-        this->SetMm(StrToStr(element.attribute("mm").value()));
-        element.remove_attribute("mm");
+    pugi::xml_attribute attr = element.attribute("mm");
+    if (attr) {
+        this->SetMm(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mm.unit")) {
-        this->SetMmUnit(StrToDuration(element.attribute("mm.unit").value()));
-        element.remove_attribute("mm.unit");
+    attr = element.attribute("mm.unit");
+    if (attr) {
+        this->SetMmUnit(StrToDuration(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("mm.dots")) {
-        this->SetMmDots(StrToInt(element.attribute("mm.dots").value()));
-        element.remove_attribute("mm.dots");
+    attr = element.attribute("mm.dots");
+    if (attr) {
+        this->SetMmDots(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4433,12 +4568,13 @@ void AttMultinummeasures::ResetMultinummeasures()
     m_multiNumber = BOOLEAN_NONE;
 }
 
-bool AttMultinummeasures::ReadMultinummeasures(pugi::xml_node element)
+bool AttMultinummeasures::ReadMultinummeasures(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("multi.number")) {
-        this->SetMultiNumber(StrToBoolean(element.attribute("multi.number").value()));
-        element.remove_attribute("multi.number");
+    pugi::xml_attribute attr = element.attribute("multi.number");
+    if (attr) {
+        this->SetMultiNumber(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4480,17 +4616,19 @@ void AttName::ResetName()
     m_role = "";
 }
 
-bool AttName::ReadName(pugi::xml_node element)
+bool AttName::ReadName(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("nymref")) {
-        this->SetNymref(StrToStr(element.attribute("nymref").value()));
-        element.remove_attribute("nymref");
+    pugi::xml_attribute attr = element.attribute("nymref");
+    if (attr) {
+        this->SetNymref(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("role")) {
-        this->SetRole(StrToStr(element.attribute("role").value()));
-        element.remove_attribute("role");
+    attr = element.attribute("role");
+    if (attr) {
+        this->SetRole(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4541,17 +4679,19 @@ void AttNotationstyle::ResetNotationstyle()
     m_musicSize = 0;
 }
 
-bool AttNotationstyle::ReadNotationstyle(pugi::xml_node element)
+bool AttNotationstyle::ReadNotationstyle(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("music.name")) {
-        this->SetMusicName(StrToStr(element.attribute("music.name").value()));
-        element.remove_attribute("music.name");
+    pugi::xml_attribute attr = element.attribute("music.name");
+    if (attr) {
+        this->SetMusicName(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("music.size")) {
-        this->SetMusicSize(StrToInt(element.attribute("music.size").value()));
-        element.remove_attribute("music.size");
+    attr = element.attribute("music.size");
+    if (attr) {
+        this->SetMusicSize(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4603,22 +4743,25 @@ void AttNoteGes::ResetNoteGes()
     m_pnum = 0;
 }
 
-bool AttNoteGes::ReadNoteGes(pugi::xml_node element)
+bool AttNoteGes::ReadNoteGes(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct.ges")) {
-        this->SetOctGes(StrToInt(element.attribute("oct.ges").value()));
-        element.remove_attribute("oct.ges");
+    pugi::xml_attribute attr = element.attribute("oct.ges");
+    if (attr) {
+        this->SetOctGes(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("pname.ges")) {
-        this->SetPnameGes(StrToPitchname(element.attribute("pname.ges").value()));
-        element.remove_attribute("pname.ges");
+    attr = element.attribute("pname.ges");
+    if (attr) {
+        this->SetPnameGes(StrToPitchname(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("pnum")) {
-        this->SetPnum(StrToInt(element.attribute("pnum").value()));
-        element.remove_attribute("pnum");
+    attr = element.attribute("pnum");
+    if (attr) {
+        this->SetPnum(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4683,42 +4826,49 @@ void AttNoteheads::ResetNoteheads()
     m_headVisible = BOOLEAN_NONE;
 }
 
-bool AttNoteheads::ReadNoteheads(pugi::xml_node element)
+bool AttNoteheads::ReadNoteheads(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("head.color")) {
-        this->SetHeadColor(StrToStr(element.attribute("head.color").value()));
-        element.remove_attribute("head.color");
+    pugi::xml_attribute attr = element.attribute("head.color");
+    if (attr) {
+        this->SetHeadColor(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.fill")) {
-        this->SetHeadFill(StrToFill(element.attribute("head.fill").value()));
-        element.remove_attribute("head.fill");
+    attr = element.attribute("head.fill");
+    if (attr) {
+        this->SetHeadFill(StrToFill(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.fillcolor")) {
-        this->SetHeadFillcolor(StrToStr(element.attribute("head.fillcolor").value()));
-        element.remove_attribute("head.fillcolor");
+    attr = element.attribute("head.fillcolor");
+    if (attr) {
+        this->SetHeadFillcolor(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.mod")) {
-        this->SetHeadMod(StrToStr(element.attribute("head.mod").value()));
-        element.remove_attribute("head.mod");
+    attr = element.attribute("head.mod");
+    if (attr) {
+        this->SetHeadMod(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.rotation")) {
-        this->SetHeadRotation(StrToStr(element.attribute("head.rotation").value()));
-        element.remove_attribute("head.rotation");
+    attr = element.attribute("head.rotation");
+    if (attr) {
+        this->SetHeadRotation(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.shape")) {
-        this->SetHeadShape(StrToHeadshapeList(element.attribute("head.shape").value()));
-        element.remove_attribute("head.shape");
+    attr = element.attribute("head.shape");
+    if (attr) {
+        this->SetHeadShape(StrToHeadshapeList(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("head.visible")) {
-        this->SetHeadVisible(StrToBoolean(element.attribute("head.visible").value()));
-        element.remove_attribute("head.visible");
+    attr = element.attribute("head.visible");
+    if (attr) {
+        this->SetHeadVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4813,12 +4963,13 @@ void AttOctave::ResetOctave()
     m_oct = 0;
 }
 
-bool AttOctave::ReadOctave(pugi::xml_node element)
+bool AttOctave::ReadOctave(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToInt(element.attribute("oct").value()));
-        element.remove_attribute("oct");
+    pugi::xml_attribute attr = element.attribute("oct");
+    if (attr) {
+        this->SetOct(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4859,12 +5010,13 @@ void AttOctavedefault::ResetOctavedefault()
     m_octaveDefault = 0;
 }
 
-bool AttOctavedefault::ReadOctavedefault(pugi::xml_node element)
+bool AttOctavedefault::ReadOctavedefault(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("octave.default")) {
-        this->SetOctaveDefault(StrToInt(element.attribute("octave.default").value()));
-        element.remove_attribute("octave.default");
+    pugi::xml_attribute attr = element.attribute("octave.default");
+    if (attr) {
+        this->SetOctaveDefault(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4906,17 +5058,19 @@ void AttOctavedisplacement::ResetOctavedisplacement()
     m_disPlace = PLACE_NONE;
 }
 
-bool AttOctavedisplacement::ReadOctavedisplacement(pugi::xml_node element)
+bool AttOctavedisplacement::ReadOctavedisplacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("dis")) {
-        this->SetDis(StrToOctaveDis(element.attribute("dis").value()));
-        element.remove_attribute("dis");
+    pugi::xml_attribute attr = element.attribute("dis");
+    if (attr) {
+        this->SetDis(StrToOctaveDis(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("dis.place")) {
-        this->SetDisPlace(StrToPlace(element.attribute("dis.place").value()));
-        element.remove_attribute("dis.place");
+    attr = element.attribute("dis.place");
+    if (attr) {
+        this->SetDisPlace(StrToPlace(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -4966,12 +5120,13 @@ void AttOnelinestaff::ResetOnelinestaff()
     m_ontheline = BOOLEAN_NONE;
 }
 
-bool AttOnelinestaff::ReadOnelinestaff(pugi::xml_node element)
+bool AttOnelinestaff::ReadOnelinestaff(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("ontheline")) {
-        this->SetOntheline(StrToBoolean(element.attribute("ontheline").value()));
-        element.remove_attribute("ontheline");
+    pugi::xml_attribute attr = element.attribute("ontheline");
+    if (attr) {
+        this->SetOntheline(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5012,12 +5167,13 @@ void AttOptimization::ResetOptimization()
     m_optimize = BOOLEAN_NONE;
 }
 
-bool AttOptimization::ReadOptimization(pugi::xml_node element)
+bool AttOptimization::ReadOptimization(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("optimize")) {
-        this->SetOptimize(StrToBoolean(element.attribute("optimize").value()));
-        element.remove_attribute("optimize");
+    pugi::xml_attribute attr = element.attribute("optimize");
+    if (attr) {
+        this->SetOptimize(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5058,12 +5214,13 @@ void AttOriginLayerident::ResetOriginLayerident()
     m_originLayer = "";
 }
 
-bool AttOriginLayerident::ReadOriginLayerident(pugi::xml_node element)
+bool AttOriginLayerident::ReadOriginLayerident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.layer")) {
-        this->SetOriginLayer(StrToStr(element.attribute("origin.layer").value()));
-        element.remove_attribute("origin.layer");
+    pugi::xml_attribute attr = element.attribute("origin.layer");
+    if (attr) {
+        this->SetOriginLayer(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5104,12 +5261,13 @@ void AttOriginStaffident::ResetOriginStaffident()
     m_originStaff = "";
 }
 
-bool AttOriginStaffident::ReadOriginStaffident(pugi::xml_node element)
+bool AttOriginStaffident::ReadOriginStaffident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.staff")) {
-        this->SetOriginStaff(StrToStr(element.attribute("origin.staff").value()));
-        element.remove_attribute("origin.staff");
+    pugi::xml_attribute attr = element.attribute("origin.staff");
+    if (attr) {
+        this->SetOriginStaff(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5151,17 +5309,19 @@ void AttOriginStartendid::ResetOriginStartendid()
     m_originEndid = "";
 }
 
-bool AttOriginStartendid::ReadOriginStartendid(pugi::xml_node element)
+bool AttOriginStartendid::ReadOriginStartendid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.startid")) {
-        this->SetOriginStartid(StrToStr(element.attribute("origin.startid").value()));
-        element.remove_attribute("origin.startid");
+    pugi::xml_attribute attr = element.attribute("origin.startid");
+    if (attr) {
+        this->SetOriginStartid(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("origin.endid")) {
-        this->SetOriginEndid(StrToStr(element.attribute("origin.endid").value()));
-        element.remove_attribute("origin.endid");
+    attr = element.attribute("origin.endid");
+    if (attr) {
+        this->SetOriginEndid(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5212,17 +5372,19 @@ void AttOriginTimestampMusical::ResetOriginTimestampMusical()
     m_originTstamp2 = std::make_pair(-1,-1.0);
 }
 
-bool AttOriginTimestampMusical::ReadOriginTimestampMusical(pugi::xml_node element)
+bool AttOriginTimestampMusical::ReadOriginTimestampMusical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("origin.tstamp")) {
-        this->SetOriginTstamp(StrToMeasurebeat(element.attribute("origin.tstamp").value()));
-        element.remove_attribute("origin.tstamp");
+    pugi::xml_attribute attr = element.attribute("origin.tstamp");
+    if (attr) {
+        this->SetOriginTstamp(StrToMeasurebeat(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("origin.tstamp2")) {
-        this->SetOriginTstamp2(StrToMeasurebeat(element.attribute("origin.tstamp2").value()));
-        element.remove_attribute("origin.tstamp2");
+    attr = element.attribute("origin.tstamp2");
+    if (attr) {
+        this->SetOriginTstamp2(StrToMeasurebeat(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5272,12 +5434,13 @@ void AttPadLog::ResetPadLog()
     m_num = 0;
 }
 
-bool AttPadLog::ReadPadLog(pugi::xml_node element)
+bool AttPadLog::ReadPadLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        element.remove_attribute("num");
+    pugi::xml_attribute attr = element.attribute("num");
+    if (attr) {
+        this->SetNum(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5325,47 +5488,55 @@ void AttPages::ResetPages()
     m_pageScale = "";
 }
 
-bool AttPages::ReadPages(pugi::xml_node element)
+bool AttPages::ReadPages(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("page.height")) {
-        this->SetPageHeight(StrToStr(element.attribute("page.height").value()));
-        element.remove_attribute("page.height");
+    pugi::xml_attribute attr = element.attribute("page.height");
+    if (attr) {
+        this->SetPageHeight(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.width")) {
-        this->SetPageWidth(StrToStr(element.attribute("page.width").value()));
-        element.remove_attribute("page.width");
+    attr = element.attribute("page.width");
+    if (attr) {
+        this->SetPageWidth(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.topmar")) {
-        this->SetPageTopmar(StrToStr(element.attribute("page.topmar").value()));
-        element.remove_attribute("page.topmar");
+    attr = element.attribute("page.topmar");
+    if (attr) {
+        this->SetPageTopmar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.botmar")) {
-        this->SetPageBotmar(StrToStr(element.attribute("page.botmar").value()));
-        element.remove_attribute("page.botmar");
+    attr = element.attribute("page.botmar");
+    if (attr) {
+        this->SetPageBotmar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.leftmar")) {
-        this->SetPageLeftmar(StrToStr(element.attribute("page.leftmar").value()));
-        element.remove_attribute("page.leftmar");
+    attr = element.attribute("page.leftmar");
+    if (attr) {
+        this->SetPageLeftmar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.rightmar")) {
-        this->SetPageRightmar(StrToStr(element.attribute("page.rightmar").value()));
-        element.remove_attribute("page.rightmar");
+    attr = element.attribute("page.rightmar");
+    if (attr) {
+        this->SetPageRightmar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.panels")) {
-        this->SetPagePanels(StrToStr(element.attribute("page.panels").value()));
-        element.remove_attribute("page.panels");
+    attr = element.attribute("page.panels");
+    if (attr) {
+        this->SetPagePanels(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("page.scale")) {
-        this->SetPageScale(StrToStr(element.attribute("page.scale").value()));
-        element.remove_attribute("page.scale");
+    attr = element.attribute("page.scale");
+    if (attr) {
+        this->SetPageScale(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5469,12 +5640,13 @@ void AttPbVis::ResetPbVis()
     m_folium = pbVis_FOLIUM_NONE;
 }
 
-bool AttPbVis::ReadPbVis(pugi::xml_node element)
+bool AttPbVis::ReadPbVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("folium")) {
-        this->SetFolium(StrToPbVisFolium(element.attribute("folium").value()));
-        element.remove_attribute("folium");
+    pugi::xml_attribute attr = element.attribute("folium");
+    if (attr) {
+        this->SetFolium(StrToPbVisFolium(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5515,12 +5687,13 @@ void AttPitch::ResetPitch()
     m_pname = PITCHNAME_NONE;
 }
 
-bool AttPitch::ReadPitch(pugi::xml_node element)
+bool AttPitch::ReadPitch(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("pname")) {
-        this->SetPname(StrToPitchname(element.attribute("pname").value()));
-        element.remove_attribute("pname");
+    pugi::xml_attribute attr = element.attribute("pname");
+    if (attr) {
+        this->SetPname(StrToPitchname(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5561,12 +5734,13 @@ void AttPlacement::ResetPlacement()
     m_place = STAFFREL_NONE;
 }
 
-bool AttPlacement::ReadPlacement(pugi::xml_node element)
+bool AttPlacement::ReadPlacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("place")) {
-        this->SetPlace(StrToStaffrel(element.attribute("place").value()));
-        element.remove_attribute("place");
+    pugi::xml_attribute attr = element.attribute("place");
+    if (attr) {
+        this->SetPlace(StrToStaffrel(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5607,12 +5781,13 @@ void AttPlist::ResetPlist()
     m_plist = "";
 }
 
-bool AttPlist::ReadPlist(pugi::xml_node element)
+bool AttPlist::ReadPlist(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("plist")) {
-        this->SetPlist(StrToStr(element.attribute("plist").value()));
-        element.remove_attribute("plist");
+    pugi::xml_attribute attr = element.attribute("plist");
+    if (attr) {
+        this->SetPlist(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5657,32 +5832,37 @@ void AttPointing::ResetPointing()
     m_targettype = "";
 }
 
-bool AttPointing::ReadPointing(pugi::xml_node element)
+bool AttPointing::ReadPointing(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("xlink:actuate")) {
-        this->SetActuate(StrToStr(element.attribute("xlink:actuate").value()));
-        element.remove_attribute("xlink:actuate");
+    pugi::xml_attribute attr = element.attribute("xlink:actuate");
+    if (attr) {
+        this->SetActuate(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:role")) {
-        this->SetRole(StrToStr(element.attribute("xlink:role").value()));
-        element.remove_attribute("xlink:role");
+    attr = element.attribute("xlink:role");
+    if (attr) {
+        this->SetRole(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:show")) {
-        this->SetShow(StrToStr(element.attribute("xlink:show").value()));
-        element.remove_attribute("xlink:show");
+    attr = element.attribute("xlink:show");
+    if (attr) {
+        this->SetShow(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:target")) {
-        this->SetTarget(StrToStr(element.attribute("xlink:target").value()));
-        element.remove_attribute("xlink:target");
+    attr = element.attribute("xlink:target");
+    if (attr) {
+        this->SetTarget(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("xlink:targettype")) {
-        this->SetTargettype(StrToStr(element.attribute("xlink:targettype").value()));
-        element.remove_attribute("xlink:targettype");
+    attr = element.attribute("xlink:targettype");
+    if (attr) {
+        this->SetTargettype(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5759,12 +5939,13 @@ void AttQuantity::ResetQuantity()
     m_quantity = 0.0;
 }
 
-bool AttQuantity::ReadQuantity(pugi::xml_node element)
+bool AttQuantity::ReadQuantity(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("quantity")) {
-        this->SetQuantity(StrToDbl(element.attribute("quantity").value()));
-        element.remove_attribute("quantity");
+    pugi::xml_attribute attr = element.attribute("quantity");
+    if (attr) {
+        this->SetQuantity(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5805,12 +5986,13 @@ void AttRelativesize::ResetRelativesize()
     m_size = SIZE_NONE;
 }
 
-bool AttRelativesize::ReadRelativesize(pugi::xml_node element)
+bool AttRelativesize::ReadRelativesize(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("size")) {
-        this->SetSize(StrToSize(element.attribute("size").value()));
-        element.remove_attribute("size");
+    pugi::xml_attribute attr = element.attribute("size");
+    if (attr) {
+        this->SetSize(StrToSize(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5851,12 +6033,13 @@ void AttResponsibility::ResetResponsibility()
     m_resp = "";
 }
 
-bool AttResponsibility::ReadResponsibility(pugi::xml_node element)
+bool AttResponsibility::ReadResponsibility(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("resp")) {
-        this->SetResp(StrToStr(element.attribute("resp").value()));
-        element.remove_attribute("resp");
+    pugi::xml_attribute attr = element.attribute("resp");
+    if (attr) {
+        this->SetResp(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5897,12 +6080,13 @@ void AttSbVis::ResetSbVis()
     m_form = sbVis_FORM_NONE;
 }
 
-bool AttSbVis::ReadSbVis(pugi::xml_node element)
+bool AttSbVis::ReadSbVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToSbVisForm(element.attribute("form").value()));
-        element.remove_attribute("form");
+    pugi::xml_attribute attr = element.attribute("form");
+    if (attr) {
+        this->SetForm(StrToSbVisForm(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5943,12 +6127,13 @@ void AttScalable::ResetScalable()
     m_scale = 0;
 }
 
-bool AttScalable::ReadScalable(pugi::xml_node element)
+bool AttScalable::ReadScalable(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("scale")) {
-        this->SetScale(StrToPercent(element.attribute("scale").value()));
-        element.remove_attribute("scale");
+    pugi::xml_attribute attr = element.attribute("scale");
+    if (attr) {
+        this->SetScale(StrToPercent(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -5991,22 +6176,25 @@ void AttScoreDefGes::ResetScoreDefGes()
     m_tuneTemper = TEMPERAMENT_NONE;
 }
 
-bool AttScoreDefGes::ReadScoreDefGes(pugi::xml_node element)
+bool AttScoreDefGes::ReadScoreDefGes(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tune.pname")) {
-        this->SetTunePname(StrToPitchname(element.attribute("tune.pname").value()));
-        element.remove_attribute("tune.pname");
+    pugi::xml_attribute attr = element.attribute("tune.pname");
+    if (attr) {
+        this->SetTunePname(StrToPitchname(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tune.Hz")) {
-        this->SetTuneHz(StrToDbl(element.attribute("tune.Hz").value()));
-        element.remove_attribute("tune.Hz");
+    attr = element.attribute("tune.Hz");
+    if (attr) {
+        this->SetTuneHz(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tune.temper")) {
-        this->SetTuneTemper(StrToTemperament(element.attribute("tune.temper").value()));
-        element.remove_attribute("tune.temper");
+    attr = element.attribute("tune.temper");
+    if (attr) {
+        this->SetTuneTemper(StrToTemperament(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6065,12 +6253,13 @@ void AttScoreDefVis::ResetScoreDefVis()
     m_vuHeight = "";
 }
 
-bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element)
+bool AttScoreDefVis::ReadScoreDefVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("vu.height")) {
-        this->SetVuHeight(StrToStr(element.attribute("vu.height").value()));
-        element.remove_attribute("vu.height");
+    pugi::xml_attribute attr = element.attribute("vu.height");
+    if (attr) {
+        this->SetVuHeight(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6111,12 +6300,13 @@ void AttSectionVis::ResetSectionVis()
     m_restart = BOOLEAN_NONE;
 }
 
-bool AttSectionVis::ReadSectionVis(pugi::xml_node element)
+bool AttSectionVis::ReadSectionVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("restart")) {
-        this->SetRestart(StrToBoolean(element.attribute("restart").value()));
-        element.remove_attribute("restart");
+    pugi::xml_attribute attr = element.attribute("restart");
+    if (attr) {
+        this->SetRestart(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6157,12 +6347,13 @@ void AttSequence::ResetSequence()
     m_seq = 0;
 }
 
-bool AttSequence::ReadSequence(pugi::xml_node element)
+bool AttSequence::ReadSequence(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("seq")) {
-        this->SetSeq(StrToInt(element.attribute("seq").value()));
-        element.remove_attribute("seq");
+    pugi::xml_attribute attr = element.attribute("seq");
+    if (attr) {
+        this->SetSeq(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6203,12 +6394,13 @@ void AttSlashcount::ResetSlashcount()
     m_slash = 0;
 }
 
-bool AttSlashcount::ReadSlashcount(pugi::xml_node element)
+bool AttSlashcount::ReadSlashcount(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToInt(element.attribute("slash").value()));
-        element.remove_attribute("slash");
+    pugi::xml_attribute attr = element.attribute("slash");
+    if (attr) {
+        this->SetSlash(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6249,12 +6441,13 @@ void AttSlurpresent::ResetSlurpresent()
     m_slur = "";
 }
 
-bool AttSlurpresent::ReadSlurpresent(pugi::xml_node element)
+bool AttSlurpresent::ReadSlurpresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur")) {
-        this->SetSlur(StrToStr(element.attribute("slur").value()));
-        element.remove_attribute("slur");
+    pugi::xml_attribute attr = element.attribute("slur");
+    if (attr) {
+        this->SetSlur(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6295,12 +6488,13 @@ void AttSpaceVis::ResetSpaceVis()
     m_compressable = BOOLEAN_NONE;
 }
 
-bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element)
+bool AttSpaceVis::ReadSpaceVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("compressable")) {
-        this->SetCompressable(StrToBoolean(element.attribute("compressable").value()));
-        element.remove_attribute("compressable");
+    pugi::xml_attribute attr = element.attribute("compressable");
+    if (attr) {
+        this->SetCompressable(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6344,27 +6538,31 @@ void AttSpacing::ResetSpacing()
     m_spacingSystem = "";
 }
 
-bool AttSpacing::ReadSpacing(pugi::xml_node element)
+bool AttSpacing::ReadSpacing(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("spacing.packexp")) {
-        this->SetSpacingPackexp(StrToDbl(element.attribute("spacing.packexp").value()));
-        element.remove_attribute("spacing.packexp");
+    pugi::xml_attribute attr = element.attribute("spacing.packexp");
+    if (attr) {
+        this->SetSpacingPackexp(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.packfact")) {
-        this->SetSpacingPackfact(StrToDbl(element.attribute("spacing.packfact").value()));
-        element.remove_attribute("spacing.packfact");
+    attr = element.attribute("spacing.packfact");
+    if (attr) {
+        this->SetSpacingPackfact(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.staff")) {
-        this->SetSpacingStaff(StrToStr(element.attribute("spacing.staff").value()));
-        element.remove_attribute("spacing.staff");
+    attr = element.attribute("spacing.staff");
+    if (attr) {
+        this->SetSpacingStaff(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing.system")) {
-        this->SetSpacingSystem(StrToStr(element.attribute("spacing.system").value()));
-        element.remove_attribute("spacing.system");
+    attr = element.attribute("spacing.system");
+    if (attr) {
+        this->SetSpacingSystem(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6432,12 +6630,13 @@ void AttStaffLog::ResetStaffLog()
     m_def = "";
 }
 
-bool AttStaffLog::ReadStaffLog(pugi::xml_node element)
+bool AttStaffLog::ReadStaffLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("def")) {
-        this->SetDef(StrToStr(element.attribute("def").value()));
-        element.remove_attribute("def");
+    pugi::xml_attribute attr = element.attribute("def");
+    if (attr) {
+        this->SetDef(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6483,37 +6682,43 @@ void AttStaffDefVis::ResetStaffDefVis()
     m_spacing = "";
 }
 
-bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element)
+bool AttStaffDefVis::ReadStaffDefVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("grid.show")) {
-        this->SetGridShow(StrToBoolean(element.attribute("grid.show").value()));
-        element.remove_attribute("grid.show");
+    pugi::xml_attribute attr = element.attribute("grid.show");
+    if (attr) {
+        this->SetGridShow(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("layerscheme")) {
-        this->SetLayerscheme(StrToLayerscheme(element.attribute("layerscheme").value()));
-        element.remove_attribute("layerscheme");
+    attr = element.attribute("layerscheme");
+    if (attr) {
+        this->SetLayerscheme(StrToLayerscheme(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lines")) {
-        this->SetLines(StrToInt(element.attribute("lines").value()));
-        element.remove_attribute("lines");
+    attr = element.attribute("lines");
+    if (attr) {
+        this->SetLines(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lines.color")) {
-        this->SetLinesColor(StrToStr(element.attribute("lines.color").value()));
-        element.remove_attribute("lines.color");
+    attr = element.attribute("lines.color");
+    if (attr) {
+        this->SetLinesColor(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("lines.visible")) {
-        this->SetLinesVisible(StrToBoolean(element.attribute("lines.visible").value()));
-        element.remove_attribute("lines.visible");
+    attr = element.attribute("lines.visible");
+    if (attr) {
+        this->SetLinesVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("spacing")) {
-        this->SetSpacing(StrToStr(element.attribute("spacing").value()));
-        element.remove_attribute("spacing");
+    attr = element.attribute("spacing");
+    if (attr) {
+        this->SetSpacing(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6599,12 +6804,13 @@ void AttStaffGrpVis::ResetStaffGrpVis()
     m_barthru = BOOLEAN_NONE;
 }
 
-bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element)
+bool AttStaffGrpVis::ReadStaffGrpVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("barthru")) {
-        this->SetBarthru(StrToBoolean(element.attribute("barthru").value()));
-        element.remove_attribute("barthru");
+    pugi::xml_attribute attr = element.attribute("barthru");
+    if (attr) {
+        this->SetBarthru(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6645,12 +6851,13 @@ void AttStaffgroupingsym::ResetStaffgroupingsym()
     m_symbol = staffgroupingsym_SYMBOL_NONE;
 }
 
-bool AttStaffgroupingsym::ReadStaffgroupingsym(pugi::xml_node element)
+bool AttStaffgroupingsym::ReadStaffgroupingsym(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("symbol")) {
-        this->SetSymbol(StrToStaffgroupingsymSymbol(element.attribute("symbol").value()));
-        element.remove_attribute("symbol");
+    pugi::xml_attribute attr = element.attribute("symbol");
+    if (attr) {
+        this->SetSymbol(StrToStaffgroupingsymSymbol(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6691,12 +6898,13 @@ void AttStaffident::ResetStaffident()
     m_staff = std::vector<int>();
 }
 
-bool AttStaffident::ReadStaffident(pugi::xml_node element)
+bool AttStaffident::ReadStaffident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("staff")) {
-        this->SetStaff(StrToXsdPositiveIntegerList(element.attribute("staff").value()));
-        element.remove_attribute("staff");
+    pugi::xml_attribute attr = element.attribute("staff");
+    if (attr) {
+        this->SetStaff(StrToXsdPositiveIntegerList(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6737,12 +6945,13 @@ void AttStaffloc::ResetStaffloc()
     m_loc = VRV_UNSET;
 }
 
-bool AttStaffloc::ReadStaffloc(pugi::xml_node element)
+bool AttStaffloc::ReadStaffloc(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("loc")) {
-        this->SetLoc(StrToInt(element.attribute("loc").value()));
-        element.remove_attribute("loc");
+    pugi::xml_attribute attr = element.attribute("loc");
+    if (attr) {
+        this->SetLoc(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6784,17 +6993,19 @@ void AttStafflocPitched::ResetStafflocPitched()
     m_oloc = 0;
 }
 
-bool AttStafflocPitched::ReadStafflocPitched(pugi::xml_node element)
+bool AttStafflocPitched::ReadStafflocPitched(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("ploc")) {
-        this->SetPloc(StrToPitchname(element.attribute("ploc").value()));
-        element.remove_attribute("ploc");
+    pugi::xml_attribute attr = element.attribute("ploc");
+    if (attr) {
+        this->SetPloc(StrToPitchname(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("oloc")) {
-        this->SetOloc(StrToInt(element.attribute("oloc").value()));
-        element.remove_attribute("oloc");
+    attr = element.attribute("oloc");
+    if (attr) {
+        this->SetOloc(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6844,12 +7055,13 @@ void AttStartendid::ResetStartendid()
     m_endid = "";
 }
 
-bool AttStartendid::ReadStartendid(pugi::xml_node element)
+bool AttStartendid::ReadStartendid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("endid")) {
-        this->SetEndid(StrToStr(element.attribute("endid").value()));
-        element.remove_attribute("endid");
+    pugi::xml_attribute attr = element.attribute("endid");
+    if (attr) {
+        this->SetEndid(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6890,12 +7102,13 @@ void AttStartid::ResetStartid()
     m_startid = "";
 }
 
-bool AttStartid::ReadStartid(pugi::xml_node element)
+bool AttStartid::ReadStartid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("startid")) {
-        this->SetStartid(StrToStr(element.attribute("startid").value()));
-        element.remove_attribute("startid");
+    pugi::xml_attribute attr = element.attribute("startid");
+    if (attr) {
+        this->SetStartid(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -6941,37 +7154,43 @@ void AttStems::ResetStems()
     m_stemY = 0.0;
 }
 
-bool AttStems::ReadStems(pugi::xml_node element)
+bool AttStems::ReadStems(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.dir")) {
-        this->SetStemDir(StrToStemdirection(element.attribute("stem.dir").value()));
-        element.remove_attribute("stem.dir");
+    pugi::xml_attribute attr = element.attribute("stem.dir");
+    if (attr) {
+        this->SetStemDir(StrToStemdirection(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.len")) {
-        this->SetStemLen(StrToInt(element.attribute("stem.len").value()));
-        element.remove_attribute("stem.len");
+    attr = element.attribute("stem.len");
+    if (attr) {
+        this->SetStemLen(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.mod")) {
-        this->SetStemMod(StrToStemmodifier(element.attribute("stem.mod").value()));
-        element.remove_attribute("stem.mod");
+    attr = element.attribute("stem.mod");
+    if (attr) {
+        this->SetStemMod(StrToStemmodifier(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.pos")) {
-        this->SetStemPos(StrToStemposition(element.attribute("stem.pos").value()));
-        element.remove_attribute("stem.pos");
+    attr = element.attribute("stem.pos");
+    if (attr) {
+        this->SetStemPos(StrToStemposition(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.x")) {
-        this->SetStemX(StrToDbl(element.attribute("stem.x").value()));
-        element.remove_attribute("stem.x");
+    attr = element.attribute("stem.x");
+    if (attr) {
+        this->SetStemX(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("stem.y")) {
-        this->SetStemY(StrToDbl(element.attribute("stem.y").value()));
-        element.remove_attribute("stem.y");
+    attr = element.attribute("stem.y");
+    if (attr) {
+        this->SetStemY(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7058,17 +7277,19 @@ void AttSylLog::ResetSylLog()
     m_wordpos = sylLog_WORDPOS_NONE;
 }
 
-bool AttSylLog::ReadSylLog(pugi::xml_node element)
+bool AttSylLog::ReadSylLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("con")) {
-        this->SetCon(StrToSylLogCon(element.attribute("con").value()));
-        element.remove_attribute("con");
+    pugi::xml_attribute attr = element.attribute("con");
+    if (attr) {
+        this->SetCon(StrToSylLogCon(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("wordpos")) {
-        this->SetWordpos(StrToSylLogWordpos(element.attribute("wordpos").value()));
-        element.remove_attribute("wordpos");
+    attr = element.attribute("wordpos");
+    if (attr) {
+        this->SetWordpos(StrToSylLogWordpos(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7118,12 +7339,13 @@ void AttSyltext::ResetSyltext()
     m_syl = "";
 }
 
-bool AttSyltext::ReadSyltext(pugi::xml_node element)
+bool AttSyltext::ReadSyltext(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("syl")) {
-        this->SetSyl(StrToStr(element.attribute("syl").value()));
-        element.remove_attribute("syl");
+    pugi::xml_attribute attr = element.attribute("syl");
+    if (attr) {
+        this->SetSyl(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7167,27 +7389,31 @@ void AttSystems::ResetSystems()
     m_systemTopmar = "";
 }
 
-bool AttSystems::ReadSystems(pugi::xml_node element)
+bool AttSystems::ReadSystems(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("system.leftline")) {
-        this->SetSystemLeftline(StrToBoolean(element.attribute("system.leftline").value()));
-        element.remove_attribute("system.leftline");
+    pugi::xml_attribute attr = element.attribute("system.leftline");
+    if (attr) {
+        this->SetSystemLeftline(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("system.leftmar")) {
-        this->SetSystemLeftmar(StrToStr(element.attribute("system.leftmar").value()));
-        element.remove_attribute("system.leftmar");
+    attr = element.attribute("system.leftmar");
+    if (attr) {
+        this->SetSystemLeftmar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("system.rightmar")) {
-        this->SetSystemRightmar(StrToStr(element.attribute("system.rightmar").value()));
-        element.remove_attribute("system.rightmar");
+    attr = element.attribute("system.rightmar");
+    if (attr) {
+        this->SetSystemRightmar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("system.topmar")) {
-        this->SetSystemTopmar(StrToStr(element.attribute("system.topmar").value()));
-        element.remove_attribute("system.topmar");
+    attr = element.attribute("system.topmar");
+    if (attr) {
+        this->SetSystemTopmar(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7255,12 +7481,13 @@ void AttTargeteval::ResetTargeteval()
     m_evaluate = targeteval_EVALUATE_NONE;
 }
 
-bool AttTargeteval::ReadTargeteval(pugi::xml_node element)
+bool AttTargeteval::ReadTargeteval(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("evaluate")) {
-        this->SetEvaluate(StrToTargetevalEvaluate(element.attribute("evaluate").value()));
-        element.remove_attribute("evaluate");
+    pugi::xml_attribute attr = element.attribute("evaluate");
+    if (attr) {
+        this->SetEvaluate(StrToTargetevalEvaluate(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7301,12 +7528,13 @@ void AttTempoLog::ResetTempoLog()
     m_func = tempoLog_FUNC_NONE;
 }
 
-bool AttTempoLog::ReadTempoLog(pugi::xml_node element)
+bool AttTempoLog::ReadTempoLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToTempoLogFunc(element.attribute("func").value()));
-        element.remove_attribute("func");
+    pugi::xml_attribute attr = element.attribute("func");
+    if (attr) {
+        this->SetFunc(StrToTempoLogFunc(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7351,32 +7579,37 @@ void AttTextstyle::ResetTextstyle()
     m_textWeight = FONTWEIGHT_NONE;
 }
 
-bool AttTextstyle::ReadTextstyle(pugi::xml_node element)
+bool AttTextstyle::ReadTextstyle(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("text.fam")) {
-        this->SetTextFam(StrToStr(element.attribute("text.fam").value()));
-        element.remove_attribute("text.fam");
+    pugi::xml_attribute attr = element.attribute("text.fam");
+    if (attr) {
+        this->SetTextFam(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.name")) {
-        this->SetTextName(StrToStr(element.attribute("text.name").value()));
-        element.remove_attribute("text.name");
+    attr = element.attribute("text.name");
+    if (attr) {
+        this->SetTextName(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.size")) {
-        this->SetTextSize(StrToInt(element.attribute("text.size").value()));
-        element.remove_attribute("text.size");
+    attr = element.attribute("text.size");
+    if (attr) {
+        this->SetTextSize(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.style")) {
-        this->SetTextStyle(StrToFontstyle(element.attribute("text.style").value()));
-        element.remove_attribute("text.style");
+    attr = element.attribute("text.style");
+    if (attr) {
+        this->SetTextStyle(StrToFontstyle(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("text.weight")) {
-        this->SetTextWeight(StrToFontweight(element.attribute("text.weight").value()));
-        element.remove_attribute("text.weight");
+    attr = element.attribute("text.weight");
+    if (attr) {
+        this->SetTextWeight(StrToFontweight(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7453,12 +7686,13 @@ void AttTiepresent::ResetTiepresent()
     m_tie = TIE_NONE;
 }
 
-bool AttTiepresent::ReadTiepresent(pugi::xml_node element)
+bool AttTiepresent::ReadTiepresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie")) {
-        this->SetTie(StrToTie(element.attribute("tie").value()));
-        element.remove_attribute("tie");
+    pugi::xml_attribute attr = element.attribute("tie");
+    if (attr) {
+        this->SetTie(StrToTie(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7499,12 +7733,13 @@ void AttTimestampMusical::ResetTimestampMusical()
     m_tstamp = -1.0;
 }
 
-bool AttTimestampMusical::ReadTimestampMusical(pugi::xml_node element)
+bool AttTimestampMusical::ReadTimestampMusical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp")) {
-        this->SetTstamp(StrToDbl(element.attribute("tstamp").value()));
-        element.remove_attribute("tstamp");
+    pugi::xml_attribute attr = element.attribute("tstamp");
+    if (attr) {
+        this->SetTstamp(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7546,17 +7781,19 @@ void AttTimestampPerformed::ResetTimestampPerformed()
     m_tstampReal = "";
 }
 
-bool AttTimestampPerformed::ReadTimestampPerformed(pugi::xml_node element)
+bool AttTimestampPerformed::ReadTimestampPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp.ges")) {
-        this->SetTstampGes(StrToDuration(element.attribute("tstamp.ges").value()));
-        element.remove_attribute("tstamp.ges");
+    pugi::xml_attribute attr = element.attribute("tstamp.ges");
+    if (attr) {
+        this->SetTstampGes(StrToDuration(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tstamp.real")) {
-        this->SetTstampReal(StrToStr(element.attribute("tstamp.real").value()));
-        element.remove_attribute("tstamp.real");
+    attr = element.attribute("tstamp.real");
+    if (attr) {
+        this->SetTstampReal(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7606,12 +7843,13 @@ void AttTimestamp2Musical::ResetTimestamp2Musical()
     m_tstamp2 = std::make_pair(-1,-1.0);
 }
 
-bool AttTimestamp2Musical::ReadTimestamp2Musical(pugi::xml_node element)
+bool AttTimestamp2Musical::ReadTimestamp2Musical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tstamp2")) {
-        this->SetTstamp2(StrToMeasurebeat(element.attribute("tstamp2").value()));
-        element.remove_attribute("tstamp2");
+    pugi::xml_attribute attr = element.attribute("tstamp2");
+    if (attr) {
+        this->SetTstamp2(StrToMeasurebeat(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7655,27 +7893,31 @@ void AttTransposition::ResetTransposition()
     m_enharmonicInt = 0.0;
 }
 
-bool AttTransposition::ReadTransposition(pugi::xml_node element)
+bool AttTransposition::ReadTransposition(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("trans.diat")) {
-        this->SetTransDiat(StrToDbl(element.attribute("trans.diat").value()));
-        element.remove_attribute("trans.diat");
+    pugi::xml_attribute attr = element.attribute("trans.diat");
+    if (attr) {
+        this->SetTransDiat(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("trans.semi")) {
-        this->SetTransSemi(StrToDbl(element.attribute("trans.semi").value()));
-        element.remove_attribute("trans.semi");
+    attr = element.attribute("trans.semi");
+    if (attr) {
+        this->SetTransSemi(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("trans.oct")) {
-        this->SetTransOct(StrToDbl(element.attribute("trans.oct").value()));
-        element.remove_attribute("trans.oct");
+    attr = element.attribute("trans.oct");
+    if (attr) {
+        this->SetTransOct(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("trans.enhInt")) {
-        this->SetEnharmonicInt(StrToDbl(element.attribute("trans.enhInt").value()));
-        element.remove_attribute("trans.enhInt");
+    attr = element.attribute("trans.enhInt");
+    if (attr) {
+        this->SetEnharmonicInt(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7743,12 +7985,13 @@ void AttTupletpresent::ResetTupletpresent()
     m_tuplet = "";
 }
 
-bool AttTupletpresent::ReadTupletpresent(pugi::xml_node element)
+bool AttTupletpresent::ReadTupletpresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tuplet")) {
-        this->SetTuplet(StrToStr(element.attribute("tuplet").value()));
-        element.remove_attribute("tuplet");
+    pugi::xml_attribute attr = element.attribute("tuplet");
+    if (attr) {
+        this->SetTuplet(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7790,17 +8033,19 @@ void AttTyped::ResetTyped()
     m_subtype = "";
 }
 
-bool AttTyped::ReadTyped(pugi::xml_node element)
+bool AttTyped::ReadTyped(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        element.remove_attribute("type");
+    pugi::xml_attribute attr = element.attribute("type");
+    if (attr) {
+        this->SetType(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("subtype")) {
-        this->SetSubtype(StrToStr(element.attribute("subtype").value()));
-        element.remove_attribute("subtype");
+    attr = element.attribute("subtype");
+    if (attr) {
+        this->SetSubtype(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7854,32 +8099,37 @@ void AttTypography::ResetTypography()
     m_fontweight = FONTWEIGHT_NONE;
 }
 
-bool AttTypography::ReadTypography(pugi::xml_node element)
+bool AttTypography::ReadTypography(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("fontfam")) {
-        this->SetFontfam(StrToStr(element.attribute("fontfam").value()));
-        element.remove_attribute("fontfam");
+    pugi::xml_attribute attr = element.attribute("fontfam");
+    if (attr) {
+        this->SetFontfam(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontname")) {
-        this->SetFontname(StrToStr(element.attribute("fontname").value()));
-        element.remove_attribute("fontname");
+    attr = element.attribute("fontname");
+    if (attr) {
+        this->SetFontname(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontsize")) {
-        this->SetFontsize(StrToInt(element.attribute("fontsize").value()));
-        element.remove_attribute("fontsize");
+    attr = element.attribute("fontsize");
+    if (attr) {
+        this->SetFontsize(StrToInt(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontstyle")) {
-        this->SetFontstyle(StrToFontstyle(element.attribute("fontstyle").value()));
-        element.remove_attribute("fontstyle");
+    attr = element.attribute("fontstyle");
+    if (attr) {
+        this->SetFontstyle(StrToFontstyle(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("fontweight")) {
-        this->SetFontweight(StrToFontweight(element.attribute("fontweight").value()));
-        element.remove_attribute("fontweight");
+    attr = element.attribute("fontweight");
+    if (attr) {
+        this->SetFontweight(StrToFontweight(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -7956,12 +8206,13 @@ void AttVisibility::ResetVisibility()
     m_visible = BOOLEAN_NONE;
 }
 
-bool AttVisibility::ReadVisibility(pugi::xml_node element)
+bool AttVisibility::ReadVisibility(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("visible")) {
-        this->SetVisible(StrToBoolean(element.attribute("visible").value()));
-        element.remove_attribute("visible");
+    pugi::xml_attribute attr = element.attribute("visible");
+    if (attr) {
+        this->SetVisible(StrToBoolean(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8002,12 +8253,13 @@ void AttVisualoffsetHo::ResetVisualoffsetHo()
     m_ho = "";
 }
 
-bool AttVisualoffsetHo::ReadVisualoffsetHo(pugi::xml_node element)
+bool AttVisualoffsetHo::ReadVisualoffsetHo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("ho")) {
-        this->SetHo(StrToStr(element.attribute("ho").value()));
-        element.remove_attribute("ho");
+    pugi::xml_attribute attr = element.attribute("ho");
+    if (attr) {
+        this->SetHo(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8048,12 +8300,13 @@ void AttVisualoffsetTo::ResetVisualoffsetTo()
     m_to = 0.0;
 }
 
-bool AttVisualoffsetTo::ReadVisualoffsetTo(pugi::xml_node element)
+bool AttVisualoffsetTo::ReadVisualoffsetTo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("to")) {
-        this->SetTo(StrToDbl(element.attribute("to").value()));
-        element.remove_attribute("to");
+    pugi::xml_attribute attr = element.attribute("to");
+    if (attr) {
+        this->SetTo(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8094,12 +8347,13 @@ void AttVisualoffsetVo::ResetVisualoffsetVo()
     m_vo = "";
 }
 
-bool AttVisualoffsetVo::ReadVisualoffsetVo(pugi::xml_node element)
+bool AttVisualoffsetVo::ReadVisualoffsetVo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("vo")) {
-        this->SetVo(StrToStr(element.attribute("vo").value()));
-        element.remove_attribute("vo");
+    pugi::xml_attribute attr = element.attribute("vo");
+    if (attr) {
+        this->SetVo(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8141,17 +8395,19 @@ void AttVisualoffset2Ho::ResetVisualoffset2Ho()
     m_endho = "";
 }
 
-bool AttVisualoffset2Ho::ReadVisualoffset2Ho(pugi::xml_node element)
+bool AttVisualoffset2Ho::ReadVisualoffset2Ho(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("startho")) {
-        this->SetStartho(StrToStr(element.attribute("startho").value()));
-        element.remove_attribute("startho");
+    pugi::xml_attribute attr = element.attribute("startho");
+    if (attr) {
+        this->SetStartho(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endho")) {
-        this->SetEndho(StrToStr(element.attribute("endho").value()));
-        element.remove_attribute("endho");
+    attr = element.attribute("endho");
+    if (attr) {
+        this->SetEndho(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8202,17 +8458,19 @@ void AttVisualoffset2To::ResetVisualoffset2To()
     m_endto = 0.0;
 }
 
-bool AttVisualoffset2To::ReadVisualoffset2To(pugi::xml_node element)
+bool AttVisualoffset2To::ReadVisualoffset2To(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("startto")) {
-        this->SetStartto(StrToDbl(element.attribute("startto").value()));
-        element.remove_attribute("startto");
+    pugi::xml_attribute attr = element.attribute("startto");
+    if (attr) {
+        this->SetStartto(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endto")) {
-        this->SetEndto(StrToDbl(element.attribute("endto").value()));
-        element.remove_attribute("endto");
+    attr = element.attribute("endto");
+    if (attr) {
+        this->SetEndto(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8263,17 +8521,19 @@ void AttVisualoffset2Vo::ResetVisualoffset2Vo()
     m_endvo = "";
 }
 
-bool AttVisualoffset2Vo::ReadVisualoffset2Vo(pugi::xml_node element)
+bool AttVisualoffset2Vo::ReadVisualoffset2Vo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("startvo")) {
-        this->SetStartvo(StrToStr(element.attribute("startvo").value()));
-        element.remove_attribute("startvo");
+    pugi::xml_attribute attr = element.attribute("startvo");
+    if (attr) {
+        this->SetStartvo(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("endvo")) {
-        this->SetEndvo(StrToStr(element.attribute("endvo").value()));
-        element.remove_attribute("endvo");
+    attr = element.attribute("endvo");
+    if (attr) {
+        this->SetEndvo(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8323,12 +8583,13 @@ void AttWhitespace::ResetWhitespace()
     m_space = "";
 }
 
-bool AttWhitespace::ReadWhitespace(pugi::xml_node element)
+bool AttWhitespace::ReadWhitespace(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("xml:space")) {
-        this->SetSpace(StrToStr(element.attribute("xml:space").value()));
-        element.remove_attribute("xml:space");
+    pugi::xml_attribute attr = element.attribute("xml:space");
+    if (attr) {
+        this->SetSpace(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8369,12 +8630,13 @@ void AttWidth::ResetWidth()
     m_width = "";
 }
 
-bool AttWidth::ReadWidth(pugi::xml_node element)
+bool AttWidth::ReadWidth(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("width")) {
-        this->SetWidth(StrToStr(element.attribute("width").value()));
-        element.remove_attribute("width");
+    pugi::xml_attribute attr = element.attribute("width");
+    if (attr) {
+        this->SetWidth(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8416,17 +8678,19 @@ void AttXy::ResetXy()
     m_y = 0.0;
 }
 
-bool AttXy::ReadXy(pugi::xml_node element)
+bool AttXy::ReadXy(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("x")) {
-        this->SetX(StrToDbl(element.attribute("x").value()));
-        element.remove_attribute("x");
+    pugi::xml_attribute attr = element.attribute("x");
+    if (attr) {
+        this->SetX(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("y")) {
-        this->SetY(StrToDbl(element.attribute("y").value()));
-        element.remove_attribute("y");
+    attr = element.attribute("y");
+    if (attr) {
+        this->SetY(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -8477,17 +8741,19 @@ void AttXy2::ResetXy2()
     m_y2 = 0.0;
 }
 
-bool AttXy2::ReadXy2(pugi::xml_node element)
+bool AttXy2::ReadXy2(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("x2")) {
-        this->SetX2(StrToDbl(element.attribute("x2").value()));
-        element.remove_attribute("x2");
+    pugi::xml_attribute attr = element.attribute("x2");
+    if (attr) {
+        this->SetX2(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("y2")) {
-        this->SetY2(StrToDbl(element.attribute("y2").value()));
-        element.remove_attribute("y2");
+    attr = element.attribute("y2");
+    if (attr) {
+        this->SetY2(StrToDbl(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetAccidLog();
 
     /** Read the values for the attribute class **/
-    bool ReadAccidLog(pugi::xml_node element);
+    bool ReadAccidLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteAccidLog(pugi::xml_node element);
@@ -74,7 +74,7 @@ public:
     void ResetAccidental();
 
     /** Read the values for the attribute class **/
-    bool ReadAccidental(pugi::xml_node element);
+    bool ReadAccidental(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteAccidental(pugi::xml_node element);
@@ -110,7 +110,7 @@ public:
     void ResetAccidentalPerformed();
 
     /** Read the values for the attribute class **/
-    bool ReadAccidentalPerformed(pugi::xml_node element);
+    bool ReadAccidentalPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteAccidentalPerformed(pugi::xml_node element);
@@ -146,7 +146,7 @@ public:
     void ResetArticulation();
 
     /** Read the values for the attribute class **/
-    bool ReadArticulation(pugi::xml_node element);
+    bool ReadArticulation(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteArticulation(pugi::xml_node element);
@@ -188,7 +188,7 @@ public:
     void ResetArticulationPerformed();
 
     /** Read the values for the attribute class **/
-    bool ReadArticulationPerformed(pugi::xml_node element);
+    bool ReadArticulationPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteArticulationPerformed(pugi::xml_node element);
@@ -224,7 +224,7 @@ public:
     void ResetAugmentdots();
 
     /** Read the values for the attribute class **/
-    bool ReadAugmentdots(pugi::xml_node element);
+    bool ReadAugmentdots(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteAugmentdots(pugi::xml_node element);
@@ -260,7 +260,7 @@ public:
     void ResetAuthorized();
 
     /** Read the values for the attribute class **/
-    bool ReadAuthorized(pugi::xml_node element);
+    bool ReadAuthorized(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteAuthorized(pugi::xml_node element);
@@ -308,7 +308,7 @@ public:
     void ResetBarLineLog();
 
     /** Read the values for the attribute class **/
-    bool ReadBarLineLog(pugi::xml_node element);
+    bool ReadBarLineLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBarLineLog(pugi::xml_node element);
@@ -344,7 +344,7 @@ public:
     void ResetBarplacement();
 
     /** Read the values for the attribute class **/
-    bool ReadBarplacement(pugi::xml_node element);
+    bool ReadBarplacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBarplacement(pugi::xml_node element);
@@ -395,7 +395,7 @@ public:
     void ResetBeamingVis();
 
     /** Read the values for the attribute class **/
-    bool ReadBeamingVis(pugi::xml_node element);
+    bool ReadBeamingVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBeamingVis(pugi::xml_node element);
@@ -443,7 +443,7 @@ public:
     void ResetBibl();
 
     /** Read the values for the attribute class **/
-    bool ReadBibl(pugi::xml_node element);
+    bool ReadBibl(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteBibl(pugi::xml_node element);
@@ -482,7 +482,7 @@ public:
     void ResetCalendared();
 
     /** Read the values for the attribute class **/
-    bool ReadCalendared(pugi::xml_node element);
+    bool ReadCalendared(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCalendared(pugi::xml_node element);
@@ -521,7 +521,7 @@ public:
     void ResetCanonical();
 
     /** Read the values for the attribute class **/
-    bool ReadCanonical(pugi::xml_node element);
+    bool ReadCanonical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCanonical(pugi::xml_node element);
@@ -561,7 +561,7 @@ public:
     void ResetChordVis();
 
     /** Read the values for the attribute class **/
-    bool ReadChordVis(pugi::xml_node element);
+    bool ReadChordVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteChordVis(pugi::xml_node element);
@@ -602,7 +602,7 @@ public:
     void ResetClasscodeident();
 
     /** Read the values for the attribute class **/
-    bool ReadClasscodeident(pugi::xml_node element);
+    bool ReadClasscodeident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteClasscodeident(pugi::xml_node element);
@@ -642,7 +642,7 @@ public:
     void ResetClefLog();
 
     /** Read the values for the attribute class **/
-    bool ReadClefLog(pugi::xml_node element);
+    bool ReadClefLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteClefLog(pugi::xml_node element);
@@ -681,7 +681,7 @@ public:
     void ResetCleffingLog();
 
     /** Read the values for the attribute class **/
-    bool ReadCleffingLog(pugi::xml_node element);
+    bool ReadCleffingLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCleffingLog(pugi::xml_node element);
@@ -739,7 +739,7 @@ public:
     void ResetCleffingVis();
 
     /** Read the values for the attribute class **/
-    bool ReadCleffingVis(pugi::xml_node element);
+    bool ReadCleffingVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCleffingVis(pugi::xml_node element);
@@ -781,7 +781,7 @@ public:
     void ResetClefshape();
 
     /** Read the values for the attribute class **/
-    bool ReadClefshape(pugi::xml_node element);
+    bool ReadClefshape(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteClefshape(pugi::xml_node element);
@@ -817,7 +817,7 @@ public:
     void ResetColor();
 
     /** Read the values for the attribute class **/
-    bool ReadColor(pugi::xml_node element);
+    bool ReadColor(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteColor(pugi::xml_node element);
@@ -856,7 +856,7 @@ public:
     void ResetColoration();
 
     /** Read the values for the attribute class **/
-    bool ReadColoration(pugi::xml_node element);
+    bool ReadColoration(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteColoration(pugi::xml_node element);
@@ -899,7 +899,7 @@ public:
     void ResetCommon();
 
     /** Read the values for the attribute class **/
-    bool ReadCommon(pugi::xml_node element);
+    bool ReadCommon(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCommon(pugi::xml_node element);
@@ -935,7 +935,7 @@ public:
     void ResetCommonPart();
 
     /** Read the values for the attribute class **/
-    bool ReadCommonPart(pugi::xml_node element);
+    bool ReadCommonPart(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCommonPart(pugi::xml_node element);
@@ -980,7 +980,7 @@ public:
     void ResetCoordinated();
 
     /** Read the values for the attribute class **/
-    bool ReadCoordinated(pugi::xml_node element);
+    bool ReadCoordinated(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCoordinated(pugi::xml_node element);
@@ -1034,7 +1034,7 @@ public:
     void ResetCurvature();
 
     /** Read the values for the attribute class **/
-    bool ReadCurvature(pugi::xml_node element);
+    bool ReadCurvature(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCurvature(pugi::xml_node element);
@@ -1093,7 +1093,7 @@ public:
     void ResetCurverend();
 
     /** Read the values for the attribute class **/
-    bool ReadCurverend(pugi::xml_node element);
+    bool ReadCurverend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCurverend(pugi::xml_node element);
@@ -1135,7 +1135,7 @@ public:
     void ResetCustosLog();
 
     /** Read the values for the attribute class **/
-    bool ReadCustosLog(pugi::xml_node element);
+    bool ReadCustosLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteCustosLog(pugi::xml_node element);
@@ -1174,7 +1174,7 @@ public:
     void ResetDatable();
 
     /** Read the values for the attribute class **/
-    bool ReadDatable(pugi::xml_node element);
+    bool ReadDatable(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDatable(pugi::xml_node element);
@@ -1234,7 +1234,7 @@ public:
     void ResetDatapointing();
 
     /** Read the values for the attribute class **/
-    bool ReadDatapointing(pugi::xml_node element);
+    bool ReadDatapointing(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDatapointing(pugi::xml_node element);
@@ -1270,7 +1270,7 @@ public:
     void ResetDeclaring();
 
     /** Read the values for the attribute class **/
-    bool ReadDeclaring(pugi::xml_node element);
+    bool ReadDeclaring(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDeclaring(pugi::xml_node element);
@@ -1309,7 +1309,7 @@ public:
     void ResetDistances();
 
     /** Read the values for the attribute class **/
-    bool ReadDistances(pugi::xml_node element);
+    bool ReadDistances(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDistances(pugi::xml_node element);
@@ -1360,7 +1360,7 @@ public:
     void ResetDotLog();
 
     /** Read the values for the attribute class **/
-    bool ReadDotLog(pugi::xml_node element);
+    bool ReadDotLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDotLog(pugi::xml_node element);
@@ -1396,7 +1396,7 @@ public:
     void ResetDurationAdditive();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationAdditive(pugi::xml_node element);
+    bool ReadDurationAdditive(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDurationAdditive(pugi::xml_node element);
@@ -1438,7 +1438,7 @@ public:
     void ResetDurationDefault();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationDefault(pugi::xml_node element);
+    bool ReadDurationDefault(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDurationDefault(pugi::xml_node element);
@@ -1496,7 +1496,7 @@ public:
     void ResetDurationMusical();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationMusical(pugi::xml_node element);
+    bool ReadDurationMusical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDurationMusical(pugi::xml_node element);
@@ -1538,7 +1538,7 @@ public:
     void ResetDurationPerformed();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationPerformed(pugi::xml_node element);
+    bool ReadDurationPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDurationPerformed(pugi::xml_node element);
@@ -1587,7 +1587,7 @@ public:
     void ResetDurationRatio();
 
     /** Read the values for the attribute class **/
-    bool ReadDurationRatio(pugi::xml_node element);
+    bool ReadDurationRatio(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteDurationRatio(pugi::xml_node element);
@@ -1635,7 +1635,7 @@ public:
     void ResetEnclosingchars();
 
     /** Read the values for the attribute class **/
-    bool ReadEnclosingchars(pugi::xml_node element);
+    bool ReadEnclosingchars(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteEnclosingchars(pugi::xml_node element);
@@ -1676,7 +1676,7 @@ public:
     void ResetEndings();
 
     /** Read the values for the attribute class **/
-    bool ReadEndings(pugi::xml_node element);
+    bool ReadEndings(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteEndings(pugi::xml_node element);
@@ -1712,7 +1712,7 @@ public:
     void ResetExtender();
 
     /** Read the values for the attribute class **/
-    bool ReadExtender(pugi::xml_node element);
+    bool ReadExtender(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteExtender(pugi::xml_node element);
@@ -1748,7 +1748,7 @@ public:
     void ResetFermatapresent();
 
     /** Read the values for the attribute class **/
-    bool ReadFermatapresent(pugi::xml_node element);
+    bool ReadFermatapresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteFermatapresent(pugi::xml_node element);
@@ -1788,7 +1788,7 @@ public:
     void ResetFiling();
 
     /** Read the values for the attribute class **/
-    bool ReadFiling(pugi::xml_node element);
+    bool ReadFiling(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteFiling(pugi::xml_node element);
@@ -1827,7 +1827,7 @@ public:
     void ResetGrpSymLog();
 
     /** Read the values for the attribute class **/
-    bool ReadGrpSymLog(pugi::xml_node element);
+    bool ReadGrpSymLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteGrpSymLog(pugi::xml_node element);
@@ -1863,7 +1863,7 @@ public:
     void ResetHandident();
 
     /** Read the values for the attribute class **/
-    bool ReadHandident(pugi::xml_node element);
+    bool ReadHandident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHandident(pugi::xml_node element);
@@ -1902,7 +1902,7 @@ public:
     void ResetHeight();
 
     /** Read the values for the attribute class **/
-    bool ReadHeight(pugi::xml_node element);
+    bool ReadHeight(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHeight(pugi::xml_node element);
@@ -1938,7 +1938,7 @@ public:
     void ResetHorizontalalign();
 
     /** Read the values for the attribute class **/
-    bool ReadHorizontalalign(pugi::xml_node element);
+    bool ReadHorizontalalign(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteHorizontalalign(pugi::xml_node element);
@@ -1974,7 +1974,7 @@ public:
     void ResetInstrumentident();
 
     /** Read the values for the attribute class **/
-    bool ReadInstrumentident(pugi::xml_node element);
+    bool ReadInstrumentident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteInstrumentident(pugi::xml_node element);
@@ -2013,7 +2013,7 @@ public:
     void ResetInternetmedia();
 
     /** Read the values for the attribute class **/
-    bool ReadInternetmedia(pugi::xml_node element);
+    bool ReadInternetmedia(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteInternetmedia(pugi::xml_node element);
@@ -2053,7 +2053,7 @@ public:
     void ResetJoined();
 
     /** Read the values for the attribute class **/
-    bool ReadJoined(pugi::xml_node element);
+    bool ReadJoined(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteJoined(pugi::xml_node element);
@@ -2096,7 +2096,7 @@ public:
     void ResetKeySigLog();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigLog(pugi::xml_node element);
+    bool ReadKeySigLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigLog(pugi::xml_node element);
@@ -2154,7 +2154,7 @@ public:
     void ResetKeySigVis();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigVis(pugi::xml_node element);
+    bool ReadKeySigVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigVis(pugi::xml_node element);
@@ -2190,7 +2190,7 @@ public:
     void ResetKeySigDefaultLog();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigDefaultLog(pugi::xml_node element);
+    bool ReadKeySigDefaultLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultLog(pugi::xml_node element);
@@ -2266,7 +2266,7 @@ public:
     void ResetKeySigDefaultVis();
 
     /** Read the values for the attribute class **/
-    bool ReadKeySigDefaultVis(pugi::xml_node element);
+    bool ReadKeySigDefaultVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteKeySigDefaultVis(pugi::xml_node element);
@@ -2308,7 +2308,7 @@ public:
     void ResetLabelsAddl();
 
     /** Read the values for the attribute class **/
-    bool ReadLabelsAddl(pugi::xml_node element);
+    bool ReadLabelsAddl(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLabelsAddl(pugi::xml_node element);
@@ -2351,7 +2351,7 @@ public:
     void ResetLang();
 
     /** Read the values for the attribute class **/
-    bool ReadLang(pugi::xml_node element);
+    bool ReadLang(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLang(pugi::xml_node element);
@@ -2393,7 +2393,7 @@ public:
     void ResetLayerLog();
 
     /** Read the values for the attribute class **/
-    bool ReadLayerLog(pugi::xml_node element);
+    bool ReadLayerLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLayerLog(pugi::xml_node element);
@@ -2429,7 +2429,7 @@ public:
     void ResetLayerident();
 
     /** Read the values for the attribute class **/
-    bool ReadLayerident(pugi::xml_node element);
+    bool ReadLayerident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLayerident(pugi::xml_node element);
@@ -2465,7 +2465,7 @@ public:
     void ResetLineVis();
 
     /** Read the values for the attribute class **/
-    bool ReadLineVis(pugi::xml_node element);
+    bool ReadLineVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLineVis(pugi::xml_node element);
@@ -2531,7 +2531,7 @@ public:
     void ResetLineloc();
 
     /** Read the values for the attribute class **/
-    bool ReadLineloc(pugi::xml_node element);
+    bool ReadLineloc(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLineloc(pugi::xml_node element);
@@ -2571,7 +2571,7 @@ public:
     void ResetLinerend();
 
     /** Read the values for the attribute class **/
-    bool ReadLinerend(pugi::xml_node element);
+    bool ReadLinerend(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLinerend(pugi::xml_node element);
@@ -2625,7 +2625,7 @@ public:
     void ResetLinerendBase();
 
     /** Read the values for the attribute class **/
-    bool ReadLinerendBase(pugi::xml_node element);
+    bool ReadLinerendBase(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLinerendBase(pugi::xml_node element);
@@ -2667,7 +2667,7 @@ public:
     void ResetLyricstyle();
 
     /** Read the values for the attribute class **/
-    bool ReadLyricstyle(pugi::xml_node element);
+    bool ReadLyricstyle(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteLyricstyle(pugi::xml_node element);
@@ -2733,7 +2733,7 @@ public:
     void ResetMeasureLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeasureLog(pugi::xml_node element);
+    bool ReadMeasureLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeasureLog(pugi::xml_node element);
@@ -2779,7 +2779,7 @@ public:
     void ResetMeasurement();
 
     /** Read the values for the attribute class **/
-    bool ReadMeasurement(pugi::xml_node element);
+    bool ReadMeasurement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeasurement(pugi::xml_node element);
@@ -2815,7 +2815,7 @@ public:
     void ResetMeasurenumbers();
 
     /** Read the values for the attribute class **/
-    bool ReadMeasurenumbers(pugi::xml_node element);
+    bool ReadMeasurenumbers(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeasurenumbers(pugi::xml_node element);
@@ -2851,7 +2851,7 @@ public:
     void ResetMediabounds();
 
     /** Read the values for the attribute class **/
-    bool ReadMediabounds(pugi::xml_node element);
+    bool ReadMediabounds(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMediabounds(pugi::xml_node element);
@@ -2912,7 +2912,7 @@ public:
     void ResetMedium();
 
     /** Read the values for the attribute class **/
-    bool ReadMedium(pugi::xml_node element);
+    bool ReadMedium(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMedium(pugi::xml_node element);
@@ -2948,7 +2948,7 @@ public:
     void ResetMeiversion();
 
     /** Read the values for the attribute class **/
-    bool ReadMeiversion(pugi::xml_node element);
+    bool ReadMeiversion(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeiversion(pugi::xml_node element);
@@ -2984,7 +2984,7 @@ public:
     void ResetMensurLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMensurLog(pugi::xml_node element);
+    bool ReadMensurLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMensurLog(pugi::xml_node element);
@@ -3026,7 +3026,7 @@ public:
     void ResetMeterSigLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigLog(pugi::xml_node element);
+    bool ReadMeterSigLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigLog(pugi::xml_node element);
@@ -3082,7 +3082,7 @@ public:
     void ResetMeterSigVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigVis(pugi::xml_node element);
+    bool ReadMeterSigVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigVis(pugi::xml_node element);
@@ -3118,7 +3118,7 @@ public:
     void ResetMeterSigDefaultLog();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigDefaultLog(pugi::xml_node element);
+    bool ReadMeterSigDefaultLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultLog(pugi::xml_node element);
@@ -3168,7 +3168,7 @@ public:
     void ResetMeterSigDefaultVis();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterSigDefaultVis(pugi::xml_node element);
+    bool ReadMeterSigDefaultVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeterSigDefaultVis(pugi::xml_node element);
@@ -3222,7 +3222,7 @@ public:
     void ResetMeterconformance();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterconformance(pugi::xml_node element);
+    bool ReadMeterconformance(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeterconformance(pugi::xml_node element);
@@ -3261,7 +3261,7 @@ public:
     void ResetMeterconformanceBar();
 
     /** Read the values for the attribute class **/
-    bool ReadMeterconformanceBar(pugi::xml_node element);
+    bool ReadMeterconformanceBar(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMeterconformanceBar(pugi::xml_node element);
@@ -3312,7 +3312,7 @@ public:
     void ResetMmtempo();
 
     /** Read the values for the attribute class **/
-    bool ReadMmtempo(pugi::xml_node element);
+    bool ReadMmtempo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMmtempo(pugi::xml_node element);
@@ -3366,7 +3366,7 @@ public:
     void ResetMultinummeasures();
 
     /** Read the values for the attribute class **/
-    bool ReadMultinummeasures(pugi::xml_node element);
+    bool ReadMultinummeasures(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteMultinummeasures(pugi::xml_node element);
@@ -3405,7 +3405,7 @@ public:
     void ResetName();
 
     /** Read the values for the attribute class **/
-    bool ReadName(pugi::xml_node element);
+    bool ReadName(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteName(pugi::xml_node element);
@@ -3454,7 +3454,7 @@ public:
     void ResetNotationstyle();
 
     /** Read the values for the attribute class **/
-    bool ReadNotationstyle(pugi::xml_node element);
+    bool ReadNotationstyle(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNotationstyle(pugi::xml_node element);
@@ -3496,7 +3496,7 @@ public:
     void ResetNoteGes();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteGes(pugi::xml_node element);
+    bool ReadNoteGes(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNoteGes(pugi::xml_node element);
@@ -3544,7 +3544,7 @@ public:
     void ResetNoteheads();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteheads(pugi::xml_node element);
+    bool ReadNoteheads(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNoteheads(pugi::xml_node element);
@@ -3623,7 +3623,7 @@ public:
     void ResetOctave();
 
     /** Read the values for the attribute class **/
-    bool ReadOctave(pugi::xml_node element);
+    bool ReadOctave(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOctave(pugi::xml_node element);
@@ -3659,7 +3659,7 @@ public:
     void ResetOctavedefault();
 
     /** Read the values for the attribute class **/
-    bool ReadOctavedefault(pugi::xml_node element);
+    bool ReadOctavedefault(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOctavedefault(pugi::xml_node element);
@@ -3699,7 +3699,7 @@ public:
     void ResetOctavedisplacement();
 
     /** Read the values for the attribute class **/
-    bool ReadOctavedisplacement(pugi::xml_node element);
+    bool ReadOctavedisplacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOctavedisplacement(pugi::xml_node element);
@@ -3741,7 +3741,7 @@ public:
     void ResetOnelinestaff();
 
     /** Read the values for the attribute class **/
-    bool ReadOnelinestaff(pugi::xml_node element);
+    bool ReadOnelinestaff(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOnelinestaff(pugi::xml_node element);
@@ -3781,7 +3781,7 @@ public:
     void ResetOptimization();
 
     /** Read the values for the attribute class **/
-    bool ReadOptimization(pugi::xml_node element);
+    bool ReadOptimization(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOptimization(pugi::xml_node element);
@@ -3820,7 +3820,7 @@ public:
     void ResetOriginLayerident();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginLayerident(pugi::xml_node element);
+    bool ReadOriginLayerident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOriginLayerident(pugi::xml_node element);
@@ -3856,7 +3856,7 @@ public:
     void ResetOriginStaffident();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginStaffident(pugi::xml_node element);
+    bool ReadOriginStaffident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOriginStaffident(pugi::xml_node element);
@@ -3895,7 +3895,7 @@ public:
     void ResetOriginStartendid();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginStartendid(pugi::xml_node element);
+    bool ReadOriginStartendid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOriginStartendid(pugi::xml_node element);
@@ -3937,7 +3937,7 @@ public:
     void ResetOriginTimestampMusical();
 
     /** Read the values for the attribute class **/
-    bool ReadOriginTimestampMusical(pugi::xml_node element);
+    bool ReadOriginTimestampMusical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteOriginTimestampMusical(pugi::xml_node element);
@@ -3986,7 +3986,7 @@ public:
     void ResetPadLog();
 
     /** Read the values for the attribute class **/
-    bool ReadPadLog(pugi::xml_node element);
+    bool ReadPadLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePadLog(pugi::xml_node element);
@@ -4025,7 +4025,7 @@ public:
     void ResetPages();
 
     /** Read the values for the attribute class **/
-    bool ReadPages(pugi::xml_node element);
+    bool ReadPages(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePages(pugi::xml_node element);
@@ -4109,7 +4109,7 @@ public:
     void ResetPbVis();
 
     /** Read the values for the attribute class **/
-    bool ReadPbVis(pugi::xml_node element);
+    bool ReadPbVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePbVis(pugi::xml_node element);
@@ -4148,7 +4148,7 @@ public:
     void ResetPitch();
 
     /** Read the values for the attribute class **/
-    bool ReadPitch(pugi::xml_node element);
+    bool ReadPitch(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePitch(pugi::xml_node element);
@@ -4184,7 +4184,7 @@ public:
     void ResetPlacement();
 
     /** Read the values for the attribute class **/
-    bool ReadPlacement(pugi::xml_node element);
+    bool ReadPlacement(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePlacement(pugi::xml_node element);
@@ -4223,7 +4223,7 @@ public:
     void ResetPlist();
 
     /** Read the values for the attribute class **/
-    bool ReadPlist(pugi::xml_node element);
+    bool ReadPlist(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePlist(pugi::xml_node element);
@@ -4263,7 +4263,7 @@ public:
     void ResetPointing();
 
     /** Read the values for the attribute class **/
-    bool ReadPointing(pugi::xml_node element);
+    bool ReadPointing(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WritePointing(pugi::xml_node element);
@@ -4333,7 +4333,7 @@ public:
     void ResetQuantity();
 
     /** Read the values for the attribute class **/
-    bool ReadQuantity(pugi::xml_node element);
+    bool ReadQuantity(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteQuantity(pugi::xml_node element);
@@ -4372,7 +4372,7 @@ public:
     void ResetRelativesize();
 
     /** Read the values for the attribute class **/
-    bool ReadRelativesize(pugi::xml_node element);
+    bool ReadRelativesize(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteRelativesize(pugi::xml_node element);
@@ -4408,7 +4408,7 @@ public:
     void ResetResponsibility();
 
     /** Read the values for the attribute class **/
-    bool ReadResponsibility(pugi::xml_node element);
+    bool ReadResponsibility(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteResponsibility(pugi::xml_node element);
@@ -4448,7 +4448,7 @@ public:
     void ResetSbVis();
 
     /** Read the values for the attribute class **/
-    bool ReadSbVis(pugi::xml_node element);
+    bool ReadSbVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSbVis(pugi::xml_node element);
@@ -4484,7 +4484,7 @@ public:
     void ResetScalable();
 
     /** Read the values for the attribute class **/
-    bool ReadScalable(pugi::xml_node element);
+    bool ReadScalable(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteScalable(pugi::xml_node element);
@@ -4520,7 +4520,7 @@ public:
     void ResetScoreDefGes();
 
     /** Read the values for the attribute class **/
-    bool ReadScoreDefGes(pugi::xml_node element);
+    bool ReadScoreDefGes(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefGes(pugi::xml_node element);
@@ -4568,7 +4568,7 @@ public:
     void ResetScoreDefVis();
 
     /** Read the values for the attribute class **/
-    bool ReadScoreDefVis(pugi::xml_node element);
+    bool ReadScoreDefVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteScoreDefVis(pugi::xml_node element);
@@ -4608,7 +4608,7 @@ public:
     void ResetSectionVis();
 
     /** Read the values for the attribute class **/
-    bool ReadSectionVis(pugi::xml_node element);
+    bool ReadSectionVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSectionVis(pugi::xml_node element);
@@ -4644,7 +4644,7 @@ public:
     void ResetSequence();
 
     /** Read the values for the attribute class **/
-    bool ReadSequence(pugi::xml_node element);
+    bool ReadSequence(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSequence(pugi::xml_node element);
@@ -4683,7 +4683,7 @@ public:
     void ResetSlashcount();
 
     /** Read the values for the attribute class **/
-    bool ReadSlashcount(pugi::xml_node element);
+    bool ReadSlashcount(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSlashcount(pugi::xml_node element);
@@ -4719,7 +4719,7 @@ public:
     void ResetSlurpresent();
 
     /** Read the values for the attribute class **/
-    bool ReadSlurpresent(pugi::xml_node element);
+    bool ReadSlurpresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSlurpresent(pugi::xml_node element);
@@ -4759,7 +4759,7 @@ public:
     void ResetSpaceVis();
 
     /** Read the values for the attribute class **/
-    bool ReadSpaceVis(pugi::xml_node element);
+    bool ReadSpaceVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSpaceVis(pugi::xml_node element);
@@ -4798,7 +4798,7 @@ public:
     void ResetSpacing();
 
     /** Read the values for the attribute class **/
-    bool ReadSpacing(pugi::xml_node element);
+    bool ReadSpacing(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSpacing(pugi::xml_node element);
@@ -4861,7 +4861,7 @@ public:
     void ResetStaffLog();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffLog(pugi::xml_node element);
+    bool ReadStaffLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStaffLog(pugi::xml_node element);
@@ -4897,7 +4897,7 @@ public:
     void ResetStaffDefVis();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffDefVis(pugi::xml_node element);
+    bool ReadStaffDefVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStaffDefVis(pugi::xml_node element);
@@ -4975,7 +4975,7 @@ public:
     void ResetStaffGrpVis();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffGrpVis(pugi::xml_node element);
+    bool ReadStaffGrpVis(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStaffGrpVis(pugi::xml_node element);
@@ -5014,7 +5014,7 @@ public:
     void ResetStaffgroupingsym();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffgroupingsym(pugi::xml_node element);
+    bool ReadStaffgroupingsym(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStaffgroupingsym(pugi::xml_node element);
@@ -5050,7 +5050,7 @@ public:
     void ResetStaffident();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffident(pugi::xml_node element);
+    bool ReadStaffident(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStaffident(pugi::xml_node element);
@@ -5090,7 +5090,7 @@ public:
     void ResetStaffloc();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffloc(pugi::xml_node element);
+    bool ReadStaffloc(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStaffloc(pugi::xml_node element);
@@ -5126,7 +5126,7 @@ public:
     void ResetStafflocPitched();
 
     /** Read the values for the attribute class **/
-    bool ReadStafflocPitched(pugi::xml_node element);
+    bool ReadStafflocPitched(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStafflocPitched(pugi::xml_node element);
@@ -5168,7 +5168,7 @@ public:
     void ResetStartendid();
 
     /** Read the values for the attribute class **/
-    bool ReadStartendid(pugi::xml_node element);
+    bool ReadStartendid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStartendid(pugi::xml_node element);
@@ -5207,7 +5207,7 @@ public:
     void ResetStartid();
 
     /** Read the values for the attribute class **/
-    bool ReadStartid(pugi::xml_node element);
+    bool ReadStartid(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStartid(pugi::xml_node element);
@@ -5246,7 +5246,7 @@ public:
     void ResetStems();
 
     /** Read the values for the attribute class **/
-    bool ReadStems(pugi::xml_node element);
+    bool ReadStems(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStems(pugi::xml_node element);
@@ -5315,7 +5315,7 @@ public:
     void ResetSylLog();
 
     /** Read the values for the attribute class **/
-    bool ReadSylLog(pugi::xml_node element);
+    bool ReadSylLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSylLog(pugi::xml_node element);
@@ -5360,7 +5360,7 @@ public:
     void ResetSyltext();
 
     /** Read the values for the attribute class **/
-    bool ReadSyltext(pugi::xml_node element);
+    bool ReadSyltext(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSyltext(pugi::xml_node element);
@@ -5396,7 +5396,7 @@ public:
     void ResetSystems();
 
     /** Read the values for the attribute class **/
-    bool ReadSystems(pugi::xml_node element);
+    bool ReadSystems(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteSystems(pugi::xml_node element);
@@ -5463,7 +5463,7 @@ public:
     void ResetTargeteval();
 
     /** Read the values for the attribute class **/
-    bool ReadTargeteval(pugi::xml_node element);
+    bool ReadTargeteval(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTargeteval(pugi::xml_node element);
@@ -5502,7 +5502,7 @@ public:
     void ResetTempoLog();
 
     /** Read the values for the attribute class **/
-    bool ReadTempoLog(pugi::xml_node element);
+    bool ReadTempoLog(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTempoLog(pugi::xml_node element);
@@ -5538,7 +5538,7 @@ public:
     void ResetTextstyle();
 
     /** Read the values for the attribute class **/
-    bool ReadTextstyle(pugi::xml_node element);
+    bool ReadTextstyle(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTextstyle(pugi::xml_node element);
@@ -5613,7 +5613,7 @@ public:
     void ResetTiepresent();
 
     /** Read the values for the attribute class **/
-    bool ReadTiepresent(pugi::xml_node element);
+    bool ReadTiepresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTiepresent(pugi::xml_node element);
@@ -5653,7 +5653,7 @@ public:
     void ResetTimestampMusical();
 
     /** Read the values for the attribute class **/
-    bool ReadTimestampMusical(pugi::xml_node element);
+    bool ReadTimestampMusical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTimestampMusical(pugi::xml_node element);
@@ -5692,7 +5692,7 @@ public:
     void ResetTimestampPerformed();
 
     /** Read the values for the attribute class **/
-    bool ReadTimestampPerformed(pugi::xml_node element);
+    bool ReadTimestampPerformed(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTimestampPerformed(pugi::xml_node element);
@@ -5738,7 +5738,7 @@ public:
     void ResetTimestamp2Musical();
 
     /** Read the values for the attribute class **/
-    bool ReadTimestamp2Musical(pugi::xml_node element);
+    bool ReadTimestamp2Musical(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTimestamp2Musical(pugi::xml_node element);
@@ -5777,7 +5777,7 @@ public:
     void ResetTransposition();
 
     /** Read the values for the attribute class **/
-    bool ReadTransposition(pugi::xml_node element);
+    bool ReadTransposition(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTransposition(pugi::xml_node element);
@@ -5835,7 +5835,7 @@ public:
     void ResetTupletpresent();
 
     /** Read the values for the attribute class **/
-    bool ReadTupletpresent(pugi::xml_node element);
+    bool ReadTupletpresent(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTupletpresent(pugi::xml_node element);
@@ -5875,7 +5875,7 @@ public:
     void ResetTyped();
 
     /** Read the values for the attribute class **/
-    bool ReadTyped(pugi::xml_node element);
+    bool ReadTyped(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTyped(pugi::xml_node element);
@@ -5923,7 +5923,7 @@ public:
     void ResetTypography();
 
     /** Read the values for the attribute class **/
-    bool ReadTypography(pugi::xml_node element);
+    bool ReadTypography(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteTypography(pugi::xml_node element);
@@ -5987,7 +5987,7 @@ public:
     void ResetVisibility();
 
     /** Read the values for the attribute class **/
-    bool ReadVisibility(pugi::xml_node element);
+    bool ReadVisibility(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVisibility(pugi::xml_node element);
@@ -6026,7 +6026,7 @@ public:
     void ResetVisualoffsetHo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualoffsetHo(pugi::xml_node element);
+    bool ReadVisualoffsetHo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVisualoffsetHo(pugi::xml_node element);
@@ -6066,7 +6066,7 @@ public:
     void ResetVisualoffsetTo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualoffsetTo(pugi::xml_node element);
+    bool ReadVisualoffsetTo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVisualoffsetTo(pugi::xml_node element);
@@ -6105,7 +6105,7 @@ public:
     void ResetVisualoffsetVo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualoffsetVo(pugi::xml_node element);
+    bool ReadVisualoffsetVo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVisualoffsetVo(pugi::xml_node element);
@@ -6145,7 +6145,7 @@ public:
     void ResetVisualoffset2Ho();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualoffset2Ho(pugi::xml_node element);
+    bool ReadVisualoffset2Ho(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVisualoffset2Ho(pugi::xml_node element);
@@ -6193,7 +6193,7 @@ public:
     void ResetVisualoffset2To();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualoffset2To(pugi::xml_node element);
+    bool ReadVisualoffset2To(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVisualoffset2To(pugi::xml_node element);
@@ -6241,7 +6241,7 @@ public:
     void ResetVisualoffset2Vo();
 
     /** Read the values for the attribute class **/
-    bool ReadVisualoffset2Vo(pugi::xml_node element);
+    bool ReadVisualoffset2Vo(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteVisualoffset2Vo(pugi::xml_node element);
@@ -6289,7 +6289,7 @@ public:
     void ResetWhitespace();
 
     /** Read the values for the attribute class **/
-    bool ReadWhitespace(pugi::xml_node element);
+    bool ReadWhitespace(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteWhitespace(pugi::xml_node element);
@@ -6325,7 +6325,7 @@ public:
     void ResetWidth();
 
     /** Read the values for the attribute class **/
-    bool ReadWidth(pugi::xml_node element);
+    bool ReadWidth(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteWidth(pugi::xml_node element);
@@ -6361,7 +6361,7 @@ public:
     void ResetXy();
 
     /** Read the values for the attribute class **/
-    bool ReadXy(pugi::xml_node element);
+    bool ReadXy(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteXy(pugi::xml_node element);
@@ -6411,7 +6411,7 @@ public:
     void ResetXy2();
 
     /** Read the values for the attribute class **/
-    bool ReadXy2(pugi::xml_node element);
+    bool ReadXy2(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteXy2(pugi::xml_node element);
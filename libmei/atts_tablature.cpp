@@ -45,17 +45,19 @@ void AttNoteGesTablature::ResetNoteGesTablature()
     m_tabString = STRINGNUMBER_NONE;
 }
 
-bool AttNoteGesTablature::ReadNoteGesTablature(pugi::xml_node element)
+bool AttNoteGesTablature::ReadNoteGesTablature(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.fret")) {
-        this->SetTabFret(StrToFretnumber(element.attribute("tab.fret").value()));
-        element.remove_attribute("tab.fret");
+    pugi::xml_attribute attr = element.attribute("tab.fret");
+    if (attr) {
+        this->SetTabFret(StrToFretnumber(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.string")) {
-        this->SetTabString(StrToStringnumber(element.attribute("tab.string").value()));
-        element.remove_attribute("tab.string");
+    attr = element.attribute("tab.string");
+    if (attr) {
+        this->SetTabString(StrToStringnumber(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -105,12 +107,13 @@ void AttStaffDefGesTablature::ResetStaffDefGesTablature()
     m_tabStrings = "";
 }
 
-bool AttStaffDefGesTablature::ReadStaffDefGesTablature(pugi::xml_node element)
+bool AttStaffDefGesTablature::ReadStaffDefGesTablature(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.strings")) {
-        this->SetTabStrings(StrToStr(element.attribute("tab.strings").value()));
-        element.remove_attribute("tab.strings");
+    pugi::xml_attribute attr = element.attribute("tab.strings");
+    if (attr) {
+        this->SetTabStrings(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -38,7 +38,7 @@ public:
     void ResetNoteGesTablature();
 
     /** Read the values for the attribute class **/
-    bool ReadNoteGesTablature(pugi::xml_node element);
+    bool ReadNoteGesTablature(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteNoteGesTablature(pugi::xml_node element);
@@ -80,7 +80,7 @@ public:
     void ResetStaffDefGesTablature();
 
     /** Read the values for the attribute class **/
-    bool ReadStaffDefGesTablature(pugi::xml_node element);
+    bool ReadStaffDefGesTablature(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteStaffDefGesTablature(pugi::xml_node element);
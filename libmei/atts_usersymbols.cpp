@@ -44,12 +44,13 @@ void AttAltsym::ResetAltsym()
     m_altsym = "";
 }
 
-bool AttAltsym::ReadAltsym(pugi::xml_node element)
+bool AttAltsym::ReadAltsym(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs)
 {
     bool hasAttribute = false;
-    if (element.attribute("altsym")) {
-        this->SetAltsym(StrToStr(element.attribute("altsym").value()));
-        element.remove_attribute("altsym");
+    pugi::xml_attribute attr = element.attribute("altsym");
+    if (attr) {
+        this->SetAltsym(StrToStr(attr.value()));
+        if (consumedAttrs) consumedAttrs->push_back(attr);
         hasAttribute = true;
     }
     return hasAttribute;
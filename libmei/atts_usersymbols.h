@@ -38,7 +38,7 @@ public:
     void ResetAltsym();
 
     /** Read the values for the attribute class **/
-    bool ReadAltsym(pugi::xml_node element);
+    bool ReadAltsym(pugi::xml_node element, ArrayOfConsumedAttrs *consumedAttrs);
 
     /** Write the values for the attribute class **/
     bool WriteAltsym(pugi::xml_node element);
@@ -56,6 +56,7 @@ void AnchoredText::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
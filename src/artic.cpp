@@ -67,6 +67,7 @@ void Artic::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
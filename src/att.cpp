@@ -11,6 +11,7 @@
 
 #include <sstream>
 #include <stdlib.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------
 
@@ -58,14 +59,14 @@ std::string Att::WcharTToStr(wchar_t data) const
 
 // Basic converters for reading
 
-double Att::StrToDbl(std::string value) const
+double Att::StrToDbl(const char *value) const
 {
-    return atof(value.c_str());
+    return atof(value);
 }
 
-int Att::StrToInt(std::string value) const
+int Att::StrToInt(const char *value) const
 {
-    return atoi(value.c_str());
+    return atoi(value);
 }
 
 wchar_t Att::StrToWcharT(std::string value) const
@@ -134,16 +135,16 @@ std::string Att::BeatrptRendToStr(data_BEATRPT_REND data) const
     return value;
 }
 
-data_BEATRPT_REND Att::StrToBeatrptRend(std::string value) const
+data_BEATRPT_REND Att::StrToBeatrptRend(const char *value) const
 {
-    if (value == "4") return BEATRPT_REND_4;
-    if (value == "8") return BEATRPT_REND_8;
-    if (value == "16") return BEATRPT_REND_16;
-    if (value == "32") return BEATRPT_REND_32;
-    if (value == "64") return BEATRPT_REND_64;
-    if (value == "128") return BEATRPT_REND_128;
-    if (value == "mixed") return BEATRPT_REND_mixed;
-    LogWarning("Unsupported beatrpt rend '%s'", value.c_str());
+    if (!strcmp(value, "4")) return BEATRPT_REND_4;
+    if (!strcmp(value, "8")) return BEATRPT_REND_8;
+    if (!strcmp(value, "16")) return BEATRPT_REND_16;
+    if (!strcmp(value, "32")) return BEATRPT_REND_32;
+    if (!strcmp(value, "64")) return BEATRPT_REND_64;
+    if (!strcmp(value, "128")) return BEATRPT_REND_128;
+    if (!strcmp(value, "mixed")) return BEATRPT_REND_mixed;
+    LogWarning("Unsupported beatrpt rend '%s'", value);
     return BEATRPT_REND_NONE;
 }
 
@@ -178,32 +179,33 @@ std::string Att::DurationToStr(data_DURATION data) const
     return value;
 }
 
-data_DURATION Att::StrToDuration(std::string value) const
-{
-    if (value == "maxima") return DURATION_maxima;
-    if (value == "longa") return DURATION_longa;
-    if (value == "brevis") return DURATION_brevis;
-    if (value == "semibrevis") return DURATION_semibrevis;
-    if (value == "minima") return DURATION_minima;
-    if (value == "semiminima") return DURATION_semiminima;
-    if (value == "fusa") return DURATION_fusa;
-    if (value == "semifusa") return DURATION_semifusa;
-    if (value == "long") return DURATION_long;
-    if (value == "breve") return DURATION_breve;
-    if (value == "1") return DURATION_1;
-    if (value == "2") return DURATION_2;
-    if (value == "4") return DURATION_4;
-    if (value == "8") return DURATION_8;
-    if (value == "16") return DURATION_16;
-    if (value == "32") return DURATION_32;
-    if (value == "64") return DURATION_64;
-    if (value == "128") return DURATION_128;
-    if (value == "256") return DURATION_256;
-    if ((value.length() > 0) && (value[value.length() - 1] == 'p')) {
+data_DURATION Att::StrToDuration(const char *value) const
+{
+    if (!strcmp(value, "maxima")) return DURATION_maxima;
+    if (!strcmp(value, "longa")) return DURATION_longa;
+    if (!strcmp(value, "brevis")) return DURATION_brevis;
+    if (!strcmp(value, "semibrevis")) return DURATION_semibrevis;
+    if (!strcmp(value, "minima")) return DURATION_minima;
+    if (!strcmp(value, "semiminima")) return DURATION_semiminima;
+    if (!strcmp(value, "fusa")) return DURATION_fusa;
+    if (!strcmp(value, "semifusa")) return DURATION_semifusa;
+    if (!strcmp(value, "long")) return DURATION_long;
+    if (!strcmp(value, "breve")) return DURATION_breve;
+    if (!strcmp(value, "1")) return DURATION_1;
+    if (!strcmp(value, "2")) return DURATION_2;
+    if (!strcmp(value, "4")) return DURATION_4;
+    if (!strcmp(value, "8")) return DURATION_8;
+    if (!strcmp(value, "16")) return DURATION_16;
+    if (!strcmp(value, "32")) return DURATION_32;
+    if (!strcmp(value, "64")) return DURATION_64;
+    if (!strcmp(value, "128")) return DURATION_128;
+    if (!strcmp(value, "256")) return DURATION_256;
+    size_t length = strlen(value);
+    if ((length > 0) && (value[length - 1] == 'p')) {
         // LogWarning("PPQ duration dur_s are not supported"); // remove it for now
     }
     else {
-        LogWarning("Unknown dur '%s'", value.c_str());
+        LogWarning("Unknown dur '%s'", value);
     }
     return DURATION_NONE;
 }
@@ -216,13 +218,15 @@ std::string Att::PPQToStr(double data) const
     return sstm.str();;
 }
 
-double Att::StrToPPQ(std::string value) const
+double Att::StrToPPQ(const char *value) const
 {
-    if ((value.length() > 0) && (value[value.length() - 1] == 'p')) {
-        return atof(value.substr(0, value.length() - 1).c_str());
+    size_t length = strlen(value);
+    if ((length > 0) && (value[length - 1] == 'p')) {
+        // atof stops at the 'p'
+        return atof(value);
     }
     else {
-        LogWarning("Unknown dur ppq '%s'", value.c_str());
+        LogWarning("Unknown dur ppq '%s'", value);
     }
     return -1;
 }
@@ -255,25 +259,25 @@ std::string Att::KeysignatureToStr(data_KEYSIGNATURE data) const
     return value;
 }
 
-data_KEYSIGNATURE Att::StrToKeysignature(std::string value) const
-{
-    if (value == "7f") return KEYSIGNATURE_7f;
-    if (value == "6f") return KEYSIGNATURE_6f;
-    if (value == "5f") return KEYSIGNATURE_5f;
-    if (value == "4f") return KEYSIGNATURE_4f;
-    if (value == "3f") return KEYSIGNATURE_3f;
-    if (value == "2f") return KEYSIGNATURE_2f;
-    if (value == "1f") return KEYSIGNATURE_1f;
-    if (value == "0") return KEYSIGNATURE_0;
-    if (value == "1s") return KEYSIGNATURE_1s;
-    if (value == "2s") return KEYSIGNATURE_2s;
-    if (value == "3s") return KEYSIGNATURE_3s;
-    if (value == "4s") return KEYSIGNATURE_4s;
-    if (value == "5s") return KEYSIGNATURE_5s;
-    if (value == "6s") return KEYSIGNATURE_6s;
-    if (value == "7s") return KEYSIGNATURE_7s;
-    if (value == "mixed") return KEYSIGNATURE_mixed;
-    LogWarning("Unsupported key signature '%s'", value.c_str());
+data_KEYSIGNATURE Att::StrToKeysignature(const char *value) const
+{
+    if (!strcmp(value, "7f")) return KEYSIGNATURE_7f;
+    if (!strcmp(value, "6f")) return KEYSIGNATURE_6f;
+    if (!strcmp(value, "5f")) return KEYSIGNATURE_5f;
+    if (!strcmp(value, "4f")) return KEYSIGNATURE_4f;
+    if (!strcmp(value, "3f")) return KEYSIGNATURE_3f;
+    if (!strcmp(value, "2f")) return KEYSIGNATURE_2f;
+    if (!strcmp(value, "1f")) return KEYSIGNATURE_1f;
+    if (!strcmp(value, "0")) return KEYSIGNATURE_0;
+    if (!strcmp(value, "1s")) return KEYSIGNATURE_1s;
+    if (!strcmp(value, "2s")) return KEYSIGNATURE_2s;
+    if (!strcmp(value, "3s")) return KEYSIGNATURE_3s;
+    if (!strcmp(value, "4s")) return KEYSIGNATURE_4s;
+    if (!strcmp(value, "5s")) return KEYSIGNATURE_5s;
+    if (!strcmp(value, "6s")) return KEYSIGNATURE_6s;
+    if (!strcmp(value, "7s")) return KEYSIGNATURE_7s;
+    if (!strcmp(value, "mixed")) return KEYSIGNATURE_mixed;
+    LogWarning("Unsupported key signature '%s'", value);
     return KEYSIGNATURE_NONE;
 }
 
@@ -318,11 +322,11 @@ std::string Att::ModusmaiorToStr(data_MODUSMAIOR data) const
     return value;
 }
 
-data_MODUSMAIOR Att::StrToModusmaior(std::string value) const
+data_MODUSMAIOR Att::StrToModusmaior(const char *value) const
 {
-    if (value == "2") return MODUSMAIOR_2;
-    if (value == "3") return MODUSMAIOR_3;
-    LogWarning("Unsupported modusmaior '%s'", value.c_str());
+    if (!strcmp(value, "2")) return MODUSMAIOR_2;
+    if (!strcmp(value, "3")) return MODUSMAIOR_3;
+    LogWarning("Unsupported modusmaior '%s'", value);
     return MODUSMAIOR_NONE;
 }
 
@@ -340,11 +344,11 @@ std::string Att::ModusminorToStr(data_MODUSMINOR data) const
     return value;
 }
 
-data_MODUSMINOR Att::StrToModusminor(std::string value) const
+data_MODUSMINOR Att::StrToModusminor(const char *value) const
 {
-    if (value == "2") return MODUSMINOR_2;
-    if (value == "3") return MODUSMINOR_3;
-    LogWarning("Unsupported modusmaior '%s'", value.c_str());
+    if (!strcmp(value, "2")) return MODUSMINOR_2;
+    if (!strcmp(value, "3")) return MODUSMINOR_3;
+    LogWarning("Unsupported modusmaior '%s'", value);
     return MODUSMINOR_NONE;
 }
 
@@ -353,9 +357,10 @@ std::string Att::PercentToStr(data_PERCENT data) const
     return StringFormat("%d%%", data);
 }
 
-data_PERCENT Att::StrToPercent(std::string value) const
+data_PERCENT Att::StrToPercent(const char *value) const
 {
-    return atoi(value.substr(0, value.find("%")).c_str());
+    // atoi stops at the '%'
+    return atoi(value);
 }
 
 std::string Att::PitchnameToStr(data_PITCHNAME data) const
@@ -377,16 +382,16 @@ std::string Att::PitchnameToStr(data_PITCHNAME data) const
     return value;
 }
 
-data_PITCHNAME Att::StrToPitchname(std::string value) const
+data_PITCHNAME Att::StrToPitchname(const char *value) const
 {
-    if (value == "c") return PITCHNAME_c;
-    if (value == "d") return PITCHNAME_d;
-    if (value == "e") return PITCHNAME_e;
-    if (value == "f") return PITCHNAME_f;
-    if (value == "g") return PITCHNAME_g;
-    if (value == "a") return PITCHNAME_a;
-    if (value == "b") return PITCHNAME_b;
-    LogWarning("Unsupported pitch name '%s'", value.c_str());
+    if (!strcmp(value, "c")) return PITCHNAME_c;
+    if (!strcmp(value, "d")) return PITCHNAME_d;
+    if (!strcmp(value, "e")) return PITCHNAME_e;
+    if (!strcmp(value, "f")) return PITCHNAME_f;
+    if (!strcmp(value, "g")) return PITCHNAME_g;
+    if (!strcmp(value, "a")) return PITCHNAME_a;
+    if (!strcmp(value, "b")) return PITCHNAME_b;
+    LogWarning("Unsupported pitch name '%s'", value);
     return PITCHNAME_NONE;
 }
 
@@ -405,12 +410,12 @@ std::string Att::OctaveDisToStr(data_OCTAVE_DIS data) const
     return value;
 }
 
-data_OCTAVE_DIS Att::StrToOctaveDis(std::string value) const
+data_OCTAVE_DIS Att::StrToOctaveDis(const char *value) const
 {
-    if (value == "8") return OCTAVE_DIS_8;
-    if (value == "15") return OCTAVE_DIS_15;
-    if (value == "22") return OCTAVE_DIS_22;
-    LogWarning("Unsupported octave dis '%s'", value.c_str());
+    if (!strcmp(value, "8")) return OCTAVE_DIS_8;
+    if (!strcmp(value, "15")) return OCTAVE_DIS_15;
+    if (!strcmp(value, "22")) return OCTAVE_DIS_22;
+    LogWarning("Unsupported octave dis '%s'", value);
     return OCTAVE_DIS_NONE;
 }
 
@@ -429,12 +434,12 @@ std::string Att::OrientationToStr(data_ORIENTATION data) const
     return value;
 }
 
-data_ORIENTATION Att::StrToOrientation(std::string value) const
+data_ORIENTATION Att::StrToOrientation(const char *value) const
 {
-    if (value == "reversed") return ORIENTATION_reversed;
-    if (value == "90CW") return ORIENTATION_90CW;
-    if (value == "90CCW") return ORIENTATION_90CCW;
-    LogWarning("Unsupported orientation '%s'", value.c_str());
+    if (!strcmp(value, "reversed")) return ORIENTATION_reversed;
+    if (!strcmp(value, "90CW")) return ORIENTATION_90CW;
+    if (!strcmp(value, "90CCW")) return ORIENTATION_90CCW;
+    LogWarning("Unsupported orientation '%s'", value);
     return ORIENTATION_NONE;
 }
 
@@ -452,11 +457,11 @@ std::string Att::ProlatioToStr(data_PROLATIO data) const
     return value;
 }
 
-data_PROLATIO Att::StrToProlatio(std::string value) const
+data_PROLATIO Att::StrToProlatio(const char *value) const
 {
-    if (value == "2") return PROLATIO_2;
-    if (value == "3") return PROLATIO_3;
-    LogWarning("Unsupported prolatio '%s'", value.c_str());
+    if (!strcmp(value, "2")) return PROLATIO_2;
+    if (!strcmp(value, "3")) return PROLATIO_3;
+    LogWarning("Unsupported prolatio '%s'", value);
     return PROLATIO_NONE;
 }
 
@@ -474,11 +479,11 @@ std::string Att::StemdirectionToStr(data_STEMDIRECTION data) const
     return value;
 }
 
-data_STEMDIRECTION Att::StrToStemdirection(std::string value) const
+data_STEMDIRECTION Att::StrToStemdirection(const char *value) const
 {
-    if (value == "up") return STEMDIRECTION_up;
-    if (value == "down") return STEMDIRECTION_down;
-    LogWarning("Unsupported stem direction '%s'", value.c_str());
+    if (!strcmp(value, "up")) return STEMDIRECTION_up;
+    if (!strcmp(value, "down")) return STEMDIRECTION_down;
+    LogWarning("Unsupported stem direction '%s'", value);
     return STEMDIRECTION_NONE;
 }
 
@@ -496,11 +501,11 @@ std::string Att::TempusToStr(data_TEMPUS data) const
     return value;
 }
 
-data_TEMPUS Att::StrToTempus(std::string value) const
+data_TEMPUS Att::StrToTempus(const char *value) const
 {
-    if (value == "2") return TEMPUS_2;
-    if (value == "3") return TEMPUS_3;
-    LogWarning("Unsupported tempus '%s'", value.c_str());
+    if (!strcmp(value, "2")) return TEMPUS_2;
+    if (!strcmp(value, "3")) return TEMPUS_3;
+    LogWarning("Unsupported tempus '%s'", value);
     return TEMPUS_NONE;
 }
 
@@ -519,12 +524,12 @@ std::string Att::TieToStr(data_TIE data) const
     return value;
 }
 
-data_TIE Att::StrToTie(std::string value) const
+data_TIE Att::StrToTie(const char *value) const
 {
-    if (value == "i") return TIE_i;
-    if (value == "m") return TIE_m;
-    if (value == "t") return TIE_t;
-    LogWarning("Unsupported tie '%s'", value.c_str());
+    if (!strcmp(value, "i")) return TIE_i;
+    if (!strcmp(value, "m")) return TIE_m;
+    if (!strcmp(value, "t")) return TIE_t;
+    LogWarning("Unsupported tie '%s'", value);
     return TIE_NONE;
 }
 
@@ -356,6 +356,7 @@ void Beam::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -22,14 +22,127 @@
 
 #define BEZIER_APPROXIMATION 50.0
 
+// The arena blocks are aligned to the granularity and larger objects are allocated directly
+#define ARENA_GRANULARITY 16
+#define ARENA_MAX_SIZE 4096
+#define ARENA_CHUNK_SIZE (256 * 1024)
+
 namespace vrv {
 
-int BoundingBox::s_deCasteljau[4][4];
+#ifdef OBJECT_ARENA
+
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+thread_local ObjectArena **ObjectArena::s_currentArena = NULL;
+
+ObjectArena::ObjectArena() : m_count(1)
+{
+    m_currentChunk = -1;
+    m_current = NULL;
+    m_end = NULL;
+}
+
+ObjectArena::~ObjectArena()
+{
+    for (char *chunk : m_chunks) {
+        ::operator delete(chunk);
+    }
+}
+
+void ObjectArena::Unref()
+{
+    if (m_count.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+}
+
+void ObjectArena::Reset(ObjectArena **arena)
+{
+    assert(arena && *arena);
+
+    // No object is alive, we can reuse the chunks
+    if ((*arena)->m_count.load(std::memory_order_acquire) == 1) {
+        (*arena)->m_currentChunk = -1;
+        (*arena)->m_current = NULL;
+        (*arena)->m_end = NULL;
+        return;
+    }
+    (*arena)->Unref();
+    *arena = new ObjectArena();
+}
+
+void *ObjectArena::Allocate(size_t size)
+{
+    ObjectArena *arena = (s_currentArena) ? *s_currentArena : NULL;
+    // Each block starts with the arena it belongs to (NULL for the global allocator) in a header of the size of
+    // the granularity, which keeps the objects aligned
+    size_t blockSize = ((size + ARENA_GRANULARITY - 1) / ARENA_GRANULARITY + 1) * ARENA_GRANULARITY;
+    char *block;
+    if (!arena || (blockSize > ARENA_MAX_SIZE)) {
+        block = (char *)::operator new(blockSize);
+        arena = NULL;
+    }
+    else {
+        if (arena->m_end - arena->m_current < (int)blockSize) {
+            arena->m_currentChunk++;
+            if (arena->m_currentChunk == (int)arena->m_chunks.size()) {
+                arena->m_chunks.push_back((char *)::operator new(ARENA_CHUNK_SIZE));
+            }
+            arena->m_current = arena->m_chunks.at(arena->m_currentChunk);
+            arena->m_end = arena->m_current + ARENA_CHUNK_SIZE;
+        }
+        block = arena->m_current;
+        arena->m_current += blockSize;
+        arena->m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    *(ObjectArena **)block = arena;
+    return block + ARENA_GRANULARITY;
+}
+
+void ObjectArena::Free(void *ptr)
+{
+    if (!ptr) return;
+
+    char *block = (char *)ptr - ARENA_GRANULARITY;
+    ObjectArena *arena = *(ObjectArena **)block;
+    if (arena) {
+        arena->Unref();
+    }
+    else {
+        ::operator delete(block);
+    }
+}
+
+ObjectArena::Scope::Scope(ObjectArena **arena)
+{
+    m_previousArena = s_currentArena;
+    s_currentArena = arena;
+}
+
+ObjectArena::Scope::~Scope()
+{
+    s_currentArena = m_previousArena;
+}
+
+#endif
+
 
 //----------------------------------------------------------------------------
 // BoundingBox
 //----------------------------------------------------------------------------
 
+#ifdef OBJECT_ARENA
+void *BoundingBox::operator new(size_t size)
+{
+    return ObjectArena::Allocate(size);
+}
+
+void BoundingBox::operator delete(void *ptr)
+{
+    ObjectArena::Free(ptr);
+}
+#endif
+
 BoundingBox::BoundingBox()
 {
     Point rect1[2];
@@ -719,15 +832,16 @@ int BoundingBox::CalcBezierAtPosition(const Point bezier[4], int x)
     if (bezier[3].x != bezier[0].x) t = (double)(x - bezier[0].x) / (double)(bezier[3].x - bezier[0].x);
     t = std::min(1.0, std::max(0.0, t));
     int n = 4;
+    // Local to the call (and not static) since this can be called concurrently
+    int deCasteljau[4][4];
 
-    for (i = 0; i < n; i++) BoundingBox::s_deCasteljau[0][i] = bezier[i].y;
+    for (i = 0; i < n; i++) deCasteljau[0][i] = bezier[i].y;
     for (j = 1; j < n; j++) {
         for (int i = 0; i < 4 - j; i++) {
-            BoundingBox::s_deCasteljau[j][i]
-                = BoundingBox::s_deCasteljau[j - 1][i] * (1 - t) + BoundingBox::s_deCasteljau[j - 1][i + 1] * t;
+            deCasteljau[j][i] = deCasteljau[j - 1][i] * (1 - t) + deCasteljau[j - 1][i + 1] * t;
         }
     }
-    return BoundingBox::s_deCasteljau[n - 1][0];
+    return deCasteljau[n - 1][0];
 }
 
 void BoundingBox::CalcThickBezier(
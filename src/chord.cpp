@@ -79,6 +79,9 @@ void Chord::Reset()
     ResetVisibility();
 
     ClearClusters();
+
+    m_playingOnset = 0.0;
+    m_playingOffset = 0.0;
 }
 
 void Chord::ClearClusters() const
@@ -122,6 +125,7 @@ void Chord::AddChild(Object *child)
         m_children.insert(m_children.begin(), child);
     else
         m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
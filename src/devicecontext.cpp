@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <climits>
 #include <math.h>
 
 //----------------------------------------------------------------------------
@@ -121,22 +122,29 @@ void DeviceContext::GetTextExtent(const std::wstring &string, TextExtend *extend
     assert(m_fontStack.top());
     assert(extend);
 
-    extend->m_width = 0;
-    extend->m_height = 0;
-
-    Glyph *unkown = Resources::GetTextGlyph(L'o');
-
-    for (unsigned int i = 0; i < string.length(); i++) {
-        wchar_t c = string[i];
-        Glyph *glyph = Resources::GetTextGlyph(c);
-        if (!glyph) {
-            glyph = Resources::GetGlyph(c);
-        }
-        if (!glyph) {
-            glyph = unkown;
+    // The texts (e.g., syllables) are often measured many times
+    TextExtend textExtend;
+    int pointSize = m_fontStack.top()->GetPointSize();
+    if (!Resources::GetCachedTextExtent(string, pointSize, false, &textExtend)) {
+        InitTextExtend(&textExtend);
+
+        Glyph *unkown = Resources::GetTextGlyph(L'o');
+
+        for (unsigned int i = 0; i < string.length(); i++) {
+            wchar_t c = string[i];
+            Glyph *glyph = Resources::GetTextGlyph(c);
+            if (!glyph) {
+                glyph = Resources::GetGlyph(c);
+            }
+            if (!glyph) {
+                glyph = unkown;
+            }
+            AddGlyphToTextExtend(glyph, &textExtend);
         }
-        AddGlyphToTextExtend(glyph, extend);
+        Resources::CacheTextExtent(string, pointSize, false, textExtend);
     }
+
+    MergeTextExtend(textExtend, extend);
 }
 
 void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *extend)
@@ -144,17 +152,45 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *e
     assert(m_fontStack.top());
     assert(extend);
 
+    TextExtend textExtend;
+    int pointSize = m_fontStack.top()->GetPointSize();
+    if (!Resources::GetCachedTextExtent(string, pointSize, true, &textExtend)) {
+        InitTextExtend(&textExtend);
+
+        for (unsigned int i = 0; i < string.length(); i++) {
+            wchar_t c = string[i];
+            Glyph *glyph = Resources::GetGlyph(c);
+            if (!glyph) {
+                continue;
+            }
+            AddGlyphToTextExtend(glyph, &textExtend);
+        }
+        Resources::CacheTextExtent(string, pointSize, true, textExtend);
+    }
+
+    MergeTextExtend(textExtend, extend);
+}
+
+void DeviceContext::InitTextExtend(TextExtend *extend)
+{
+    assert(extend);
+
+    // The ascent and the descent are unset so they can be merged with the ones already in the extend
     extend->m_width = 0;
     extend->m_height = 0;
+    extend->m_ascent = INT_MIN;
+    extend->m_descent = INT_MIN;
+}
 
-    for (unsigned int i = 0; i < string.length(); i++) {
-        wchar_t c = string[i];
-        Glyph *glyph = Resources::GetGlyph(c);
-        if (!glyph) {
-            continue;
-        }
-        AddGlyphToTextExtend(glyph, extend);
-    }
+void DeviceContext::MergeTextExtend(const TextExtend &textExtend, TextExtend *extend)
+{
+    assert(extend);
+
+    // The width and the height are reset for every text, but not the ascent and the descent
+    extend->m_width = textExtend.m_width;
+    extend->m_height = textExtend.m_height;
+    extend->m_ascent = std::max(textExtend.m_ascent, extend->m_ascent);
+    extend->m_descent = std::max(textExtend.m_descent, extend->m_descent);
 }
 
 void DeviceContext::AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend)
@@ -9,8 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <math.h>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -28,6 +30,7 @@
 #include "multirest.h"
 #include "note.h"
 #include "page.h"
+#include "rest.h"
 #include "rpt.h"
 #include "score.h"
 #include "slur.h"
@@ -54,6 +57,12 @@ Doc::Doc() : Object("doc-")
 
     // owned pointers need to be set to NULL;
     m_scoreBuffer = NULL;
+    m_scaledGlyphMetrics = NULL;
+    m_uuidIndexIsValid = false;
+    m_processingInThreads = 0;
+#ifdef OBJECT_ARENA
+    m_objectArena = ObjectArena::Create();
+#endif
     Reset();
 }
 
@@ -63,6 +72,13 @@ Doc::~Doc()
     if (m_scoreBuffer) {
         delete m_scoreBuffer;
     }
+    if (m_scaledGlyphMetrics) {
+        delete[] m_scaledGlyphMetrics;
+    }
+#ifdef OBJECT_ARENA
+    // The objects still alive (e.g., the pages deleted afterwards by Object::~Object) keep the arena
+    ObjectArena::Release(m_objectArena);
+#endif
 }
 
 void Doc::Reset()
@@ -78,16 +94,23 @@ void Doc::Reset()
 
     m_drawingSpacingLinear = DEFAULT_SPACING_LINEAR;
     m_drawingSpacingNonLinear = DEFAULT_SPACING_NON_LINEAR;
+    m_layoutThreads = 1;
 
     m_spacingStaff = m_style->m_spacingStaff;
     m_spacingSystem = m_style->m_spacingSystem;
 
     m_drawingPage = NULL;
+    m_drawingAllPages = false;
     m_drawingJustifyX = true;
     m_drawingEvenSpacing = false;
     m_currentScoreDefDone = false;
     m_drawingPreparationDone = false;
     m_midiExportDone = false;
+    m_midiElements.clear();
+    m_midiElementsByOnset.clear();
+    m_midiOnsets.clear();
+    m_midiOffsets.clear();
+    m_midiMaxOffsets.clear();
 
     m_scoreDef.Reset();
     if (m_scoreBuffer) {
@@ -97,6 +120,25 @@ void Doc::Reset()
 
     m_drawingSmuflFontSize = 0;
     m_drawingLyricFontSize = 0;
+
+    m_castOffLayoutIsValid = false;
+    m_castOffLayoutFont = NULL;
+    m_castOffLayoutSpacingLinear = 0.0;
+    m_castOffLayoutSpacingNonLinear = 0.0;
+    m_castOffLayoutEvenSpacing = false;
+    m_castOffLayoutUnit = 0;
+    m_castOffLayoutLyricFontSize = 0;
+    m_castOffLayoutLabelsWidth = 0;
+    m_castOffLayoutScoreDefWidth = 0;
+
+    // The table itself is kept and cleared when the font or the font size are set again
+    m_scaledGlyphMetricsFont = NULL;
+    m_scaledGlyphMetricsFontSize = 0;
+
+#ifdef OBJECT_ARENA
+    // All the objects have been deleted, unless some are still held elsewhere
+    ObjectArena::Reset(&m_objectArena);
+#endif
 }
 
 void Doc::SetType(DocType type)
@@ -119,6 +161,7 @@ void Doc::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -192,9 +235,8 @@ void Doc::ExportMIDI(MidiFile *midiFile)
     Functor prepareProcessingLists(&Object::PrepareProcessingLists);
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
-    // The tree is used to process each staff/layer/verse separatly
-    // For this, we use a array of AttCommmonNComparison that looks for each object if it is of the type
-    // and with @n specified
+    // The tree is used to process each staff/layer separately
+    // All the layers are processed in one single pass with Object::ProcessByLayer, each one with its own params
 
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
@@ -207,7 +249,8 @@ void Doc::ExportMIDI(MidiFile *midiFile)
     // Process notes and chords, rests, spaces layer by layer
     // track 0 (included by default) is reserved for meta messages common to all tracks
     int midiTrack = 1;
-    std::vector<AttComparison *> filters;
+    std::vector<GenerateMIDIParams> generateMIDIParams;
+    ArrayOfLayerProcessingItems items;
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
 
@@ -222,28 +265,118 @@ void Doc::ExportMIDI(MidiFile *midiFile)
         }
 
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            GenerateMIDIParams generateMIDIParams(midiFile);
-            generateMIDIParams.m_maxValues = calcMaxMeasureDurationParams.m_maxValues;
-            generateMIDIParams.m_midiTrack = midiTrack;
-            generateMIDIParams.m_transSemi = transSemi;
-            Functor generateMIDI(&Object::GenerateMIDI);
-            Functor generateMIDIEnd(&Object::GenerateMIDIEnd);
-
-            // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(&generateMIDI, &generateMIDIParams, &generateMIDIEnd, &filters);
+            GenerateMIDIParams params(midiFile, &calcMaxMeasureDurationParams.m_maxValues);
+            params.m_midiTrack = midiTrack;
+            params.m_transSemi = transSemi;
+            generateMIDIParams.push_back(params);
+            items.push_back(LayerProcessingItem(staves->first, layers->first, NULL));
+        }
+    }
+    // The params are set once the vector is filled since it can be reallocated
+    for (int i = 0; i < (int)items.size(); ++i) {
+        items.at(i).m_params = &generateMIDIParams.at(i);
+    }
+
+    Functor generateMIDI(&Object::GenerateMIDI);
+    Functor generateMIDIEnd(&Object::GenerateMIDIEnd);
+    this->ProcessByLayer(&generateMIDI, &items, &generateMIDIEnd);
+
+    // Index the notes, rests and chords played by onset for Doc::FindElementsPlayingAt
+    ArrayOfObjects elements;
+    std::vector<double> onsets;
+    std::vector<double> offsets;
+    AttComparisonAny matchType({ NOTE, REST, CHORD });
+    this->FindAllChildByAttComparison(&elements, &matchType);
+    m_midiElements.clear();
+    for (auto &object : elements) {
+        double onset, offset;
+        if (object->Is(NOTE)) {
+            Note *note = dynamic_cast<Note *>(object);
+            assert(note);
+            onset = note->m_playingOnset;
+            offset = note->m_playingOffset;
+        }
+        else if (object->Is(REST)) {
+            Rest *rest = dynamic_cast<Rest *>(object);
+            assert(rest);
+            onset = rest->m_playingOnset;
+            offset = rest->m_playingOffset;
+        }
+        else {
+            Chord *chord = dynamic_cast<Chord *>(object);
+            assert(chord);
+            onset = chord->m_playingOnset;
+            offset = chord->m_playingOffset;
         }
+        // Grace notes and chords are not played
+        if (offset <= onset) continue;
+        m_midiElements.push_back(object);
+        onsets.push_back(onset);
+        offsets.push_back(offset);
+    }
+    m_midiElementsByOnset.resize(m_midiElements.size());
+    for (int i = 0; i < (int)m_midiElements.size(); ++i) {
+        m_midiElementsByOnset.at(i) = i;
+    }
+    std::stable_sort(m_midiElementsByOnset.begin(), m_midiElementsByOnset.end(),
+        [&onsets](int i1, int i2) { return (onsets.at(i1) < onsets.at(i2)); });
+    m_midiOnsets.resize(m_midiElements.size());
+    m_midiOffsets.resize(m_midiElements.size());
+    for (int i = 0; i < (int)m_midiElementsByOnset.size(); ++i) {
+        m_midiOnsets.at(i) = onsets.at(m_midiElementsByOnset.at(i));
+        m_midiOffsets.at(i) = offsets.at(m_midiElementsByOnset.at(i));
     }
+    m_midiMaxOffsets.resize(m_midiElements.size());
+    this->IndexMidiElements(0, (int)m_midiElements.size());
 
     m_midiExportDone = true;
 }
 
+double Doc::IndexMidiElements(int begin, int end)
+{
+    if (begin >= end) return 0.0;
+
+    int root = begin + (end - begin) / 2;
+    double maxOffset = m_midiOffsets.at(root);
+    maxOffset = std::max(maxOffset, this->IndexMidiElements(begin, root));
+    maxOffset = std::max(maxOffset, this->IndexMidiElements(root + 1, end));
+    m_midiMaxOffsets.at(root) = maxOffset;
+    return maxOffset;
+}
+
+void Doc::FindMidiElements(int begin, int end, double time, std::vector<int> *indices) const
+{
+    assert(indices);
+
+    if (begin >= end) return;
+
+    // No element in the range is still played
+    int root = begin + (end - begin) / 2;
+    if (m_midiMaxOffsets.at(root) <= time) return;
+
+    this->FindMidiElements(begin, root, time, indices);
+    // The root and the elements after it in the onset order start too late
+    if (m_midiOnsets.at(root) >= time) return;
+
+    if (m_midiOffsets.at(root) > time) indices->push_back(m_midiElementsByOnset.at(root));
+    this->FindMidiElements(root + 1, end, time, indices);
+}
+
+void Doc::FindElementsPlayingAt(double time, ArrayOfObjects *elements) const
+{
+    assert(elements);
+    elements->clear();
+
+    std::vector<int> indices;
+    this->FindMidiElements(0, (int)m_midiElementsByOnset.size(), time, &indices);
+
+    // Back to the document order
+    std::sort(indices.begin(), indices.end());
+    for (auto idx : indices) {
+        elements->push_back(m_midiElements.at(idx));
+    }
+}
+
 void Doc::PrepareDrawing()
 {
     if (m_drawingPreparationDone) {
@@ -307,84 +440,77 @@ void Doc::PrepareDrawing()
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
     // The tree is used to process each staff/layer/verse separately
-    // For this, we use an array of AttCommmonNComparison that looks for each object if it is of the type
-    // and with @n specified
+    // For this, we build one processing item (with its own params) for each staff/layer and each
+    // staff/layer/verse and process all of them in one single pass with Object::ProcessByLayer. This is
+    // equivalent to processing the tree for each of them with AttCommonNComparison filters.
 
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
     IntTree_t::iterator verses;
 
-    // Process by layer for matching @tie attribute - we process notes and chords, looking at
-    // GetTie values and pitch and oct for matching notes
-    std::vector<AttComparison *> filters;
+    int layerCount = 0;
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            PrepareTieAttrParams prepareTieAttrParams;
-            Functor prepareTieAttr(&Object::PrepareTieAttr);
-            Functor prepareTieAttrEnd(&Object::PrepareTieAttrEnd);
-            this->Process(&prepareTieAttr, &prepareTieAttrParams, &prepareTieAttrEnd, &filters);
-
-            // After having processed one layer, we check if we have open ties - if yes, we
-            // must reset them and they will be ignored.
-            if (!prepareTieAttrParams.m_currentNotes.empty()) {
-                std::vector<Note *>::iterator iter;
-                for (iter = prepareTieAttrParams.m_currentNotes.begin();
-                     iter != prepareTieAttrParams.m_currentNotes.end(); iter++) {
-                    LogWarning("Unable to match @tie of note '%s', skipping it", (*iter)->GetUuid().c_str());
-                    (*iter)->ResetDrawingTieAttr();
-                }
-            }
-        }
+        layerCount += (int)staves->second.child.size();
     }
 
+    // Process by layer for matching @tie attribute - we process notes and chords, looking at
+    // GetTie values and pitch and oct for matching notes
+    std::vector<PrepareTieAttrParams> prepareTieAttrParams(layerCount);
+    ArrayOfLayerProcessingItems items;
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            PreparePointersByLayerParams preparePointersByLayerParams;
-            Functor preparePointersByLayer(&Object::PreparePointersByLayer);
-            this->Process(&preparePointersByLayer, &preparePointersByLayerParams, NULL, &filters);
+            items.push_back(
+                LayerProcessingItem(staves->first, layers->first, &prepareTieAttrParams.at(items.size())));
+        }
+    }
+    Functor prepareTieAttr(&Object::PrepareTieAttr);
+    Functor prepareTieAttrEnd(&Object::PrepareTieAttrEnd);
+    this->ProcessByLayer(&prepareTieAttr, &items, &prepareTieAttrEnd);
+
+    // After having processed the layers, we check if we have open ties - if yes, we
+    // must reset them and they will be ignored.
+    std::vector<PrepareTieAttrParams>::iterator tieParamsIter;
+    for (tieParamsIter = prepareTieAttrParams.begin(); tieParamsIter != prepareTieAttrParams.end(); ++tieParamsIter) {
+        std::vector<Note *>::iterator iter;
+        for (iter = tieParamsIter->m_currentNotes.begin(); iter != tieParamsIter->m_currentNotes.end(); iter++) {
+            LogWarning("Unable to match @tie of note '%s', skipping it", (*iter)->GetUuid().c_str());
+            (*iter)->ResetDrawingTieAttr();
         }
     }
 
+    std::vector<PreparePointersByLayerParams> preparePointersByLayerParams(layerCount);
+    for (int i = 0; i < layerCount; ++i) {
+        items.at(i).m_params = &preparePointersByLayerParams.at(i);
+    }
+    Functor preparePointersByLayer(&Object::PreparePointersByLayer);
+    this->ProcessByLayer(&preparePointersByLayer, &items);
+
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
+    // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
+    // m_drawingLastNote is set only if the syl has a forward connector
+    int verseCount = 0;
+    for (staves = prepareProcessingListsParams.m_verseTree.child.begin();
+         staves != prepareProcessingListsParams.m_verseTree.child.end(); ++staves) {
+        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
+            verseCount += (int)layers->second.child.size();
+        }
+    }
+    std::vector<PrepareLyricsParams> prepareLyricsParams(verseCount);
+    ArrayOfLayerProcessingItems verseItems;
     for (staves = prepareProcessingListsParams.m_verseTree.child.begin();
          staves != prepareProcessingListsParams.m_verseTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
-                // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
-                filters.clear();
-                // Create ad comparison object for each type / @n
-                AttCommonNComparison matchStaff(STAFF, staves->first);
-                AttCommonNComparison matchLayer(LAYER, layers->first);
-                AttCommonNComparison matchVerse(VERSE, verses->first);
-                filters.push_back(&matchStaff);
-                filters.push_back(&matchLayer);
-                filters.push_back(&matchVerse);
-
-                // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
-                // m_drawingLastNote is set only if the syl has a forward connector
-                PrepareLyricsParams prepareLyricsParams;
-                Functor prepareLyrics(&Object::PrepareLyrics);
-                Functor prepareLyricsEnd(&Object::PrepareLyricsEnd);
-                this->Process(&prepareLyrics, &prepareLyricsParams, &prepareLyricsEnd, &filters);
+                verseItems.push_back(LayerProcessingItem(
+                    staves->first, layers->first, verses->first, &prepareLyricsParams.at(verseItems.size())));
             }
         }
     }
+    Functor prepareLyrics(&Object::PrepareLyrics);
+    Functor prepareLyricsEnd(&Object::PrepareLyricsEnd);
+    this->ProcessByLayer(&prepareLyrics, &verseItems, &prepareLyricsEnd);
 
     // Once <slur>, <ties> and @ties are matched but also syl connectors, we need to set them as running
     // TimeSpanningInterface to each staff they are extended. This does not need to be done staff by staff because we
@@ -401,22 +527,13 @@ void Doc::PrepareDrawing()
     }
 
     // Process by staff for matching mRpt elements and setting the drawing number
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
-            // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
-            PrepareRptParams prepareRptParams(&m_scoreDef);
-            Functor prepareRpt(&Object::PrepareRpt);
-            this->Process(&prepareRpt, &prepareRptParams, NULL, &filters);
-        }
+    // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
+    std::vector<PrepareRptParams> prepareRptParams(layerCount, PrepareRptParams(&m_scoreDef));
+    for (int i = 0; i < layerCount; ++i) {
+        items.at(i).m_params = &prepareRptParams.at(i);
     }
+    Functor prepareRpt(&Object::PrepareRpt);
+    this->ProcessByLayer(&prepareRpt, &items);
 
     // Prepare the endings (pointers to the measure after and before the boundaries
     PrepareBoundariesParams prepareEndingsParams;
@@ -492,31 +609,55 @@ void Doc::CollectScoreDefs(bool force)
     m_currentScoreDefDone = true;
 }
 
-void Doc::CastOffDoc()
+void Doc::CastOffDoc(bool reuseLayout)
 {
     this->CollectScoreDefs();
 
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
-    contentPage->LayOutHorizontally();
+
+    // The horizontal layout of the content depends only on the font, the drawing sizes and the spacing options
+    reuseLayout = reuseLayout && m_castOffLayoutIsValid && (m_castOffLayoutFont == Resources::GetCurrentFont())
+        && (m_castOffLayoutUnit == m_drawingUnit) && (m_castOffLayoutLyricFontSize == m_drawingLyricFontSize)
+        && (m_castOffLayoutSpacingLinear == m_drawingSpacingLinear)
+        && (m_castOffLayoutSpacingNonLinear == m_drawingSpacingNonLinear)
+        && (m_castOffLayoutEvenSpacing == m_drawingEvenSpacing);
+
+    if (!reuseLayout) {
+        contentPage->LayOutHorizontally();
+    }
 
     System *contentSystem = dynamic_cast<System *>(contentPage->DetachChild(0));
     assert(contentSystem);
 
+    if (!reuseLayout) {
+        m_castOffLayoutLabelsWidth = contentSystem->GetDrawingLabelsWidth();
+        m_castOffLayoutScoreDefWidth
+            = contentPage->m_drawingScoreDef.GetDrawingWidth() + contentSystem->GetDrawingAbbrLabelsWidth();
+    }
+
     System *currentSystem = new System();
     contentPage->AddChild(currentSystem);
     CastOffSystemsParams castOffSystemsParams(contentSystem, contentPage, currentSystem);
     castOffSystemsParams.m_systemWidth = this->m_drawingPageWidth - this->m_drawingPageLeftMar
         - this->m_drawingPageRightMar - currentSystem->m_systemLeftMar - currentSystem->m_systemRightMar;
-    castOffSystemsParams.m_shift = -contentSystem->GetDrawingLabelsWidth();
-    castOffSystemsParams.m_currentScoreDefWidth
-        = contentPage->m_drawingScoreDef.GetDrawingWidth() + contentSystem->GetDrawingAbbrLabelsWidth();
+    castOffSystemsParams.m_shift = -m_castOffLayoutLabelsWidth;
+    castOffSystemsParams.m_currentScoreDefWidth = m_castOffLayoutScoreDefWidth;
+    castOffSystemsParams.m_reuseLayout = reuseLayout;
 
     Functor castOffSystems(&Object::CastOffSystems);
     Functor castOffSystemsEnd(&Object::CastOffSystemsEnd);
     contentSystem->Process(&castOffSystems, &castOffSystemsParams, &castOffSystemsEnd);
     delete contentSystem;
 
+    m_castOffLayoutIsValid = true;
+    m_castOffLayoutFont = Resources::GetCurrentFont();
+    m_castOffLayoutUnit = m_drawingUnit;
+    m_castOffLayoutLyricFontSize = m_drawingLyricFontSize;
+    m_castOffLayoutSpacingLinear = m_drawingSpacingLinear;
+    m_castOffLayoutSpacingNonLinear = m_drawingSpacingNonLinear;
+    m_castOffLayoutEvenSpacing = m_drawingEvenSpacing;
+
     // Reset the scoreDef at the beginning of each system
     this->CollectScoreDefs(true);
 
@@ -626,6 +767,28 @@ void Doc::ConvertToPageBasedDoc()
     this->ResetDrawingPage();
 }
 
+void Doc::MoveContentFrom(Doc *doc)
+{
+    assert(doc && (doc != this));
+    assert(!doc->m_scoreBuffer); // The doc needs to be page-based
+
+    DocType type = doc->GetType();
+    this->Reset();
+    m_type = type;
+
+    this->MoveChildrenFrom(doc);
+    doc->ClearRelinquishedChildren();
+    m_scoreDef.MoveChildrenFrom(&doc->m_scoreDef);
+    doc->m_scoreDef.ClearRelinquishedChildren();
+    // Copy the attributes of the scoreDef
+    m_scoreDef.ScoreDefInterface::operator=(doc->m_scoreDef);
+    m_scoreDef.AttCommon::operator=(doc->m_scoreDef);
+    m_scoreDef.AttTyped::operator=(doc->m_scoreDef);
+    m_scoreDef.AttTimebase::operator=(doc->m_scoreDef);
+    m_scoreDef.AttEndings::operator=(doc->m_scoreDef);
+    m_header.reset(doc->m_header);
+}
+
 bool Doc::HasPage(int pageIdx) const
 {
     return ((pageIdx >= 0) && (pageIdx < GetChildCount()));
@@ -641,26 +804,73 @@ bool Doc::GetMidiExportDone() const
     return m_midiExportDone;
 }
 
-int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
+void Doc::GetScaledGlyphMetrics(wchar_t code, bool graceSize, int &descender, int &width, int &height) const
 {
-    int x, y, w, h;
+    int size = (graceSize) ? 1 : 0;
+    ScaledGlyphMetrics *metrics = NULL;
+    // The table is valid only for the font it was filled with
+    if (m_scaledGlyphMetrics && (code >= SMUFL_CODE_FIRST) && (code <= SMUFL_CODE_LAST)
+        && (m_scaledGlyphMetricsFont == Resources::GetCurrentFont())) {
+        metrics = &m_scaledGlyphMetrics[code - SMUFL_CODE_FIRST];
+        if (metrics->m_isSet[size].load(std::memory_order_acquire)) {
+            descender = metrics->m_descender[size].load(std::memory_order_relaxed);
+            width = metrics->m_width[size].load(std::memory_order_relaxed);
+            height = metrics->m_height[size].load(std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    int x;
     Glyph *glyph = Resources::GetGlyph(code);
     assert(glyph);
-    glyph->GetBoundingBox(x, y, w, h);
-    h = h * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) h = h * this->m_style->m_graceNum / this->m_style->m_graceDen;
+    glyph->GetBoundingBox(x, descender, width, height);
+    descender = descender * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
+    width = width * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
+    height = height * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
+    if (graceSize) {
+        descender = descender * this->m_style->m_graceNum / this->m_style->m_graceDen;
+        width = width * this->m_style->m_graceNum / this->m_style->m_graceDen;
+        height = height * this->m_style->m_graceNum / this->m_style->m_graceDen;
+    }
+
+    // Another thread might be setting the same values at the same time, which is harmless
+    if (metrics) {
+        metrics->m_descender[size].store(descender, std::memory_order_relaxed);
+        metrics->m_width[size].store(width, std::memory_order_relaxed);
+        metrics->m_height[size].store(height, std::memory_order_relaxed);
+        metrics->m_isSet[size].store(true, std::memory_order_release);
+    }
+}
+
+void Doc::UpdateScaledGlyphMetrics()
+{
+    if ((m_scaledGlyphMetricsFont == Resources::GetCurrentFont())
+        && (m_scaledGlyphMetricsFontSize == m_drawingSmuflFontSize)) {
+        return;
+    }
+
+    const int count = SMUFL_CODE_LAST - SMUFL_CODE_FIRST + 1;
+    if (!m_scaledGlyphMetrics) m_scaledGlyphMetrics = new ScaledGlyphMetrics[count];
+    for (int i = 0; i < count; ++i) {
+        m_scaledGlyphMetrics[i].m_isSet[0].store(false, std::memory_order_relaxed);
+        m_scaledGlyphMetrics[i].m_isSet[1].store(false, std::memory_order_relaxed);
+    }
+    m_scaledGlyphMetricsFont = Resources::GetCurrentFont();
+    m_scaledGlyphMetricsFontSize = m_drawingSmuflFontSize;
+}
+
+int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
+{
+    int y, w, h;
+    GetScaledGlyphMetrics(code, graceSize, y, w, h);
     h = h * staffSize / 100;
     return h;
 }
 
 int Doc::GetGlyphWidth(wchar_t code, int staffSize, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(x, y, w, h);
-    w = w * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) w = w * this->m_style->m_graceNum / this->m_style->m_graceDen;
+    int y, w, h;
+    GetScaledGlyphMetrics(code, graceSize, y, w, h);
     w = w * staffSize / 100;
     return w;
 }
@@ -685,12 +895,8 @@ Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staf
 
 int Doc::GetGlyphDescender(wchar_t code, int staffSize, bool graceSize) const
 {
-    int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
-    assert(glyph);
-    glyph->GetBoundingBox(x, y, w, h);
-    y = y * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
-    if (graceSize) y = y * this->m_style->m_graceNum / this->m_style->m_graceDen;
+    int y, w, h;
+    GetScaledGlyphMetrics(code, graceSize, y, w, h);
     y = y * staffSize / 100;
     return y;
 }
@@ -818,16 +1024,31 @@ int Doc::GetCueSize(int value) const
 
 FontInfo *Doc::GetDrawingSmuflFont(int staffSize, bool graceSize)
 {
+    // One font per thread since pages can be drawn concurrently (see Doc::SetDrawingPages)
+    static thread_local FontInfo drawingSmuflFont;
+
     int value = m_drawingSmuflFontSize * staffSize / 100;
     if (graceSize) value = value * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    m_drawingSmuflFont.SetPointSize(value);
-    return &m_drawingSmuflFont;
+    drawingSmuflFont.SetPointSize(value);
+    return &drawingSmuflFont;
 }
 
 FontInfo *Doc::GetDrawingLyricFont(int staffSize)
 {
-    m_drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
-    return &m_drawingLyricFont;
+    static thread_local FontInfo drawingLyricFont;
+
+    drawingLyricFont.SetPointSize(this->GetDrawingLyricFontSize(staffSize));
+    return &drawingLyricFont;
+}
+
+int Doc::GetLayoutThreads() const
+{
+#ifdef USE_EMSCRIPTEN
+    return 1;
+#else
+    if (m_layoutThreads > 0) return m_layoutThreads;
+    return std::max((int)std::thread::hardware_concurrency(), 1);
+#endif
 }
 
 char Doc::GetLeftMargin(const ClassId classId) const
@@ -928,8 +1149,14 @@ Page *Doc::SetDrawingPage(int pageIdx)
     if (!HasPage(pageIdx)) {
         return NULL;
     }
+    // the drawing values are the same for all pages
+    if (m_drawingAllPages) {
+        return dynamic_cast<Page *>(this->GetChild(pageIdx));
+    }
     // nothing to do
     if (m_drawingPage && m_drawingPage->GetIdx() == pageIdx) {
+        // The font might have been changed in the meantime
+        this->UpdateScaledGlyphMetrics();
         return m_drawingPage;
     }
     m_drawingPage = dynamic_cast<Page *>(this->GetChild(pageIdx));
@@ -996,6 +1223,7 @@ Page *Doc::SetDrawingPage(int pageIdx)
     // values for fonts
     m_drawingSmuflFontSize = CalcMusicFontSize();
     m_drawingLyricFontSize = m_drawingUnit * m_style->m_lyricSize / PARAM_DENOMINATOR;
+    this->UpdateScaledGlyphMetrics();
 
     glyph_size = GetGlyphWidth(SMUFL_E0A3_noteheadHalf, 100, 0);
     m_drawingLedgerLine = glyph_size * 72 / 100;
@@ -1007,31 +1235,163 @@ Page *Doc::SetDrawingPage(int pageIdx)
     return m_drawingPage;
 }
 
+bool Doc::SetDrawingPages()
+{
+    if (this->GetType() == Transcription) return false;
+
+    ArrayOfObjects::iterator iter;
+    for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
+        Page *page = dynamic_cast<Page *>(*iter);
+        if (!page || (page->m_pageHeight != -1)) return false;
+    }
+
+    if (!this->SetDrawingPage(0)) return false;
+    m_drawingAllPages = true;
+
+    return true;
+}
+
 int Doc::CalcMusicFontSize()
 {
     return m_style->m_unit * 8;
 }
 
-int Doc::GetAdjustedDrawingPageHeight() const
+int Doc::GetAdjustedDrawingPageHeight(Page *page) const
 {
-    assert(m_drawingPage);
+    if (!page) page = m_drawingPage;
+    assert(page);
+    assert(this->IsDrawingPage(page));
 
-    if (this->GetType() == Transcription) return m_drawingPage->m_pageHeight / DEFINITION_FACTOR;
+    if (this->GetType() == Transcription) return page->m_pageHeight / DEFINITION_FACTOR;
 
-    int contentHeight = m_drawingPage->GetContentHeight();
+    int contentHeight = page->GetContentHeight();
     return (contentHeight + m_drawingPageTopMar * 2) / DEFINITION_FACTOR;
 }
 
-int Doc::GetAdjustedDrawingPageWidth() const
+int Doc::GetAdjustedDrawingPageWidth(Page *page) const
 {
-    assert(m_drawingPage);
+    if (!page) page = m_drawingPage;
+    assert(page);
+    assert(this->IsDrawingPage(page));
 
-    if (this->GetType() == Transcription) return m_drawingPage->m_pageWidth / DEFINITION_FACTOR;
+    if (this->GetType() == Transcription) return page->m_pageWidth / DEFINITION_FACTOR;
 
-    int contentWidth = m_drawingPage->GetContentWidth();
+    int contentWidth = page->GetContentWidth();
     return (contentWidth + m_drawingPageLeftMar + m_drawingPageRightMar) / DEFINITION_FACTOR;
 }
 
+void Doc::StartProcessingInThreads(const ArrayOfObjects &objects)
+{
+    ArrayOfObjects::const_iterator iter;
+    for (iter = objects.begin(); iter != objects.end(); ++iter) {
+        (*iter)->Modify();
+    }
+    ++m_processingInThreads;
+}
+
+void Doc::EndProcessingInThreads()
+{
+    assert(m_processingInThreads > 0);
+    --m_processingInThreads;
+}
+
+void Doc::ResetUuidIndex()
+{
+    m_uuidIndex.clear();
+    m_uuidIndexIsValid = false;
+}
+
+bool Doc::IsInUuidIndex(Object *object)
+{
+    assert(object);
+
+    MapOfUuidObjects::iterator iter = m_uuidIndex.find(object->GetUuid());
+    if (iter == m_uuidIndex.end()) return false;
+    if (!iter->second) {
+        this->ResetUuidIndex();
+        return false;
+    }
+    return (iter->second == object);
+}
+
+void Doc::AddObjectToUuidIndex(Object *object, bool descendants)
+{
+    assert(object);
+
+    std::unique_lock<std::mutex> lock(m_uuidIndexMutex, std::defer_lock);
+    if (this->IsProcessingInThreads()) lock.lock();
+
+    if (!m_uuidIndexIsValid) return;
+
+    // Only the objects attached to the indexed tree are added (e.g., not the alignments of the aligners)
+    if (object != this) {
+        Object *parent = object->GetParent();
+        if (!parent || !this->IsInUuidIndex(parent)) return;
+    }
+
+    AddToUuidIndexParams addToUuidIndexParams(&m_uuidIndex);
+    if (descendants) {
+        Functor addToUuidIndex(&Object::AddToUuidIndex);
+        addToUuidIndex.m_visibleOnly = false;
+        object->Process(&addToUuidIndex, &addToUuidIndexParams);
+    }
+    else {
+        object->AddToUuidIndex(&addToUuidIndexParams);
+    }
+}
+
+void Doc::RemoveObjectFromUuidIndex(Object *object, bool descendants)
+{
+    assert(object);
+
+    std::unique_lock<std::mutex> lock(m_uuidIndexMutex, std::defer_lock);
+    if (this->IsProcessingInThreads()) lock.lock();
+
+    if (!m_uuidIndexIsValid) return;
+
+    // The descendants of an object not in the index are not in it either
+    if (!this->IsInUuidIndex(object)) return;
+
+    RemoveFromUuidIndexParams removeFromUuidIndexParams(&m_uuidIndex);
+    if (descendants) {
+        Functor removeFromUuidIndex(&Object::RemoveFromUuidIndex);
+        removeFromUuidIndex.m_visibleOnly = false;
+        object->Process(&removeFromUuidIndex, &removeFromUuidIndexParams);
+    }
+    else {
+        object->RemoveFromUuidIndex(&removeFromUuidIndexParams);
+    }
+
+    // One of the uuids is not unique and we cannot know if another object with it remains in the tree
+    if (removeFromUuidIndexParams.m_notUnique) this->ResetUuidIndex();
+}
+
+bool Doc::FindInUuidIndex(const std::string &uuid, Object **object)
+{
+    assert(object);
+
+    std::unique_lock<std::mutex> lock(m_uuidIndexMutex, std::defer_lock);
+    if (this->IsProcessingInThreads()) lock.lock();
+
+    if (!m_uuidIndexIsValid) {
+        // Index all the objects, including the ones in hidden editorial elements
+        Functor addToUuidIndex(&Object::AddToUuidIndex);
+        addToUuidIndex.m_visibleOnly = false;
+        AddToUuidIndexParams addToUuidIndexParams(&m_uuidIndex);
+        this->Process(&addToUuidIndex, &addToUuidIndexParams);
+        m_uuidIndexIsValid = true;
+    }
+
+    (*object) = NULL;
+    MapOfUuidObjects::iterator iter = m_uuidIndex.find(uuid);
+    if (iter == m_uuidIndex.end()) return true;
+    // The uuid is not unique
+    if (!iter->second) return false;
+
+    (*object) = iter->second;
+    return true;
+}
+
 //----------------------------------------------------------------------------
 // Doc functors methods
 //----------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <sstream>
 #include <stdlib.h>
 
 //----------------------------------------------------------------------------
@@ -22,6 +23,26 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// Font pack helpers
+//----------------------------------------------------------------------------
+
+static void AppendPackString(std::string &pack, const std::string &value)
+{
+    Glyph::AppendPackInt(pack, (int)value.size());
+    pack.append(value);
+}
+
+static bool ReadPackString(const char *&position, const char *end, std::string &value)
+{
+    int size;
+    if (!Glyph::ReadPackInt(position, end, size)) return false;
+    if ((size < 0) || (end - position < size)) return false;
+    value.assign(position, size);
+    position += size;
+    return true;
+}
+
 //----------------------------------------------------------------------------
 // Glyph
 //----------------------------------------------------------------------------
@@ -49,13 +70,15 @@ Glyph::Glyph(std::string path, std::string codeStr)
     m_path = path;
     m_codeStr = codeStr;
 
-    pugi::xml_document doc;
-    pugi::xml_parse_result result = doc.load_file(path.c_str());
+    // The parsed file is kept for the SVG output (see SvgDeviceContext::Commit)
+    std::shared_ptr<pugi::xml_document> doc = std::make_shared<pugi::xml_document>();
+    pugi::xml_parse_result result = doc->load_file(path.c_str());
     if (!result) {
         LogError("Font file '%s' could not be loaded", path.c_str());
         return;
     }
-    pugi::xml_node root = doc.first_child();
+    m_xml = doc;
+    pugi::xml_node root = doc->first_child();
 
     // look at the viewBox attribute for getting the units per em
     if (!root.attribute("viewBox")) {
@@ -135,7 +158,87 @@ bool Glyph::HasAnchor(SMuFLGlyphAnchor anchor)
 
 const Point *Glyph::GetAnchor(SMuFLGlyphAnchor anchor)
 {
-    return &m_anchors[anchor];
+    // Do not use operator[] since glyphs are shared between threads and must not be modified
+    std::map<SMuFLGlyphAnchor, Point>::const_iterator iter = m_anchors.find(anchor);
+    if (iter == m_anchors.end()) return NULL;
+    return &iter->second;
+}
+
+void Glyph::AppendPackInt(std::string &pack, int value)
+{
+    unsigned int uValue = (unsigned int)value;
+    for (int i = 0; i < 4; ++i) {
+        pack.push_back((char)((uValue >> (8 * i)) & 0xFF));
+    }
+}
+
+bool Glyph::ReadPackInt(const char *&position, const char *end, int &value)
+{
+    if (end - position < 4) return false;
+    unsigned int uValue = 0;
+    for (int i = 0; i < 4; ++i) {
+        uValue |= (unsigned int)(unsigned char)position[i] << (8 * i);
+    }
+    value = (int)uValue;
+    position += 4;
+    return true;
+}
+
+void Glyph::WriteToPack(std::string &pack) const
+{
+    AppendPackString(pack, m_codeStr);
+    AppendPackString(pack, m_path.substr(m_path.find_last_of('/') + 1));
+    AppendPackInt(pack, m_unitsPerEm);
+    AppendPackInt(pack, m_x);
+    AppendPackInt(pack, m_y);
+    AppendPackInt(pack, m_width);
+    AppendPackInt(pack, m_height);
+    AppendPackInt(pack, m_horizAdvX);
+    AppendPackInt(pack, (int)m_anchors.size());
+    std::map<SMuFLGlyphAnchor, Point>::const_iterator iter;
+    for (iter = m_anchors.begin(); iter != m_anchors.end(); ++iter) {
+        AppendPackInt(pack, (int)iter->first);
+        AppendPackInt(pack, iter->second.x);
+        AppendPackInt(pack, iter->second.y);
+    }
+    // The declaration, comments, and indentation are not kept when parsing, so the raw output is enough
+    std::ostringstream xml;
+    if (m_xml) m_xml->save(xml, "", pugi::format_raw | pugi::format_no_declaration);
+    AppendPackString(pack, xml.str());
+}
+
+bool Glyph::ReadFromPack(const char *&position, const char *end, const std::string &dirname)
+{
+    std::string filename;
+    int anchorCount;
+    if (!ReadPackString(position, end, m_codeStr) || !ReadPackString(position, end, filename)) return false;
+    if (!ReadPackInt(position, end, m_unitsPerEm) || !ReadPackInt(position, end, m_x)
+        || !ReadPackInt(position, end, m_y) || !ReadPackInt(position, end, m_width)
+        || !ReadPackInt(position, end, m_height) || !ReadPackInt(position, end, m_horizAdvX)
+        || !ReadPackInt(position, end, anchorCount)) {
+        return false;
+    }
+    m_path = dirname + "/" + filename;
+    m_anchors.clear();
+    for (int i = 0; i < anchorCount; ++i) {
+        int anchorId, x, y;
+        if (!ReadPackInt(position, end, anchorId) || !ReadPackInt(position, end, x) || !ReadPackInt(position, end, y)) {
+            return false;
+        }
+        m_anchors[(SMuFLGlyphAnchor)anchorId] = Point(x, y);
+    }
+
+    std::string xml;
+    if (!ReadPackString(position, end, xml)) return false;
+    m_xml.reset();
+    if (xml.empty()) return true;
+    std::shared_ptr<pugi::xml_document> doc = std::make_shared<pugi::xml_document>();
+    if (!doc->load_buffer(xml.data(), xml.size())) {
+        LogError("Font pack content for '%s' could not be loaded", m_path.c_str());
+        return false;
+    }
+    m_xml = doc;
+    return true;
 }
 
 } // namespace vrv
@@ -49,30 +49,25 @@ void HorizontalAligner::Reset()
 
 Alignment *HorizontalAligner::SearchAlignmentAtTime(double time, AlignmentType type, int &idx)
 {
-    int i;
     idx = -1; // the index if we reach the end.
-    Alignment *alignment = NULL;
-    // First try to see if we already have something at the time position
-    for (i = 0; i < GetAlignmentCount(); i++) {
-        alignment = dynamic_cast<Alignment *>(m_children.at(i));
-        assert(alignment);
+    // The alignments are sorted by time and type, so we look for the first one at the time position with a type that is
+    // not lower, or the first one after the time position. The children are all Alignment objects.
+    ArrayOfObjects::iterator iter
+        = std::partition_point(m_children.begin(), m_children.end(), [time, type](Object *child) {
+              Alignment *alignment = static_cast<Alignment *>(child);
+              if (alignment->GetTime() > time) return false;
+              if (AreEqual(alignment->GetTime(), time)) return (alignment->GetType() < type);
+              return true;
+          });
+    // nothing found until the end
+    if (iter == m_children.end()) return NULL;
 
-        double alignment_time = alignment->GetTime();
-        if (AreEqual(alignment_time, time)) {
-            if (alignment->GetType() == type) {
-                return alignment;
-            }
-            else if (alignment->GetType() > type) {
-                idx = i;
-                break;
-            }
-        }
-        // nothing found, do not go any further but keep the index
-        if (alignment->GetTime() > time) {
-            idx = i;
-            break;
-        }
-    }
+    // we already have an alignment of the type at that time
+    Alignment *alignment = static_cast<Alignment *>(*iter);
+    if (AreEqual(alignment->GetTime(), time) && (alignment->GetType() == type)) return alignment;
+
+    // nothing found, keep the index
+    idx = (int)(iter - m_children.begin());
     return NULL;
 }
 
@@ -678,28 +673,25 @@ void TimestampAligner::Reset()
 
 TimestampAttr *TimestampAligner::GetTimestampAtTime(double time)
 {
-    int i;
     int idx = -1; // the index if we reach the end.
     // We need to adjust the position since timestamp 0 to 1.0 are before 0 musical time
     time = time - 1.0;
-    TimestampAttr *timestampAttr = NULL;
     // First try to see if we already have something at the time position
-    for (i = 0; i < GetChildCount(); i++) {
-        timestampAttr = dynamic_cast<TimestampAttr *>(m_children.at(i));
-        assert(timestampAttr);
-
-        double alignmentTime = timestampAttr->GetActualDurPos();
-        if (AreEqual(alignmentTime, time)) {
+    // The timestamps are sorted by position and the children are all TimestampAttr objects
+    ArrayOfObjects::iterator iter = std::partition_point(m_children.begin(), m_children.end(), [time](Object *child) {
+        double alignmentTime = static_cast<TimestampAttr *>(child)->GetActualDurPos();
+        return (!AreEqual(alignmentTime, time) && (alignmentTime <= time));
+    });
+    if (iter != m_children.end()) {
+        TimestampAttr *timestampAttr = static_cast<TimestampAttr *>(*iter);
+        if (AreEqual(timestampAttr->GetActualDurPos(), time)) {
             return timestampAttr;
         }
         // nothing found, do not go any further but keep the index
-        if (alignmentTime > time) {
-            idx = i;
-            break;
-        }
+        idx = (int)(iter - m_children.begin());
     }
     // nothing found
-    timestampAttr = new TimestampAttr();
+    TimestampAttr *timestampAttr = new TimestampAttr();
     timestampAttr->SetDrawingPos(time);
     timestampAttr->SetParent(this);
     if (idx == -1) {
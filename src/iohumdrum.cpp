@@ -289,6 +289,8 @@ HumdrumInput::HumdrumInput(Doc *doc, std::string filename) : FileInputStream(doc
 
 #ifndef NO_HUMDRUM_SUPPORT
     m_filename = filename;
+    m_harm = false;
+    m_fb = false;
 #endif /* NO_HUMDRUM_SUPPORT */
 }
 
@@ -6433,6 +6435,8 @@ void HumdrumInput::storeOriginalClefMensurationApp(void)
     Rdg *rdg = new Rdg;
     app->AddChild(rdg);
     rdg->SetLabel("original-clef");
+    // Only the <lem> is visible, as when the <app> is read from MEI without xpath query
+    rdg->m_visibility = Hidden;
 
     ScoreDef *scoredef = new ScoreDef;
     rdg->AddChild(scoredef);
@@ -6748,7 +6752,20 @@ static const EntityNameEntry StaticEntityNames[] = {
 
 typedef std::map<std::string, unsigned int> EntityNameMap;
 typedef std::pair<std::string, unsigned int> EntityNamePair;
-static EntityNameMap EntityNames;
+
+static EntityNameMap LoadEntityNames()
+{
+    /* load EntityNames from StaticEntityNames */
+    EntityNameMap entityNames;
+    const EntityNameEntry *ThisEntry;
+    ThisEntry = StaticEntityNames;
+    for (;;) {
+        if (ThisEntry->Name == NULL) break;
+        entityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
+        ++ThisEntry;
+    }
+    return entityNames;
+}
 
 //////////////////////////////
 //
@@ -6834,16 +6851,8 @@ void HumdrumInput::UnquoteHTML(std::istream &In, std::ostream &Out)
                     ProcessedChar = true;
                 }
                 else if (ThisCh == ';') {
-                    if (EntityNames.empty()) {
-                        /* first use, load EntityNames from StaticEntityNames */
-                        const EntityNameEntry *ThisEntry;
-                        ThisEntry = StaticEntityNames;
-                        for (;;) {
-                            if (ThisEntry->Name == NULL) break;
-                            EntityNames.insert(EntityNamePair(std::string(ThisEntry->Name), ThisEntry->Value));
-                            ++ThisEntry;
-                        }
-                    }
+                    /* loaded on first use - the initialization of a local static is thread-safe */
+                    static const EntityNameMap EntityNames = LoadEntityNames();
                     const EntityNameMap::const_iterator NameEntry = EntityNames.find(MatchingName);
                     if (NameEntry != EntityNames.end()) {
                         CharCode = NameEntry->second;
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #include <iostream>
 
@@ -1917,8 +1918,8 @@ bool MeiInput::ReadMeiSection(Object *parent, pugi::xml_node section)
     Section *vrvSection = new Section();
     SetMeiUuid(section, vrvSection);
 
-    vrvSection->ReadCommon(section);
-    vrvSection->ReadCommonPart(section);
+    vrvSection->ReadCommon(section, &m_consumedAttrs);
+    vrvSection->ReadCommonPart(section, &m_consumedAttrs);
 
     parent->AddChild(vrvSection);
     if (m_readingScoreBased)
@@ -1995,8 +1996,8 @@ bool MeiInput::ReadMeiSectionChildren(Object *parent, pugi::xml_node parentNode)
 bool MeiInput::ReadSystemElement(pugi::xml_node element, SystemElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadTyped(element);
+    object->ReadCommon(element, &m_consumedAttrs);
+    object->ReadTyped(element, &m_consumedAttrs);
 
     return true;
 }
@@ -2018,8 +2019,8 @@ bool MeiInput::ReadMeiExpansion(Object *parent, pugi::xml_node expansion)
     Expansion *vrvExpansion = new Expansion();
     ReadSystemElement(expansion, vrvExpansion);
 
-    vrvExpansion->ReadCommonPart(expansion);
-    vrvExpansion->ReadPlist(expansion);
+    vrvExpansion->ReadCommonPart(expansion, &m_consumedAttrs);
+    vrvExpansion->ReadPlist(expansion, &m_consumedAttrs);
 
     parent->AddChild(vrvExpansion);
     if (m_readingScoreBased)
@@ -2126,8 +2127,8 @@ bool MeiInput::ReadMeiSystem(Object *parent, pugi::xml_node system)
 
     System *vrvSystem = new System();
     SetMeiUuid(system, vrvSystem);
-    vrvSystem->ReadCommon(system);
-    vrvSystem->ReadTyped(system);
+    vrvSystem->ReadCommon(system, &m_consumedAttrs);
+    vrvSystem->ReadTyped(system, &m_consumedAttrs);
 
     if (system.attribute("system.leftmar")) {
         vrvSystem->m_systemLeftMar = atoi(system.attribute("system.leftmar").value());
@@ -2226,9 +2227,9 @@ bool MeiInput::ReadMeiBoundaryEnd(Object *parent, pugi::xml_node boundaryEnd)
 bool MeiInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadTyped(element);
-    object->ReadTimebase(element);
+    object->ReadCommon(element, &m_consumedAttrs);
+    object->ReadTyped(element, &m_consumedAttrs);
+    object->ReadTimebase(element, &m_consumedAttrs);
 
     return true;
 }
@@ -2248,7 +2249,7 @@ bool MeiInput::ReadMeiScoreDef(Object *parent, pugi::xml_node scoreDef)
     ReadScoreDefElement(scoreDef, vrvScoreDef);
 
     ReadScoreDefInterface(scoreDef, vrvScoreDef);
-    vrvScoreDef->ReadEndings(scoreDef);
+    vrvScoreDef->ReadEndings(scoreDef, &m_consumedAttrs);
 
     if (!m_hasScoreDef) {
         m_hasScoreDef = true;
@@ -2289,13 +2290,13 @@ bool MeiInput::ReadMeiStaffGrp(Object *parent, pugi::xml_node staffGrp)
     StaffGrp *vrvStaffGrp = new StaffGrp();
     SetMeiUuid(staffGrp, vrvStaffGrp);
 
-    vrvStaffGrp->ReadCommon(staffGrp);
-    vrvStaffGrp->ReadCommonPart(staffGrp);
-    vrvStaffGrp->ReadLabelsAddl(staffGrp);
-    vrvStaffGrp->ReadStaffGrpVis(staffGrp);
-    vrvStaffGrp->ReadStaffgroupingsym(staffGrp);
-    vrvStaffGrp->ReadTyped(staffGrp);
-    vrvStaffGrp->ReadMidiinstrument(staffGrp);
+    vrvStaffGrp->ReadCommon(staffGrp, &m_consumedAttrs);
+    vrvStaffGrp->ReadCommonPart(staffGrp, &m_consumedAttrs);
+    vrvStaffGrp->ReadLabelsAddl(staffGrp, &m_consumedAttrs);
+    vrvStaffGrp->ReadStaffGrpVis(staffGrp, &m_consumedAttrs);
+    vrvStaffGrp->ReadStaffgroupingsym(staffGrp, &m_consumedAttrs);
+    vrvStaffGrp->ReadTyped(staffGrp, &m_consumedAttrs);
+    vrvStaffGrp->ReadMidiinstrument(staffGrp, &m_consumedAttrs);
 
     parent->AddChild(vrvStaffGrp);
     return ReadMeiStaffGrpChildren(vrvStaffGrp, staffGrp);
@@ -2334,14 +2335,14 @@ bool MeiInput::ReadMeiStaffDef(Object *parent, pugi::xml_node staffDef)
     StaffDef *vrvStaffDef = new StaffDef();
     ReadScoreDefElement(staffDef, vrvStaffDef);
 
-    vrvStaffDef->ReadCommonPart(staffDef);
-    vrvStaffDef->ReadDistances(staffDef);
-    vrvStaffDef->ReadLabelsAddl(staffDef);
-    vrvStaffDef->ReadNotationtype(staffDef);
-    vrvStaffDef->ReadScalable(staffDef);
-    vrvStaffDef->ReadStaffDefVis(staffDef);
-    vrvStaffDef->ReadTransposition(staffDef);
-    vrvStaffDef->ReadMidiinstrument(staffDef);
+    vrvStaffDef->ReadCommonPart(staffDef, &m_consumedAttrs);
+    vrvStaffDef->ReadDistances(staffDef, &m_consumedAttrs);
+    vrvStaffDef->ReadLabelsAddl(staffDef, &m_consumedAttrs);
+    vrvStaffDef->ReadNotationtype(staffDef, &m_consumedAttrs);
+    vrvStaffDef->ReadScalable(staffDef, &m_consumedAttrs);
+    vrvStaffDef->ReadStaffDefVis(staffDef, &m_consumedAttrs);
+    vrvStaffDef->ReadTransposition(staffDef, &m_consumedAttrs);
+    vrvStaffDef->ReadMidiinstrument(staffDef, &m_consumedAttrs);
 
     if (!vrvStaffDef->HasN()) {
         LogWarning("No @n on <staffDef> might yield unpredictable results");
@@ -2358,10 +2359,10 @@ bool MeiInput::ReadMeiMeasure(Object *parent, pugi::xml_node measure)
     Measure *vrvMeasure = new Measure();
     SetMeiUuid(measure, vrvMeasure);
 
-    vrvMeasure->ReadCommon(measure);
-    vrvMeasure->ReadMeasureLog(measure);
-    vrvMeasure->ReadPointing(measure);
-    vrvMeasure->ReadTyped(measure);
+    vrvMeasure->ReadCommon(measure, &m_consumedAttrs);
+    vrvMeasure->ReadMeasureLog(measure, &m_consumedAttrs);
+    vrvMeasure->ReadPointing(measure, &m_consumedAttrs);
+    vrvMeasure->ReadTyped(measure, &m_consumedAttrs);
 
     if (measure.attribute("ulx") && measure.attribute("lrx") && (this->m_doc->GetType() == Transcription)) {
         vrvMeasure->m_xAbs = atoi(measure.attribute("ulx").value()) * DEFINITION_FACTOR;
@@ -2449,9 +2450,9 @@ bool MeiInput::ReadMeiMeasureChildren(Object *parent, pugi::xml_node parentNode)
 bool MeiInput::ReadControlElement(pugi::xml_node element, ControlElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadCommonPart(element);
-    object->ReadTyped(element);
+    object->ReadCommon(element, &m_consumedAttrs);
+    object->ReadCommonPart(element, &m_consumedAttrs);
+    object->ReadTyped(element, &m_consumedAttrs);
 
     return true;
 }
@@ -2473,8 +2474,8 @@ bool MeiInput::ReadMeiBreath(Object *parent, pugi::xml_node breath)
     ReadControlElement(breath, vrvBreath);
 
     ReadTimePointInterface(breath, vrvBreath);
-    vrvBreath->ReadColor(breath);
-    vrvBreath->ReadPlacement(breath);
+    vrvBreath->ReadColor(breath, &m_consumedAttrs);
+    vrvBreath->ReadPlacement(breath, &m_consumedAttrs);
 
     parent->AddChild(vrvBreath);
     return ReadMeiTextChildren(vrvBreath, breath, vrvBreath);
@@ -2487,7 +2488,7 @@ bool MeiInput::ReadMeiDir(Object *parent, pugi::xml_node dir)
 
     ReadTextDirInterface(dir, vrvDir);
     ReadTimeSpanningInterface(dir, vrvDir);
-    vrvDir->ReadLang(dir);
+    vrvDir->ReadLang(dir, &m_consumedAttrs);
 
     parent->AddChild(vrvDir);
     return ReadMeiTextChildren(vrvDir, dir, vrvDir);
@@ -2511,9 +2512,9 @@ bool MeiInput::ReadMeiFermata(Object *parent, pugi::xml_node fermata)
     ReadControlElement(fermata, vrvFermata);
 
     ReadTimePointInterface(fermata, vrvFermata);
-    vrvFermata->ReadColor(fermata);
-    vrvFermata->ReadFermataVis(fermata);
-    vrvFermata->ReadPlacement(fermata);
+    vrvFermata->ReadColor(fermata, &m_consumedAttrs);
+    vrvFermata->ReadFermataVis(fermata, &m_consumedAttrs);
+    vrvFermata->ReadPlacement(fermata, &m_consumedAttrs);
 
     parent->AddChild(vrvFermata);
     return true;
@@ -2525,9 +2526,9 @@ bool MeiInput::ReadMeiHairpin(Object *parent, pugi::xml_node hairpin)
     ReadControlElement(hairpin, vrvHairpin);
 
     ReadTimeSpanningInterface(hairpin, vrvHairpin);
-    vrvHairpin->ReadColor(hairpin);
-    vrvHairpin->ReadHairpinLog(hairpin);
-    vrvHairpin->ReadPlacement(hairpin);
+    vrvHairpin->ReadColor(hairpin, &m_consumedAttrs);
+    vrvHairpin->ReadHairpinLog(hairpin, &m_consumedAttrs);
+    vrvHairpin->ReadPlacement(hairpin, &m_consumedAttrs);
 
     parent->AddChild(vrvHairpin);
     return true;
@@ -2540,7 +2541,7 @@ bool MeiInput::ReadMeiHarm(Object *parent, pugi::xml_node harm)
 
     ReadTextDirInterface(harm, vrvHarm);
     ReadTimeSpanningInterface(harm, vrvHarm);
-    vrvHarm->ReadLang(harm);
+    vrvHarm->ReadLang(harm, &m_consumedAttrs);
 
     parent->AddChild(vrvHarm);
     return ReadMeiTextChildren(vrvHarm, harm, vrvHarm);
@@ -2552,10 +2553,10 @@ bool MeiInput::ReadMeiMordent(Object *parent, pugi::xml_node mordent)
     ReadControlElement(mordent, vrvMordent);
 
     ReadTimePointInterface(mordent, vrvMordent);
-    vrvMordent->ReadColor(mordent);
-    vrvMordent->ReadOrnamentaccid(mordent);
-    vrvMordent->ReadPlacement(mordent);
-    vrvMordent->ReadMordentLog(mordent);
+    vrvMordent->ReadColor(mordent, &m_consumedAttrs);
+    vrvMordent->ReadOrnamentaccid(mordent, &m_consumedAttrs);
+    vrvMordent->ReadPlacement(mordent, &m_consumedAttrs);
+    vrvMordent->ReadMordentLog(mordent, &m_consumedAttrs);
 
     parent->AddChild(vrvMordent);
     return true;
@@ -2567,9 +2568,9 @@ bool MeiInput::ReadMeiOctave(Object *parent, pugi::xml_node octave)
     ReadControlElement(octave, vrvOctave);
 
     ReadTimeSpanningInterface(octave, vrvOctave);
-    vrvOctave->ReadColor(octave);
-    vrvOctave->ReadLinerendBase(octave);
-    vrvOctave->ReadOctavedisplacement(octave);
+    vrvOctave->ReadColor(octave, &m_consumedAttrs);
+    vrvOctave->ReadLinerendBase(octave, &m_consumedAttrs);
+    vrvOctave->ReadOctavedisplacement(octave, &m_consumedAttrs);
 
     parent->AddChild(vrvOctave);
     return true;
@@ -2581,9 +2582,9 @@ bool MeiInput::ReadMeiPedal(Object *parent, pugi::xml_node pedal)
     ReadControlElement(pedal, vrvPedal);
 
     ReadTimePointInterface(pedal, vrvPedal);
-    vrvPedal->ReadColor(pedal);
-    vrvPedal->ReadPedalLog(pedal);
-    vrvPedal->ReadPlacement(pedal);
+    vrvPedal->ReadColor(pedal, &m_consumedAttrs);
+    vrvPedal->ReadPedalLog(pedal, &m_consumedAttrs);
+    vrvPedal->ReadPlacement(pedal, &m_consumedAttrs);
 
     parent->AddChild(vrvPedal);
     return true;
@@ -2595,8 +2596,8 @@ bool MeiInput::ReadMeiSlur(Object *parent, pugi::xml_node slur)
     ReadControlElement(slur, vrvSlur);
 
     ReadTimeSpanningInterface(slur, vrvSlur);
-    vrvSlur->ReadColor(slur);
-    vrvSlur->ReadCurvature(slur);
+    vrvSlur->ReadColor(slur, &m_consumedAttrs);
+    vrvSlur->ReadCurvature(slur, &m_consumedAttrs);
 
     parent->AddChild(vrvSlur);
     return true;
@@ -2609,9 +2610,9 @@ bool MeiInput::ReadMeiTempo(Object *parent, pugi::xml_node tempo)
 
     ReadTextDirInterface(tempo, vrvTempo);
     ReadTimePointInterface(tempo, vrvTempo);
-    vrvTempo->ReadLang(tempo);
-    vrvTempo->ReadMiditempo(tempo);
-    vrvTempo->ReadMmtempo(tempo);
+    vrvTempo->ReadLang(tempo, &m_consumedAttrs);
+    vrvTempo->ReadMiditempo(tempo, &m_consumedAttrs);
+    vrvTempo->ReadMmtempo(tempo, &m_consumedAttrs);
 
     parent->AddChild(vrvTempo);
     return ReadMeiTextChildren(vrvTempo, tempo, vrvTempo);
@@ -2623,8 +2624,8 @@ bool MeiInput::ReadMeiTie(Object *parent, pugi::xml_node tie)
     ReadControlElement(tie, vrvTie);
 
     ReadTimeSpanningInterface(tie, vrvTie);
-    vrvTie->ReadColor(tie);
-    vrvTie->ReadCurvature(tie);
+    vrvTie->ReadColor(tie, &m_consumedAttrs);
+    vrvTie->ReadCurvature(tie, &m_consumedAttrs);
 
     parent->AddChild(vrvTie);
     return true;
@@ -2636,9 +2637,9 @@ bool MeiInput::ReadMeiTrill(Object *parent, pugi::xml_node trill)
     ReadControlElement(trill, vrvTrill);
 
     ReadTimePointInterface(trill, vrvTrill);
-    vrvTrill->ReadColor(trill);
-    vrvTrill->ReadOrnamentaccid(trill);
-    vrvTrill->ReadPlacement(trill);
+    vrvTrill->ReadColor(trill, &m_consumedAttrs);
+    vrvTrill->ReadOrnamentaccid(trill, &m_consumedAttrs);
+    vrvTrill->ReadPlacement(trill, &m_consumedAttrs);
 
     parent->AddChild(vrvTrill);
     return true;
@@ -2650,10 +2651,10 @@ bool MeiInput::ReadMeiTurn(Object *parent, pugi::xml_node turn)
     ReadControlElement(turn, vrvTurn);
 
     ReadTimePointInterface(turn, vrvTurn);
-    vrvTurn->ReadColor(turn);
-    vrvTurn->ReadOrnamentaccid(turn);
-    vrvTurn->ReadPlacement(turn);
-    vrvTurn->ReadTurnLog(turn);
+    vrvTurn->ReadColor(turn, &m_consumedAttrs);
+    vrvTurn->ReadOrnamentaccid(turn, &m_consumedAttrs);
+    vrvTurn->ReadPlacement(turn, &m_consumedAttrs);
+    vrvTurn->ReadTurnLog(turn, &m_consumedAttrs);
 
     parent->AddChild(vrvTurn);
     return true;
@@ -2696,9 +2697,9 @@ bool MeiInput::ReadMeiStaff(Object *parent, pugi::xml_node staff)
     Staff *vrvStaff = new Staff();
     SetMeiUuid(staff, vrvStaff);
 
-    vrvStaff->ReadCommon(staff);
-    vrvStaff->ReadTyped(staff);
-    vrvStaff->ReadVisibility(staff);
+    vrvStaff->ReadCommon(staff, &m_consumedAttrs);
+    vrvStaff->ReadTyped(staff, &m_consumedAttrs);
+    vrvStaff->ReadVisibility(staff, &m_consumedAttrs);
 
     if (staff.attribute("uly") && (this->m_doc->GetType() == Transcription)) {
         vrvStaff->m_yAbs = atoi(staff.attribute("uly").value()) * DEFINITION_FACTOR;
@@ -2740,9 +2741,9 @@ bool MeiInput::ReadMeiLayer(Object *parent, pugi::xml_node layer)
     Layer *vrvLayer = new Layer();
     SetMeiUuid(layer, vrvLayer);
 
-    vrvLayer->ReadCommon(layer);
-    vrvLayer->ReadTyped(layer);
-    vrvLayer->ReadVisibility(layer);
+    vrvLayer->ReadCommon(layer, &m_consumedAttrs);
+    vrvLayer->ReadTyped(layer, &m_consumedAttrs);
+    vrvLayer->ReadVisibility(layer, &m_consumedAttrs);
 
     if (!vrvLayer->HasN()) {
         LogWarning("No @n on <layer>, 1 is set");
@@ -2874,9 +2875,9 @@ bool MeiInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
     }
 
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadCommonPart(element);
-    object->ReadTyped(element);
+    object->ReadCommon(element, &m_consumedAttrs);
+    object->ReadCommonPart(element, &m_consumedAttrs);
+    object->ReadTyped(element, &m_consumedAttrs);
 
     return true;
 }
@@ -2887,11 +2888,11 @@ bool MeiInput::ReadMeiAccid(Object *parent, pugi::xml_node accid)
     ReadLayerElement(accid, vrvAccid);
 
     ReadPositionInterface(accid, vrvAccid);
-    vrvAccid->ReadAccidental(accid);
-    vrvAccid->ReadAccidentalPerformed(accid);
-    vrvAccid->ReadAccidLog(accid);
-    vrvAccid->ReadColor(accid);
-    vrvAccid->ReadEnclosingchars(accid);
+    vrvAccid->ReadAccidental(accid, &m_consumedAttrs);
+    vrvAccid->ReadAccidentalPerformed(accid, &m_consumedAttrs);
+    vrvAccid->ReadAccidLog(accid, &m_consumedAttrs);
+    vrvAccid->ReadColor(accid, &m_consumedAttrs);
+    vrvAccid->ReadEnclosingchars(accid, &m_consumedAttrs);
 
     parent->AddChild(vrvAccid);
     return true;
@@ -2902,9 +2903,9 @@ bool MeiInput::ReadMeiArtic(Object *parent, pugi::xml_node artic)
     Artic *vrvArtic = new Artic();
     ReadLayerElement(artic, vrvArtic);
 
-    vrvArtic->ReadArticulation(artic);
-    vrvArtic->ReadColor(artic);
-    vrvArtic->ReadPlacement(artic);
+    vrvArtic->ReadArticulation(artic, &m_consumedAttrs);
+    vrvArtic->ReadColor(artic, &m_consumedAttrs);
+    vrvArtic->ReadPlacement(artic, &m_consumedAttrs);
 
     parent->AddChild(vrvArtic);
     return true;
@@ -2915,8 +2916,8 @@ bool MeiInput::ReadMeiBarLine(Object *parent, pugi::xml_node barLine)
     BarLine *vrvBarLine = new BarLine();
     ReadLayerElement(barLine, vrvBarLine);
 
-    vrvBarLine->ReadBarLineLog(barLine);
-    vrvBarLine->ReadColor(barLine);
+    vrvBarLine->ReadBarLineLog(barLine, &m_consumedAttrs);
+    vrvBarLine->ReadColor(barLine, &m_consumedAttrs);
 
     parent->AddChild(vrvBarLine);
     return true;
@@ -2927,7 +2928,7 @@ bool MeiInput::ReadMeiBeam(Object *parent, pugi::xml_node beam)
     Beam *vrvBeam = new Beam();
     ReadLayerElement(beam, vrvBeam);
 
-    vrvBeam->ReadColor(beam);
+    vrvBeam->ReadColor(beam, &m_consumedAttrs);
 
     parent->AddChild(vrvBeam);
 
@@ -2939,8 +2940,8 @@ bool MeiInput::ReadMeiBeatRpt(Object *parent, pugi::xml_node beatRpt)
     BeatRpt *vrvBeatRpt = new BeatRpt();
     ReadLayerElement(beatRpt, vrvBeatRpt);
 
-    vrvBeatRpt->ReadColor(beatRpt);
-    vrvBeatRpt->ReadBeatRptVis(beatRpt);
+    vrvBeatRpt->ReadColor(beatRpt, &m_consumedAttrs);
+    vrvBeatRpt->ReadBeatRptVis(beatRpt, &m_consumedAttrs);
 
     parent->AddChild(vrvBeatRpt);
     return true;
@@ -2951,7 +2952,7 @@ bool MeiInput::ReadMeiBTrem(Object *parent, pugi::xml_node bTrem)
     BTrem *vrvBTrem = new BTrem();
     ReadLayerElement(bTrem, vrvBTrem);
 
-    vrvBTrem->ReadTremmeasured(bTrem);
+    vrvBTrem->ReadTremmeasured(bTrem, &m_consumedAttrs);
 
     parent->AddChild(vrvBTrem);
     return ReadMeiLayerChildren(vrvBTrem, bTrem, vrvBTrem);
@@ -2963,16 +2964,16 @@ bool MeiInput::ReadMeiChord(Object *parent, pugi::xml_node chord)
     ReadLayerElement(chord, vrvChord);
 
     ReadDurationInterface(chord, vrvChord);
-    vrvChord->ReadColor(chord);
-    vrvChord->ReadGraced(chord);
-    vrvChord->ReadRelativesize(chord);
-    vrvChord->ReadStems(chord);
-    vrvChord->ReadStemsCmn(chord);
-    vrvChord->ReadTiepresent(chord);
-    vrvChord->ReadVisibility(chord);
+    vrvChord->ReadColor(chord, &m_consumedAttrs);
+    vrvChord->ReadGraced(chord, &m_consumedAttrs);
+    vrvChord->ReadRelativesize(chord, &m_consumedAttrs);
+    vrvChord->ReadStems(chord, &m_consumedAttrs);
+    vrvChord->ReadStemsCmn(chord, &m_consumedAttrs);
+    vrvChord->ReadTiepresent(chord, &m_consumedAttrs);
+    vrvChord->ReadVisibility(chord, &m_consumedAttrs);
 
     AttArticulation artic;
-    artic.ReadArticulation(chord);
+    artic.ReadArticulation(chord, &m_consumedAttrs);
     if (artic.HasArtic()) {
         Artic *vrvArtic = new Artic();
         vrvArtic->IsAttribute(true);
@@ -2989,11 +2990,11 @@ bool MeiInput::ReadMeiClef(Object *parent, pugi::xml_node clef)
     Clef *vrvClef = new Clef();
     ReadLayerElement(clef, vrvClef);
 
-    vrvClef->ReadClefshape(clef);
-    vrvClef->ReadColor(clef);
-    vrvClef->ReadLineloc(clef);
-    vrvClef->ReadOctavedisplacement(clef);
-    vrvClef->ReadStaffident(clef);
+    vrvClef->ReadClefshape(clef, &m_consumedAttrs);
+    vrvClef->ReadColor(clef, &m_consumedAttrs);
+    vrvClef->ReadLineloc(clef, &m_consumedAttrs);
+    vrvClef->ReadOctavedisplacement(clef, &m_consumedAttrs);
+    vrvClef->ReadStaffident(clef, &m_consumedAttrs);
 
     parent->AddChild(vrvClef);
     return true;
@@ -3006,7 +3007,7 @@ bool MeiInput::ReadMeiCustos(Object *parent, pugi::xml_node custos)
 
     ReadPositionInterface(custos, vrvCustos);
 
-    vrvCustos->ReadColor(custos);
+    vrvCustos->ReadColor(custos, &m_consumedAttrs);
 
     parent->AddChild(vrvCustos);
     return true;
@@ -3018,8 +3019,8 @@ bool MeiInput::ReadMeiDot(Object *parent, pugi::xml_node dot)
     ReadLayerElement(dot, vrvDot);
 
     ReadPositionInterface(dot, vrvDot);
-    vrvDot->ReadColor(dot);
-    vrvDot->ReadDotLog(dot);
+    vrvDot->ReadColor(dot, &m_consumedAttrs);
+    vrvDot->ReadDotLog(dot, &m_consumedAttrs);
 
     parent->AddChild(vrvDot);
     return true;
@@ -3030,8 +3031,8 @@ bool MeiInput::ReadMeiFTrem(Object *parent, pugi::xml_node fTrem)
     FTrem *vrvFTrem = new FTrem();
     ReadLayerElement(fTrem, vrvFTrem);
 
-    vrvFTrem->ReadSlashcount(fTrem);
-    vrvFTrem->ReadTremmeasured(fTrem);
+    vrvFTrem->ReadSlashcount(fTrem, &m_consumedAttrs);
+    vrvFTrem->ReadTremmeasured(fTrem, &m_consumedAttrs);
 
     parent->AddChild(vrvFTrem);
     return ReadMeiLayerChildren(vrvFTrem, fTrem, vrvFTrem);
@@ -3042,8 +3043,8 @@ bool MeiInput::ReadMeiKeySig(Object *parent, pugi::xml_node keySig)
     KeySig *vrvKeySig = new KeySig();
     ReadLayerElement(keySig, vrvKeySig);
 
-    vrvKeySig->ReadAccidental(keySig);
-    vrvKeySig->ReadPitch(keySig);
+    vrvKeySig->ReadAccidental(keySig, &m_consumedAttrs);
+    vrvKeySig->ReadPitch(keySig, &m_consumedAttrs);
 
     // special processing required
     vrvKeySig->ConvertToInternal();
@@ -3058,9 +3059,9 @@ bool MeiInput::ReadMeiLigature(Object *parent, pugi::xml_node ligature)
     SetMeiUuid(ligature, vrvLigature);
 
     ReadDurationInterface(ligature, vrvLigature);
-    vrvLigature->ReadStems(ligature);
-    vrvLigature->ReadStemsCmn(ligature);
-    vrvLigature->ReadTiepresent(ligature);
+    vrvLigature->ReadStems(ligature, &m_consumedAttrs);
+    vrvLigature->ReadStemsCmn(ligature, &m_consumedAttrs);
+    vrvLigature->ReadTiepresent(ligature, &m_consumedAttrs);
 
     parent->AddChild(vrvLigature);
     return ReadMeiLayerChildren(vrvLigature, ligature, vrvLigature);
@@ -3071,13 +3072,13 @@ bool MeiInput::ReadMeiMensur(Object *parent, pugi::xml_node mensur)
     Mensur *vrvMensur = new Mensur();
     ReadLayerElement(mensur, vrvMensur);
 
-    vrvMensur->ReadColor(mensur);
-    vrvMensur->ReadDurationRatio(mensur);
-    vrvMensur->ReadMensuralShared(mensur);
-    vrvMensur->ReadMensurLog(mensur);
-    vrvMensur->ReadMensurVis(mensur);
-    vrvMensur->ReadRelativesize(mensur);
-    vrvMensur->ReadSlashcount(mensur);
+    vrvMensur->ReadColor(mensur, &m_consumedAttrs);
+    vrvMensur->ReadDurationRatio(mensur, &m_consumedAttrs);
+    vrvMensur->ReadMensuralShared(mensur, &m_consumedAttrs);
+    vrvMensur->ReadMensurLog(mensur, &m_consumedAttrs);
+    vrvMensur->ReadMensurVis(mensur, &m_consumedAttrs);
+    vrvMensur->ReadRelativesize(mensur, &m_consumedAttrs);
+    vrvMensur->ReadSlashcount(mensur, &m_consumedAttrs);
 
     parent->AddChild(vrvMensur);
     return true;
@@ -3088,8 +3089,8 @@ bool MeiInput::ReadMeiMeterSig(Object *parent, pugi::xml_node meterSig)
     MeterSig *vrvMeterSig = new MeterSig();
     ReadLayerElement(meterSig, vrvMeterSig);
 
-    vrvMeterSig->ReadMeterSigLog(meterSig);
-    vrvMeterSig->ReadMeterSigVis(meterSig);
+    vrvMeterSig->ReadMeterSigLog(meterSig, &m_consumedAttrs);
+    vrvMeterSig->ReadMeterSigVis(meterSig, &m_consumedAttrs);
 
     parent->AddChild(vrvMeterSig);
     return true;
@@ -3101,9 +3102,9 @@ bool MeiInput::ReadMeiMRest(Object *parent, pugi::xml_node mRest)
     ReadLayerElement(mRest, vrvMRest);
     ReadPositionInterface(mRest, vrvMRest);
 
-    vrvMRest->ReadFermatapresent(mRest);
-    vrvMRest->ReadRelativesize(mRest);
-    vrvMRest->ReadVisibility(mRest);
+    vrvMRest->ReadFermatapresent(mRest, &m_consumedAttrs);
+    vrvMRest->ReadRelativesize(mRest, &m_consumedAttrs);
+    vrvMRest->ReadVisibility(mRest, &m_consumedAttrs);
 
     parent->AddChild(vrvMRest);
     return true;
@@ -3132,8 +3133,8 @@ bool MeiInput::ReadMeiMultiRest(Object *parent, pugi::xml_node multiRest)
     MultiRest *vrvMultiRest = new MultiRest();
     ReadLayerElement(multiRest, vrvMultiRest);
 
-    vrvMultiRest->ReadMultiRestVis(multiRest);
-    vrvMultiRest->ReadNumbered(multiRest);
+    vrvMultiRest->ReadMultiRestVis(multiRest, &m_consumedAttrs);
+    vrvMultiRest->ReadNumbered(multiRest, &m_consumedAttrs);
 
     parent->AddChild(vrvMultiRest);
     return true;
@@ -3144,7 +3145,7 @@ bool MeiInput::ReadMeiMultiRpt(Object *parent, pugi::xml_node multiRpt)
     MultiRpt *vrvMultiRpt = new MultiRpt();
     ReadLayerElement(multiRpt, vrvMultiRpt);
 
-    vrvMultiRpt->ReadNumbered(multiRpt);
+    vrvMultiRpt->ReadNumbered(multiRpt, &m_consumedAttrs);
 
     parent->AddChild(vrvMultiRpt);
     return true;
@@ -3158,18 +3159,18 @@ bool MeiInput::ReadMeiNote(Object *parent, pugi::xml_node note)
     ReadDurationInterface(note, vrvNote);
     ReadPitchInterface(note, vrvNote);
     ReadPositionInterface(note, vrvNote);
-    vrvNote->ReadColor(note);
-    vrvNote->ReadColoration(note);
-    vrvNote->ReadGraced(note);
-    vrvNote->ReadNoteLogMensural(note);
-    vrvNote->ReadRelativesize(note);
-    vrvNote->ReadStems(note);
-    vrvNote->ReadStemsCmn(note);
-    vrvNote->ReadTiepresent(note);
-    vrvNote->ReadVisibility(note);
+    vrvNote->ReadColor(note, &m_consumedAttrs);
+    vrvNote->ReadColoration(note, &m_consumedAttrs);
+    vrvNote->ReadGraced(note, &m_consumedAttrs);
+    vrvNote->ReadNoteLogMensural(note, &m_consumedAttrs);
+    vrvNote->ReadRelativesize(note, &m_consumedAttrs);
+    vrvNote->ReadStems(note, &m_consumedAttrs);
+    vrvNote->ReadStemsCmn(note, &m_consumedAttrs);
+    vrvNote->ReadTiepresent(note, &m_consumedAttrs);
+    vrvNote->ReadVisibility(note, &m_consumedAttrs);
 
     AttArticulation artic;
-    artic.ReadArticulation(note);
+    artic.ReadArticulation(note, &m_consumedAttrs);
     if (artic.HasArtic()) {
         Artic *vrvArtic = new Artic();
         vrvArtic->IsAttribute(true);
@@ -3178,9 +3179,9 @@ bool MeiInput::ReadMeiNote(Object *parent, pugi::xml_node note)
     }
 
     AttAccidental accidental;
-    accidental.ReadAccidental(note);
+    accidental.ReadAccidental(note, &m_consumedAttrs);
     AttAccidentalPerformed accidentalPerformed;
-    accidentalPerformed.ReadAccidentalPerformed(note);
+    accidentalPerformed.ReadAccidentalPerformed(note, &m_consumedAttrs);
     if (accidental.HasAccid() || accidentalPerformed.HasAccidGes()) {
         Accid *vrvAccid = new Accid();
         vrvAccid->IsAttribute(true);
@@ -3200,9 +3201,9 @@ bool MeiInput::ReadMeiRest(Object *parent, pugi::xml_node rest)
 
     ReadDurationInterface(rest, vrvRest);
     ReadPositionInterface(rest, vrvRest);
-    vrvRest->ReadColor(rest);
-    vrvRest->ReadRelativesize(rest);
-    vrvRest->ReadRestVisMensural(rest);
+    vrvRest->ReadColor(rest, &m_consumedAttrs);
+    vrvRest->ReadRelativesize(rest, &m_consumedAttrs);
+    vrvRest->ReadRestVisMensural(rest, &m_consumedAttrs);
 
     parent->AddChild(vrvRest);
     return true;
@@ -3213,7 +3214,7 @@ bool MeiInput::ReadMeiProport(Object *parent, pugi::xml_node proport)
     Proport *vrvProport = new Proport();
     ReadLayerElement(proport, vrvProport);
 
-    vrvProport->ReadDurationRatio(proport);
+    vrvProport->ReadDurationRatio(proport, &m_consumedAttrs);
 
     parent->AddChild(vrvProport);
     return true;
@@ -3235,9 +3236,9 @@ bool MeiInput::ReadMeiSyl(Object *parent, pugi::xml_node syl)
     Syl *vrvSyl = new Syl();
     ReadLayerElement(syl, vrvSyl);
 
-    vrvSyl->ReadLang(syl);
-    vrvSyl->ReadTypography(syl);
-    vrvSyl->ReadSylLog(syl);
+    vrvSyl->ReadLang(syl, &m_consumedAttrs);
+    vrvSyl->ReadTypography(syl, &m_consumedAttrs);
+    vrvSyl->ReadSylLog(syl, &m_consumedAttrs);
 
     parent->AddChild(vrvSyl);
     return ReadMeiTextChildren(vrvSyl, syl, vrvSyl);
@@ -3248,10 +3249,10 @@ bool MeiInput::ReadMeiTuplet(Object *parent, pugi::xml_node tuplet)
     Tuplet *vrvTuplet = new Tuplet();
     ReadLayerElement(tuplet, vrvTuplet);
 
-    vrvTuplet->ReadColor(tuplet);
-    vrvTuplet->ReadDurationRatio(tuplet);
-    vrvTuplet->ReadNumberplacement(tuplet);
-    vrvTuplet->ReadTupletVis(tuplet);
+    vrvTuplet->ReadColor(tuplet, &m_consumedAttrs);
+    vrvTuplet->ReadDurationRatio(tuplet, &m_consumedAttrs);
+    vrvTuplet->ReadNumberplacement(tuplet, &m_consumedAttrs);
+    vrvTuplet->ReadTupletVis(tuplet, &m_consumedAttrs);
 
     parent->AddChild(vrvTuplet);
     return ReadMeiLayerChildren(vrvTuplet, tuplet, vrvTuplet);
@@ -3262,9 +3263,9 @@ bool MeiInput::ReadMeiVerse(Object *parent, pugi::xml_node verse)
     Verse *vrvVerse = new Verse();
     ReadLayerElement(verse, vrvVerse);
 
-    vrvVerse->ReadColor(verse);
-    vrvVerse->ReadLang(verse);
-    vrvVerse->ReadTypography(verse);
+    vrvVerse->ReadColor(verse, &m_consumedAttrs);
+    vrvVerse->ReadLang(verse, &m_consumedAttrs);
+    vrvVerse->ReadTypography(verse, &m_consumedAttrs);
 
     parent->AddChild(vrvVerse);
     return ReadMeiLayerChildren(vrvVerse, verse, vrvVerse);
@@ -3317,8 +3318,8 @@ bool MeiInput::ReadMeiTextChildren(Object *parent, pugi::xml_node parentNode, Ob
 bool MeiInput::ReadTextElement(pugi::xml_node element, TextElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadTyped(element);
+    object->ReadCommon(element, &m_consumedAttrs);
+    object->ReadTyped(element, &m_consumedAttrs);
 
     return true;
 }
@@ -3337,11 +3338,11 @@ bool MeiInput::ReadMeiRend(Object *parent, pugi::xml_node rend)
     Rend *vrvRend = new Rend();
     ReadTextElement(rend, vrvRend);
 
-    vrvRend->ReadColor(rend);
-    vrvRend->ReadHorizontalalign(rend);
-    vrvRend->ReadLang(rend);
-    vrvRend->ReadTypography(rend);
-    vrvRend->ReadWhitespace(rend);
+    vrvRend->ReadColor(rend, &m_consumedAttrs);
+    vrvRend->ReadHorizontalalign(rend, &m_consumedAttrs);
+    vrvRend->ReadLang(rend, &m_consumedAttrs);
+    vrvRend->ReadTypography(rend, &m_consumedAttrs);
+    vrvRend->ReadWhitespace(rend, &m_consumedAttrs);
 
     parent->AddChild(vrvRend);
     return ReadMeiTextChildren(vrvRend, rend);
@@ -3364,72 +3365,73 @@ bool MeiInput::ReadMeiText(Object *parent, pugi::xml_node text, bool trimLeft, b
 
 bool MeiInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *interface)
 {
-    interface->ReadAugmentdots(element);
-    interface->ReadBeamsecondary(element);
-    interface->ReadDurationMusical(element);
-    interface->ReadDurationPerformed(element);
-    interface->ReadDurationRatio(element);
-    interface->ReadFermatapresent(element);
-    interface->ReadStaffident(element);
+    interface->ReadAugmentdots(element, &m_consumedAttrs);
+    interface->ReadBeamsecondary(element, &m_consumedAttrs);
+    interface->ReadDurationMusical(element, &m_consumedAttrs);
+    interface->ReadDurationPerformed(element, &m_consumedAttrs);
+    interface->ReadDurationRatio(element, &m_consumedAttrs);
+    interface->ReadFermatapresent(element, &m_consumedAttrs);
+    interface->ReadStaffident(element, &m_consumedAttrs);
     return true;
 }
 
 bool MeiInput::ReadPitchInterface(pugi::xml_node element, PitchInterface *interface)
 {
-    interface->ReadNoteGes(element);
-    interface->ReadOctave(element);
-    interface->ReadPitch(element);
+    interface->ReadNoteGes(element, &m_consumedAttrs);
+    interface->ReadOctave(element, &m_consumedAttrs);
+    interface->ReadPitch(element, &m_consumedAttrs);
     return true;
 }
 
 bool MeiInput::ReadPositionInterface(pugi::xml_node element, PositionInterface *interface)
 {
-    interface->ReadStaffloc(element);
-    interface->ReadStafflocPitched(element);
+    interface->ReadStaffloc(element, &m_consumedAttrs);
+    interface->ReadStafflocPitched(element, &m_consumedAttrs);
     return true;
 }
 
 bool MeiInput::ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface)
 {
-    interface->ReadCleffingLog(element);
-    interface->ReadCleffingVis(element);
-    interface->ReadKeySigDefaultLog(element);
-    interface->ReadKeySigDefaultVis(element);
-    interface->ReadLyricstyle(element);
-    interface->ReadMensuralLog(element);
-    interface->ReadMensuralShared(element);
-    interface->ReadMeterSigDefaultLog(element);
-    interface->ReadMeterSigDefaultVis(element);
-    interface->ReadMiditempo(element);
-    interface->ReadMultinummeasures(element);
+    interface->ReadCleffingLog(element, &m_consumedAttrs);
+    interface->ReadCleffingVis(element, &m_consumedAttrs);
+    interface->ReadKeySigDefaultLog(element, &m_consumedAttrs);
+    interface->ReadKeySigDefaultVis(element, &m_consumedAttrs);
+    interface->ReadLyricstyle(element, &m_consumedAttrs);
+    interface->ReadMensuralLog(element, &m_consumedAttrs);
+    interface->ReadMensuralShared(element, &m_consumedAttrs);
+    interface->ReadMeterSigDefaultLog(element, &m_consumedAttrs);
+    interface->ReadMeterSigDefaultVis(element, &m_consumedAttrs);
+    interface->ReadMiditempo(element, &m_consumedAttrs);
+    interface->ReadMultinummeasures(element, &m_consumedAttrs);
     return true;
 }
 
 bool MeiInput::ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface)
 {
-    interface->ReadPlacement(element);
+    interface->ReadPlacement(element, &m_consumedAttrs);
     return true;
 }
 
 bool MeiInput::ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface)
 {
-    interface->ReadStaffident(element);
-    interface->ReadStartid(element);
-    interface->ReadTimestampMusical(element);
+    interface->ReadStaffident(element, &m_consumedAttrs);
+    interface->ReadStartid(element, &m_consumedAttrs);
+    interface->ReadTimestampMusical(element, &m_consumedAttrs);
     return true;
 }
 
 bool MeiInput::ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface)
 {
     ReadTimePointInterface(element, interface);
-    interface->ReadStartendid(element);
-    interface->ReadTimestamp2Musical(element);
+    interface->ReadStartendid(element, &m_consumedAttrs);
+    interface->ReadTimestamp2Musical(element, &m_consumedAttrs);
     return true;
 }
 
 void MeiInput::ReadUnsupportedAttr(pugi::xml_node element, Object *object)
 {
     for (pugi::xml_attribute_iterator ait = element.attributes_begin(); ait != element.attributes_end(); ++ait) {
+        if (std::find(m_consumedAttrs.begin(), m_consumedAttrs.end(), *ait) != m_consumedAttrs.end()) continue;
         object->m_unsupported.push_back(std::make_pair(ait->name(), ait->value()));
     }
 }
@@ -3491,9 +3493,9 @@ bool MeiInput::ReadEditorialElement(pugi::xml_node element, EditorialElement *ob
 {
     SetMeiUuid(element, object);
 
-    object->ReadCommon(element);
-    object->ReadCommonPart(element);
-    object->ReadTyped(element);
+    object->ReadCommon(element, &m_consumedAttrs);
+    object->ReadCommonPart(element, &m_consumedAttrs);
+    object->ReadTyped(element, &m_consumedAttrs);
 
     return true;
 }
@@ -3503,7 +3505,7 @@ bool MeiInput::ReadMeiAbbr(Object *parent, pugi::xml_node abbr, EditorialLevel l
     Abbr *vrvAbbr = new Abbr();
     ReadEditorialElement(abbr, vrvAbbr);
 
-    vrvAbbr->ReadSource(abbr);
+    vrvAbbr->ReadSource(abbr, &m_consumedAttrs);
 
     parent->AddChild(vrvAbbr);
     return ReadMeiEditorialChildren(vrvAbbr, abbr, level, filter);
@@ -3514,7 +3516,7 @@ bool MeiInput::ReadMeiAdd(Object *parent, pugi::xml_node add, EditorialLevel lev
     Add *vrvAdd = new Add();
     ReadEditorialElement(add, vrvAdd);
 
-    vrvAdd->ReadSource(add);
+    vrvAdd->ReadSource(add, &m_consumedAttrs);
 
     parent->AddChild(vrvAdd);
     return ReadMeiEditorialChildren(vrvAdd, add, level, filter);
@@ -3525,8 +3527,8 @@ bool MeiInput::ReadMeiAnnot(Object *parent, pugi::xml_node annot)
     Annot *vrvAnnot = new Annot();
     ReadEditorialElement(annot, vrvAnnot);
 
-    vrvAnnot->ReadPlist(annot);
-    vrvAnnot->ReadSource(annot);
+    vrvAnnot->ReadPlist(annot, &m_consumedAttrs);
+    vrvAnnot->ReadSource(annot, &m_consumedAttrs);
 
     vrvAnnot->m_content.reset();
     // copy all the nodes inside into the document
@@ -3692,7 +3694,7 @@ bool MeiInput::ReadMeiCorr(Object *parent, pugi::xml_node corr, EditorialLevel l
     Corr *vrvCorr = new Corr();
     ReadEditorialElement(corr, vrvCorr);
 
-    vrvCorr->ReadSource(corr);
+    vrvCorr->ReadSource(corr, &m_consumedAttrs);
 
     parent->AddChild(vrvCorr);
     return ReadMeiEditorialChildren(vrvCorr, corr, level, filter);
@@ -3703,7 +3705,7 @@ bool MeiInput::ReadMeiDamage(Object *parent, pugi::xml_node damage, EditorialLev
     Damage *vrvDamage = new Damage();
     ReadEditorialElement(damage, vrvDamage);
 
-    vrvDamage->ReadSource(damage);
+    vrvDamage->ReadSource(damage, &m_consumedAttrs);
 
     parent->AddChild(vrvDamage);
     return ReadMeiEditorialChildren(vrvDamage, damage, level, filter);
@@ -3714,7 +3716,7 @@ bool MeiInput::ReadMeiDel(Object *parent, pugi::xml_node del, EditorialLevel lev
     Del *vrvDel = new Del();
     ReadEditorialElement(del, vrvDel);
 
-    vrvDel->ReadSource(del);
+    vrvDel->ReadSource(del, &m_consumedAttrs);
 
     parent->AddChild(vrvDel);
     return ReadMeiEditorialChildren(vrvDel, del, level, filter);
@@ -3725,7 +3727,7 @@ bool MeiInput::ReadMeiExpan(Object *parent, pugi::xml_node expan, EditorialLevel
     Expan *vrvExpan = new Expan();
     ReadEditorialElement(expan, vrvExpan);
 
-    vrvExpan->ReadSource(expan);
+    vrvExpan->ReadSource(expan, &m_consumedAttrs);
 
     parent->AddChild(vrvExpan);
     return ReadMeiEditorialChildren(vrvExpan, expan, level, filter);
@@ -3740,7 +3742,7 @@ bool MeiInput::ReadMeiLem(Object *parent, pugi::xml_node lem, EditorialLevel lev
     vrvLem->m_visibility = Hidden;
     ReadEditorialElement(lem, vrvLem);
 
-    vrvLem->ReadSource(lem);
+    vrvLem->ReadSource(lem, &m_consumedAttrs);
 
     parent->AddChild(vrvLem);
     return ReadMeiEditorialChildren(vrvLem, lem, level, filter);
@@ -3751,7 +3753,7 @@ bool MeiInput::ReadMeiOrig(Object *parent, pugi::xml_node orig, EditorialLevel l
     Orig *vrvOrig = new Orig();
     ReadEditorialElement(orig, vrvOrig);
 
-    vrvOrig->ReadSource(orig);
+    vrvOrig->ReadSource(orig, &m_consumedAttrs);
 
     parent->AddChild(vrvOrig);
     return ReadMeiEditorialChildren(vrvOrig, orig, level, filter);
@@ -3766,7 +3768,7 @@ bool MeiInput::ReadMeiRdg(Object *parent, pugi::xml_node rdg, EditorialLevel lev
     vrvRdg->m_visibility = Hidden;
     ReadEditorialElement(rdg, vrvRdg);
 
-    vrvRdg->ReadSource(rdg);
+    vrvRdg->ReadSource(rdg, &m_consumedAttrs);
 
     parent->AddChild(vrvRdg);
     return ReadMeiEditorialChildren(vrvRdg, rdg, level, filter);
@@ -3777,7 +3779,7 @@ bool MeiInput::ReadMeiReg(Object *parent, pugi::xml_node reg, EditorialLevel lev
     Reg *vrvReg = new Reg();
     ReadEditorialElement(reg, vrvReg);
 
-    vrvReg->ReadSource(reg);
+    vrvReg->ReadSource(reg, &m_consumedAttrs);
 
     parent->AddChild(vrvReg);
     return ReadMeiEditorialChildren(vrvReg, reg, level, filter);
@@ -3788,7 +3790,7 @@ bool MeiInput::ReadMeiRestore(Object *parent, pugi::xml_node restore, EditorialL
     Restore *vrvRestore = new Restore();
     ReadEditorialElement(restore, vrvRestore);
 
-    vrvRestore->ReadSource(restore);
+    vrvRestore->ReadSource(restore, &m_consumedAttrs);
 
     parent->AddChild(vrvRestore);
     return ReadMeiEditorialChildren(vrvRestore, restore, level, filter);
@@ -3799,7 +3801,7 @@ bool MeiInput::ReadMeiSic(Object *parent, pugi::xml_node sic, EditorialLevel lev
     Sic *vrvSic = new Sic();
     ReadEditorialElement(sic, vrvSic);
 
-    vrvSic->ReadSource(sic);
+    vrvSic->ReadSource(sic, &m_consumedAttrs);
 
     parent->AddChild(vrvSic);
     return ReadMeiEditorialChildren(vrvSic, sic, level, filter);
@@ -3810,7 +3812,7 @@ bool MeiInput::ReadMeiSupplied(Object *parent, pugi::xml_node supplied, Editoria
     Supplied *vrvSupplied = new Supplied();
     ReadEditorialElement(supplied, vrvSupplied);
 
-    vrvSupplied->ReadSource(supplied);
+    vrvSupplied->ReadSource(supplied, &m_consumedAttrs);
 
     parent->AddChild(vrvSupplied);
     return ReadMeiEditorialChildren(vrvSupplied, supplied, level, filter);
@@ -3821,7 +3823,7 @@ bool MeiInput::ReadMeiUnclear(Object *parent, pugi::xml_node unclear, EditorialL
     Unclear *vrvUnclear = new Unclear();
     ReadEditorialElement(unclear, vrvUnclear);
 
-    vrvUnclear->ReadSource(unclear);
+    vrvUnclear->ReadSource(unclear, &m_consumedAttrs);
 
     parent->AddChild(vrvUnclear);
     return ReadMeiEditorialChildren(vrvUnclear, unclear, level, filter);
@@ -3981,12 +3983,16 @@ bool MeiInput::ReadTupletSpanAsTuplet(Measure *measure, pugi::xml_node tupletSpa
 
 void MeiInput::SetMeiUuid(pugi::xml_node element, Object *object)
 {
-    if (!element.attribute("xml:id")) {
+    // This is called first when reading an element, so we can reset the attributes consumed for the previous one
+    m_consumedAttrs.clear();
+
+    pugi::xml_attribute uuid = element.attribute("xml:id");
+    if (!uuid) {
         return;
     }
 
-    object->SetUuid(element.attribute("xml:id").value());
-    element.remove_attribute("xml:id");
+    object->SetUuid(uuid.value());
+    m_consumedAttrs.push_back(uuid);
 }
 
 DocType MeiInput::StrToDocType(std::string type)
@@ -110,6 +110,18 @@ bool MusicXmlInput::HasAttributeWithValue(pugi::xml_node node, std::string attri
     return false;
 }
 
+bool MusicXmlInput::HasBeamWithValue(pugi::xml_node node, std::string value)
+{
+    assert(node);
+
+    for (pugi::xml_node beam = node.child("beam"); beam; beam = beam.next_sibling("beam")) {
+        if (HasAttributeWithValue(beam, "number", "1") && HasContentWithValue(beam, value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool MusicXmlInput::IsElement(pugi::xml_node node, std::string name)
 {
     assert(node);
@@ -157,11 +169,22 @@ std::string MusicXmlInput::GetContent(pugi::xml_node node)
     return "";
 }
 
+pugi::xml_node MusicXmlInput::GetChildWithNumber(
+    pugi::xml_node node, std::string name, std::string number, std::string child)
+{
+    for (pugi::xml_node current = node.child(name.c_str()); current; current = current.next_sibling(name.c_str())) {
+        if (HasAttributeWithValue(current, "number", number) && current.child(child.c_str())) {
+            return current.child(child.c_str());
+        }
+    }
+    return pugi::xml_node();
+}
+
 std::string MusicXmlInput::GetContentOfChild(pugi::xml_node node, std::string child)
 {
-    pugi::xpath_node childNode = node.select_single_node(child.c_str());
-    if (childNode && HasContent(childNode.node())) {
-        return GetContent(childNode.node());
+    pugi::xml_node childNode = node.first_element_by_path(child.c_str());
+    if (childNode && HasContent(childNode)) {
+        return GetContent(childNode);
     }
     return "";
 }
@@ -393,16 +416,20 @@ void MusicXmlInput::TextRendition(pugi::xpath_node_set words, ControlElement *el
 void MusicXmlInput::PrintMetronome(pugi::xml_node metronome, Tempo *tempo)
 {
     std::string tempoText = "M.M.";
-    if (metronome.select_single_node("per-minute").node()) {
-        std::string mm = GetContent(metronome.select_single_node("per-minute").node());
+    if (metronome.child("per-minute")) {
+        std::string mm = GetContent(metronome.child("per-minute"));
         if (atoi(mm.c_str())) tempo->SetMm(mm.c_str());
         tempoText = tempoText + StringFormat(" = %s", mm.c_str());
     }
-    if (metronome.select_single_node("beat-unit").node()) {
-        tempo->SetMmUnit(ConvertTypeToDur(GetContent(metronome.select_single_node("beat-unit").node())));
+    if (metronome.child("beat-unit")) {
+        tempo->SetMmUnit(ConvertTypeToDur(GetContent(metronome.child("beat-unit"))));
     }
-    if (metronome.select_single_node("beat-unit-dot")) {
-        tempo->SetMmDots((int)metronome.select_nodes("beat-unit-dot").size());
+    if (metronome.child("beat-unit-dot")) {
+        int dots = 0;
+        for (pugi::xml_node dot = metronome.child("beat-unit-dot"); dot; dot = dot.next_sibling("beat-unit-dot")) {
+            dots++;
+        }
+        tempo->SetMmDots(dots);
     }
     if (GetAttributeValue(metronome, "parentheses") == "yes") tempoText = "(" + tempoText + ")";
     Text *text = new Text();
@@ -435,6 +462,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     pugi::xpath_node scoreMidiBpm = root.select_single_node("/score-partwise/part[1]/measure[1]/sound[@tempo][1]");
     if (scoreMidiBpm) m_doc->m_scoreDef.SetMidiBpm(atoi(GetAttributeValue(scoreMidiBpm.node(), "tempo").c_str()));
 
+    pugi::xml_node scorePartwise = root.root().child("score-partwise");
     pugi::xpath_node_set partListChildren = root.select_nodes("/score-partwise/part-list/*");
     for (pugi::xpath_node_set::const_iterator it = partListChildren.begin(); it != partListChildren.end(); ++it) {
         pugi::xpath_node xpathNode = *it;
@@ -464,9 +492,9 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
         else if (IsElement(xpathNode.node(), "score-part")) {
             // get the attributes element of the first measure of the part
             std::string partId = xpathNode.node().attribute("id").as_string();
-            std::string xpath = StringFormat("/score-partwise/part[@id='%s']/measure[1]", partId.c_str());
-            pugi::xpath_node partFirstMeasure = root.select_single_node(xpath.c_str());
-            if (!partFirstMeasure.node().select_single_node("attributes")) {
+            pugi::xml_node part = scorePartwise.find_child_by_attribute("part", "id", partId.c_str());
+            pugi::xml_node partFirstMeasure = part.child("measure");
+            if (!partFirstMeasure.child("attributes")) {
                 LogWarning("Could not find the 'attributes' element in the first "
                            "measure of part '%s'",
                     partId.c_str());
@@ -476,7 +504,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
             std::string partAbbr = GetContentOfChild(xpathNode.node(), "part-abbreviation");
             // create the staffDef(s)
             StaffGrp *partStaffGrp = new StaffGrp();
-            int nbStaves = ReadMusicXmlPartAttributesAsStaffDef(partFirstMeasure.node(), partStaffGrp, staffOffset);
+            int nbStaves = ReadMusicXmlPartAttributesAsStaffDef(partFirstMeasure, partStaffGrp, staffOffset);
             // if we have more than one staff in the part we create a new staffGrp
             if (nbStaves > 1) {
                 partStaffGrp->SetLabel(partName);
@@ -495,14 +523,12 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
                 delete partStaffGrp;
             }
 
-            // find the part and read it
-            xpath = StringFormat("/score-partwise/part[@id='%s']", partId.c_str());
-            pugi::xpath_node part = root.select_single_node(xpath.c_str());
+            // read the part
             if (!part) {
                 LogWarning("Could not find the part '%s'", partId.c_str());
                 continue;
             }
-            ReadMusicXmlPart(part.node(), section, nbStaves, staffOffset);
+            ReadMusicXmlPart(part, section, nbStaves, staffOffset);
             // increment the staffOffset for reading the next part
             staffOffset += nbStaves;
         }
@@ -591,16 +617,16 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
         if (IsElement(*it, "attributes")) it->set_name("mei-read");
 
         // First get the number of staves in the part
-        pugi::xpath_node staves = it->select_single_node("staves");
+        pugi::xml_node staves = it->child("staves");
         if (staves) {
-            if (staves.node().text()) {
-                int values = atoi(staves.node().text().as_string());
+            if (staves.text()) {
+                int values = atoi(staves.text().as_string());
                 nbStaves = (values > 0) ? values : 1;
             }
         }
 
         int i;
-        std::string xpath;
+        std::string number;
         // Create as many staffDef
         for (i = 0; i < nbStaves; i++) {
             // Find or create the staffDef
@@ -615,37 +641,31 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
                 m_octDis.push_back(0);
             }
 
+            number = StringFormat("%d", i + 1);
             // clef sign - first look if we have a clef-sign with the corresponding staff @number
-            pugi::xpath_node clefSign;
-            xpath = StringFormat("clef[@number='%d']/sign", i + 1);
-            clefSign = it->select_single_node(xpath.c_str());
+            pugi::xml_node clefSign = GetChildWithNumber(*it, "clef", number, "sign");
             // if not, look at a common one
             if (!clefSign) {
-                clefSign = it->select_single_node("clef/sign");
+                clefSign = it->first_element_by_path("clef/sign");
             }
-            if (clefSign && HasContent(clefSign.node())) {
-                staffDef->SetClefShape(
-                    staffDef->AttCleffingLog::StrToClefshape(GetContent(clefSign.node()).substr(0, 4)));
+            if (clefSign && HasContent(clefSign)) {
+                staffDef->SetClefShape(staffDef->AttCleffingLog::StrToClefshape(GetContent(clefSign).substr(0, 4)));
             }
             // clef line
-            pugi::xpath_node clefLine;
-            xpath = StringFormat("clef[@number='%d']/line", i + 1);
-            clefLine = it->select_single_node(xpath.c_str());
+            pugi::xml_node clefLine = GetChildWithNumber(*it, "clef", number, "line");
             if (!clefLine) {
-                clefLine = it->select_single_node("clef/line");
+                clefLine = it->first_element_by_path("clef/line");
             }
-            if (clefLine && HasContent(clefLine.node())) {
-                staffDef->SetClefLine(staffDef->AttCleffingLog::StrToInt(clefLine.node().text().as_string()));
+            if (clefLine && HasContent(clefLine)) {
+                staffDef->SetClefLine(staffDef->AttCleffingLog::StrToInt(clefLine.text().as_string()));
             }
             // clef octave change
-            pugi::xpath_node clefOctaveChange;
-            xpath = StringFormat("clef[@number='%d']/clef-octave-change", i + 1);
-            clefOctaveChange = it->select_single_node(xpath.c_str());
+            pugi::xml_node clefOctaveChange = GetChildWithNumber(*it, "clef", number, "clef-octave-change");
             if (!clefOctaveChange) {
-                clefOctaveChange = it->select_single_node("clef/clef-octave-change");
+                clefOctaveChange = it->first_element_by_path("clef/clef-octave-change");
             }
-            if (clefOctaveChange && HasContent(clefOctaveChange.node())) {
-                int change = clefOctaveChange.node().text().as_int();
+            if (clefOctaveChange && HasContent(clefOctaveChange)) {
+                int change = clefOctaveChange.text().as_int();
                 if (abs(change) == 1)
                     staffDef->SetClefDis(OCTAVE_DIS_8);
                 else if (abs(change) == 2)
@@ -656,15 +676,13 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
                     staffDef->SetClefDisPlace(PLACE_above);
             }
             // key sig
-            pugi::xpath_node key;
-            xpath = StringFormat("key[@number='%d']", i + 1);
-            key = it->select_single_node(xpath.c_str());
+            pugi::xml_node key = it->find_child_by_attribute("key", "number", number.c_str());
             if (!key) {
-                key = it->select_single_node("key");
+                key = it->child("key");
             }
             if (key) {
-                if (key.node().select_single_node("fifths")) {
-                    int fifths = atoi(key.node().select_single_node("fifths").node().text().as_string());
+                if (key.child("fifths")) {
+                    int fifths = atoi(key.child("fifths").text().as_string());
                     std::string keySig;
                     if (fifths < 0)
                         keySig = StringFormat("%df", abs(fifths));
@@ -674,44 +692,40 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
                         keySig = "0";
                     staffDef->SetKeySig(staffDef->AttKeySigDefaultLog::StrToKeysignature(keySig));
                 }
-                else if (key.node().select_single_node("key-step")) {
+                else if (key.child("key-step")) {
                     staffDef->SetKeySig(KEYSIGNATURE_mixed);
                 }
-                if (key.node().select_single_node("mode")) {
-                    staffDef->SetKeyMode(staffDef->AttKeySigDefaultLog::StrToMode(
-                        key.node().select_single_node("mode").node().text().as_string()));
+                if (key.child("mode")) {
+                    staffDef->SetKeyMode(
+                        staffDef->AttKeySigDefaultLog::StrToMode(key.child("mode").text().as_string()));
                 }
             }
             // staff details
-            pugi::xpath_node staffDetails;
-            xpath = StringFormat("staff-details[@number='%d']", i + 1);
-            staffDetails = it->select_single_node(xpath.c_str());
+            pugi::xml_node staffDetails = it->find_child_by_attribute("staff-details", "number", number.c_str());
             if (!staffDetails) {
-                staffDetails = it->select_single_node("staff-details");
+                staffDetails = it->child("staff-details");
             }
-            std::string linesStr = staffDetails.node().select_single_node("staff-lines").node().text().as_string();
+            std::string linesStr = staffDetails.child("staff-lines").text().as_string();
             if (!linesStr.empty()) {
                 staffDef->SetLines(atoi(linesStr.c_str()));
             }
             else
                 staffDef->SetLines(5);
-            std::string scaleStr = staffDetails.node().select_single_node("staff-size").node().text().as_string();
+            std::string scaleStr = staffDetails.child("staff-size").text().as_string();
             if (!scaleStr.empty()) {
                 staffDef->SetScale(staffDef->AttScalable::StrToPercent(scaleStr));
             }
-            pugi::xpath_node staffTuning = staffDetails.node().select_single_node("staff-tuning");
+            pugi::xml_node staffTuning = staffDetails.child("staff-tuning");
             if (staffTuning) {
                 staffDef->SetNotationtype(NOTATIONTYPE_tab);
             }
             // time
-            pugi::xpath_node time;
-            xpath = StringFormat("time[@number='%d']", i + 1);
-            time = it->select_single_node(xpath.c_str());
+            pugi::xml_node time = it->find_child_by_attribute("time", "number", number.c_str());
             if (!time) {
-                time = it->select_single_node("time");
+                time = it->child("time");
             }
             if (time) {
-                std::string symbol = GetAttributeValue(time.node(), "symbol");
+                std::string symbol = GetAttributeValue(time, "symbol");
                 if (!symbol.empty()) {
                     if (symbol == "cut" || symbol == "common")
                         staffDef->SetMeterSym(staffDef->AttMeterSigDefaultVis::StrToMetersign(symbol.c_str()));
@@ -720,41 +734,39 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
                     else
                         staffDef->SetMeterRend(meterSigDefaultVis_METERREND_norm);
                 }
-                if (time.node().select_nodes("beats").size() > 1) {
+                if (time.child("beats").next_sibling("beats")) {
                     LogWarning("Compound meter signatures are not supported");
                 }
-                pugi::xpath_node beats = time.node().select_single_node("beats");
-                if (beats && HasContent(beats.node())) {
-                    m_meterCount = beats.node().text().as_int();
+                pugi::xml_node beats = time.child("beats");
+                if (beats && HasContent(beats)) {
+                    m_meterCount = beats.text().as_int();
                     // staffDef->AttMeterSigDefaultLog::StrToInt(beats.node().text().as_string());
                     // this is a little "hack", until libMEI is fixed
-                    std::string compound = beats.node().text().as_string();
+                    std::string compound = beats.text().as_string();
                     if (compound.find("+") != std::string::npos) {
                         m_meterCount += atoi(compound.substr(compound.find("+")).c_str());
                         LogWarning("Compound time is not supported");
                     }
                     staffDef->SetMeterCount(m_meterCount);
                 }
-                pugi::xpath_node beatType = time.node().select_single_node("beat-type");
-                if (beatType && HasContent(beatType.node())) {
-                    m_meterUnit = beatType.node().text().as_int();
+                pugi::xml_node beatType = time.child("beat-type");
+                if (beatType && HasContent(beatType)) {
+                    m_meterUnit = beatType.text().as_int();
                     staffDef->SetMeterUnit(m_meterUnit);
                 }
             }
             // transpose
-            pugi::xpath_node transpose;
-            xpath = StringFormat("transpose[@number='%d']", i + 1);
-            transpose = it->select_single_node(xpath.c_str());
+            pugi::xml_node transpose = it->find_child_by_attribute("transpose", "number", number.c_str());
             if (!transpose) {
-                transpose = it->select_single_node("transpose");
+                transpose = it->child("transpose");
             }
             if (transpose) {
-                staffDef->SetTransDiat(atoi(GetContentOfChild(transpose.node(), "diatonic").c_str()));
-                staffDef->SetTransSemi(atoi(GetContentOfChild(transpose.node(), "chromatic").c_str()));
+                staffDef->SetTransDiat(atoi(GetContentOfChild(transpose, "diatonic").c_str()));
+                staffDef->SetTransSemi(atoi(GetContentOfChild(transpose, "chromatic").c_str()));
             }
             // ppq
-            pugi::xpath_node divisions = it->select_single_node("divisions");
-            if (divisions) m_ppq = atoi(GetContent(divisions.node()).c_str());
+            pugi::xml_node divisions = it->child("divisions");
+            if (divisions) m_ppq = atoi(GetContent(divisions).c_str());
         }
     }
 
@@ -766,17 +778,16 @@ bool MusicXmlInput::ReadMusicXmlPart(pugi::xml_node node, Section *section, int
     assert(node);
     assert(section);
 
-    pugi::xpath_node_set measures = node.select_nodes("measure");
-    if (measures.size() == 0) {
+    if (!node.child("measure")) {
         LogWarning("No measure to load");
         return false;
     }
 
     int i = 0;
-    for (pugi::xpath_node_set::const_iterator it = measures.begin(); it != measures.end(); ++it) {
-        pugi::xpath_node xmlMeasure = *it;
+    for (pugi::xml_node xmlMeasure = node.child("measure"); xmlMeasure;
+         xmlMeasure = xmlMeasure.next_sibling("measure")) {
         Measure *measure = new Measure();
-        ReadMusicXmlMeasure(xmlMeasure.node(), section, measure, nbStaves, staffOffset);
+        ReadMusicXmlMeasure(xmlMeasure, section, measure, nbStaves, staffOffset);
         // Add the measure to the system - if already there from a previous part we'll just merge the content
         AddMeasure(section, measure, i);
         i++;
@@ -791,6 +802,8 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
     assert(measure);
 
     int measureNum = atoi(GetAttributeValue(node, "number").c_str());
+    // for now only print elements of the first part are read
+    bool isFirstPart = (IsElement(node.parent(), "part") && !node.parent().previous_sibling("part"));
     if (measure != NULL) measure->SetN(measureNum);
 
     int i = 0;
@@ -837,7 +850,7 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
             ReadMusicXmlNote(*it, measure, measureNum);
         }
         // for now only check first part
-        else if (IsElement(*it, "print") && node.select_single_node("parent::part[not(preceding-sibling::part)]")) {
+        else if (IsElement(*it, "print") && isFirstPart) {
             ReadMusicXmlPrint(*it, section);
         }
     }
@@ -852,22 +865,22 @@ void MusicXmlInput::ReadMusicXmlAttributes(pugi::xml_node node, Section *section
     assert(measure);
 
     // read clef changes as MEI clef
-    pugi::xpath_node clef = node.select_single_node("clef");
+    pugi::xml_node clef = node.child("clef");
     if (clef) {
         // check if we have a staff number
-        std::string numberStr = GetAttributeValue(clef.node(), "number");
+        std::string numberStr = GetAttributeValue(clef, "number");
         int staffNum = (numberStr.empty()) ? 1 : atoi(numberStr.c_str());
         Layer *layer = SelectLayer(staffNum, measure);
-        pugi::xpath_node clefSign = clef.node().select_single_node("sign");
-        pugi::xpath_node clefLine = clef.node().select_single_node("line");
+        pugi::xml_node clefSign = clef.child("sign");
+        pugi::xml_node clefLine = clef.child("line");
         if (clefSign && clefLine) {
             Clef *meiClef = new Clef();
-            meiClef->SetShape(meiClef->AttClefshape::StrToClefshape(GetContent(clefSign.node())));
-            meiClef->SetLine(meiClef->AttClefshape::StrToInt(clefLine.node().text().as_string()));
+            meiClef->SetShape(meiClef->AttClefshape::StrToClefshape(GetContent(clefSign)));
+            meiClef->SetLine(meiClef->AttClefshape::StrToInt(clefLine.text().as_string()));
             // clef octave change
-            pugi::xpath_node clefOctaveChange = clef.node().select_single_node("clef-octave-change");
-            if (clefOctaveChange && HasContent(clefOctaveChange.node())) {
-                int change = clefOctaveChange.node().text().as_int();
+            pugi::xml_node clefOctaveChange = clef.child("clef-octave-change");
+            if (clefOctaveChange && HasContent(clefOctaveChange)) {
+                int change = clefOctaveChange.text().as_int();
                 if (abs(change) == 1)
                     meiClef->SetDis(OCTAVE_DIS_8);
                 else if (abs(change) == 2)
@@ -882,13 +895,15 @@ void MusicXmlInput::ReadMusicXmlAttributes(pugi::xml_node node, Section *section
     }
 
     // key and time change
-    pugi::xpath_node key = node.select_single_node("key");
-    pugi::xpath_node time = node.select_single_node("time");
+    pugi::xml_node key = node.child("key");
+    pugi::xml_node time = node.child("time");
     // for now only read first part and make it change in scoreDef
-    if ((key || time) && node.select_single_node("ancestor::part[not(preceding-sibling::part)]")) {
+    pugi::xml_node part = node.parent().parent();
+    bool isFirstPart = (IsElement(part, "part") && !part.previous_sibling("part"));
+    if ((key || time) && isFirstPart) {
         ScoreDef *scoreDef = new ScoreDef();
-        if (key.node().select_single_node("fifths")) {
-            int fifths = atoi(key.node().select_single_node("fifths").node().text().as_string());
+        if (key.child("fifths")) {
+            int fifths = atoi(key.child("fifths").text().as_string());
             std::string keySig;
             if (fifths < 0)
                 keySig = StringFormat("%df", abs(fifths));
@@ -898,15 +913,14 @@ void MusicXmlInput::ReadMusicXmlAttributes(pugi::xml_node node, Section *section
                 keySig = "0";
             scoreDef->SetKeySig(scoreDef->AttKeySigDefaultLog::StrToKeysignature(keySig));
         }
-        else if (key.node().select_single_node("key-step")) {
+        else if (key.child("key-step")) {
             scoreDef->SetKeySig(KEYSIGNATURE_mixed);
         }
-        if (key.node().select_single_node("mode")) {
-            scoreDef->SetKeyMode(scoreDef->AttKeySigDefaultLog::StrToMode(
-                key.node().select_single_node("mode").node().text().as_string()));
+        if (key.child("mode")) {
+            scoreDef->SetKeyMode(scoreDef->AttKeySigDefaultLog::StrToMode(key.child("mode").text().as_string()));
         }
         if (time) {
-            std::string symbol = GetAttributeValue(time.node(), "symbol");
+            std::string symbol = GetAttributeValue(time, "symbol");
             if (!symbol.empty()) {
                 if (symbol == "cut" || symbol == "common")
                     scoreDef->SetMeterSym(scoreDef->AttMeterSigDefaultVis::StrToMetersign(symbol.c_str()));
@@ -915,33 +929,33 @@ void MusicXmlInput::ReadMusicXmlAttributes(pugi::xml_node node, Section *section
                 else
                     scoreDef->SetMeterRend(meterSigDefaultVis_METERREND_norm);
             }
-            if (time.node().select_nodes("beats").size() > 1) {
+            if (time.child("beats").next_sibling("beats")) {
                 LogWarning("Compound meter signatures are not supported");
             }
-            pugi::xpath_node beats = time.node().select_single_node("beats");
-            if (beats && HasContent(beats.node())) {
-                m_meterCount = beats.node().text().as_int();
+            pugi::xml_node beats = time.child("beats");
+            if (beats && HasContent(beats)) {
+                m_meterCount = beats.text().as_int();
                 // staffDef->AttMeterSigDefaultLog::StrToInt(beats.node().text().as_string());
                 // this is a little "hack", until libMEI is fixed
-                std::string compound = beats.node().text().as_string();
+                std::string compound = beats.text().as_string();
                 if (compound.find("+") != std::string::npos) {
                     m_meterCount += atoi(compound.substr(compound.find("+")).c_str());
                     LogWarning("Compound time is not supported");
                 }
                 scoreDef->SetMeterCount(m_meterCount);
             }
-            pugi::xpath_node beatType = time.node().select_single_node("beat-type");
-            if (beatType && HasContent(beatType.node())) {
-                m_meterUnit = beatType.node().text().as_int();
+            pugi::xml_node beatType = time.child("beat-type");
+            if (beatType && HasContent(beatType)) {
+                m_meterUnit = beatType.text().as_int();
                 scoreDef->SetMeterUnit(m_meterUnit);
             }
         }
         section->AddChild(scoreDef);
     }
 
-    pugi::xpath_node measureRepeat = node.select_single_node("measure-style/measure-repeat");
+    pugi::xml_node measureRepeat = node.first_element_by_path("measure-style/measure-repeat");
     if (measureRepeat) {
-        if (GetAttributeValue(measureRepeat.node(), "type") == "start")
+        if (GetAttributeValue(measureRepeat, "type") == "start")
             m_mRpt = true;
         else
             m_mRpt = false;
@@ -955,11 +969,11 @@ void MusicXmlInput::ReadMusicXmlBackup(pugi::xml_node node, Measure *measure, in
 
     m_durTotal -= atoi(GetContentOfChild(node, "duration").c_str());
 
-    pugi::xpath_node nextNote = node.next_sibling("note");
+    pugi::xml_node nextNote = node.next_sibling("note");
     if (nextNote && m_durTotal > 0) {
         // We need a <space> if a note follows that starts not at the beginning of the measure
         Layer *layer = new Layer();
-        if (!node.select_single_node("voice")) layer = SelectLayer(nextNote.node(), measure);
+        if (!node.child("voice")) layer = SelectLayer(nextNote, measure);
         FillSpace(layer, m_durTotal);
     }
 }
@@ -974,7 +988,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, i
 
     data_BARRENDITION barRendition = BARRENDITION_NONE;
     std::string barStyle = GetContentOfChild(node, "bar-style");
-    pugi::xpath_node repeat = node.select_single_node("repeat");
+    pugi::xml_node repeat = node.child("repeat");
     if (!barStyle.empty()) {
         barRendition = ConvertStyleToRend(barStyle, repeat);
         if (HasAttributeWithValue(node, "location", "left")) {
@@ -987,12 +1001,12 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, i
             measure->SetRight(barRendition);
         }
     }
-    pugi::xpath_node ending = node.select_single_node("ending");
+    pugi::xml_node ending = node.child("ending");
     if (ending) {
         LogWarning("Endings not supported");
     }
     // fermatas
-    pugi::xpath_node xmlFermata = node.select_single_node("fermata");
+    pugi::xml_node xmlFermata = node.child("fermata");
     if (xmlFermata) {
         Fermata *fermata = new Fermata();
         m_controlElements.push_back(std::make_pair(measureNum, fermata));
@@ -1007,16 +1021,16 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, i
         }
         fermata->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         // color
-        std::string colorStr = GetAttributeValue(xmlFermata.node(), "color");
+        std::string colorStr = GetAttributeValue(xmlFermata, "color");
         if (!colorStr.empty()) fermata->SetColor(colorStr.c_str());
         // shape
-        fermata->SetShape(ConvertFermataShape(GetContent(xmlFermata.node())));
+        fermata->SetShape(ConvertFermataShape(GetContent(xmlFermata)));
         // form and place
-        if (HasAttributeWithValue(xmlFermata.node(), "type", "inverted")) {
+        if (HasAttributeWithValue(xmlFermata, "type", "inverted")) {
             fermata->SetForm(fermataVis_FORM_inv);
             fermata->SetPlace(STAFFREL_below);
         }
-        else if (HasAttributeWithValue(xmlFermata.node(), "type", "upright")) {
+        else if (HasAttributeWithValue(xmlFermata, "type", "upright")) {
             fermata->SetForm(fermataVis_FORM_norm);
             fermata->SetPlace(STAFFREL_above);
         }
@@ -1028,12 +1042,19 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
     assert(node);
     assert(measure);
 
-    pugi::xpath_node type = node.select_single_node("direction-type");
+    pugi::xml_node type = node.child("direction-type");
     std::string placeStr = GetAttributeValue(node, "placement");
-    pugi::xpath_node_set words = type.node().select_nodes("words");
+    pugi::xpath_node_set words = type.select_nodes("words");
+    pugi::xml_node soundTempo;
+    for (pugi::xml_node sound = node.child("sound"); sound; sound = sound.next_sibling("sound")) {
+        if (sound.attribute("tempo")) {
+            soundTempo = sound;
+            break;
+        }
+    }
 
     // Directive
-    if (words.size() != 0 && !node.select_single_node("sound[@tempo]")) {
+    if (words.size() != 0 && !soundTempo) {
         Dir *dir = new Dir();
         if (words.size() == 1) {
             std::string lang = GetAttributeValue(words.first().node(), "xml:lang");
@@ -1046,10 +1067,10 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
     }
 
     // Dynamics
-    pugi::xpath_node dynam = type.node().select_single_node("dynamics");
+    pugi::xml_node dynam = type.child("dynamics");
     if (dynam) {
-        std::string dynamStr = GetContentOfChild(dynam.node(), "other-dynamics");
-        if (dynamStr.empty()) dynamStr = dynam.node().first_child().name();
+        std::string dynamStr = GetContentOfChild(dynam, "other-dynamics");
+        if (dynamStr.empty()) dynamStr = dynam.first_child().name();
         Dynam *dynam = new Dynam();
         if (!placeStr.empty()) dynam->SetPlace(dynam->AttPlacement::StrToStaffrel(placeStr.c_str()));
         Text *text = new Text();
@@ -1060,11 +1081,11 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
     }
 
     // Hairpins
-    pugi::xpath_node wedge = type.node().select_single_node("wedge");
+    pugi::xml_node wedge = type.child("wedge");
     if (wedge) {
-        int hairpinNumber = atoi(GetAttributeValue(wedge.node(), "number").c_str());
+        int hairpinNumber = atoi(GetAttributeValue(wedge, "number").c_str());
         hairpinNumber = (hairpinNumber < 1) ? 1 : hairpinNumber;
-        if (HasAttributeWithValue(wedge.node(), "type", "stop")) {
+        if (HasAttributeWithValue(wedge, "type", "stop")) {
             std::vector<std::pair<Hairpin *, musicxml::OpenHairpin> >::iterator iter;
             for (iter = m_hairpinStack.begin(); iter != m_hairpinStack.end(); iter++) {
                 if (iter->second.m_dirN == hairpinNumber) {
@@ -1077,13 +1098,13 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
         else {
             Hairpin *hairpin = new Hairpin();
             musicxml::OpenHairpin openHairpin(hairpinNumber, "");
-            if (HasAttributeWithValue(wedge.node(), "type", "crescendo")) {
+            if (HasAttributeWithValue(wedge, "type", "crescendo")) {
                 hairpin->SetForm(hairpinLog_FORM_cres);
             }
-            else if (HasAttributeWithValue(wedge.node(), "type", "diminuendo")) {
+            else if (HasAttributeWithValue(wedge, "type", "diminuendo")) {
                 hairpin->SetForm(hairpinLog_FORM_dim);
             }
-            std::string colorStr = GetAttributeValue(wedge.node(), "color");
+            std::string colorStr = GetAttributeValue(wedge, "color");
             if (!colorStr.empty()) hairpin->SetColor(colorStr.c_str());
             if (!placeStr.empty()) hairpin->SetPlace(hairpin->AttPlacement::StrToStaffrel(placeStr.c_str()));
             m_controlElements.push_back(std::make_pair(measureNum, hairpin));
@@ -1092,11 +1113,11 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
     }
 
     // Ottava
-    pugi::xpath_node xmlShift = type.node().select_single_node("octave-shift");
+    pugi::xml_node xmlShift = type.child("octave-shift");
     if (xmlShift) {
-        pugi::xpath_node staffNode = node.select_single_node("staff");
-        int staffN = (!staffNode) ? 1 : atoi(GetContent(staffNode.node()).c_str());
-        if (HasAttributeWithValue(xmlShift.node(), "type", "stop")) {
+        pugi::xml_node staffNode = node.child("staff");
+        int staffN = (!staffNode) ? 1 : atoi(GetContent(staffNode).c_str());
+        if (HasAttributeWithValue(xmlShift, "type", "stop")) {
             m_octDis[staffN] = 0;
             std::vector<std::pair<int, ControlElement *> >::iterator iter;
             for (iter = m_controlElements.begin(); iter != m_controlElements.end(); iter++) {
@@ -1112,14 +1133,14 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
         }
         else {
             Octave *octave = new Octave();
-            std::string colorStr = GetAttributeValue(xmlShift.node(), "color");
+            std::string colorStr = GetAttributeValue(xmlShift, "color");
             if (!colorStr.empty()) octave->SetColor(colorStr.c_str());
             if (!placeStr.empty()) octave->SetDisPlace(octave->AttOctavedisplacement::StrToPlace(placeStr.c_str()));
             octave->SetStaff(octave->AttStaffident::StrToXsdPositiveIntegerList(std::to_string(staffN)));
             octave->SetDis(
-                octave->AttOctavedisplacement::StrToOctaveDis(GetAttributeValue(xmlShift.node(), "size").c_str()));
-            m_octDis[staffN] = (atoi(GetAttributeValue(xmlShift.node(), "size").c_str()) + 2) / 8;
-            if (HasAttributeWithValue(xmlShift.node(), "type", "down")) {
+                octave->AttOctavedisplacement::StrToOctaveDis(GetAttributeValue(xmlShift, "size").c_str()));
+            m_octDis[staffN] = (atoi(GetAttributeValue(xmlShift, "size").c_str()) + 2) / 8;
+            if (HasAttributeWithValue(xmlShift, "type", "down")) {
                 octave->SetDisPlace(PLACE_below);
                 m_octDis[staffN] = -1 * m_octDis[staffN];
             }
@@ -1131,11 +1152,11 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
     }
 
     // Pedal
-    pugi::xpath_node xmlPedal = type.node().select_single_node("pedal");
+    pugi::xml_node xmlPedal = type.child("pedal");
     if (xmlPedal) {
         Pedal *pedal = new Pedal();
         if (!placeStr.empty()) pedal->SetPlace(pedal->AttPlacement::StrToStaffrel(placeStr.c_str()));
-        std::string pedalType = GetAttributeValue(xmlPedal.node(), "type");
+        std::string pedalType = GetAttributeValue(xmlPedal, "type");
         if (!pedalType.empty()) pedal->SetDir(ConvertPedalTypeToDir(pedalType));
         if (pedalType == "stop") pedal->SetStartid(m_ID);
         m_controlElements.push_back(std::make_pair(measureNum, pedal));
@@ -1143,8 +1164,8 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
     }
 
     // Tempo
-    pugi::xpath_node metronome = type.node().select_single_node("metronome");
-    if (node.select_single_node("sound[@tempo]") || metronome) {
+    pugi::xml_node metronome = type.child("metronome");
+    if (soundTempo || metronome) {
         Tempo *tempo = new Tempo();
         if (words.size() == 1) {
             std::string lang = GetAttributeValue(words.first().node(), "xml:lang");
@@ -1153,16 +1174,16 @@ void MusicXmlInput::ReadMusicXmlDirection(pugi::xml_node node, Measure *measure,
         if (!placeStr.empty()) tempo->SetPlace(tempo->AttPlacement::StrToStaffrel(placeStr.c_str()));
         if (words.size() != 0) TextRendition(words, tempo);
         if (metronome)
-            PrintMetronome(metronome.node(), tempo);
+            PrintMetronome(metronome, tempo);
         else
-            tempo->SetMidiBpm(atoi(GetAttributeValue(node.select_single_node("sound").node(), "tempo").c_str()));
+            tempo->SetMidiBpm(atoi(GetAttributeValue(node.child("sound"), "tempo").c_str()));
         m_controlElements.push_back(std::make_pair(measureNum, tempo));
         m_tempoStack.push_back(tempo);
     }
 
     // other cases
     if (words.size() == 0 && !dynam && !metronome && !xmlShift && !xmlPedal && !wedge) {
-        LogWarning("Unsupported direction-type '%s'", type.node().first_child().name());
+        LogWarning("Unsupported direction-type '%s'", type.first_child().name());
     }
 }
 
@@ -1179,7 +1200,7 @@ void MusicXmlInput::ReadMusicXmlFigures(pugi::xml_node node, Measure *measure, i
         std::string textStyle = GetAttributeValue(node, "font-style");
         std::string textWeight = GetAttributeValue(node, "font-weight");
         for (pugi::xml_node figure = node.child("figure"); figure; figure = figure.next_sibling("figure")) {
-            std::string textStr = GetContent(figure.select_single_node("figure-number").node());
+            std::string textStr = GetContent(figure.child("figure-number"));
             F *f = new F();
             Text *text = new Text();
             text->SetText(UTF8to16(textStr));
@@ -1200,14 +1221,14 @@ void MusicXmlInput::ReadMusicXmlForward(pugi::xml_node node, Measure *measure, i
 
     Layer *layer = SelectLayer(node, measure);
 
-    pugi::xpath_node prevNote = node.select_single_node("preceding-sibling::note[1]");
-    pugi::xpath_node nextNote = node.select_single_node("following-sibling::note[1]");
+    pugi::xml_node prevNote = node.previous_sibling("note");
+    pugi::xml_node nextNote = node.next_sibling("note");
     if (nextNote) {
         // We need a <space> if a note follows
-        if (!node.select_single_node("voice")) layer = SelectLayer(nextNote.node(), measure);
+        if (!node.child("voice")) layer = SelectLayer(nextNote, measure);
         FillSpace(layer, atoi(GetContentOfChild(node, "duration").c_str()));
     }
-    else if (!prevNote && !node.select_single_node("preceding-sibling::backup")) {
+    else if (!prevNote && !node.previous_sibling("backup")) {
         // If there is no previous or following note in the first layer, the measure seems to be empty
         // an invisible mRest is used, which should be replaced by mSpace, when available
         MRest *mRest = new MRest();
@@ -1225,17 +1246,17 @@ void MusicXmlInput::ReadMusicXmlHarmony(pugi::xml_node node, Measure *measure, i
     std::string typeStr = GetAttributeValue(node, "type");
 
     std::string harmText = GetContentOfChild(node, "root/root-step");
-    pugi::xpath_node alter = node.select_single_node("root/root-alter");
+    pugi::xml_node alter = node.first_element_by_path("root/root-alter");
     if (alter) {
-        if (GetContent(alter.node()) == "-1")
+        if (GetContent(alter) == "-1")
             harmText = harmText + "♭";
-        else if (GetContent(alter.node()) == "0")
+        else if (GetContent(alter) == "0")
             harmText = harmText + "♮";
-        else if (GetContent(alter.node()) == "1")
+        else if (GetContent(alter) == "1")
             harmText = harmText + "♯";
     }
-    pugi::xpath_node kind = node.select_single_node("kind");
-    if (kind) harmText = harmText + GetAttributeValue(kind.node(), "text").c_str();
+    pugi::xml_node kind = node.child("kind");
+    if (kind) harmText = harmText + GetAttributeValue(kind, "text").c_str();
     Harm *harm = new Harm();
     Text *text = new Text();
     if (!placeStr.empty()) harm->SetPlace(harm->AttPlacement::StrToStaffrel(placeStr.c_str()));
@@ -1260,7 +1281,7 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
     LayerElement *element = NULL;
 
     // add duration to measure time
-    if (!node.select_single_node("chord")) m_durTotal += atoi(GetContentOfChild(node, "duration").c_str());
+    if (!node.child("chord")) m_durTotal += atoi(GetContentOfChild(node, "duration").c_str());
 
     // for measure repeats add a single <mRpt> and return
     if (m_mRpt) {
@@ -1274,35 +1295,41 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
 
     std::string noteColor = GetAttributeValue(node, "color");
 
-    pugi::xpath_node notations = node.select_single_node("notations[not(@print-object='no')]");
+    pugi::xml_node notations;
+    for (notations = node.child("notations"); notations; notations = notations.next_sibling("notations")) {
+        if (!HasAttributeWithValue(notations, "print-object", "no")) break;
+    }
 
     bool cue = false;
-    if (node.select_single_node("cue") || node.select_single_node("type[@size='cue']")) cue = true;
+    if (node.child("cue") || node.find_child_by_attribute("type", "size", "cue")) cue = true;
 
     // duration string and dots
     std::string typeStr = GetContentOfChild(node, "type");
-    int dots = (int)node.select_nodes("dot").size();
+    int dots = 0;
+    for (pugi::xml_node dot = node.child("dot"); dot; dot = dot.next_sibling("dot")) {
+        dots++;
+    }
 
     // tremolos
-    pugi::xpath_node tremolo = notations.node().select_single_node("ornaments/tremolo");
+    pugi::xml_node tremolo = notations.first_element_by_path("ornaments/tremolo");
     std::string tremSlashNum = "0";
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "single")) {
+        if (HasAttributeWithValue(tremolo, "type", "single")) {
             BTrem *bTrem = new BTrem();
             AddLayerElement(layer, bTrem);
             m_elementStack.push_back(bTrem);
-            tremSlashNum = GetContent(tremolo.node());
+            tremSlashNum = GetContent(tremolo);
         }
-        else if (HasAttributeWithValue(tremolo.node(), "type", "start")) {
+        else if (HasAttributeWithValue(tremolo, "type", "start")) {
             FTrem *fTrem = new FTrem();
             AddLayerElement(layer, fTrem);
             m_elementStack.push_back(fTrem);
-            fTrem->SetSlash(atoi(GetContent(tremolo.node()).c_str()));
+            fTrem->SetSlash(atoi(GetContent(tremolo).c_str()));
         }
     }
 
     // beam start
-    bool beamStart = node.select_single_node("beam[@number='1'][text()='begin']");
+    bool beamStart = HasBeamWithValue(node, "begin");
     if (beamStart) {
         Beam *beam = new Beam();
         AddLayerElement(layer, beam);
@@ -1314,31 +1341,31 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
     // quite likely not work if we have a tuplet over serveral beams. We would need to check which
     // one is ending first in order to determine which one is on top of the hierarchy.
     // Also, it is not 100% sure that we can represent them as tuplet and beam elements.
-    pugi::xpath_node tupletStart = notations.node().select_single_node("tuplet[@type='start']");
+    pugi::xml_node tupletStart = notations.find_child_by_attribute("tuplet", "type", "start");
     if (tupletStart) {
         Tuplet *tuplet = new Tuplet();
         AddLayerElement(layer, tuplet);
         m_elementStack.push_back(tuplet);
-        pugi::xpath_node actualNotes = node.select_single_node("time-modification/actual-notes");
-        pugi::xpath_node normalNotes = node.select_single_node("time-modification/normal-notes");
+        pugi::xml_node actualNotes = node.first_element_by_path("time-modification/actual-notes");
+        pugi::xml_node normalNotes = node.first_element_by_path("time-modification/normal-notes");
         if (actualNotes && normalNotes) {
-            tuplet->SetNum(atoi(GetContent(actualNotes.node()).c_str()));
-            tuplet->SetNumbase(atoi(GetContent(normalNotes.node()).c_str()));
+            tuplet->SetNum(atoi(GetContent(actualNotes).c_str()));
+            tuplet->SetNumbase(atoi(GetContent(normalNotes).c_str()));
         }
-        if (!GetAttributeValue(tupletStart.node(), "placement").empty()) {
-            tuplet->SetNumPlace(tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart.node(), "placement")));
+        if (!GetAttributeValue(tupletStart, "placement").empty()) {
+            tuplet->SetNumPlace(tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart, "placement")));
             tuplet->SetBracketPlace(
-                tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart.node(), "placement")));
+                tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart, "placement")));
         }
-        tuplet->SetNumFormat(ConvertTupletNumberValue(GetAttributeValue(tupletStart.node(), "show-number")));
-        if (HasAttributeWithValue(tupletStart.node(), "show-number", "none")) tuplet->SetNumVisible(BOOLEAN_false);
-        tuplet->SetBracketVisible(ConvertWordToBool(GetAttributeValue(tupletStart.node(), "bracket")));
+        tuplet->SetNumFormat(ConvertTupletNumberValue(GetAttributeValue(tupletStart, "show-number")));
+        if (HasAttributeWithValue(tupletStart, "show-number", "none")) tuplet->SetNumVisible(BOOLEAN_false);
+        tuplet->SetBracketVisible(ConvertWordToBool(GetAttributeValue(tupletStart, "bracket")));
     }
 
-    pugi::xpath_node rest = node.select_single_node("rest");
+    pugi::xml_node rest = node.child("rest");
     if (rest) {
-        std::string stepStr = GetContentOfChild(rest.node(), "display-step");
-        std::string octaveStr = GetContentOfChild(rest.node(), "display-octave");
+        std::string stepStr = GetContentOfChild(rest, "display-step");
+        std::string octaveStr = GetContentOfChild(rest, "display-octave");
         if (HasAttributeWithValue(node, "print-object", "no")) {
             Space *space = new Space();
             element = space;
@@ -1346,7 +1373,7 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
             AddLayerElement(layer, space);
         }
         // we assume /note without /type to be mRest
-        else if (typeStr.empty() || HasAttributeWithValue(rest.node(), "measure", "yes")) {
+        else if (typeStr.empty() || HasAttributeWithValue(rest, "measure", "yes")) {
             MRest *mRest = new MRest();
             element = mRest;
             if (cue) mRest->SetSize(SIZE_cue);
@@ -1372,16 +1399,16 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
         if (!noteColor.empty()) note->SetColor(noteColor.c_str());
 
         // accidental
-        pugi::xpath_node accidental = node.select_single_node("accidental");
+        pugi::xml_node accidental = node.child("accidental");
         if (accidental) {
             Accid *accid = new Accid();
-            accid->SetAccid(ConvertAccidentalToAccid(GetContent(accidental.node())));
-            std::string accidColor = GetAttributeValue(accidental.node(), "color");
+            accid->SetAccid(ConvertAccidentalToAccid(GetContent(accidental)));
+            std::string accidColor = GetAttributeValue(accidental, "color");
             if (!accidColor.empty()) accid->SetColor(accidColor.c_str());
-            if (HasAttributeWithValue(accidental.node(), "cautionary", "yes")) accid->SetFunc(accidLog_FUNC_caution);
-            if (HasAttributeWithValue(accidental.node(), "editorial", "yes")) accid->SetFunc(accidLog_FUNC_edit);
-            if (HasAttributeWithValue(accidental.node(), "bracket", "yes")) accid->SetEnclose(ENCLOSURE_brack);
-            if (HasAttributeWithValue(accidental.node(), "parentheses", "yes")) accid->SetEnclose(ENCLOSURE_paren);
+            if (HasAttributeWithValue(accidental, "cautionary", "yes")) accid->SetFunc(accidLog_FUNC_caution);
+            if (HasAttributeWithValue(accidental, "editorial", "yes")) accid->SetFunc(accidLog_FUNC_edit);
+            if (HasAttributeWithValue(accidental, "bracket", "yes")) accid->SetEnclose(ENCLOSURE_brack);
+            if (HasAttributeWithValue(accidental, "parentheses", "yes")) accid->SetEnclose(ENCLOSURE_paren);
             note->AddChild(accid);
         }
 
@@ -1396,11 +1423,11 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
         }
 
         // pitch and octave
-        pugi::xpath_node pitch = node.select_single_node("pitch");
+        pugi::xml_node pitch = node.child("pitch");
         if (pitch) {
-            std::string stepStr = GetContentOfChild(pitch.node(), "step");
+            std::string stepStr = GetContentOfChild(pitch, "step");
             if (!stepStr.empty()) note->SetPname(ConvertStepToPitchName(stepStr));
-            std::string octaveStr = GetContentOfChild(pitch.node(), "octave");
+            std::string octaveStr = GetContentOfChild(pitch, "octave");
             if (!octaveStr.empty()) {
                 if (m_octDis[staff->GetN()] != 0) {
                     note->SetOct(atoi(octaveStr.c_str()) + m_octDis[staff->GetN()]);
@@ -1409,7 +1436,7 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
                 else
                     note->SetOct(atoi(octaveStr.c_str()));
             }
-            std::string alterStr = GetContentOfChild(pitch.node(), "alter");
+            std::string alterStr = GetContentOfChild(pitch, "alter");
             if (!alterStr.empty()) {
                 Accid *accid = dynamic_cast<Accid *>(note->GetFirst(ACCID));
                 if (!accid) {
@@ -1422,15 +1449,15 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
         }
 
         // notehead
-        pugi::xpath_node notehead = node.select_single_node("notehead");
+        pugi::xml_node notehead = node.child("notehead");
         if (notehead) {
-            // if (HasAttributeWithValue(notehead.node(), "parentheses", "yes")) note->SetEnclose(ENCLOSURE_paren);
+            // if (HasAttributeWithValue(notehead, "parentheses", "yes")) note->SetEnclose(ENCLOSURE_paren);
         }
 
         // look at the next note to see if we are starting or ending a chord
-        pugi::xpath_node nextNote = node.select_single_node("./following-sibling::note");
+        pugi::xml_node nextNote = node.next_sibling("note");
         bool nextIsChord = false;
-        if (nextNote.node().select_single_node("chord")) nextIsChord = true;
+        if (nextNote.child("chord")) nextIsChord = true;
         // create the chord if we are starting a new chord
         if (nextIsChord) {
             if (m_elementStack.empty() || !m_elementStack.back()->Is(CHORD)) {
@@ -1447,9 +1474,9 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
         }
 
         // grace notes
-        pugi::xpath_node grace = node.select_single_node("grace");
+        pugi::xml_node grace = node.child("grace");
         if (grace) {
-            std::string slashStr = GetAttributeValue(grace.node(), "slash");
+            std::string slashStr = GetAttributeValue(grace, "slash");
             if (slashStr == "no") {
                 note->SetGrace(GRACE_acc);
             }
@@ -1472,9 +1499,7 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
         }
 
         // verse / syl
-        pugi::xpath_node_set lyrics = node.select_nodes("lyric");
-        for (pugi::xpath_node_set::const_iterator it = lyrics.begin(); it != lyrics.end(); ++it) {
-            pugi::xml_node lyric = it->node();
+        for (pugi::xml_node lyric = node.child("lyric"); lyric; lyric = lyric.next_sibling("lyric")) {
             int lyricNumber = atoi(GetAttributeValue(lyric, "number").c_str());
             lyricNumber = (lyricNumber < 1) ? 1 : lyricNumber;
             std::string lyricName = GetAttributeValue(lyric, "name");
@@ -1492,7 +1517,7 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
                     std::string textStr = GetContent(textNode);
                     Syl *syl = new Syl();
                     if (!lang.empty()) syl->SetLang(lang.c_str());
-                    if (lyric.select_single_node("extend")) {
+                    if (lyric.child("extend")) {
                         syl->SetCon(sylLog_CON_u);
                     }
                     if (textNode.next_sibling("elision")) {
@@ -1523,20 +1548,20 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
         }
 
         // ties
-        pugi::xpath_node startTie = notations.node().select_single_node("tied[@type='start']");
-        pugi::xpath_node endTie = notations.node().select_single_node("tied[@type='stop']");
+        pugi::xml_node startTie = notations.find_child_by_attribute("tied", "type", "start");
+        pugi::xml_node endTie = notations.find_child_by_attribute("tied", "type", "stop");
         CloseTie(staff, layer, note, endTie);
         // Then open a new tie
         if ((startTie)) {
             Tie *tie = new Tie();
             // color
-            std::string colorStr = GetAttributeValue(startTie.node(), "color");
+            std::string colorStr = GetAttributeValue(startTie, "color");
             if (!colorStr.empty()) tie->SetColor(colorStr.c_str());
             // placement and orientation
-            tie->SetCurvedir(ConvertOrientationToCurvedir(GetAttributeValue(startTie.node(), "orientation").c_str()));
-            if (!GetAttributeValue(startTie.node(), "placement").empty())
+            tie->SetCurvedir(ConvertOrientationToCurvedir(GetAttributeValue(startTie, "orientation").c_str()));
+            if (!GetAttributeValue(startTie, "placement").empty())
                 tie->SetCurvedir(
-                    tie->AttCurvature::StrToCurvatureCurvedir(GetAttributeValue(startTie.node(), "placement").c_str()));
+                    tie->AttCurvature::StrToCurvatureCurvedir(GetAttributeValue(startTie, "placement").c_str()));
             // add it to the stack
             m_controlElements.push_back(std::make_pair(measureNum, tie));
             OpenTie(staff, layer, note, tie);
@@ -1544,29 +1569,29 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
 
         // articulation
         std::vector<data_ARTICULATION> artics;
-        for (pugi::xml_node articulations = notations.node().child("articulations"); articulations;
+        for (pugi::xml_node articulations = notations.child("articulations"); articulations;
              articulations = articulations.next_sibling("articulations")) {
             Artic *artic = new Artic();
-            if (articulations.select_single_node("accent")) artics.push_back(ARTICULATION_acc);
-            if (articulations.select_single_node("detached-legato")) artics.push_back(ARTICULATION_ten_stacc);
-            if (articulations.select_single_node("spiccato")) artics.push_back(ARTICULATION_spicc);
-            if (articulations.select_single_node("staccatissimo")) artics.push_back(ARTICULATION_stacciss);
-            if (articulations.select_single_node("staccato")) artics.push_back(ARTICULATION_stacc);
-            if (articulations.select_single_node("strong-accent")) artics.push_back(ARTICULATION_marc);
-            if (articulations.select_single_node("tenuto")) artics.push_back(ARTICULATION_ten);
+            if (articulations.child("accent")) artics.push_back(ARTICULATION_acc);
+            if (articulations.child("detached-legato")) artics.push_back(ARTICULATION_ten_stacc);
+            if (articulations.child("spiccato")) artics.push_back(ARTICULATION_spicc);
+            if (articulations.child("staccatissimo")) artics.push_back(ARTICULATION_stacciss);
+            if (articulations.child("staccato")) artics.push_back(ARTICULATION_stacc);
+            if (articulations.child("strong-accent")) artics.push_back(ARTICULATION_marc);
+            if (articulations.child("tenuto")) artics.push_back(ARTICULATION_ten);
             artic->SetArtic(artics);
             element->AddChild(artic);
             artics.clear();
         }
-        for (pugi::xml_node technical = notations.node().child("technical"); technical;
+        for (pugi::xml_node technical = notations.child("technical"); technical;
              technical = technical.next_sibling("technical")) {
             Artic *artic = new Artic();
-            if (technical.select_single_node("down-bow")) artics.push_back(ARTICULATION_dnbow);
-            if (technical.select_single_node("harmonic")) artics.push_back(ARTICULATION_harm);
-            if (technical.select_single_node("open-string")) artics.push_back(ARTICULATION_open);
-            if (technical.select_single_node("snap-pizzicato")) artics.push_back(ARTICULATION_snap);
-            if (technical.select_single_node("stopped")) artics.push_back(ARTICULATION_stop);
-            if (technical.select_single_node("up-bow")) artics.push_back(ARTICULATION_upbow);
+            if (technical.child("down-bow")) artics.push_back(ARTICULATION_dnbow);
+            if (technical.child("harmonic")) artics.push_back(ARTICULATION_harm);
+            if (technical.child("open-string")) artics.push_back(ARTICULATION_open);
+            if (technical.child("snap-pizzicato")) artics.push_back(ARTICULATION_snap);
+            if (technical.child("stopped")) artics.push_back(ARTICULATION_stop);
+            if (technical.child("up-bow")) artics.push_back(ARTICULATION_upbow);
             artic->SetArtic(artics);
             artic->SetType("technical");
             element->AddChild(artic);
@@ -1586,16 +1611,16 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
     m_ID = "#" + element->GetUuid();
 
     // Dynamics
-    pugi::xpath_node xmlDynam = notations.node().select_single_node("dynamics");
+    pugi::xml_node xmlDynam = notations.child("dynamics");
     if (xmlDynam) {
         Dynam *dynam = new Dynam();
         m_controlElements.push_back(std::make_pair(measureNum, dynam));
         dynam->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         dynam->SetStartid(m_ID);
-        std::string dynamStr = GetContentOfChild(xmlDynam.node(), "other-dynamics");
-        if (dynamStr.empty()) dynamStr = xmlDynam.node().first_child().name();
+        std::string dynamStr = GetContentOfChild(xmlDynam, "other-dynamics");
+        if (dynamStr.empty()) dynamStr = xmlDynam.first_child().name();
         // place
-        std::string placeStr = GetAttributeValue(xmlDynam.node(), "placement");
+        std::string placeStr = GetAttributeValue(xmlDynam, "placement");
         if (!placeStr.empty()) dynam->SetPlace(dynam->AttPlacement::StrToStaffrel(placeStr.c_str()));
         Text *text = new Text();
         text->SetText(UTF8to16(dynamStr));
@@ -1603,118 +1628,116 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
     }
 
     // fermatas
-    pugi::xpath_node xmlFermata = notations.node().select_single_node("fermata");
+    pugi::xml_node xmlFermata = notations.child("fermata");
     if (xmlFermata) {
         Fermata *fermata = new Fermata();
         m_controlElements.push_back(std::make_pair(measureNum, fermata));
         fermata->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         fermata->SetStartid(m_ID);
         // color
-        std::string colorStr = GetAttributeValue(xmlFermata.node(), "color");
+        std::string colorStr = GetAttributeValue(xmlFermata, "color");
         if (!colorStr.empty()) fermata->SetColor(colorStr.c_str());
         // shape
-        fermata->SetShape(ConvertFermataShape(GetContent(xmlFermata.node())));
+        fermata->SetShape(ConvertFermataShape(GetContent(xmlFermata)));
         // form and place
-        if (HasAttributeWithValue(xmlFermata.node(), "type", "inverted")) {
+        if (HasAttributeWithValue(xmlFermata, "type", "inverted")) {
             fermata->SetForm(fermataVis_FORM_inv);
             fermata->SetPlace(STAFFREL_below);
         }
-        else if (HasAttributeWithValue(xmlFermata.node(), "type", "upright")) {
+        else if (HasAttributeWithValue(xmlFermata, "type", "upright")) {
             fermata->SetForm(fermataVis_FORM_norm);
             fermata->SetPlace(STAFFREL_above);
         }
     }
 
     // mordent
-    pugi::xpath_node xmlMordent = notations.node().select_single_node("ornaments/mordent");
+    pugi::xml_node xmlMordent = notations.first_element_by_path("ornaments/mordent");
     if (xmlMordent) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back(std::make_pair(measureNum, mordent));
         mordent->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         mordent->SetStartid(m_ID);
         // color
-        std::string colorStr = GetAttributeValue(xmlMordent.node(), "color");
+        std::string colorStr = GetAttributeValue(xmlMordent, "color");
         if (!colorStr.empty()) mordent->SetColor(colorStr.c_str());
         // form
         mordent->SetForm(mordentLog_FORM_norm);
         // long
-        std::string elongation = GetAttributeValue(xmlMordent.node(), "long");
+        std::string elongation = GetAttributeValue(xmlMordent, "long");
         if (!elongation.empty()) mordent->SetLong(ConvertWordToBool(elongation.c_str()));
         // place
-        std::string placeStr = GetAttributeValue(xmlMordent.node(), "placement");
+        std::string placeStr = GetAttributeValue(xmlMordent, "placement");
         if (!placeStr.empty()) mordent->SetPlace(mordent->AttPlacement::StrToStaffrel(placeStr.c_str()));
     }
-    pugi::xpath_node xmlMordentInv = notations.node().select_single_node("ornaments/inverted-mordent");
+    pugi::xml_node xmlMordentInv = notations.first_element_by_path("ornaments/inverted-mordent");
     if (xmlMordentInv) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back(std::make_pair(measureNum, mordent));
         mordent->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         mordent->SetStartid(m_ID);
         // color
-        std::string colorStr = GetAttributeValue(xmlMordentInv.node(), "color");
+        std::string colorStr = GetAttributeValue(xmlMordentInv, "color");
         if (!colorStr.empty()) mordent->SetColor(colorStr.c_str());
         // form
         mordent->SetForm(mordentLog_FORM_inv);
         // long
-        std::string elongation = GetAttributeValue(xmlMordentInv.node(), "long");
+        std::string elongation = GetAttributeValue(xmlMordentInv, "long");
         if (!elongation.empty()) mordent->SetLong(ConvertWordToBool(elongation.c_str()));
         // place
-        std::string placeStr = GetAttributeValue(xmlMordentInv.node(), "placement");
+        std::string placeStr = GetAttributeValue(xmlMordentInv, "placement");
         if (!placeStr.empty()) mordent->SetPlace(mordent->AttPlacement::StrToStaffrel(placeStr.c_str()));
     }
 
     // trill
-    pugi::xpath_node xmlTrill = notations.node().select_single_node("ornaments/trill-mark");
+    pugi::xml_node xmlTrill = notations.first_element_by_path("ornaments/trill-mark");
     if (xmlTrill) {
         Trill *trill = new Trill();
         m_controlElements.push_back(std::make_pair(measureNum, trill));
         trill->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         trill->SetStartid(m_ID);
         // color
-        std::string colorStr = GetAttributeValue(xmlTrill.node(), "color");
+        std::string colorStr = GetAttributeValue(xmlTrill, "color");
         if (!colorStr.empty()) trill->SetColor(colorStr.c_str());
         // place
-        std::string placeStr = GetAttributeValue(xmlTrill.node(), "placement");
+        std::string placeStr = GetAttributeValue(xmlTrill, "placement");
         if (!placeStr.empty()) trill->SetPlace(trill->AttPlacement::StrToStaffrel(placeStr.c_str()));
     }
 
     // turn
-    pugi::xpath_node xmlTurn = notations.node().select_single_node("ornaments/turn");
+    pugi::xml_node xmlTurn = notations.first_element_by_path("ornaments/turn");
     if (xmlTurn) {
         Turn *turn = new Turn();
         m_controlElements.push_back(std::make_pair(measureNum, turn));
         turn->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         turn->SetStartid(m_ID);
         // color
-        std::string colorStr = GetAttributeValue(xmlTurn.node(), "color");
+        std::string colorStr = GetAttributeValue(xmlTurn, "color");
         if (!colorStr.empty()) turn->SetColor(colorStr.c_str());
         // form
         turn->SetForm(turnLog_FORM_norm);
         // place
-        std::string placeStr = GetAttributeValue(xmlTurn.node(), "placement");
+        std::string placeStr = GetAttributeValue(xmlTurn, "placement");
         if (!placeStr.empty()) turn->SetPlace(turn->AttPlacement::StrToStaffrel(placeStr.c_str()));
     }
-    pugi::xpath_node xmlTurnInv = notations.node().select_single_node("ornaments/inverted-turn");
+    pugi::xml_node xmlTurnInv = notations.first_element_by_path("ornaments/inverted-turn");
     if (xmlTurnInv) {
         Turn *turn = new Turn();
         m_controlElements.push_back(std::make_pair(measureNum, turn));
         turn->SetStaff(staff->AttCommon::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         turn->SetStartid(m_ID);
         // color
-        std::string colorStr = GetAttributeValue(xmlTurnInv.node(), "color");
+        std::string colorStr = GetAttributeValue(xmlTurnInv, "color");
         if (!colorStr.empty()) turn->SetColor(colorStr.c_str());
         // form
         turn->SetForm(turnLog_FORM_inv);
         // place
-        std::string placeStr = GetAttributeValue(xmlTurnInv.node(), "placement");
+        std::string placeStr = GetAttributeValue(xmlTurnInv, "placement");
         if (!placeStr.empty()) turn->SetPlace(turn->AttPlacement::StrToStaffrel(placeStr.c_str()));
     }
 
     // slur
     // cross staff slurs won't work
-    pugi::xpath_node_set slurs = notations.node().select_nodes("slur");
-    for (pugi::xpath_node_set::const_iterator it = slurs.begin(); it != slurs.end(); ++it) {
-        pugi::xml_node slur = it->node();
+    for (pugi::xml_node slur = notations.child("slur"); slur; slur = slur.next_sibling("slur")) {
         int slurNumber = atoi(GetAttributeValue(slur, "number").c_str());
         slurNumber = (slurNumber < 1) ? 1 : slurNumber;
         if (HasAttributeWithValue(slur, "type", "start")) {
@@ -1740,22 +1763,22 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
 
     // tremolo end
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "single")) {
+        if (HasAttributeWithValue(tremolo, "type", "single")) {
             RemoveLastFromStack(BTREM);
         }
-        if (HasAttributeWithValue(tremolo.node(), "type", "stop")) {
+        if (HasAttributeWithValue(tremolo, "type", "stop")) {
             RemoveLastFromStack(FTREM);
         }
     }
 
     // tuplet end
-    pugi::xpath_node tupletEnd = notations.node().select_single_node("tuplet[@type='stop']");
+    pugi::xml_node tupletEnd = notations.find_child_by_attribute("tuplet", "type", "stop");
     if (tupletEnd) {
         RemoveLastFromStack(TUPLET);
     }
 
     // beam end
-    bool beamEnd = node.select_single_node("beam[@number='1'][text()='end']");
+    bool beamEnd = HasBeamWithValue(node, "end");
     if (beamEnd) {
         RemoveLastFromStack(BEAM);
     }
@@ -128,6 +128,7 @@ void Layer::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -177,46 +178,24 @@ Clef *Layer::GetClef(LayerElement *test)
         assert(thisStaff);
         if (test->m_crossStaff) thisStaff = test->m_crossStaff;
 
-        Layer *thisLayer = dynamic_cast<Layer *>(test->GetFirstParent(LAYER));
-        assert(thisLayer);
-        if (test->m_crossLayer) thisLayer = test->m_crossLayer;
-
-        // get all the clefs in the current measure, we'll filter them down below
+        // get all the clefs of the staff in the current measure
+        // don't check for Layers until there's a better way to account for duplicated clefs
+        // see issue 400 https://github.com/rism-ch/verovio/issues/400
         Measure *measure = dynamic_cast<Measure *>(this->GetFirstParent(MEASURE));
         assert(measure);
-        ArrayOfObjects clefs;
-        AttComparison matchType(CLEF);
-        measure->FindAllChildByAttComparison(&clefs, &matchType);
-
-        ArrayOfObjects::iterator iter;
-        for (iter = clefs.begin(); iter != clefs.end(); iter++) {
-            Clef *clef = dynamic_cast<Clef *>(*iter);
-            assert(clef);
-
-            if (clef && clef->Is(CLEF))
-            {
-                // account for cross-staff clefs
-                Staff *clefStaff = dynamic_cast<Staff *>(clef->GetFirstParent(STAFF));
-                if (clef->m_crossStaff) clefStaff = clef->m_crossStaff;
-
-                Layer *clefLayer = dynamic_cast<Layer *>(clef->GetFirstParent(LAYER));
-                if (clef->m_crossLayer) clefLayer = clef->m_crossLayer;
-
-                // make sure the clef is in the same staff as the element
-                if (clefStaff->GetN() == thisStaff->GetN())
-                {
-                    // don't check for Layers until there's a better way to account for duplicated clefs 
-                    // see issue 400 https://github.com/rism-ch/verovio/issues/400
-                    //if (clefLayer->GetN() != thisLayer->GetN()) continue;
-
-                    // We'll set this layer's clef as our clef if
-                    // 1) the new clef is closer than the the current clef (testObject)
-                    // and
-                    // 2) the new clef isn't past the original element's x position (should this be < or <=?)
-                    if ((!testObject->Is(CLEF) || clef->GetDrawingX() > testObject->GetDrawingX()) && clef->GetDrawingX() <= origXPos)
-                    {
-                        testObject = clef;
-                    }
+        const std::vector<Clef *> *clefs = measure->GetDrawingClefs(thisStaff->GetN());
+
+        if (clefs) {
+            std::vector<Clef *>::const_iterator iter;
+            for (iter = clefs->begin(); iter != clefs->end(); iter++) {
+                Clef *clef = *iter;
+                // We'll set this layer's clef as our clef if
+                // 1) the new clef is closer than the the current clef (testObject)
+                // and
+                // 2) the new clef isn't past the original element's x position (should this be < or <=?)
+                if ((!testObject->Is(CLEF) || clef->GetDrawingX() > testObject->GetDrawingX())
+                    && clef->GetDrawingX() <= origXPos) {
+                    testObject = clef;
                 }
             }
         }
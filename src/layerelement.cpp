@@ -1206,8 +1206,22 @@ int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 
     // Now deal with the different elements
     if (this->Is(REST)) {
+        Rest *rest = dynamic_cast<Rest *>(this);
+        assert(rest);
+        double dur = GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
+        rest->m_playingOnset = params->m_totalTime + params->m_currentMeasureTime;
+        rest->m_playingOffset = params->m_totalTime + params->m_currentMeasureTime + dur;
         // increase the currentTime accordingly
-        params->m_currentMeasureTime += GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
+        params->m_currentMeasureTime += dur;
+    }
+    else if (this->Is(CHORD)) {
+        Chord *chord = dynamic_cast<Chord *>(this);
+        assert(chord);
+        // For now just ignore grace chords
+        if (chord->HasGrace()) return FUNCTOR_CONTINUE;
+        double dur = GetAlignmentDuration() * params->m_currentBpm / (DUR_MAX / DURATION_4);
+        chord->m_playingOnset = params->m_totalTime + params->m_currentMeasureTime;
+        chord->m_playingOffset = params->m_totalTime + params->m_currentMeasureTime + dur;
     }
     else if (this->Is(NOTE)) {
         Note *note = dynamic_cast<Note *>(this);
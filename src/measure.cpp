@@ -17,6 +17,7 @@
 
 #include "attcomparison.h"
 #include "boundary.h"
+#include "clef.h"
 #include "controlelement.h"
 #include "doc.h"
 #include "editorial.h"
@@ -87,6 +88,8 @@ void Measure::Reset()
     m_xAbs = VRV_UNSET;
     m_xAbs2 = VRV_UNSET;
     m_drawingXRel = 0;
+    m_castOffXRel = 0;
+    m_castOffWidth = 0;
 
     // by default, we have a single barLine on the right (none on the left)
     m_rightBarLine.SetForm(this->GetRight());
@@ -98,6 +101,8 @@ void Measure::Reset()
     }
 
     m_drawingEnding = NULL;
+    m_drawingClefs.clear();
+    m_drawingClefsDone = false;
     m_hasAlignmentRefWithMultipleLayers = false;
 }
 
@@ -125,6 +130,7 @@ void Measure::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -258,6 +264,31 @@ std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
     return staves;
 }
 
+const std::vector<Clef *> *Measure::GetDrawingClefs(int staffN)
+{
+    if (!m_drawingClefsDone) {
+        ArrayOfObjects clefs;
+        AttComparison matchType(CLEF);
+        this->FindAllChildByAttComparison(&clefs, &matchType);
+
+        ArrayOfObjects::iterator iter;
+        for (iter = clefs.begin(); iter != clefs.end(); iter++) {
+            Clef *clef = dynamic_cast<Clef *>(*iter);
+            assert(clef);
+            // account for cross-staff clefs
+            Staff *clefStaff = dynamic_cast<Staff *>(clef->GetFirstParent(STAFF));
+            if (clef->m_crossStaff) clefStaff = clef->m_crossStaff;
+            assert(clefStaff);
+            m_drawingClefs[clefStaff->GetN()].push_back(clef);
+        }
+        m_drawingClefsDone = true;
+    }
+
+    std::map<int, std::vector<Clef *> >::iterator clefs = m_drawingClefs.find(staffN);
+    if (clefs == m_drawingClefs.end()) return NULL;
+    return &clefs->second;
+}
+
 void Measure::UpgradePageBasedMEI(System *system)
 {
     assert(!this->IsMeasuredMusic());
@@ -612,6 +643,8 @@ int Measure::ResetDrawing(FunctorParams *functorParams)
     this->m_rightBarLine.Reset();
     this->m_timestampAligner.Reset();
     m_drawingEnding = NULL;
+    m_drawingClefs.clear();
+    m_drawingClefsDone = false;
     return FUNCTOR_CONTINUE;
 };
 
@@ -620,12 +653,21 @@ int Measure::CastOffSystems(FunctorParams *functorParams)
     CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
+    if (params->m_reuseLayout) {
+        // Put the measure back in place for the vertical layout of the content page
+        this->SetDrawingXRel(m_castOffXRel);
+    }
+    else {
+        m_castOffXRel = this->m_drawingXRel;
+        m_castOffWidth = this->GetWidth();
+    }
+
     if ((params->m_currentSystem->GetChildCount() > 0)
-        && (this->m_drawingXRel + this->GetWidth() + params->m_currentScoreDefWidth - params->m_shift
+        && (m_castOffXRel + m_castOffWidth + params->m_currentScoreDefWidth - params->m_shift
                > params->m_systemWidth)) {
         params->m_currentSystem = new System();
         params->m_page->AddChild(params->m_currentSystem);
-        params->m_shift = this->m_drawingXRel;
+        params->m_shift = m_castOffXRel;
     }
 
     // First add all pendings objects
@@ -707,6 +749,10 @@ int Measure::PrepareCrossStaff(FunctorParams *functorParams)
 
     params->m_currentMeasure = this;
 
+    // The clefs have to be collected again with the cross-staff pointers
+    m_drawingClefs.clear();
+    m_drawingClefsDone = false;
+
     return FUNCTOR_CONTINUE;
 }
 
@@ -847,9 +893,10 @@ int Measure::GenerateMIDIEnd(FunctorParams *functorParams)
     // We a to the total time the maximum duration of the measure so if there is no layer, if the layer is not full
     // or
     // if there is an encoding error in the measure, the next one will be properly aligned
-    assert(!params->m_maxValues.empty());
-    params->m_totalTime += params->m_maxValues.front();
-    params->m_maxValues.erase(params->m_maxValues.begin());
+    assert(params->m_maxValues);
+    assert(params->m_currentMeasure < (int)params->m_maxValues->size());
+    params->m_totalTime += params->m_maxValues->at(params->m_currentMeasure);
+    params->m_currentMeasure++;
 
     return FUNCTOR_CONTINUE;
 }
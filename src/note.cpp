@@ -155,6 +155,7 @@ void Note::AddChild(Object *child)
         m_children.insert(m_children.begin(), child);
     else
         m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
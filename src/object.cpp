@@ -10,9 +10,12 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <atomic>
 #include <iostream>
 #include <math.h>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -45,22 +48,94 @@ namespace vrv {
 // Object
 //----------------------------------------------------------------------------
 
-unsigned long Object::s_objectCounter = 0;
+thread_local std::mt19937 Object::s_uuidGenerator;
+thread_local bool Object::s_uuidGeneratorSeeded = false;
+/**
+ * A shared list of registered ids.
+ * Each list keeps the lists extending it by one id, which are only added and never deleted.
+ * They can therefore be looked for without locking.
+ */
+template <class ID> class RegisteredList : public std::vector<ID> {
+public:
+    RegisteredList()
+    {
+        m_extensions = NULL;
+        m_next = NULL;
+    }
+    RegisteredList(const RegisteredList &list, ID id) : std::vector<ID>(list)
+    {
+        this->push_back(id);
+        m_extensions = NULL;
+        m_next = NULL;
+    }
+
+    /** The first list extending this one */
+    mutable std::atomic<RegisteredList *> m_extensions;
+    /** The next list extending the same list as this one */
+    RegisteredList *m_next;
+};
+
+/**
+ * Return the shared list made of the ids in list followed by id.
+ * Each list is created only once and is identified by the list it extends and the id appended,
+ * so all objects going through the same sequence of registrations point to the same list.
+ * The lists are never deleted. Only the creation of a list is guarded by a mutex.
+ */
+template <class ID> static const std::vector<ID> *GetRegisteredList(const std::vector<ID> *list, ID id)
+{
+    // All the lists are created as RegisteredList (see GetEmptyList)
+    const RegisteredList<ID> *registeredList = static_cast<const RegisteredList<ID> *>(list);
+
+    RegisteredList<ID> *extension;
+    for (extension = registeredList->m_extensions.load(std::memory_order_acquire); extension;
+         extension = extension->m_next) {
+        if (extension->back() == id) return extension;
+    }
+
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Look again since the list might have been created in the meantime
+    RegisteredList<ID> *first = registeredList->m_extensions.load(std::memory_order_acquire);
+    for (extension = first; extension; extension = extension->m_next) {
+        if (extension->back() == id) return extension;
+    }
+    extension = new RegisteredList<ID>(*registeredList, id);
+    extension->m_next = first;
+    registeredList->m_extensions.store(extension, std::memory_order_release);
+    return extension;
+}
+
+/**
+ * Return the empty shared list from which all the lists are built.
+ */
+template <class ID> static const std::vector<ID> *GetEmptyList()
+{
+    static const RegisteredList<ID> emptyList;
+    return &emptyList;
+}
+
+/**
+ * Return the Doc at the root of the tree of the object (NULL if there is none).
+ * This uses a dynamic_cast and no virtual method because it can be called from destructors.
+ */
+static Doc *GetRootDoc(Object *object)
+{
+    Object *root = object;
+    while (root->GetParent()) {
+        root = root->GetParent();
+    }
+    return dynamic_cast<Doc *>(root);
+}
 
 Object::Object() : BoundingBox()
 {
     Init("m-");
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
 Object::Object(std::string classid) : BoundingBox()
 {
     Init(classid);
-    if (s_objectCounter++ == 0) {
-        SeedUuid();
-    }
 }
 
 Object *Object::Clone() const
@@ -79,6 +154,8 @@ Object::Object(const Object &object) : BoundingBox(object)
     m_isReferencObject = object.m_isReferencObject;
     m_uuid = object.m_uuid; // for now copy the uuid - to be decided
     m_isModified = true;
+    m_attClasses = GetEmptyList<AttClassId>();
+    m_interfaces = GetEmptyList<InterfaceId>();
     int i;
     for (i = 0; i < (int)object.m_children.size(); i++) {
         Object *current = object.m_children.at(i);
@@ -93,6 +170,7 @@ Object &Object::operator=(const Object &object)
 {
     // not self assignement
     if (this != &object) {
+        this->RemoveFromDocUuidIndex();
         ClearChildren();
         ResetBoundingBox(); // It does not make sense to keep the values of the BBox
         m_parent = NULL;
@@ -125,6 +203,8 @@ void Object::Init(std::string classid)
     m_isModified = true;
     m_classid = classid;
     m_isReferencObject = false;
+    m_attClasses = GetEmptyList<AttClassId>();
+    m_interfaces = GetEmptyList<InterfaceId>();
     this->GenerateUuid();
 
     Reset();
@@ -150,10 +230,17 @@ void Object::Reset()
     ResetBoundingBox();
 };
 
+void Object::RegisterAttClass(AttClassId attClassId)
+{
+    m_attClasses = GetRegisteredList(m_attClasses, attClassId);
+}
+
 void Object::RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
 {
-    m_attClasses.insert(m_attClasses.end(), attClasses->begin(), attClasses->end());
-    m_interfaces.push_back(interfaceId);
+    for (AttClassId attClassId : *attClasses) {
+        m_attClasses = GetRegisteredList(m_attClasses, attClassId);
+    }
+    m_interfaces = GetRegisteredList(m_interfaces, interfaceId);
 }
 
 bool Object::IsBoundaryElement()
@@ -185,6 +272,7 @@ void Object::MoveChildrenFrom(Object *sourceParent, int idx, bool allowTypeChang
         }
         else {
             this->m_children.push_back(child);
+            child->AddToDocUuidIndex();
         }
     }
 }
@@ -202,7 +290,10 @@ void Object::MoveItselfTo(Object *targetParent)
 
 void Object::SetUuid(std::string uuid)
 {
+    Doc *doc = GetRootDoc(this);
+    if (doc) doc->RemoveObjectFromUuidIndex(this, false);
     m_uuid = uuid;
+    if (doc) doc->AddObjectToUuidIndex(this, false);
 };
 
 void Object::ClearChildren()
@@ -212,11 +303,13 @@ void Object::ClearChildren()
         return;
     }
 
+    Doc *doc = (m_children.empty()) ? NULL : GetRootDoc(this);
     ArrayOfObjects::iterator iter;
     for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
         // we need to check if this is the parent
         // ownership might have been given up with Relinquish
         if ((*iter)->GetParent() == this) {
+            if (doc) doc->RemoveObjectFromUuidIndex(*iter);
             delete *iter;
         }
     }
@@ -292,10 +385,12 @@ void Object::InsertChild(Object *element, int idx)
 
     if (idx >= (int)m_children.size()) {
         m_children.push_back(element);
-        return;
     }
-    ArrayOfObjects::iterator iter = m_children.begin();
-    m_children.insert(iter + (idx), element);
+    else {
+        ArrayOfObjects::iterator iter = m_children.begin();
+        m_children.insert(iter + (idx), element);
+    }
+    element->AddToDocUuidIndex();
 }
 
 Object *Object::DetachChild(int idx)
@@ -304,6 +399,7 @@ Object *Object::DetachChild(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    child->RemoveFromDocUuidIndex();
     child->ResetParent();
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
@@ -332,6 +428,7 @@ Object *Object::Relinquish(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    child->RemoveFromDocUuidIndex();
     child->ResetParent();
     return child;
 }
@@ -350,6 +447,25 @@ void Object::ClearRelinquishedChildren()
 
 Object *Object::FindChildByUuid(std::string uuid, int deepness, bool direction)
 {
+    // Look in the uuid index when the object is in a doc
+    Doc *doc = GetRootDoc(this);
+    Object *indexed = NULL;
+    if (doc && (deepness == UNLIMITED_DEPTH) && (direction == FORWARD)
+        && ((this == doc) || (doc->FindInUuidIndex(this->GetUuid(), &indexed) && (indexed == this)))
+        && doc->FindInUuidIndex(uuid, &indexed)) {
+        // Make sure the object is a descendant not hidden by an editorial element as with the FindByUuid functor
+        Object *current = indexed;
+        while (current && (current != this)) {
+            current = current->m_parent;
+            if (current && current->IsEditorialElement()) {
+                EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(current);
+                assert(editorialElement);
+                if (editorialElement->m_visibility == Hidden) return NULL;
+            }
+        }
+        return current ? indexed : NULL;
+    }
+
     Functor findByUuid(&Object::FindByUuid);
     FindByUuidParams findbyUuidParams;
     findbyUuidParams.m_uuid = uuid;
@@ -410,6 +526,7 @@ bool Object::DeleteChild(Object *child)
 {
     auto it = std::find(m_children.begin(), m_children.end(), child);
     if (it != m_children.end()) {
+        child->RemoveFromDocUuidIndex();
         m_children.erase(it);
         delete child;
         this->Modify();
@@ -423,7 +540,12 @@ bool Object::DeleteChild(Object *child)
 
 void Object::GenerateUuid()
 {
-    int nr = std::rand();
+    if (!s_uuidGeneratorSeeded) {
+        SeedUuid();
+    }
+
+    // Keep the value positive as with std::rand
+    int nr = (int)(s_uuidGenerator() >> 1);
     char str[17];
     // I do not want to use a stream for doing this!
     snprintf(str, 17, "%016d", nr);
@@ -433,18 +555,24 @@ void Object::GenerateUuid()
 
 void Object::ResetUuid()
 {
+    Doc *doc = GetRootDoc(this);
+    if (doc) doc->RemoveObjectFromUuidIndex(this, false);
     GenerateUuid();
+    if (doc) doc->AddObjectToUuidIndex(this, false);
 }
 
 void Object::SeedUuid(unsigned int seed)
 {
-    // Init random number generator for uuids
+    // Init random number generator for uuids of the current thread
     if (seed == 0) {
-        std::srand((unsigned int)std::time(0));
+        // Mix in the thread id for threads starting at the same time not to generate the same uuids
+        size_t threadHash = std::hash<std::thread::id>()(std::this_thread::get_id());
+        s_uuidGenerator.seed((unsigned int)std::time(0) ^ (unsigned int)threadHash);
     }
     else {
-        std::srand(seed);
+        s_uuidGenerator.seed(seed);
     }
+    s_uuidGeneratorSeeded = true;
 }
 
 void Object::SetParent(Object *parent)
@@ -506,11 +634,29 @@ int Object::GetChildIndex(const Object *child)
 
 void Object::Modify(bool modified)
 {
-    // if we have a parent and a new modification, propagate it
-    if (m_parent && modified) {
-        m_parent->Modify();
-    }
     m_isModified = modified;
+    if (!modified) return;
+
+    // propagate the modification to the parents
+    // The flag is written only when not set, since the common ancestors of objects processed in several threads
+    // are shared by them (see Doc::StartProcessingInThreads)
+    Object *parent = m_parent;
+    while (parent) {
+        if (!parent->m_isModified) parent->m_isModified = true;
+        parent = parent->m_parent;
+    }
+}
+
+void Object::AddToDocUuidIndex()
+{
+    Doc *doc = GetRootDoc(this);
+    if (doc) doc->AddObjectToUuidIndex(this);
+}
+
+void Object::RemoveFromDocUuidIndex()
+{
+    Doc *doc = GetRootDoc(this);
+    if (doc) doc->RemoveObjectFromUuidIndex(this);
 }
 
 void Object::FillFlatList(ListOfObjects *flatList)
@@ -642,6 +788,83 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
     }
 }
 
+void Object::ProcessByLayer(Functor *functor, ArrayOfLayerProcessingItems *items, Functor *endFunctor)
+{
+    assert(items);
+
+    std::vector<LayerProcessingItem *> layerItems;
+    for (auto &item : *items) {
+        item.m_returnCode = FUNCTOR_CONTINUE;
+        layerItems.push_back(&item);
+    }
+    this->ProcessLayerItems(functor, &layerItems, endFunctor);
+}
+
+void Object::ProcessLayerItems(Functor *functor, std::vector<LayerProcessingItem *> *items, Functor *endFunctor)
+{
+    bool processChildren = true;
+    if (functor->m_visibleOnly && this->IsEditorialElement()) {
+        EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(this);
+        assert(editorialElement);
+        if (editorialElement->m_visibility == Hidden) {
+            processChildren = false;
+        }
+    }
+
+    // The items for which the children (and the end functor) have to be processed - see Object::Process
+    std::vector<LayerProcessingItem *> processed;
+    for (auto &item : *items) {
+        if (item->m_returnCode == FUNCTOR_STOP) continue;
+        functor->Call(this, item->m_params);
+        item->m_returnCode = functor->m_returnCode;
+        // do not go any deeper in this case
+        if (item->m_returnCode == FUNCTOR_SIBLINGS) {
+            item->m_returnCode = FUNCTOR_CONTINUE;
+            continue;
+        }
+        processed.push_back(item);
+    }
+
+    if (processChildren && !processed.empty()) {
+        std::vector<LayerProcessingItem *> childItems;
+        ArrayOfObjects::iterator iter;
+        for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
+            // The filtering is the same as with AttCommonNComparison filters in Object::Process
+            ClassId classId = (*iter)->GetClassId();
+            bool isFiltered = ((classId == STAFF) || (classId == LAYER) || (classId == VERSE));
+            bool hasN = (isFiltered && (*iter)->HasAttClass(ATT_COMMON));
+            int n = 0;
+            if (hasN) {
+                AttCommon *att = dynamic_cast<AttCommon *>(*iter);
+                assert(att);
+                n = att->GetN();
+            }
+            childItems.clear();
+            for (auto &item : processed) {
+                if (classId == STAFF) {
+                    if (!hasN || (n != item->m_staffN)) continue;
+                }
+                else if (classId == LAYER) {
+                    if (!hasN || (n != item->m_layerN)) continue;
+                }
+                else if ((classId == VERSE) && item->m_byVerse) {
+                    if (!hasN || (n != item->m_verseN)) continue;
+                }
+                childItems.push_back(item);
+            }
+            if (!childItems.empty()) {
+                (*iter)->ProcessLayerItems(functor, &childItems, endFunctor);
+            }
+        }
+    }
+
+    if (endFunctor) {
+        for (auto &item : processed) {
+            endFunctor->Call(this, item->m_params);
+        }
+    }
+}
+
 int Object::Save(FileOutputStream *output)
 {
     SaveParams saveParams(output);
@@ -670,6 +893,8 @@ ObjectListInterface &ObjectListInterface::operator=(const ObjectListInterface &i
     // actually nothing to do, we just don't want the list to be copied
     if (this != &interface) {
         this->m_list.clear();
+        this->m_listVector.clear();
+        this->m_listIndexes.clear();
     }
     return *this;
 }
@@ -685,6 +910,13 @@ void ObjectListInterface::ResetList(Object *node)
     m_list.clear();
     node->FillFlatList(&m_list);
     this->FilterList(&m_list);
+
+    m_listVector.assign(m_list.begin(), m_list.end());
+    m_listIndexes.clear();
+    int i;
+    for (i = 0; i < (int)m_listVector.size(); ++i) {
+        m_listIndexes.insert({ m_listVector.at(i), i });
+    }
 }
 
 ListOfObjects *ObjectListInterface::GetList(Object *node)
@@ -695,69 +927,40 @@ ListOfObjects *ObjectListInterface::GetList(Object *node)
 
 int ObjectListInterface::GetListIndex(const Object *listElement)
 {
-    ListOfObjects::iterator iter;
-    int i;
-    for (iter = m_list.begin(), i = 0; iter != m_list.end(); ++iter, i++) {
-        if (listElement == *iter) {
-            return i;
-        }
-    }
-    return -1;
+    auto it = m_listIndexes.find(listElement);
+    return (it == m_listIndexes.end()) ? -1 : it->second;
 }
 
 Object *ObjectListInterface::GetListFirst(const Object *startFrom, const ClassId classId)
 {
-    ListOfObjects::iterator it = m_list.begin();
     int idx = GetListIndex(startFrom);
     if (idx == -1) return NULL;
-    std::advance(it, idx);
-    it = std::find_if(it, m_list.end(), ObjectComparison(classId));
-    return (it == m_list.end()) ? NULL : *it;
+    ArrayOfObjects::iterator it
+        = std::find_if(m_listVector.begin() + idx, m_listVector.end(), ObjectComparison(classId));
+    return (it == m_listVector.end()) ? NULL : *it;
 }
 
 Object *ObjectListInterface::GetListFirstBackward(Object *startFrom, const ClassId classId)
 {
-    ListOfObjects::iterator it = m_list.begin();
     int idx = GetListIndex(startFrom);
     if (idx == -1) return NULL;
-    std::advance(it, idx);
-    ListOfObjects::reverse_iterator rit(it);
-    rit = std::find_if(rit, m_list.rend(), ObjectComparison(classId));
-    return (rit == m_list.rend()) ? NULL : *rit;
+    ArrayOfObjects::reverse_iterator rit(m_listVector.begin() + idx);
+    rit = std::find_if(rit, m_listVector.rend(), ObjectComparison(classId));
+    return (rit == m_listVector.rend()) ? NULL : *rit;
 }
 
 Object *ObjectListInterface::GetListPrevious(Object *listElement)
 {
-    ListOfObjects::iterator iter;
-    int i;
-    for (iter = m_list.begin(), i = 0; iter != m_list.end(); ++iter, i++) {
-        if (listElement == *iter) {
-            if (i > 0) {
-                return *(--iter);
-            }
-            else {
-                return NULL;
-            }
-        }
-    }
-    return NULL;
+    int idx = GetListIndex(listElement);
+    if (idx < 1) return NULL;
+    return m_listVector.at(idx - 1);
 }
 
 Object *ObjectListInterface::GetListNext(Object *listElement)
 {
-    ListOfObjects::reverse_iterator iter;
-    int i;
-    for (iter = m_list.rbegin(), i = 0; iter != m_list.rend(); ++iter, i++) {
-        if (listElement == *iter) {
-            if (i > 0) {
-                return *(--iter);
-            }
-            else {
-                return NULL;
-            }
-        }
-    }
-    return NULL;
+    int idx = GetListIndex(listElement);
+    if ((idx == -1) || (idx + 1 >= (int)m_listVector.size())) return NULL;
+    return m_listVector.at(idx + 1);
 }
 
 //----------------------------------------------------------------------------
@@ -849,6 +1052,38 @@ int Object::FindByUuid(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int Object::AddToUuidIndex(FunctorParams *functorParams)
+{
+    AddToUuidIndexParams *params = dynamic_cast<AddToUuidIndexParams *>(functorParams);
+    assert(params);
+
+    std::pair<MapOfUuidObjects::iterator, bool> result
+        = params->m_uuidIndex->insert(std::make_pair(this->GetUuid(), this));
+    // The uuid is already used by another object - mark it as not unique
+    if (!result.second && (result.first->second != this)) {
+        result.first->second = NULL;
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
+int Object::RemoveFromUuidIndex(FunctorParams *functorParams)
+{
+    RemoveFromUuidIndexParams *params = dynamic_cast<RemoveFromUuidIndexParams *>(functorParams);
+    assert(params);
+
+    MapOfUuidObjects::iterator iter = params->m_uuidIndex->find(this->GetUuid());
+    if (iter == params->m_uuidIndex->end()) return FUNCTOR_CONTINUE;
+    if (!iter->second) {
+        params->m_notUnique = true;
+    }
+    else if (iter->second == this) {
+        params->m_uuidIndex->erase(iter);
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
 int Object::FindByAttComparison(FunctorParams *functorParams)
 {
     FindByAttComparisonParams *params = dynamic_cast<FindByAttComparisonParams *>(functorParams);
@@ -9,7 +9,11 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <functional>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -17,12 +21,51 @@
 #include "bboxdevicecontext.h"
 #include "doc.h"
 #include "functorparams.h"
+#include "measure.h"
 #include "system.h"
 #include "view.h"
 #include "vrv.h"
 
 namespace vrv {
 
+/**
+ * Call the function for each object of the doc with the given number of threads (including the calling one).
+ * Each thread takes the next object until all of them are done.
+ */
+static void ProcessInThreads(
+    Doc *doc, const ArrayOfObjects &objects, int threads, const std::function<void(Object *)> &function)
+{
+    assert(doc);
+
+    threads = std::min(threads, (int)objects.size());
+
+    // The font is selected per thread
+    const Resources::GlyphTable *font = Resources::GetCurrentFont();
+    std::atomic<int> next(0);
+
+    auto processObjects = [&]() {
+        Resources::SetCurrentFont(font);
+        int i;
+        while ((i = next++) < (int)objects.size()) {
+            function(objects.at(i));
+        }
+    };
+
+    doc->StartProcessingInThreads(objects);
+
+    std::vector<std::thread> workers;
+    int i;
+    for (i = 1; i < threads; ++i) {
+        workers.push_back(std::thread(processObjects));
+    }
+    processObjects();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    doc->EndProcessingInThreads();
+}
+
 //----------------------------------------------------------------------------
 // Page
 //----------------------------------------------------------------------------
@@ -65,6 +108,7 @@ void Page::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -92,7 +136,7 @@ void Page::LayOutTranscription(bool force)
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
-    assert(this == doc->GetDrawingPage());
+    assert(doc->IsDrawingPage(this));
 
     // Reset the horizontal alignment
     Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
@@ -160,7 +204,7 @@ void Page::LayOutHorizontally()
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
-    assert(this == doc->GetDrawingPage());
+    assert(doc->IsDrawingPage(this));
 
     // Reset the horizontal alignment
     Functor resetHorizontalAlignment(&Object::ResetHorizontalAlignment);
@@ -231,31 +275,37 @@ void Page::LayOutHorizontally()
     view.SetPage(this->GetIdx(), false);
     view.DrawCurrentPage(&bBoxDC, false);
 
-    // Adjust the x position of the LayerElement where multiple layer collide
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustLayers(&Object::AdjustLayers);
-    AdjustLayersParams adjustLayersParams(doc, &adjustLayers, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustLayers, &adjustLayersParams);
-
-    // Adjust the X position of the accidentals, including in chords
-    Functor adjustAccidX(&Object::AdjustAccidX);
-    AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
-    this->Process(&adjustAccidX, &adjustAccidXParams);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustXPos(&Object::AdjustXPos);
-    Functor adjustXPosEnd(&Object::AdjustXPosEnd);
-    AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustGraceXPos(&Object::AdjustGraceXPos);
-    Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
-    AdjustGraceXPosParams adjustGraceXPosParams(
-        doc, &adjustGraceXPos, &adjustGraceXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+    int threads = doc->GetLayoutThreads();
+    if (threads > 1) {
+        this->AdjustMeasuresHorizontally(doc, threads);
+    }
+    else {
+        // Adjust the x position of the LayerElement where multiple layer collide
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustLayers(&Object::AdjustLayers);
+        AdjustLayersParams adjustLayersParams(doc, &adjustLayers, doc->m_scoreDef.GetStaffNs());
+        this->Process(&adjustLayers, &adjustLayersParams);
+
+        // Adjust the X position of the accidentals, including in chords
+        Functor adjustAccidX(&Object::AdjustAccidX);
+        AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
+        this->Process(&adjustAccidX, &adjustAccidXParams);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustXPos(&Object::AdjustXPos);
+        Functor adjustXPosEnd(&Object::AdjustXPosEnd);
+        AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, doc->m_scoreDef.GetStaffNs());
+        this->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustGraceXPos(&Object::AdjustGraceXPos);
+        Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
+        AdjustGraceXPosParams adjustGraceXPosParams(
+            doc, &adjustGraceXPos, &adjustGraceXPosEnd, doc->m_scoreDef.GetStaffNs());
+        this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+    }
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
@@ -279,7 +329,7 @@ void Page::LayOutVertically()
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
-    assert(this == doc->GetDrawingPage());
+    assert(doc->IsDrawingPage(this));
 
     // Reset the vertical alignment
     Functor resetVerticalAlignment(&Object::ResetVerticalAlignment);
@@ -310,32 +360,38 @@ void Page::LayOutVertically()
     view.SetPage(this->GetIdx(), false);
     view.DrawCurrentPage(&bBoxDC, false);
 
-    // Adjust the position of outside articulations with slurs end and start positions
-    FunctorDocParams adjustArticWithSlursParams(doc);
-    Functor adjustArticWithSlurs(&Object::AdjustArticWithSlurs);
-    this->Process(&adjustArticWithSlurs, &adjustArticWithSlursParams);
-
-    // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
-    SetOverflowBBoxesParams setOverflowBBoxesParams(doc);
-    Functor setOverflowBBoxes(&Object::SetOverflowBBoxes);
-    Functor setOverflowBBoxesEnd(&Object::SetOverflowBBoxesEnd);
-    this->Process(&setOverflowBBoxes, &setOverflowBBoxesParams, &setOverflowBBoxesEnd);
-
-    // Adjust the positioners of floationg elements (slurs, hairpin, dynam, etc)
-    Functor adjustFloatingPostioners(&Object::AdjustFloatingPostioners);
-    AdjustFloatingPostionersParams adjustFloatingPostionersParams(doc, &adjustFloatingPostioners);
-    this->Process(&adjustFloatingPostioners, &adjustFloatingPostionersParams);
-
-    // Adjust the overlap of the staff aligmnents by looking at the overflow bounding boxes params.clear();
-    Functor adjustStaffOverlap(&Object::AdjustStaffOverlap);
-    AdjustStaffOverlapParams adjustStaffOverlapParams(&adjustStaffOverlap);
-    this->Process(&adjustStaffOverlap, &adjustStaffOverlapParams);
-
-    // Set the Y position of each StaffAlignment
-    // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
-    Functor adjustYPos(&Object::AdjustYPos);
-    AdjustYPosParams adjustYPosParams(doc, &adjustYPos);
-    this->Process(&adjustYPos, &adjustYPosParams);
+    int threads = doc->GetLayoutThreads();
+    if (threads > 1) {
+        this->AdjustSystemsVertically(doc, threads);
+    }
+    else {
+        // Adjust the position of outside articulations with slurs end and start positions
+        FunctorDocParams adjustArticWithSlursParams(doc);
+        Functor adjustArticWithSlurs(&Object::AdjustArticWithSlurs);
+        this->Process(&adjustArticWithSlurs, &adjustArticWithSlursParams);
+
+        // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
+        SetOverflowBBoxesParams setOverflowBBoxesParams(doc);
+        Functor setOverflowBBoxes(&Object::SetOverflowBBoxes);
+        Functor setOverflowBBoxesEnd(&Object::SetOverflowBBoxesEnd);
+        this->Process(&setOverflowBBoxes, &setOverflowBBoxesParams, &setOverflowBBoxesEnd);
+
+        // Adjust the positioners of floationg elements (slurs, hairpin, dynam, etc)
+        Functor adjustFloatingPostioners(&Object::AdjustFloatingPostioners);
+        AdjustFloatingPostionersParams adjustFloatingPostionersParams(doc, &adjustFloatingPostioners);
+        this->Process(&adjustFloatingPostioners, &adjustFloatingPostionersParams);
+
+        // Adjust the overlap of the staff aligmnents by looking at the overflow bounding boxes params.clear();
+        Functor adjustStaffOverlap(&Object::AdjustStaffOverlap);
+        AdjustStaffOverlapParams adjustStaffOverlapParams(&adjustStaffOverlap);
+        this->Process(&adjustStaffOverlap, &adjustStaffOverlapParams);
+
+        // Set the Y position of each StaffAlignment
+        // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
+        Functor adjustYPos(&Object::AdjustYPos);
+        AdjustYPosParams adjustYPosParams(doc, &adjustYPos);
+        this->Process(&adjustYPos, &adjustYPosParams);
+    }
 
     // Adjust system Y position
     AlignSystemsParams alignSystemsParams;
@@ -357,12 +413,26 @@ void Page::JustifyHorizontally()
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
-    assert(this == doc->GetDrawingPage());
+    assert(doc->IsDrawingPage(this));
+
+    int systemFullWidth = doc->m_drawingPageWidth - doc->m_drawingPageLeftMar - doc->m_drawingPageRightMar;
+
+    // Each system is justified independently from the other ones
+    int threads = doc->GetLayoutThreads();
+    if (threads > 1) {
+        ProcessInThreads(doc, m_children, threads, [systemFullWidth](Object *system) {
+            Functor justifyX(&Object::JustifyX);
+            JustifyXParams justifyXParams(&justifyX);
+            justifyXParams.m_systemFullWidth = systemFullWidth;
+            system->Process(&justifyX, &justifyXParams);
+        });
+        return;
+    }
 
     // Justify X position
     Functor justifyX(&Object::JustifyX);
     JustifyXParams justifyXParams(&justifyX);
-    justifyXParams.m_systemFullWidth = doc->m_drawingPageWidth - doc->m_drawingPageLeftMar - doc->m_drawingPageRightMar;
+    justifyXParams.m_systemFullWidth = systemFullWidth;
     this->Process(&justifyX, &justifyXParams);
 }
 
@@ -373,7 +443,7 @@ void Page::LayOutPitchPos()
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
-    assert(this == doc->GetDrawingPage());
+    assert(doc->IsDrawingPage(this));
 
     // Set the pitch / pos alignement
     SetAlignmentPitchPosParams setAlignmentPitchPosParams(doc);
@@ -392,7 +462,7 @@ int Page::GetContentHeight() const
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
-    assert(this == doc->GetDrawingPage());
+    assert(doc->IsDrawingPage(this));
 
     System *last = dynamic_cast<System *>(m_children.back());
     assert(last);
@@ -408,7 +478,7 @@ int Page::GetContentWidth() const
 
     // Doc::SetDrawingPage should have been called before
     // Make sure we have the correct page
-    assert(this == doc->GetDrawingPage());
+    assert(doc->IsDrawingPage(this));
 
     System *first = dynamic_cast<System *>(m_children.front());
     assert(first);
@@ -451,6 +521,70 @@ void Page::AdjustSylSpacingByVerse(PrepareProcessingListsParams &listsParams, Do
     }
 }
 
+void Page::AdjustMeasuresHorizontally(Doc *doc, int threads)
+{
+    ArrayOfObjects measures = this->FindAllChildByType(MEASURE);
+    std::vector<int> staffNs = doc->m_scoreDef.GetStaffNs();
+
+    // Make sure the systems do not change their cached x when read concurrently by the measures
+    ArrayOfObjects::iterator iter;
+    for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
+        (*iter)->GetDrawingX();
+    }
+
+    ProcessInThreads(doc, measures, threads, [doc, &staffNs](Object *measure) {
+        Functor adjustLayers(&Object::AdjustLayers);
+        AdjustLayersParams adjustLayersParams(doc, &adjustLayers, staffNs);
+        measure->Process(&adjustLayers, &adjustLayersParams);
+
+        Functor adjustAccidX(&Object::AdjustAccidX);
+        AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
+        measure->Process(&adjustAccidX, &adjustAccidXParams);
+
+        Functor adjustXPos(&Object::AdjustXPos);
+        Functor adjustXPosEnd(&Object::AdjustXPosEnd);
+        AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, staffNs);
+        measure->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
+
+        Functor adjustGraceXPos(&Object::AdjustGraceXPos);
+        Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
+        AdjustGraceXPosParams adjustGraceXPosParams(doc, &adjustGraceXPos, &adjustGraceXPosEnd, staffNs);
+        measure->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+    });
+}
+
+void Page::AdjustSystemsVertically(Doc *doc, int threads)
+{
+    // Make sure the systems do not change their cached y when read concurrently by their content
+    ArrayOfObjects::iterator iter;
+    for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
+        (*iter)->GetDrawingY();
+    }
+
+    ProcessInThreads(doc, m_children, threads, [doc](Object *system) {
+        FunctorDocParams adjustArticWithSlursParams(doc);
+        Functor adjustArticWithSlurs(&Object::AdjustArticWithSlurs);
+        system->Process(&adjustArticWithSlurs, &adjustArticWithSlursParams);
+
+        SetOverflowBBoxesParams setOverflowBBoxesParams(doc);
+        Functor setOverflowBBoxes(&Object::SetOverflowBBoxes);
+        Functor setOverflowBBoxesEnd(&Object::SetOverflowBBoxesEnd);
+        system->Process(&setOverflowBBoxes, &setOverflowBBoxesParams, &setOverflowBBoxesEnd);
+
+        Functor adjustFloatingPostioners(&Object::AdjustFloatingPostioners);
+        AdjustFloatingPostionersParams adjustFloatingPostionersParams(doc, &adjustFloatingPostioners);
+        system->Process(&adjustFloatingPostioners, &adjustFloatingPostionersParams);
+
+        Functor adjustStaffOverlap(&Object::AdjustStaffOverlap);
+        AdjustStaffOverlapParams adjustStaffOverlapParams(&adjustStaffOverlap);
+        system->Process(&adjustStaffOverlap, &adjustStaffOverlapParams);
+
+        Functor adjustYPos(&Object::AdjustYPos);
+        AdjustYPosParams adjustYPosParams(doc, &adjustYPos);
+        system->Process(&adjustYPos, &adjustYPosParams);
+    });
+}
+
 void Page::UpgradePageBasedMEI(Doc *doc)
 {
     // Once we have the GetPPU in Page through LibMEI, call this from Doc::SetDrawingPage and
@@ -55,6 +55,9 @@ void Rest::Reset()
     ResetColor();
     ResetRelativesize();
     ResetRestVisMensural();
+
+    m_playingOnset = 0.0;
+    m_playingOffset = 0.0;
 }
 
 void Rest::AddChild(Object *child)
@@ -78,6 +81,7 @@ void Rest::AddChild(Object *child)
         m_children.insert(m_children.begin(), child);
     else
         m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -93,6 +93,7 @@ void BTrem::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 //----------------------------------------------------------------------------
@@ -140,6 +141,7 @@ void FTrem::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -201,6 +201,7 @@ void ScoreDef::Reset()
 
     m_drawLabels = false;
     m_drawingWidth = 0;
+    m_castOffWidth = 0;
     m_setAsDrawing = false;
 }
 
@@ -219,6 +220,7 @@ void ScoreDef::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -321,14 +323,24 @@ void ScoreDef::FilterList(ListOfObjects *childList)
             iter++;
         }
     }
+
+    m_staffDefsByN.clear();
+    for (iter = childList->begin(); iter != childList->end(); ++iter) {
+        StaffDef *staffDef = dynamic_cast<StaffDef *>(*iter);
+        assert(staffDef);
+        m_staffDefsByN.insert({ staffDef->GetN(), staffDef });
+    }
 }
 
 StaffDef *ScoreDef::GetStaffDef(int n)
 {
-    this->ResetList(this);
     ListOfObjects *childList = this->GetList(this);
     ListOfObjects::iterator iter;
 
+    // The @n might have been changed since the list was built, so double check it
+    auto it = m_staffDefsByN.find(n);
+    if ((it != m_staffDefsByN.end()) && (it->second->GetN() == n)) return it->second;
+
     StaffDef *staffDef = NULL;
     for (iter = childList->begin(); iter != childList->end(); ++iter) {
         if (!(*iter)->Is(STAFFDEF)) continue;
@@ -439,6 +451,7 @@ void StaffGrp::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -538,7 +551,10 @@ int ScoreDef::CastOffSystems(FunctorParams *functorParams)
     // the initial one - for this to be corrected, we would need two parameters, one for the current initial
     // scoreDef and one for the current that will be the initial one at the next system
     // Also, the abbr label (width) changes would not be taken into account
-    params->m_currentScoreDefWidth = this->GetDrawingWidth() + params->m_contentSystem->GetDrawingAbbrLabelsWidth();
+    if (!params->m_reuseLayout) {
+        m_castOffWidth = this->GetDrawingWidth() + params->m_contentSystem->GetDrawingAbbrLabelsWidth();
+    }
+    params->m_currentScoreDefWidth = m_castOffWidth;
 
     return FUNCTOR_SIBLINGS;
 }
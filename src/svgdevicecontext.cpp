@@ -56,6 +56,7 @@ SvgDeviceContext::SvgDeviceContext(int width, int height) : DeviceContext()
     SetPen(AxBLACK, 1, AxSOLID);
 
     m_smufl_glyphs.clear();
+    m_smuflGlyphCodes.reset();
 
     m_committed = false;
     m_vrvTextFont = false;
@@ -100,27 +101,23 @@ void SvgDeviceContext::Commit(bool xml_declaration)
 
     // add the woff VerovioText font if needed
     if (m_vrvTextFont) {
-        std::string woff = Resources::GetPath() + "/woff.xml";
-        pugi::xml_document woffDoc;
-        woffDoc.load_file(woff.c_str());
-        m_svgNode.prepend_copy(woffDoc.first_child());
+        m_svgNode.prepend_copy(Resources::GetTextFontDefinition().first_child());
     }
 
     // header
     if (m_smufl_glyphs.size() > 0) {
 
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
 
         // for each needed glyph
-        std::vector<std::string>::const_iterator it;
+        std::vector<const Glyph *>::const_iterator it;
         for (it = m_smufl_glyphs.begin(); it != m_smufl_glyphs.end(); ++it) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source((*it).c_str());
-            sourceDoc.load(source);
+            // the glyph file was parsed when loading the font
+            const pugi::xml_document *sourceDoc = (*it)->GetXML();
+            if (!sourceDoc) continue;
 
             // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+            for (pugi::xml_node child = sourceDoc->first_child(); child; child = child.next_sibling()) {
                 defs.append_copy(child);
             }
         }
@@ -741,12 +738,15 @@ void SvgDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, boo
             continue;
         }
 
-        std::string path = glyph->GetPath();
-
         // Add the glyph to the array for the <defs>
-        std::vector<std::string>::const_iterator it = std::find(m_smufl_glyphs.begin(), m_smufl_glyphs.end(), path);
-        if (it == m_smufl_glyphs.end()) {
-            m_smufl_glyphs.push_back(path);
+        if ((c >= SMUFL_CODE_FIRST) && (c <= SMUFL_CODE_LAST)) {
+            if (!m_smuflGlyphCodes.test(c - SMUFL_CODE_FIRST)) {
+                m_smuflGlyphCodes.set(c - SMUFL_CODE_FIRST);
+                m_smufl_glyphs.push_back(glyph);
+            }
+        }
+        else if (std::find(m_smufl_glyphs.begin(), m_smufl_glyphs.end(), glyph) == m_smufl_glyphs.end()) {
+            m_smufl_glyphs.push_back(glyph);
         }
 
         // Write the char in the SVG
@@ -94,6 +94,7 @@ void System::AddChild(Object *child)
 
     child->SetParent(this);
     m_children.push_back(child);
+    child->AddToDocUuidIndex();
     Modify();
 }
 
@@ -101,7 +102,8 @@ int System::GetDrawingX() const
 {
     if (m_xAbs != VRV_UNSET) return m_xAbs;
 
-    m_cachedDrawingX = 0;
+    // Do not write it again since measures can read it concurrently (see Page::AdjustMeasuresHorizontally)
+    if (m_cachedDrawingX != 0) m_cachedDrawingX = 0;
     return m_drawingXRel;
 }
 
@@ -109,7 +111,8 @@ int System::GetDrawingY() const
 {
     if (m_yAbs != VRV_UNSET) return m_yAbs;
 
-    m_cachedDrawingY = 0;
+    // Do not write it again since the content can read it concurrently (see Page::AdjustSystemsVertically)
+    if (m_cachedDrawingY != 0) m_cachedDrawingY = 0;
     return m_drawingYRel;
 }
 
@@ -10,6 +10,9 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -25,8 +28,10 @@
 #include "note.h"
 #include "page.h"
 #include "slur.h"
+#include "staff.h"
 #include "style.h"
 #include "svgdevicecontext.h"
+#include "timeinterface.h"
 #include "vrv.h"
 
 #include "functorparams.h"
@@ -44,12 +49,11 @@ const char *UTF_16_LE_BOM = "\xFF\xFE";
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
-
 Toolkit::Toolkit(bool initFont)
 {
     m_scale = DEFAULT_SCALE;
     m_format = AUTO;
+    m_outformat = UNKNOWN;
 
     // default page size
     m_pageHeight = DEFAULT_PAGE_HEIGHT;
@@ -65,6 +69,7 @@ Toolkit::Toolkit(bool initFont)
     m_adjustPageHeight = false;
     m_noJustification = false;
     m_evenNoteSpacing = false;
+    m_layoutThreads = 1;
     m_showBoundingBoxes = false;
     m_scoreBasedMei = false;
     m_backgroundOpacity = 1.0;
@@ -208,6 +213,9 @@ void Toolkit::SetHeader(std::string title, std::string subtitle, std::string com
     m_doc.m_subtitle = subtitle;
     m_doc.m_composer = composer;
     m_doc.m_arrangement = arrangement;
+    m_doc.ResetCastOffLayout();
+
+    this->SelectFont();
 
     // Have to re-cast off the doc so that there is no system overflow due to the new header
     m_doc.UnCastOffDoc();
@@ -360,9 +368,21 @@ FileFormat Toolkit::IdentifyInputFormat(const string &data)
 
 bool Toolkit::SetFont(std::string const &font)
 {
-    return Resources::SetFont(font);
+    if (!Resources::SetFont(font)) return false;
+    m_font = font;
+    return true;
 };
 
+void Toolkit::SelectFont()
+{
+    if (m_font.empty()) {
+        Resources::ResetFont();
+    }
+    else {
+        Resources::SetFont(m_font);
+    }
+}
+
 bool Toolkit::LoadFile(const std::string &filename)
 {
     if (IsUTF16(filename)) {
@@ -440,6 +460,12 @@ bool Toolkit::LoadData(const std::string &data)
 {
     string newData;
     FileInputStream *input = NULL;
+#ifdef OBJECT_ARENA
+    // The objects created while loading and laying out the document are taken from its arena
+    ObjectArena::Scope arenaScope(m_doc.GetObjectArena());
+#endif
+    // Set to true when the input was already imported and no input stream is left (e.g., for Humdrum)
+    bool isImported = false;
 
     auto inputFormat = m_format;
     if (inputFormat == AUTO) {
@@ -456,6 +482,11 @@ bool Toolkit::LoadData(const std::string &data)
     else if (inputFormat == HUMDRUM) {
         // LogMessage("Importing Humdrum data");
 
+        // The Humdrum data is imported into a temporary document that is moved to the document on success. We need
+        // to go through MEI only when xpath queries have to be applied since they are evaluated on the MEI tree.
+        bool hasXPathQueries
+            = (m_appXPathQueries.size() > 0) || (m_choiceXPathQueries.size() > 0) || (m_mdivXPathQuery.length() > 0);
+
         Doc tempdoc;
         HumdrumInput *tempinput = new HumdrumInput(&tempdoc, "");
         tempinput->SetTypeOption(GetHumType());
@@ -473,15 +504,23 @@ bool Toolkit::LoadData(const std::string &data)
         SetHumdrumBuffer(tempinput->GetHumdrumString().c_str());
 
         if (GetOutputFormat() == HUMDRUM) {
+            delete tempinput;
             return true;
         }
 
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
+        if (hasXPathQueries) {
+            MeiOutput meioutput(&tempdoc, "");
+            meioutput.SetScoreBasedMEI(true);
+            newData = meioutput.GetOutput();
+            delete tempinput;
 
-        input = new MeiInput(&m_doc, "");
+            input = new MeiInput(&m_doc, "");
+        }
+        else {
+            m_doc.MoveContentFrom(&tempdoc);
+            delete tempinput;
+            isImported = true;
+        }
     }
 #endif
     else if (inputFormat == MEI) {
@@ -528,27 +567,29 @@ bool Toolkit::LoadData(const std::string &data)
     }
 
     // something went wrong
-    if (!input) {
+    if (!input && !isImported) {
         LogError("Unknown error");
         return false;
     }
 
-    // xpath queries?
-    if (m_appXPathQueries.size() > 0) {
-        input->SetAppXPathQueries(m_appXPathQueries);
-    }
-    if (m_choiceXPathQueries.size() > 0) {
-        input->SetChoiceXPathQueries(m_choiceXPathQueries);
-    }
-    if (m_mdivXPathQuery.length() > 0) {
-        input->SetMdivXPathQuery(m_mdivXPathQuery);
-    }
+    if (!isImported) {
+        // xpath queries?
+        if (m_appXPathQueries.size() > 0) {
+            input->SetAppXPathQueries(m_appXPathQueries);
+        }
+        if (m_choiceXPathQueries.size() > 0) {
+            input->SetChoiceXPathQueries(m_choiceXPathQueries);
+        }
+        if (m_mdivXPathQuery.length() > 0) {
+            input->SetMdivXPathQuery(m_mdivXPathQuery);
+        }
 
-    // load the file
-    if (!input->ImportString(newData.size() ? newData : data)) {
-        LogError("Error importing data");
-        delete input;
-        return false;
+        // load the file
+        if (!input->ImportString(newData.size() ? newData : data)) {
+            LogError("Error importing data");
+            delete input;
+            return false;
+        }
     }
 
     m_doc.SetPageHeight(this->GetPageHeight());
@@ -561,6 +602,9 @@ bool Toolkit::LoadData(const std::string &data)
     m_doc.SetSpacingStaff(this->GetSpacingStaff());
     m_doc.SetSpacingSystem(this->GetSpacingSystem());
     m_doc.SetEvenSpacing(this->GetEvenNoteSpacing());
+    m_doc.SetLayoutThreads(this->GetLayoutThreads());
+
+    this->SelectFont();
 
     m_doc.PrepareDrawing();
 
@@ -569,7 +613,7 @@ bool Toolkit::LoadData(const std::string &data)
     // might have been ignored because of the --ignore-layout option.
     // Regardless, we won't do layout if the --no-layout option was set.
     if (!m_noLayout) {
-        if (input->HasLayoutInformation() && !m_ignoreLayout) {
+        if (input && input->HasLayoutInformation() && !m_ignoreLayout) {
             // LogElapsedTimeStart();
             m_doc.CastOffEncodingDoc();
             // LogElapsedTimeEnd("layout");
@@ -691,9 +735,16 @@ bool Toolkit::ParseOptions(const std::string &json_options)
     // Note: it seems that there is a bug with jsonxx and emscripten
     // Boolean value false won't be parsed properly. We have to use Number instead
 
-    if (json.has<jsonxx::Number>("noLayout")) SetNoLayout(json.get<jsonxx::Number>("noLayout"));
+    // The font and the spacing options are checked by CastOffDoc itself, only the layout flags invalidate it here
+    if (json.has<jsonxx::Number>("noLayout") && (json.get<jsonxx::Number>("noLayout") != GetNoLayout())) {
+        SetNoLayout(json.get<jsonxx::Number>("noLayout"));
+        m_doc.ResetCastOffLayout();
+    }
 
-    if (json.has<jsonxx::Number>("ignoreLayout")) SetIgnoreLayout(json.get<jsonxx::Number>("ignoreLayout"));
+    if (json.has<jsonxx::Number>("ignoreLayout") && (json.get<jsonxx::Number>("ignoreLayout") != GetIgnoreLayout())) {
+        SetIgnoreLayout(json.get<jsonxx::Number>("ignoreLayout"));
+        m_doc.ResetCastOffLayout();
+    }
 
     if (json.has<jsonxx::Number>("adjustPageHeight")) SetAdjustPageHeight(json.get<jsonxx::Number>("adjustPageHeight"));
 
@@ -855,8 +906,11 @@ void Toolkit::RedoLayout()
     m_doc.SetSpacingStaff(this->GetSpacingStaff());
     m_doc.SetSpacingSystem(this->GetSpacingSystem());
 
+    this->SelectFont();
+
+    // The layout of the previous cast off is re-used unless the content, the font or the sizes have changed
     m_doc.UnCastOffDoc();
-    m_doc.CastOffDoc();
+    m_doc.CastOffDoc(true);
 }
 
 void Toolkit::RedoPagePitchPosLayout()
@@ -868,6 +922,8 @@ void Toolkit::RedoPagePitchPosLayout()
         return;
     }
 
+    this->SelectFont();
+
     page->LayOutPitchPos();
 }
 
@@ -876,22 +932,145 @@ std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
     // Page number is one-based - correct it to 0-based first
     pageNo--;
 
+    this->SelectFont();
+
     // Get the current system for the SVG clipping size
     m_view.SetPage(pageNo);
 
+    return this->RenderPageToSvg(&m_view, pageNo, xml_declaration);
+}
+
+bool Toolkit::RenderToSvgFile(const std::string &filename, int pageNo)
+{
+    std::string output = RenderToSvg(pageNo, true);
+
+    std::ofstream outfile;
+    outfile.open(filename.c_str());
+
+    if (!outfile.is_open()) {
+        // add message?
+        return false;
+    }
+
+    outfile << output;
+    outfile.close();
+    return true;
+}
+
+std::vector<std::string> Toolkit::RenderAllPagesToSvg(int threads, bool xml_declaration)
+{
+    int pageCount = this->GetPageCount();
+    std::vector<std::string> pages(pageCount);
+
+#ifdef USE_EMSCRIPTEN
+    threads = 1;
+#endif
+    if (threads <= 0) {
+        threads = std::max((int)std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::min(threads, pageCount);
+
+    this->SelectFont();
+
+    // The pages are laid out and drawn concurrently from the document when the drawing values are the same for all
+    m_doc.CollectScoreDefs();
+    if ((threads > 1) && m_doc.SetDrawingPages()) {
+        std::vector<std::pair<int, int> > sharingPages = GetSharingPages(&m_doc);
+        enum { PAGE_WAITING = 0, PAGE_RENDERING, PAGE_RENDERED };
+        std::vector<char> states(pageCount, PAGE_WAITING);
+        std::mutex mutex;
+        std::condition_variable pageRendered;
+
+        // Return the next page sharing no element with the pages being rendered, -1 if none is available for now,
+        // and the page count when all of them have been taken
+        auto nextPage = [&]() {
+            bool waiting = false;
+            for (int i = 0; i < pageCount; ++i) {
+                if (states.at(i) != PAGE_WAITING) continue;
+                waiting = true;
+                bool available = true;
+                for (int j = sharingPages.at(i).first; j <= sharingPages.at(i).second; ++j) {
+                    if (states.at(j) == PAGE_RENDERING) available = false;
+                }
+                if (available) return i;
+            }
+            return (waiting) ? -1 : pageCount;
+        };
+
+        // The font is selected per thread
+        const Resources::GlyphTable *font = Resources::GetCurrentFont();
+
+        auto renderPages = [&]() {
+            Resources::SetCurrentFont(font);
+            View view;
+            view.SetDoc(&m_doc);
+            std::unique_lock<std::mutex> lock(mutex);
+            int pageIdx;
+            while ((pageIdx = nextPage()) != pageCount) {
+                if (pageIdx == -1) {
+                    pageRendered.wait(lock);
+                    continue;
+                }
+                states.at(pageIdx) = PAGE_RENDERING;
+                lock.unlock();
+                view.SetPage(pageIdx);
+                pages.at(pageIdx) = this->RenderPageToSvg(&view, pageIdx, xml_declaration);
+                lock.lock();
+                states.at(pageIdx) = PAGE_RENDERED;
+                pageRendered.notify_all();
+            }
+        };
+
+        ArrayOfObjects pageObjects;
+        for (int i = 0; i < pageCount; ++i) {
+            pageObjects.push_back(m_doc.GetChild(i));
+        }
+        m_doc.StartProcessingInThreads(pageObjects);
+
+        std::vector<std::thread> workers;
+        for (int i = 1; i < threads; ++i) {
+            workers.push_back(std::thread(renderPages));
+        }
+        renderPages();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+
+        m_doc.EndProcessingInThreads();
+
+        // Leave the last page as the drawing page, as with a serial rendering
+        m_doc.ResetDrawingPage();
+        m_view.SetPage(pageCount - 1);
+        return pages;
+    }
+
+    for (int i = 0; i < pageCount; ++i) {
+        pages.at(i) = this->RenderToSvg(i + 1, xml_declaration);
+    }
+
+    return pages;
+}
+
+std::string Toolkit::RenderPageToSvg(View *view, int pageIdx, bool xml_declaration)
+{
+    assert(view);
+
+    Page *page = dynamic_cast<Page *>(m_doc.GetChild(pageIdx));
+    assert(page);
+
     // Adjusting page width and height according to the options
     int width = m_pageWidth;
     int height = m_pageHeight;
 
-    if (m_noLayout) width = m_doc.GetAdjustedDrawingPageWidth();
-    if (m_adjustPageHeight || m_noLayout) height = m_doc.GetAdjustedDrawingPageHeight();
+    if (m_noLayout) width = m_doc.GetAdjustedDrawingPageWidth(page);
+    if (m_adjustPageHeight || m_noLayout) height = m_doc.GetAdjustedDrawingPageHeight(page);
 
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg(width, height);
 
     // set scale and border from user options
-    svg.SetUserScale(m_view.GetPPUFactor() * (double)m_scale / 100, m_view.GetPPUFactor() * (double)m_scale / 100);
+    svg.SetUserScale(view->GetPPUFactor() * (double)m_scale / 100, view->GetPPUFactor() * (double)m_scale / 100);
 
     // debug BB?
     svg.SetDrawBoundingBoxes(m_showBoundingBoxes);
@@ -899,27 +1078,64 @@ std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
     svg.SetBackgroundImage(m_backgroundData, m_backgroundOpacity);
 
     // render the page
-    m_view.DrawCurrentPage(&svg, false);
+    view->DrawCurrentPage(&svg, false);
 
     std::string out_str = svg.GetStringSVG(xml_declaration);
     return out_str;
 }
 
-bool Toolkit::RenderToSvgFile(const std::string &filename, int pageNo)
+std::vector<std::pair<int, int> > Toolkit::GetSharingPages(Doc *doc)
 {
-    std::string output = RenderToSvg(pageNo, true);
-
-    std::ofstream outfile;
-    outfile.open(filename.c_str());
+    assert(doc);
+
+    int pageCount = doc->GetChildCount();
+    std::vector<std::pair<int, int> > sharingPages;
+    for (int i = 0; i < pageCount; ++i) {
+        sharingPages.push_back(std::make_pair(i, i));
+    }
+
+    AttComparison matchStaff(STAFF);
+    AttComparison matchMeasure(MEASURE);
+    ArrayOfObjects objects;
+    ArrayOfObjects::iterator iter;
+
+    for (int i = 0; i < pageCount; ++i) {
+        Object *page = doc->GetChild(i);
+        // The elements continued from a previous measure (e.g., slurs, ties, hairpins)...
+        std::vector<Object *> sharedElements;
+        page->FindAllChildByAttComparison(&objects, &matchStaff);
+        for (iter = objects.begin(); iter != objects.end(); ++iter) {
+            Staff *staff = dynamic_cast<Staff *>(*iter);
+            assert(staff);
+            sharedElements.insert(sharedElements.end(), staff->m_timeSpanningElements.begin(),
+                staff->m_timeSpanningElements.end());
+        }
+        // ... and the endings
+        page->FindAllChildByAttComparison(&objects, &matchMeasure);
+        for (iter = objects.begin(); iter != objects.end(); ++iter) {
+            Measure *measure = dynamic_cast<Measure *>(*iter);
+            assert(measure);
+            if (measure->GetDrawingEnding()) sharedElements.push_back(measure->GetDrawingEnding());
+        }
+        // The page shares them with the pages from the one where they start
+        for (iter = sharedElements.begin(); iter != sharedElements.end(); ++iter) {
+            Object *start = (*iter)->GetFirstParent(PAGE);
+            TimeSpanningInterface *interface = (*iter)->GetTimeSpanningInterface();
+            // The elements without parent (e.g., the ties from @tie) start where their start element is
+            if (!start && interface && interface->GetStart()) start = interface->GetStart()->GetFirstParent(PAGE);
+            if (!start) continue;
+            sharingPages.at(i).first = std::min(sharingPages.at(i).first, start->GetIdx());
+        }
+    }
 
-    if (!outfile.is_open()) {
-        // add message?
-        return false;
+    // The sharing is mutual
+    for (int i = 0; i < pageCount; ++i) {
+        for (int j = sharingPages.at(i).first; j < i; ++j) {
+            sharingPages.at(j).second = std::max(sharingPages.at(j).second, i);
+        }
     }
 
-    outfile << output;
-    outfile.close();
-    return true;
+    return sharingPages;
 }
 
 std::string Toolkit::GetHumdrum()
@@ -966,28 +1182,36 @@ std::string Toolkit::GetElementsAtTime(int millisec)
 {
 #if defined(USE_EMSCRIPTEN) || defined(PYTHON_BINDING)
     jsonxx::Object o;
-    jsonxx::Array a;
+    jsonxx::Array notes;
+    jsonxx::Array rests;
+    jsonxx::Array chords;
 
     double time = (double)(millisec * 120 / 1000);
-    NoteOnsetOffsetComparison matchTime(time);
-    ArrayOfObjects notes;
+    ArrayOfObjects elements;
     // Here we would need to check that the midi export is done
     if (m_doc.GetMidiExportDone()) {
-        m_doc.FindAllChildByAttComparison(&notes, &matchTime);
+        m_doc.FindElementsPlayingAt(time, &elements);
 
-        // Get the pageNo from the first note (if any)
+        // Get the pageNo from the first element (if any)
         int pageNo = -1;
-        if (notes.size() > 0) {
-            Page *page = dynamic_cast<Page *>(notes.at(0)->GetFirstParent(PAGE));
+        if (elements.size() > 0) {
+            Page *page = dynamic_cast<Page *>(elements.at(0)->GetFirstParent(PAGE));
             if (page) pageNo = page->GetIdx() + 1;
         }
 
         // Fill the JSON object
         ArrayOfObjects::iterator iter;
-        for (iter = notes.begin(); iter != notes.end(); iter++) {
-            a << (*iter)->GetUuid();
+        for (iter = elements.begin(); iter != elements.end(); iter++) {
+            if ((*iter)->Is(NOTE))
+                notes << (*iter)->GetUuid();
+            else if ((*iter)->Is(REST))
+                rests << (*iter)->GetUuid();
+            else
+                chords << (*iter)->GetUuid();
         }
-        o << "notes" << a;
+        o << "notes" << notes;
+        o << "rests" << rests;
+        o << "chords" << chords;
         o << "page" << pageNo;
     }
     return o.json();
@@ -1450,6 +1674,10 @@ bool Toolkit::ChangeInstrument(std::string elementId, std::string json_newInstru
         }
     }
 
+    m_doc.ResetCastOffLayout();
+
+    this->SelectFont();
+
     m_doc.UnCastOffDoc();
     m_doc.CastOffDoc();
     return true;
@@ -1615,6 +1843,7 @@ bool Toolkit::Drag(std::string elementId, int x, int y)
             = (data_PITCHNAME)m_view.CalculatePitchCode(layer, m_view.ToLogicalY(y), note->GetDrawingX(), &oct);
         note->SetPname(pname);
         note->SetOct(oct);
+        m_doc.ResetCastOffLayout();
         return true;
     }
     return false;
@@ -1648,6 +1877,8 @@ bool Toolkit::Insert(std::string elementType, std::string startid, std::string e
         slur->SetStartid(startid);
         slur->SetEndid(endid);
         measure->AddChild(slur);
+        m_doc.ResetCastOffLayout();
+        this->SelectFont();
         m_doc.PrepareDrawing();
         return true;
     }
@@ -1658,20 +1889,35 @@ bool Toolkit::Set(std::string elementId, std::string attrType, std::string attrV
 {
     if (!m_doc.GetDrawingPage()) return false;
     Object *element = m_doc.GetDrawingPage()->FindChildByUuid(elementId);
-    if (Att::SetCmn(element, attrType, attrValue)) return true;
-    if (Att::SetCmnornaments(element, attrType, attrValue)) return true;
-    if (Att::SetCritapp(element, attrType, attrValue)) return true;
-    if (Att::SetExternalsymbols(element, attrType, attrValue)) return true;
-    if (Att::SetMei(element, attrType, attrValue)) return true;
-    if (Att::SetMensural(element, attrType, attrValue)) return true;
-    if (Att::SetMidi(element, attrType, attrValue)) return true;
-    if (Att::SetPagebased(element, attrType, attrValue)) return true;
-    if (Att::SetShared(element, attrType, attrValue)) return true;
-    return false;
+    bool success = false;
+    if (Att::SetCmn(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetCmnornaments(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetCritapp(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetExternalsymbols(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetMei(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetMensural(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetMidi(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetPagebased(element, attrType, attrValue))
+        success = true;
+    else if (Att::SetShared(element, attrType, attrValue))
+        success = true;
+    if (success) m_doc.ResetCastOffLayout();
+    return success;
 }
 
 bool Toolkit::TransposeKey(int newFifths)
 {
+    m_doc.ResetCastOffLayout();
+
+    this->SelectFont();
+
     return m_transpose.transposeFifths(newFifths);
 }
 
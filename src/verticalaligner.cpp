@@ -10,7 +10,9 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <climits>
 #include <math.h>
+#include <set>
 
 //----------------------------------------------------------------------------
 
@@ -23,6 +25,180 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// OverflowBBoxes
+//----------------------------------------------------------------------------
+
+OverflowBBoxes::OverflowBBoxes()
+{
+}
+
+void OverflowBBoxes::Add(BoundingBox *box)
+{
+    int idx = (int)m_boxes.size();
+    m_boxes.push_back(box);
+
+    // Boxes without content cannot be indexed (they will be checked each time)
+    if (!box->HasContentBB()) {
+        m_unsortedBoxes.push_back(idx);
+        return;
+    }
+
+    // Merge the full levels into the first empty one, as in a binary counter
+    std::vector<std::tuple<int, int, int> > extents;
+    extents.push_back(std::make_tuple(box->GetContentLeft(), box->GetContentRight(), idx));
+    int level = 0;
+    for (; (level < (int)m_extents.size()) && !m_extents.at(level).empty(); ++level) {
+        std::vector<std::tuple<int, int, int> > merged;
+        merged.reserve(extents.size() + m_extents.at(level).size());
+        std::merge(m_extents.at(level).begin(), m_extents.at(level).end(), extents.begin(), extents.end(),
+            std::back_inserter(merged));
+        extents.swap(merged);
+        m_extents.at(level).clear();
+        m_maxRights.at(level).clear();
+    }
+    if (level == (int)m_extents.size()) {
+        m_extents.resize(level + 1);
+        m_maxRights.resize(level + 1);
+    }
+    m_extents.at(level).swap(extents);
+    m_maxRights.at(level).resize(m_extents.at(level).size());
+    this->IndexLevel(level, 0, (int)m_extents.at(level).size());
+}
+
+void OverflowBBoxes::Clear()
+{
+    m_boxes.clear();
+    m_extents.clear();
+    m_maxRights.clear();
+    m_unsortedBoxes.clear();
+}
+
+int OverflowBBoxes::IndexLevel(int level, int begin, int end)
+{
+    if (begin >= end) return INT_MIN;
+
+    int root = begin + (end - begin) / 2;
+    int maxRight = std::get<1>(m_extents.at(level).at(root));
+    maxRight = std::max(maxRight, this->IndexLevel(level, begin, root));
+    maxRight = std::max(maxRight, this->IndexLevel(level, root + 1, end));
+    m_maxRights.at(level).at(root) = maxRight;
+    return maxRight;
+}
+
+void OverflowBBoxes::FindInLevel(int level, int begin, int end, int left, int right, std::vector<int> *indices) const
+{
+    assert(indices);
+
+    if (begin >= end) return;
+
+    // No box in the range reaches the left
+    int root = begin + (end - begin) / 2;
+    if (m_maxRights.at(level).at(root) <= left) return;
+
+    this->FindInLevel(level, begin, root, left, right, indices);
+    // The root and the boxes after it start too far right
+    const std::tuple<int, int, int> &extent = m_extents.at(level).at(root);
+    if (std::get<0>(extent) >= right) return;
+
+    if (std::get<1>(extent) > left) indices->push_back(std::get<2>(extent));
+    this->FindInLevel(level, root + 1, end, left, right, indices);
+}
+
+void OverflowBBoxes::FindHorizontalOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes *overlappingBoxes) const
+{
+    assert(overlappingBoxes);
+
+    overlappingBoxes->clear();
+    if (!box->HasContentBB()) return;
+
+    int left = box->GetContentLeft();
+    int right = box->GetContentRight();
+
+    std::vector<int> candidates;
+    for (int level = 0; level < (int)m_extents.size(); ++level) {
+        this->FindInLevel(level, 0, (int)m_extents.at(level).size(), left, right, &candidates);
+    }
+    candidates.insert(candidates.end(), m_unsortedBoxes.begin(), m_unsortedBoxes.end());
+    // Back to the order in which the boxes were added
+    std::sort(candidates.begin(), candidates.end());
+
+    // Double check with the current bounding boxes
+    std::vector<int>::iterator candidate;
+    for (candidate = candidates.begin(); candidate != candidates.end(); ++candidate) {
+        BoundingBox *overflowBox = m_boxes.at(*candidate);
+        if (box->HorizontalContentOverlap(overflowBox)) overlappingBoxes->push_back(overflowBox);
+    }
+}
+
+void OverflowBBoxes::CalcSkyline(
+    StaffAlignment *alignment, bool above, ArrayOfSkylineSteps *skyline, ArrayOfBoundingBoxes *pointBoxes) const
+{
+    assert(alignment);
+    assert(skyline);
+    assert(pointBoxes);
+
+    skyline->clear();
+    pointBoxes->clear();
+
+    // The edges of the boxes as x position, start (true) or end (false), and overflow value
+    std::vector<std::tuple<int, bool, int> > edges;
+    ArrayOfBoundingBoxes::const_iterator iter;
+    for (iter = m_boxes.begin(); iter != m_boxes.end(); ++iter) {
+        if (!(*iter)->HasContentBB()) continue;
+        if ((*iter)->GetContentLeft() >= (*iter)->GetContentRight()) {
+            pointBoxes->push_back(*iter);
+            continue;
+        }
+        int overflow = (above) ? alignment->CalcOverflowAbove(*iter) : alignment->CalcOverflowBelow(*iter);
+        edges.push_back(std::make_tuple((*iter)->GetContentLeft(), true, overflow));
+        edges.push_back(std::make_tuple((*iter)->GetContentRight(), false, overflow));
+    }
+    std::sort(edges.begin(), edges.end());
+
+    // Sweep the edges and keep the overflow values of the boxes spanning over the current position
+    std::multiset<int> overflows;
+    std::vector<std::tuple<int, bool, int> >::iterator edge = edges.begin();
+    while (edge != edges.end()) {
+        int x = std::get<0>(*edge);
+        for (; (edge != edges.end()) && (std::get<0>(*edge) == x); ++edge) {
+            if (std::get<1>(*edge)) {
+                overflows.insert(std::get<2>(*edge));
+            }
+            else {
+                overflows.erase(overflows.find(std::get<2>(*edge)));
+            }
+        }
+        int value = (overflows.empty()) ? INT_MIN : *overflows.rbegin();
+        if (skyline->empty() || (skyline->back().second != value)) skyline->push_back(std::make_pair(x, value));
+    }
+}
+
+int OverflowBBoxes::CalcSkylinesMaxSum(const ArrayOfSkylineSteps &skyline1, const ArrayOfSkylineSteps &skyline2)
+{
+    int maxSum = INT_MIN;
+    int value1 = INT_MIN;
+    int value2 = INT_MIN;
+    ArrayOfSkylineSteps::const_iterator step1 = skyline1.begin();
+    ArrayOfSkylineSteps::const_iterator step2 = skyline2.begin();
+    // Go through the steps of both skylines in x order
+    while ((step1 != skyline1.end()) || (step2 != skyline2.end())) {
+        int x = INT_MAX;
+        if (step1 != skyline1.end()) x = step1->first;
+        if (step2 != skyline2.end()) x = std::min(x, step2->first);
+        if ((step1 != skyline1.end()) && (step1->first == x)) {
+            value1 = step1->second;
+            ++step1;
+        }
+        if ((step2 != skyline2.end()) && (step2->first == x)) {
+            value2 = step2->second;
+            ++step2;
+        }
+        if ((value1 != INT_MIN) && (value2 != INT_MIN)) maxSum = std::max(maxSum, value1 + value2);
+    }
+    return maxSum;
+}
+
 //----------------------------------------------------------------------------
 // SystemAligner
 //----------------------------------------------------------------------------
@@ -225,11 +401,12 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             this->SetOverflowBelow(this->m_overflowBelow + this->GetVerseCount() * (height - descender + margin));
             // For now just clear the overflowBelow, which avoids the overlap to be calculated. We could also keep them
             // and check if they are some lyrics in order to know if the overlap needs to be calculated or not.
-            m_overflowBelowBBoxes.clear();
+            m_overflowBelowBBoxes.Clear();
         }
         return FUNCTOR_SIBLINGS;
     }
 
+    ArrayOfBoundingBoxes overlappingBoxes;
     ArrayOfFloatingPositioners::iterator iter;
     for (iter = m_floatingPositioners.begin(); iter != m_floatingPositioners.end(); ++iter) {
         assert((*iter)->GetObject());
@@ -255,7 +432,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             if (overflowAbove > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%sparams->m_doctop overflow: %d", current->GetUuid().c_str(), overflowAbove);
                 this->SetOverflowAbove(overflowAbove);
-                this->m_overflowAboveBBoxes.push_back((*iter));
+                this->m_overflowAboveBBoxes.Add((*iter));
             }
 
             int overflowBelow = 0;
@@ -263,7 +440,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             if (overflowBelow > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%s bottom overflow: %d", current->GetUuid().c_str(), overflowBelow);
                 this->SetOverflowBelow(overflowBelow);
-                this->m_overflowBelowBBoxes.push_back((*iter));
+                this->m_overflowBelowBBoxes.Add((*iter));
             }
             continue;
         }
@@ -271,32 +448,28 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
         // This sets the default position (without considering any overflowing box)
         (*iter)->CalcDrawingYRel(params->m_doc, this, NULL);
 
-        ArrayOfBoundingBoxes *overflowBoxes = &m_overflowBelowBBoxes;
+        OverflowBBoxes *overflowBoxes = &m_overflowBelowBBoxes;
         // above?
         if ((*iter)->GetDrawingPlace() == STAFFREL_above) {
             overflowBoxes = &m_overflowAboveBBoxes;
         }
-        auto i = overflowBoxes->begin();
-        auto end = overflowBoxes->end();
-        while (i != end) {
-            // find all the overflowing elements from the staff that overlap horizonatally
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // update the yRel accordingly
-                (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
-                i++;
-            }
+        // find all the overflowing elements from the staff that overlap horizonatally
+        overflowBoxes->FindHorizontalOverlaps((*iter), &overlappingBoxes);
+        ArrayOfBoundingBoxes::iterator i;
+        for (i = overlappingBoxes.begin(); i != overlappingBoxes.end(); ++i) {
+            // update the yRel accordingly
+            (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
         }
         //  Now update the staffAlignment max overflow (above or below) and add the positioner to the list of
         //  overflowing elements
         if ((*iter)->GetDrawingPlace() == STAFFREL_above) {
             int overflowAbove = this->CalcOverflowAbove((*iter));
-            overflowBoxes->push_back((*iter));
+            overflowBoxes->Add((*iter));
             this->SetOverflowAbove(overflowAbove);
         }
         else {
             int overflowBelow = this->CalcOverflowBelow((*iter));
-            overflowBoxes->push_back((*iter));
+            overflowBoxes->Add((*iter));
             this->SetOverflowBelow(overflowBelow);
         }
     }
@@ -371,28 +544,42 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
+    // Build the profiles of the overflow below the top staff and of the overflow above the current one
+    ArrayOfSkylineSteps skylineBelow;
+    ArrayOfSkylineSteps skylineAbove;
+    ArrayOfBoundingBoxes pointBoxesBelow;
+    ArrayOfBoundingBoxes pointBoxesAbove;
+    params->m_previous->m_overflowBelowBBoxes.CalcSkyline(params->m_previous, false, &skylineBelow, &pointBoxesBelow);
+    m_overflowAboveBBoxes.CalcSkyline(this, true, &skylineAbove, &pointBoxesAbove);
+
+    // The largest overflow sum where elements overlap horizontally
+    int maxOverflow = OverflowBBoxes::CalcSkylinesMaxSum(skylineBelow, skylineAbove);
+
+    // Boxes without width are not in the profiles and are checked one by one
+    ArrayOfBoundingBoxes overlappingBoxes;
     ArrayOfBoundingBoxes::iterator iter;
-    // go through all the elements of the top staff that have an overflow below
-    for (iter = params->m_previous->m_overflowBelowBBoxes.begin();
-         iter != params->m_previous->m_overflowBelowBBoxes.end(); iter++) {
-        auto i = m_overflowAboveBBoxes.begin();
-        auto end = m_overflowAboveBBoxes.end();
-        while (i != end) {
-            // find all the elements from the bottom staff that have an overflow at the top with an horizontal overap
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // calculate the vertical overlap and see if this is more than the expected space
-                int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
-                int overflowAbove = this->CalcOverflowAbove(*i);
-                int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
-                if (spacing < (overflowBelow + overflowAbove)) {
-                    // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
-                    this->SetOverlap((overflowBelow + overflowAbove) - spacing);
-                }
-                i++;
-            }
+    ArrayOfBoundingBoxes::iterator i;
+    for (iter = pointBoxesBelow.begin(); iter != pointBoxesBelow.end(); ++iter) {
+        m_overflowAboveBBoxes.FindHorizontalOverlaps(*iter, &overlappingBoxes);
+        for (i = overlappingBoxes.begin(); i != overlappingBoxes.end(); ++i) {
+            int overflowSum = params->m_previous->CalcOverflowBelow(*iter) + this->CalcOverflowAbove(*i);
+            maxOverflow = std::max(maxOverflow, overflowSum);
         }
     }
+    for (iter = pointBoxesAbove.begin(); iter != pointBoxesAbove.end(); ++iter) {
+        params->m_previous->m_overflowBelowBBoxes.FindHorizontalOverlaps(*iter, &overlappingBoxes);
+        for (i = overlappingBoxes.begin(); i != overlappingBoxes.end(); ++i) {
+            int overflowSum = params->m_previous->CalcOverflowBelow(*i) + this->CalcOverflowAbove(*iter);
+            maxOverflow = std::max(maxOverflow, overflowSum);
+        }
+    }
+
+    // calculate the vertical overlap and see if this is more than the expected space
+    int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
+    if ((maxOverflow != INT_MIN) && (spacing < maxOverflow)) {
+        // LogDebug("Overlap %d", maxOverflow - spacing);
+        this->SetOverlap(maxOverflow - spacing);
+    }
 
     params->m_previous = this;
 
@@ -12,10 +12,13 @@
 
 #include <assert.h>
 #include <cmath>
+#include <fstream>
+#include <iterator>
 #include <sstream>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/stat.h>
 #include <vector>
 
 #ifndef _WIN32
@@ -50,6 +53,11 @@
 
 #define STRING_FORMAT_MAX_LEN 2048
 
+#define FONT_PACK_MAGIC "VRVFONT2"
+
+// The number of text extents stored in a generation of the cache of a thread
+#define TEXT_EXTENT_CACHE_MAX 10000
+
 namespace vrv {
 
 //----------------------------------------------------------------------------
@@ -57,66 +65,315 @@ namespace vrv {
 //----------------------------------------------------------------------------
 
 std::string Resources::m_path = "/usr/local/share/verovio";
-std::map<wchar_t, Glyph> Resources::m_font;
-std::map<wchar_t, Glyph> Resources::m_textFont;
+std::mutex Resources::s_pathMutex;
+std::map<std::string, Resources::FontSet> Resources::s_fontSets;
+std::atomic<Resources::FontSet *> Resources::s_defaultFontSet(NULL);
+thread_local Resources::GlyphTable *Resources::s_currentFont = NULL;
+thread_local Resources::TextExtentCache Resources::s_textExtentCache;
+std::mutex Resources::s_fontMutex;
 
 //----------------------------------------------------------------------------
 // Font related methods
 //----------------------------------------------------------------------------
 
+std::string Resources::GetPath()
+{
+    std::lock_guard<std::mutex> lock(s_pathMutex);
+    return m_path;
+}
+
+void Resources::SetPath(std::string path)
+{
+    std::lock_guard<std::mutex> lock(s_pathMutex);
+    m_path = path;
+}
+
 bool Resources::InitFonts()
 {
-    // We will need to rethink this for adding the option to add custom fonts
-    // Font Bravura first since it is expected to have always all symbols
-    if (!LoadFont("Bravura")) LogError("Bravura font could not be loaded.");
-    // The Leipzig as the default font
-    if (!LoadFont("Leipzig")) LogError("Leipzig font could not be loaded.");
+    std::string path = GetPath();
 
-    if (m_font.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, m_font.size());
-        return false;
+    std::lock_guard<std::mutex> lock(s_fontMutex);
+
+    s_currentFont = NULL;
+
+    // The fonts already registered from the same path (e.g., by another Toolkit) are used as they are.
+    // Font sets are never freed because other threads can still be using the fonts of a previous path.
+    std::map<std::string, FontSet>::iterator setIter = s_fontSets.find(path);
+    if (setIter != s_fontSets.end()) {
+        s_defaultFontSet.store(&setIter->second, std::memory_order_release);
+        return true;
     }
 
-    if (!InitTextFont()) {
+    FontSet &fontSet = s_fontSets[path];
+    fontSet.m_path = path;
+
+    // We will need to rethink this for adding the option to add custom fonts
+    // Font Bravura first since it is expected to have always all symbols
+    GlyphTable &bravura = fontSet.m_fonts["Bravura"];
+    bravura.m_fontSet = &fontSet;
+    if (!RegisterFont(path, "Bravura", &bravura)) LogError("Bravura font could not be loaded.");
+    // The Leipzig as the default font, falling back to Bravura for the missing glyphs
+    GlyphTable &leipzig = fontSet.m_fonts["Leipzig"];
+    leipzig.m_fontSet = &fontSet;
+    leipzig.m_fallback = &bravura;
+    if (!RegisterFont(path, "Leipzig", &leipzig)) LogError("Leipzig font could not be loaded.");
+
+    int glyphCount = (int)leipzig.m_glyphs.size();
+    std::map<wchar_t, FontGlyph>::iterator iter;
+    for (iter = bravura.m_glyphs.begin(); iter != bravura.m_glyphs.end(); ++iter) {
+        if (leipzig.m_glyphs.count(iter->first) == 0) ++glyphCount;
+    }
+    bool success = true;
+    if (glyphCount < SMUFL_COUNT) {
+        LogError("Expected %d default SMUFL glyphs but could load only %d.", SMUFL_COUNT, glyphCount);
+        success = false;
+    }
+    else if (!LoadTextFont(&fontSet)) {
         LogError("Text font could not be initialized.");
+        success = false;
+    }
+
+    // The font set was never published, so it can be removed
+    if (!success) {
+        s_fontSets.erase(path);
         return false;
     }
 
+    fontSet.m_defaultFont = &leipzig;
+    s_defaultFontSet.store(&fontSet, std::memory_order_release);
+
     return true;
 }
 
 bool Resources::SetFont(std::string fontName)
 {
-    return LoadFont(fontName);
+    std::lock_guard<std::mutex> lock(s_fontMutex);
+
+    FontSet *fontSet = s_defaultFontSet.load(std::memory_order_acquire);
+    if (!fontSet) return false;
+
+    // Registering a font does not invalidate the other fonts of the set
+    std::map<std::string, GlyphTable>::iterator iter = fontSet->m_fonts.find(fontName);
+    if (iter == fontSet->m_fonts.end()) {
+        // Register the font with the default one as fallback for the missing glyphs
+        GlyphTable &font = fontSet->m_fonts[fontName];
+        font.m_fontSet = fontSet;
+        font.m_fallback = fontSet->m_defaultFont;
+        if (!RegisterFont(fontSet->m_path, fontName, &font)) {
+            fontSet->m_fonts.erase(fontName);
+            return false;
+        }
+        iter = fontSet->m_fonts.find(fontName);
+    }
+    s_currentFont = &iter->second;
+
+    return true;
+}
+
+void Resources::ResetFont()
+{
+    s_currentFont = NULL;
+}
+
+Resources::GlyphTable *Resources::GetDefaultFont()
+{
+    FontSet *fontSet = s_defaultFontSet.load(std::memory_order_acquire);
+    return (fontSet) ? fontSet->m_defaultFont : NULL;
+}
+
+Resources::FontSet *Resources::GetCurrentFontSet()
+{
+    const GlyphTable *font = GetCurrentFont();
+    return (font) ? font->m_fontSet : NULL;
+}
+
+void Resources::SetCurrentFont(const GlyphTable *font)
+{
+    // The fonts are all owned by Resources
+    s_currentFont = (font == GetDefaultFont()) ? NULL : const_cast<GlyphTable *>(font);
 }
 
 Glyph *Resources::GetGlyph(wchar_t smuflCode)
 {
-    if (!m_font.count(smuflCode)) return NULL;
-    return &m_font[smuflCode];
+    GlyphTable *font = (s_currentFont) ? s_currentFont : GetDefaultFont();
+    if (!font) return NULL;
+
+    FontGlyph *fontGlyph = NULL;
+    if ((smuflCode >= SMUFL_CODE_FIRST) && (smuflCode <= SMUFL_CODE_LAST)) {
+        fontGlyph = font->m_smuflGlyphs[smuflCode - SMUFL_CODE_FIRST];
+    }
+    else {
+        // Look in the current font first and then in the fallback fonts
+        for (; font && !fontGlyph; font = font->m_fallback) {
+            std::map<wchar_t, FontGlyph>::iterator iter = font->m_glyphs.find(smuflCode);
+            if (iter != font->m_glyphs.end()) fontGlyph = &iter->second;
+        }
+    }
+    if (!fontGlyph) return NULL;
+
+    std::call_once(fontGlyph->m_loaded, LoadGlyph, fontGlyph);
+    return &fontGlyph->m_glyph;
 }
 
 Glyph *Resources::GetTextGlyph(wchar_t code)
 {
-    if (!m_textFont.count(code)) return NULL;
-    return &m_textFont[code];
+    FontSet *fontSet = GetCurrentFontSet();
+    if (!fontSet) return NULL;
+
+    if ((unsigned int)code < fontSet->m_textFontAscii.size()) return fontSet->m_textFontAscii[code];
+    std::map<wchar_t, Glyph>::iterator iter = fontSet->m_textFont.find(code);
+    if (iter == fontSet->m_textFont.end()) return NULL;
+    return &iter->second;
+}
+
+const pugi::xml_document &Resources::GetTextFontDefinition()
+{
+    static const pugi::xml_document empty;
+
+    FontSet *fontSet = GetCurrentFontSet();
+    if (!fontSet || !fontSet->m_textFontDefinition) return empty;
+    return *fontSet->m_textFontDefinition;
 }
 
-bool Resources::LoadFont(std::string fontName)
+bool Resources::GetCachedTextExtent(const std::wstring &text, int pointSize, bool smufl, TextExtend *extend)
 {
+    assert(extend);
+
+    const GlyphTable *font = GetCurrentFont();
+    if (!font) return false;
+
+    std::tuple<const GlyphTable *, int, bool> key(font, pointSize, smufl);
+    TextExtentCache::Generation::iterator sizeIter = s_textExtentCache.m_current.find(key);
+    if (sizeIter != s_textExtentCache.m_current.end()) {
+        std::unordered_map<std::wstring, TextExtend>::iterator iter = sizeIter->second.find(text);
+        if (iter != sizeIter->second.end()) {
+            *extend = iter->second;
+            return true;
+        }
+    }
+
+    // Still used, so move it back to the current generation
+    sizeIter = s_textExtentCache.m_previous.find(key);
+    if (sizeIter == s_textExtentCache.m_previous.end()) return false;
+    std::unordered_map<std::wstring, TextExtend>::iterator iter = sizeIter->second.find(text);
+    if (iter == sizeIter->second.end()) return false;
+    *extend = iter->second;
+    CacheTextExtent(text, pointSize, smufl, *extend);
+    return true;
+}
+
+void Resources::CacheTextExtent(const std::wstring &text, int pointSize, bool smufl, const TextExtend &extend)
+{
+    const GlyphTable *font = GetCurrentFont();
+    if (!font) return;
+
+    // Keep the memory bounded when many different texts are measured (e.g., for a long running process)
+    if (s_textExtentCache.m_currentCount >= TEXT_EXTENT_CACHE_MAX) {
+        s_textExtentCache.m_previous.swap(s_textExtentCache.m_current);
+        s_textExtentCache.m_current.clear();
+        s_textExtentCache.m_currentCount = 0;
+    }
+    std::tuple<const GlyphTable *, int, bool> key(font, pointSize, smufl);
+    if (s_textExtentCache.m_current[key].insert(std::make_pair(text, extend)).second) {
+        ++s_textExtentCache.m_currentCount;
+    }
+}
+
+bool Resources::RegisterFont(const std::string &path, std::string fontName, GlyphTable *font)
+{
+    assert(font);
+
+    bool success = RegisterFontPack(path, fontName, font) || RegisterFontDirectory(path, fontName, font);
+
+    // Resolve the SMuFL glyphs, including the ones from the fallback fonts, once for all
+    if (font->m_fallback) {
+        font->m_smuflGlyphs = font->m_fallback->m_smuflGlyphs;
+    }
+    else {
+        font->m_smuflGlyphs.assign(SMUFL_CODE_LAST - SMUFL_CODE_FIRST + 1, NULL);
+    }
+    std::map<wchar_t, FontGlyph>::iterator iter;
+    for (iter = font->m_glyphs.begin(); iter != font->m_glyphs.end(); ++iter) {
+        iter->second.m_font = font;
+        iter->second.m_code = iter->first;
+        if ((iter->first < SMUFL_CODE_FIRST) || (iter->first > SMUFL_CODE_LAST)) continue;
+        font->m_smuflGlyphs[iter->first - SMUFL_CODE_FIRST] = &iter->second;
+    }
+
+    return success;
+}
+
+bool Resources::RegisterFontPack(const std::string &path, std::string fontName, GlyphTable *font)
+{
+    assert(font);
+
+    std::string filename = path + "/" + fontName + ".vrvfont";
+    struct stat packStat;
+    if (stat(filename.c_str(), &packStat) != 0) return false;
+
+    // A pack older than the bounding box file or the font directory is stale and the font directory is used
+    const std::string sources[] = { path + "/" + fontName + ".xml", path + "/" + fontName };
+    for (const std::string &source : sources) {
+        struct stat sourceStat;
+        if ((stat(source.c_str(), &sourceStat) == 0) && (sourceStat.st_mtime > packStat.st_mtime)) {
+            LogWarning("Font pack '%s' is older than '%s' and is ignored", filename.c_str(), source.c_str());
+            return false;
+        }
+    }
+
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file.is_open()) return false;
+
+    // Read the entire file at once and keep it for loading the glyphs when requested
+    font->m_pack.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    const char *begin = font->m_pack.data();
+    const char *end = begin + font->m_pack.size();
+    size_t magicLength = strlen(FONT_PACK_MAGIC);
+    bool valid = (font->m_pack.size() >= magicLength) && (font->m_pack.compare(0, magicLength, FONT_PACK_MAGIC) == 0);
+
+    // Each glyph is preceded by its code and its size
+    const char *position = begin + magicLength;
+    while (valid && (position < end)) {
+        int smuflCode, size;
+        valid = Glyph::ReadPackInt(position, end, smuflCode) && Glyph::ReadPackInt(position, end, size)
+            && (size >= 0) && (end - position >= size);
+        if (!valid) break;
+        FontGlyph &fontGlyph = font->m_glyphs[(wchar_t)smuflCode];
+        fontGlyph.m_packPosition = position - begin;
+        fontGlyph.m_packSize = size;
+        position += size;
+    }
+
+    if (!valid) {
+        LogWarning("Font pack '%s' is not valid and is ignored", filename.c_str());
+        font->m_glyphs.clear();
+        font->m_pack.clear();
+        return false;
+    }
+
+    font->m_dirname = path + "/" + fontName;
+
+    return true;
+}
+
+bool Resources::RegisterFontDirectory(const std::string &path, std::string fontName, GlyphTable *font)
+{
+    assert(font);
+
     ::DIR *dir;
     dirent *pdir;
-    std::string dirname = Resources::GetPath() + "/" + fontName;
+    std::string dirname = path + "/" + fontName;
     dir = opendir(dirname.c_str());
 
     if (!dir) {
         LogError("Font directory '%s' cannot be read", dirname.c_str());
         return false;
     }
+    font->m_dirname = dirname;
 
-    // First loop through the fontName directory and load each glyph
+    // First loop through the fontName directory and register each glyph
     // Since the filename starts with the Unicode code, it is used
-    // to assign the glyph to the corresponding position in m_fonts
+    // to assign the glyph to the corresponding position in the font
     while ((pdir = readdir(dir))) {
         if (strstr(pdir->d_name, ".xml")) {
             // E.g, : E053-gClef8va.xml => strtol extracts E053 as hex
@@ -125,10 +382,7 @@ bool Resources::LoadFont(std::string fontName)
                 LogError("Invalid SMUFL code (0)");
                 continue;
             }
-            std::string codeStr = pdir->d_name;
-            codeStr = codeStr.substr(0, 4);
-            Glyph glyph(Resources::GetPath() + "/" + fontName + "/" + pdir->d_name, codeStr);
-            m_font[smuflCode] = glyph;
+            font->m_glyphs[smuflCode].m_filename = pdir->d_name;
         }
     }
 
@@ -136,7 +390,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // Then load the bounding boxes (if bounding box file is provided)
     pugi::xml_document doc;
-    std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+    std::string filename = path + "/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -148,41 +402,38 @@ bool Resources::LoadFont(std::string fontName)
         LogWarning("No units-per-em attribute in bouding box file");
         return true;
     }
-    int unitsPerEm = atoi(root.attribute("units-per-em").value());
+    font->m_unitsPerEm = atoi(root.attribute("units-per-em").value());
+
+    // Store the metrics with the glyphs so the file does not need to be kept and searched when loading them
     pugi::xml_node current;
     for (current = root.child("g"); current; current = current.next_sibling("g")) {
-        Glyph *glyph = NULL;
-        if (current.attribute("c")) {
-            wchar_t smuflCode = (wchar_t)strtol(current.attribute("c").value(), NULL, 16);
-            if (!m_font.count(smuflCode)) {
-                LogWarning("Glyph with code '%d' not found.", smuflCode);
-                continue;
-            }
-            glyph = &m_font[smuflCode];
-            if (glyph->GetUnitsPerEm() != unitsPerEm * 10) {
-                LogWarning("Glyph and bounding box units-per-em for code '%d' miss-match (bounding box: %d)", smuflCode,
-                    unitsPerEm);
-                continue;
-            }
-            double x = 0.0, y = 0.0, width = 0.0, height = 0.0;
-            // Not check for missing values...
-            if (current.attribute("x")) x = atof(current.attribute("x").value());
-            if (current.attribute("y")) y = atof(current.attribute("y").value());
-            if (current.attribute("w")) width = atof(current.attribute("w").value());
-            if (current.attribute("h")) height = atof(current.attribute("h").value());
-            glyph->SetBoundingBox(x, y, width, height);
-            if (current.attribute("h-a-x")) glyph->SetHorizAdvX(atof(current.attribute("h-a-x").value()));
+        if (!current.attribute("c")) continue;
+        wchar_t smuflCode = (wchar_t)strtol(current.attribute("c").value(), NULL, 16);
+        std::map<wchar_t, FontGlyph>::iterator iter = font->m_glyphs.find(smuflCode);
+        if (iter == font->m_glyphs.end()) {
+            LogWarning("Glyph with code '%d' not found.", smuflCode);
+            continue;
+        }
+        FontGlyph &fontGlyph = iter->second;
+        // A glyph listed more than once keeps the first metrics
+        if (fontGlyph.m_hasMetrics) continue;
+        fontGlyph.m_hasMetrics = true;
+        GlyphMetrics &metrics = fontGlyph.m_metrics;
+        // Not check for missing values...
+        if (current.attribute("x")) metrics.m_x = atof(current.attribute("x").value());
+        if (current.attribute("y")) metrics.m_y = atof(current.attribute("y").value());
+        if (current.attribute("w")) metrics.m_width = atof(current.attribute("w").value());
+        if (current.attribute("h")) metrics.m_height = atof(current.attribute("h").value());
+        if (current.attribute("h-a-x")) {
+            metrics.m_horizAdvX = atof(current.attribute("h-a-x").value());
+            metrics.m_hasHorizAdvX = true;
         }
-
-        if (!glyph) continue;
-
-        // load anchors
         pugi::xml_node anchor;
         for (anchor = current.child("a"); anchor; anchor = anchor.next_sibling("a")) {
             if (anchor.attribute("n")) {
-                std::string name = std::string(anchor.attribute("n").value());
                 // No check for possible x and y missing attributes - not very safe.
-                glyph->SetAnchor(name, atof(anchor.attribute("x").value()), atof(anchor.attribute("y").value()));
+                metrics.m_anchors.push_back(std::make_pair(std::string(anchor.attribute("n").value()),
+                    std::make_pair(atof(anchor.attribute("x").value()), atof(anchor.attribute("y").value()))));
             }
         }
     }
@@ -190,13 +441,87 @@ bool Resources::LoadFont(std::string fontName)
     return true;
 }
 
-bool Resources::InitTextFont()
+void Resources::LoadGlyph(FontGlyph *fontGlyph)
 {
+    assert(fontGlyph);
+
+    GlyphTable *font = fontGlyph->m_font;
+    assert(font);
+    wchar_t smuflCode = fontGlyph->m_code;
+
+    if (!font->m_pack.empty()) {
+        const char *position = font->m_pack.data() + fontGlyph->m_packPosition;
+        if (!fontGlyph->m_glyph.ReadFromPack(position, position + fontGlyph->m_packSize, font->m_dirname)) {
+            LogError("Glyph with code '%d' could not be read from the font pack", smuflCode);
+            fontGlyph->m_glyph = Glyph();
+        }
+        return;
+    }
+
+    Glyph *glyph = &fontGlyph->m_glyph;
+    *glyph = Glyph(font->m_dirname + "/" + fontGlyph->m_filename, fontGlyph->m_filename.substr(0, 4));
+
+    // Then set the bounding box and the anchors stored from the bounding box file
+    if (!fontGlyph->m_hasMetrics) return;
+
+    if (glyph->GetUnitsPerEm() != font->m_unitsPerEm * 10) {
+        LogWarning("Glyph and bounding box units-per-em for code '%d' miss-match (bounding box: %d)", smuflCode,
+            font->m_unitsPerEm);
+        return;
+    }
+    const GlyphMetrics &metrics = fontGlyph->m_metrics;
+    glyph->SetBoundingBox(metrics.m_x, metrics.m_y, metrics.m_width, metrics.m_height);
+    if (metrics.m_hasHorizAdvX) glyph->SetHorizAdvX(metrics.m_horizAdvX);
+
+    std::vector<std::pair<std::string, std::pair<double, double> > >::const_iterator iter;
+    for (iter = metrics.m_anchors.begin(); iter != metrics.m_anchors.end(); ++iter) {
+        glyph->SetAnchor(iter->first, iter->second.first, iter->second.second);
+    }
+}
+
+bool Resources::WriteFontPack(std::string fontName, std::string filename)
+{
+    // Always use the font directory since the font pack might be the one being re-written
+    GlyphTable font;
+    if (!RegisterFontDirectory(GetPath(), fontName, &font)) return false;
+
+    // Each glyph is preceded by its code and its size so they can be registered without being read
+    std::string pack = FONT_PACK_MAGIC;
+    std::map<wchar_t, FontGlyph>::iterator iter;
+    for (iter = font.m_glyphs.begin(); iter != font.m_glyphs.end(); ++iter) {
+        iter->second.m_font = &font;
+        iter->second.m_code = iter->first;
+        LoadGlyph(&iter->second);
+        std::string glyph;
+        iter->second.m_glyph.WriteToPack(glyph);
+        Glyph::AppendPackInt(pack, (int)iter->first);
+        Glyph::AppendPackInt(pack, (int)glyph.size());
+        pack.append(glyph);
+    }
+
+    std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        LogError("Font pack '%s' cannot be written", filename.c_str());
+        return false;
+    }
+    file.write(pack.data(), pack.size());
+    return file.good();
+}
+
+bool Resources::LoadTextFont(FontSet *fontSet)
+{
+    assert(fontSet);
+
+    // The VerovioText font definition, embedded in the SVG output when needed (no check since it is optional)
+    std::string woff = fontSet->m_path + "/woff.xml";
+    fontSet->m_textFontDefinition = std::make_shared<pugi::xml_document>();
+    fontSet->m_textFontDefinition->load_file(woff.c_str());
+
     // For the text font, we load the bounding boxes only
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = Resources::GetPath() + "/text/Times.xml";
+    std::string filename = fontSet->m_path + "/text/Times.xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -224,9 +549,17 @@ bool Resources::InitTextFont()
             if (current.attribute("h")) height = atof(current.attribute("h").value());
             glyph.SetBoundingBox(x, y, width, height);
             if (current.attribute("h-a-x")) glyph.SetHorizAdvX(atof(current.attribute("h-a-x").value()));
-            m_textFont[code] = glyph;
+            fontSet->m_textFont[code] = glyph;
         }
     }
+
+    std::map<wchar_t, Glyph>::iterator iter;
+    for (iter = fontSet->m_textFont.begin(); iter != fontSet->m_textFont.end(); ++iter) {
+        if ((unsigned int)iter->first < fontSet->m_textFontAscii.size()) {
+            fontSet->m_textFontAscii[iter->first] = &iter->second;
+        }
+    }
+
     return true;
 }
 
@@ -235,12 +568,12 @@ bool Resources::InitTextFont()
 //----------------------------------------------------------------------------
 
 /** Global for LogElapsedTimeXXX functions (debugging purposes) */
-struct timeval start;
+thread_local struct timeval start;
 /** For disabling log */
 bool noLog = false;
 
 #ifdef EMSCRIPTEN
-std::vector<std::string> logBuffer;
+thread_local std::vector<std::string> logBuffer;
 #endif
 
 void LogElapsedTimeStart()
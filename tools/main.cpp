@@ -6,6 +6,7 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include <assert.h>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -123,6 +124,9 @@ void display_usage()
     cerr << " --ignore-layout            Ignore all encoded layout information (if any)" << endl;
     cerr << "                            and fully recalculate the layout" << endl;
 
+    cerr << " --layout-threads=NUM       Number of threads for laying out the measures horizontally (default is 1;" << endl;
+    cerr << "                            0 for the number of hardware threads)" << endl;
+
     cerr << " --mdiv-xpath-query=QR      Set the xPath query for selecting the <mdiv> to be rendered;" << endl;
     cerr << "                            only one <mdiv> can be rendered" << endl;
 
@@ -141,6 +145,12 @@ void display_usage()
 
     cerr << " --spacing-system=SP        Specify the spacing above each system (in MEI vu)" << endl;
 
+    cerr << " --threads=NUM              Number of threads for rendering all pages (default is 1;" << endl;
+    cerr << "                            0 for the number of hardware threads)" << endl;
+
+    cerr << " --write-font-pack=FONT     Write the font from the resource directory into a single binary file" << endl;
+    cerr << "                            (default output file is FONT.vrvfont) and exit without input file" << endl;
+
     cerr << " --xml-id-seed=INT          Seed the random number generator for XML IDs" << endl;
 
     // Debugging options
@@ -159,6 +169,7 @@ int main(int argc, char **argv)
     string outfile;
     string outformat = "svg";
     string font = "";
+    string font_pack = "";
     vector<string> appXPathQueries;
     vector<string> choiceXPathQueries;
     bool std_output = false;
@@ -173,6 +184,7 @@ int main(int argc, char **argv)
     int even_note_spacing = 0;
     int show_bounding_boxes = 0;
     int page = 1;
+    int threads = 1;
     int show_help = 0;
     int show_version = 0;
 
@@ -194,15 +206,18 @@ int main(int argc, char **argv)
         { "even-note-spacing", no_argument, &even_note_spacing, 1 }, { "font", required_argument, 0, 0 },
         { "format", required_argument, 0, 'f' }, { "help", no_argument, &show_help, 1 },
         { "hum-type", no_argument, &hum_type, 1 }, { "ignore-layout", no_argument, &ignore_layout, 1 },
-        { "mdiv-xpath-query", required_argument, 0, 0 }, { "no-layout", no_argument, &no_layout, 1 },
+        { "layout-threads", required_argument, 0, 0 }, { "mdiv-xpath-query", required_argument, 0, 0 },
+        { "no-layout", no_argument, &no_layout, 1 },
         { "no-mei-hdr", no_argument, &no_mei_hdr, 1 }, { "no-justification", no_argument, &no_justification, 1 },
         { "outfile", required_argument, 0, 'o' }, { "page", required_argument, 0, 0 },
         { "page-height", required_argument, 0, 'h' }, { "page-width", required_argument, 0, 'w' },
         { "resources", required_argument, 0, 'r' }, { "scale", required_argument, 0, 's' },
         { "show-bounding-boxes", no_argument, &show_bounding_boxes, 1 }, { "spacing-linear", required_argument, 0, 0 },
         { "spacing-non-linear", required_argument, 0, 0 }, { "spacing-staff", required_argument, 0, 0 },
-        { "spacing-system", required_argument, 0, 0 }, { "type", required_argument, 0, 't' },
-        { "version", no_argument, &show_version, 1 }, { "xml-id-seed", required_argument, 0, 0 }, { 0, 0, 0, 0 } };
+        { "spacing-system", required_argument, 0, 0 }, { "threads", required_argument, 0, 0 },
+        { "type", required_argument, 0, 't' },
+        { "version", no_argument, &show_version, 1 }, { "write-font-pack", required_argument, 0, 0 },
+        { "xml-id-seed", required_argument, 0, 0 }, { 0, 0, 0, 0 } };
 
     int option_index = 0;
     while ((c = getopt_long(argc, argv, "b:f:h:o:p:r:s:t:w:v", long_options, &option_index)) != -1) {
@@ -228,6 +243,9 @@ int main(int argc, char **argv)
                 else if (strcmp(long_options[option_index].name, "page") == 0) {
                     page = atoi(optarg);
                 }
+                else if (strcmp(long_options[option_index].name, "layout-threads") == 0) {
+                    toolkit.SetLayoutThreads(atoi(optarg));
+                }
                 else if (strcmp(long_options[option_index].name, "spacing-linear") == 0) {
                     if (!toolkit.SetSpacingLinear(atof(optarg))) {
                         exit(1);
@@ -248,6 +266,12 @@ int main(int argc, char **argv)
                         exit(1);
                     }
                 }
+                else if (strcmp(long_options[option_index].name, "threads") == 0) {
+                    threads = atoi(optarg);
+                }
+                else if (strcmp(long_options[option_index].name, "write-font-pack") == 0) {
+                    font_pack = string(optarg);
+                }
                 else if (strcmp(long_options[option_index].name, "xml-id-seed") == 0) {
                     Object::SeedUuid(atoi(optarg));
                 }
@@ -320,6 +344,16 @@ int main(int argc, char **argv)
         exit(0);
     }
 
+    // Write the font pack (e.g., at build time) without processing any input file
+    if (!font_pack.empty()) {
+        if (outfile.empty()) outfile = font_pack + ".vrvfont";
+        if (!Resources::WriteFontPack(font_pack, outfile)) {
+            cerr << "The font pack for '" << font_pack << "' could not be written." << endl;
+            exit(1);
+        }
+        exit(0);
+    }
+
     // Set the various flags in accordance with the options given
     toolkit.SetAdjustPageHeight(adjust_page_height);
     toolkit.SetNoLayout(no_layout);
@@ -431,7 +465,25 @@ int main(int argc, char **argv)
         to = toolkit.GetPageCount() + 1;
     }
 
-    if (outformat == "svg") {
+    if (outformat == "svg" && all_pages && (threads != 1)) {
+        std::vector<std::string> pages = toolkit.RenderAllPagesToSvg(threads, !std_output);
+        int p;
+        for (p = from; p < to; p++) {
+            std::string cur_outfile = outfile + StringFormat("_%03d", p) + ".svg";
+            if (std_output) {
+                cout << pages.at(p - 1);
+                continue;
+            }
+            std::ofstream svgfile(cur_outfile.c_str());
+            if (!svgfile.is_open()) {
+                cerr << "Unable to write SVG to " << cur_outfile << "." << endl;
+                exit(1);
+            }
+            svgfile << pages.at(p - 1);
+            cerr << "Output written to " << cur_outfile << "." << endl;
+        }
+    }
+    else if (outformat == "svg") {
         int p;
         for (p = from; p < to; p++) {
             std::string cur_outfile = outfile;